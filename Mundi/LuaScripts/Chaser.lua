@@ -24,6 +24,7 @@ local InitialRotation = nil
 local CurrentDelayCoroutine = nil
 
 local gm
+local DistanceUpdateEventId = nil  -- 매 주기 발행하므로 이름 대신 ID 사용
 
 ---
 --- 추격자 시작 지연 코루틴 (5초)
@@ -157,7 +158,11 @@ function Tick(dt)
     if DistanceUpdateTimer >= DistanceUpdateInterval then
         DistanceUpdateTimer = 0.0
         local intDistance = math.floor(distanceX)
-        gm:FireEvent("OnChaserDistanceUpdate", intDistance)
+        if not DistanceUpdateEventId then
+            DistanceUpdateEventId = gm:RegisterEvent("OnChaserDistanceUpdate")
+        end
+        -- HUD 표시용이므로 프레임 끝에 일괄 발행
+        gm:QueueEvent(DistanceUpdateEventId, intDistance)
     end
 
     -- 잡힘 판정
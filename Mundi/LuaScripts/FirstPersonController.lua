@@ -339,35 +339,38 @@ function UpdateMovement(dt, input)
         CurrentRightSpeed = approach(CurrentRightSpeed, targetRight, StrafeDeceleration, dt)
     end
 
+    -- 매 프레임 실행되므로 Vector userdata 대신 숫자 3개 API 사용 (GC 할당 없음)
     -- 경계에서 바깥 방향 속도 차단 (Y 축)
-    local pos = actor:GetActorLocation()
-    if pos.Y >= InitialPosition.Y + MaxHorizontalPosition and CurrentRightSpeed > 0 then
+    local _, posY = actor:GetActorLocationXYZ()
+    if posY >= InitialPosition.Y + MaxHorizontalPosition and CurrentRightSpeed > 0 then
         CurrentRightSpeed = 0
-    elseif pos.Y <= InitialPosition.Y + MinHorizontalPosition and CurrentRightSpeed < 0 then
+    elseif posY <= InitialPosition.Y + MinHorizontalPosition and CurrentRightSpeed < 0 then
         CurrentRightSpeed = 0
     end
 
     -- 이동 적용: 속도 * dt
-    local movement = Vector(0,0,0)
+    local mx, my, mz = 0, 0, 0
     if math.abs(CurrentRightSpeed) > 0.0001 then
-        movement = movement + actor:GetActorRight() * (CurrentRightSpeed * dt)
+        local rx, ry, rz = actor:GetActorRightXYZ()
+        local step = CurrentRightSpeed * dt
+        mx, my, mz = mx + rx * step, my + ry * step, mz + rz * step
     end
     if math.abs(CurrentForwardSpeed) > 0.0001 then
-        movement = movement + actor:GetActorForward() * (CurrentForwardSpeed * dt)
+        local fx, fy, fz = actor:GetActorForwardXYZ()
+        local step = CurrentForwardSpeed * dt
+        mx, my, mz = mx + fx * step, my + fy * step, mz + fz * step
     end
-    if movement.X ~= 0 or movement.Y ~= 0 or movement.Z ~= 0 then
-        actor:AddActorWorldLocation(movement)
+    if mx ~= 0 or my ~= 0 or mz ~= 0 then
+        actor:AddActorWorldLocationXYZ(mx, my, mz)
     end
 
     -- 강제 클램프 Y 범위
-    local newPos = actor:GetActorLocation()
-    if newPos.Y < MinHorizontalPosition then
-        newPos.Y = MinHorizontalPosition
-        actor:SetActorLocation(newPos)
+    local newX, newY, newZ = actor:GetActorLocationXYZ()
+    if newY < MinHorizontalPosition then
+        actor:SetActorLocationXYZ(newX, MinHorizontalPosition, newZ)
         CurrentRightSpeed = 0.0
-    elseif newPos.Y > MaxHorizontalPosition then
-        newPos.Y = MaxHorizontalPosition
-        actor:SetActorLocation(newPos)
+    elseif newY > MaxHorizontalPosition then
+        actor:SetActorLocationXYZ(newX, MaxHorizontalPosition, newZ)
         CurrentRightSpeed = 0.0
     end
 end
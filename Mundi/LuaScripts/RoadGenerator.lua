@@ -107,12 +107,14 @@ local Config = {
     FrenzySpawnBlockProbability = 0.05 -- 각 블록마다 하나 스폰할 확률
 }
 
+-- 스크립트 틱 매니저가 이 간격마다 Tick(누적 dt)을 호출 (자체 타이머 불필요)
+TickInterval = Config.CheckInterval
+
 -- =====================================================
 -- [내부 변수 - 도로]
 -- =====================================================
 local OwnerActor = nil
 local RoadBlocks = {}
-local CheckTimer = 0.0
 local IsInitialized = false
 local CurrentGroupModelType = 1
 local GroupCounter = 0
@@ -885,12 +887,6 @@ end
 function Tick(dt)
     if not IsInitialized then return end
 
-    CheckTimer = CheckTimer + dt
-    if CheckTimer < Config.CheckInterval then
-        return
-    end
-    CheckTimer = 0.0
-
     local ownerX = OwnerActor:GetActorLocation().X
     local firstBlock = RoadBlocks[1]
     local lastBlock = RoadBlocks[#RoadBlocks]
@@ -980,7 +976,6 @@ function ResetRoadGenerator()
     ObstaclePatternCounter = 0
     GroupCounter = 0
     CurrentGroupModelType = math.random(1, #Config.RoadModels)
-    CheckTimer = 0.0
     Log("[RoadGenerator] All counters reset (PatternCounter=0, GroupCounter=0)")
 
     -- 3. InitialYPosition 재계산
@@ -59,7 +59,7 @@ struct FPointLightInfo
     float ShadowBias;       // 4 bytes
     float ShadowSlopeBias;  // 4 bytes
     float ShadowSharpen;    // 4 bytes
-    float Padding;          // 4 bytes
+    uint ShadowTile;        // 4 bytes - 큐브 면 안의 타일 (상위 16비트: 분할 레벨, 하위 16비트: 타일 번호, 0=면 전체)
 };
 
 struct FSpotLightInfo
@@ -199,6 +199,23 @@ float3 CubemapUVToDirection(float2 uv, int faceIndex)
     return normalize(dir);
 }
 
+// 큐브 섀도우 타일 디코딩 (상위 16비트: 면 분할 레벨, 하위 16비트: 타일 번호)
+// 반환값 x: 면 대비 타일 크기, yz: 면 UV 오프셋
+float3 DecodeCubeShadowTile(uint ShadowTile)
+{
+    uint TilesPerAxis = 1u << (ShadowTile >> 16);
+    uint TileIndex = ShadowTile & 0xFFFF;
+    float Scale = 1.0f / float(TilesPerAxis);
+    return float3(Scale, float(TileIndex % TilesPerAxis) * Scale, float(TileIndex / TilesPerAxis) * Scale);
+}
+
+// 타일 기준 UV를 실제 면 UV로 옮긴 샘플 방향 (바이리니어가 이웃 타일을 읽지 않도록 반 텍셀 안쪽으로 클램프)
+float3 CubeShadowTileUVToDirection(float2 TileUV, int FaceIndex, float3 Tile, float HalfTexel)
+{
+    TileUV = clamp(TileUV, HalfTexel, 1.0f - HalfTexel);
+    return CubemapUVToDirection(TileUV * Tile.x + Tile.yz, FaceIndex);
+}
+
 //================================================================================================
 // 쉐도우 샘플링 함수
 //================================================================================================
@@ -280,10 +297,44 @@ float SampleShadow2D_VSM(float PixelDepth, float2 AtlasUV,
 //================================================================================================
 
 // PCF for cubemap shadow maps
-float SampleShadowCube_PCF(float PixelDepth, float3 CubemapDir, uint LightIndex,
+// ShadowTile != 0 이면 면의 일부 타일에만 그려진 저해상도 섀도우 (여러 라이트가 한 슬라이스를 나눠 씀)
+float SampleShadowCube_PCF(float PixelDepth, float3 CubemapDir, uint LightIndex, uint ShadowTile,
     int SampleCount, float FilterRadiusTexel,
     TextureCubeArray<float2> ShadowMapCube, SamplerState ShadowSampler)
 {
+    if (ShadowTile != 0)
+    {
+        float Width, Height, Elements;
+        ShadowMapCube.GetDimensions(Width, Height, Elements);
+
+        float3 Tile = DecodeCubeShadowTile(ShadowTile);
+        float HalfTexel = 0.5f / (Width * Tile.x);
+        CubemapUV tileBaseUV = DirectionToCubemapUV(CubemapDir);
+
+        if (SampleCount <= 0)
+        {
+            float3 tileDir = CubeShadowTileUVToDirection(tileBaseUV.uv, tileBaseUV.faceIndex, Tile, HalfTexel);
+            float2 moments = ShadowMapCube.SampleLevel(ShadowSampler, float4(tileDir, LightIndex), 0);
+            return (PixelDepth <= moments.x) ? 1.0f : 0.0f;
+        }
+
+        // 필터 반경은 타일 텍셀 기준으로 유지
+        float tileFilterRadius = FilterRadiusTexel / Tile.x;
+        float TileShadowSum = 0.0f;
+
+        [loop]
+        for (int t = 0; t < SampleCount; t++)
+        {
+            float2 offsetUV = tileBaseUV.uv + PoissonDisk[t] * tileFilterRadius;
+            float3 sampleDir = CubeShadowTileUVToDirection(offsetUV, tileBaseUV.faceIndex, Tile, HalfTexel);
+
+            float2 moments = ShadowMapCube.SampleLevel(ShadowSampler, float4(sampleDir, LightIndex), 0);
+            TileShadowSum += (PixelDepth <= moments.x) ? 1.0f : 0.0f;
+        }
+
+        return TileShadowSum / float(SampleCount);
+    }
+
     if (SampleCount <= 0)
     {
         float2 moments = ShadowMapCube.SampleLevel(ShadowSampler, float4(CubemapDir, LightIndex), 0);
@@ -307,9 +358,19 @@ float SampleShadowCube_PCF(float PixelDepth, float3 CubemapDir, uint LightIndex,
 }
 
 // VSM for cubemap shadow maps
-float SampleShadowCube_VSM(float PixelDepth, float3 CubemapDir, uint LightIndex,
+float SampleShadowCube_VSM(float PixelDepth, float3 CubemapDir, uint LightIndex, uint ShadowTile,
     TextureCubeArray<float2> ShadowMapCube, SamplerState ShadowSampler)
 {
+    if (ShadowTile != 0)
+    {
+        float Width, Height, Elements;
+        ShadowMapCube.GetDimensions(Width, Height, Elements);
+
+        float3 Tile = DecodeCubeShadowTile(ShadowTile);
+        CubemapUV tileUV = DirectionToCubemapUV(CubemapDir);
+        CubemapDir = CubeShadowTileUVToDirection(tileUV.uv, tileUV.faceIndex, Tile, 0.5f / (Width * Tile.x));
+    }
+
     float2 Moments = ShadowMapCube.SampleLevel(ShadowSampler, float4(CubemapDir, LightIndex), 0);
     return ComputeVSMShadow(PixelDepth, Moments);
 }
@@ -382,7 +443,7 @@ float CalculateSpotLightShadowFactorVSM(
 // Point Light Shadow (PCF)
 //================================================================================================
 float CalculatePointLightShadowFactor(
-    float3 WorldPos, float3 Normal, float3 LightPos, float FarPlane, uint LightIndex, int SampleCount,
+    float3 WorldPos, float3 Normal, float3 LightPos, float FarPlane, uint LightIndex, uint ShadowTile, int SampleCount,
     float ShadowBias, float ShadowSlopeBias, float ShadowSharpen,
     TextureCubeArray<float2> ShadowMapCube, SamplerState ShadowSampler)
 {
@@ -404,14 +465,14 @@ float CalculatePointLightShadowFactor(
     ShadowMapCube.GetDimensions(Width, Height, Elements);
     float filterRadiusTexel = (1.5f * ShadowSharpen) / Width;
     
-    return SampleShadowCube_PCF(PixelDepth, cubemapDir, LightIndex, SampleCount, filterRadiusTexel, ShadowMapCube, ShadowSampler);
+    return SampleShadowCube_PCF(PixelDepth, cubemapDir, LightIndex, ShadowTile, SampleCount, filterRadiusTexel, ShadowMapCube, ShadowSampler);
 }
 
 //================================================================================================
 // Point Light Shadow (VSM)
 //================================================================================================
 float CalculatePointLightShadowFactorVSM(
-    float3 WorldPos, float3 Normal, float3 LightPos, float FarPlane, uint LightIndex,
+    float3 WorldPos, float3 Normal, float3 LightPos, float FarPlane, uint LightIndex, uint ShadowTile,
     float ShadowBias, float ShadowSlopeBias, float ShadowSharpen,
     TextureCubeArray<float2> ShadowMapCube, SamplerState ShadowSampler)
 {
@@ -429,7 +490,7 @@ float CalculatePointLightShadowFactorVSM(
     // 좌표계 변환
     float3 cubemapDir = float3(lightToPixel.y, lightToPixel.z, lightToPixel.x);
     
-    return SampleShadowCube_VSM(PixelDepth, cubemapDir, LightIndex, ShadowMapCube, ShadowSampler);
+    return SampleShadowCube_VSM(PixelDepth, cubemapDir, LightIndex, ShadowTile, ShadowMapCube, ShadowSampler);
 }
 
 //================================================================================================
@@ -693,14 +754,14 @@ float3 CalculatePointLight(
     {
 #if SHADOW_AA_TECHNIQUE == 1
         float shadowFactor = CalculatePointLightShadowFactor(
-            worldPos, normal, light.Position, light.AttenuationRadius, light.LightIndex, light.SampleCount,
+            worldPos, normal, light.Position, light.AttenuationRadius, light.LightIndex, light.ShadowTile, light.SampleCount,
             light.ShadowBias, light.ShadowSlopeBias, light.ShadowSharpen,
             ShadowMapCube, ShadowSampler);
         diffuse *= shadowFactor;
         specular *= shadowFactor;
 #elif SHADOW_AA_TECHNIQUE == 2
         float shadowFactor = CalculatePointLightShadowFactorVSM(
-            worldPos, normal, light.Position, light.AttenuationRadius, light.LightIndex,
+            worldPos, normal, light.Position, light.AttenuationRadius, light.LightIndex, light.ShadowTile,
             light.ShadowBias, light.ShadowSlopeBias, light.ShadowSharpen,
             VShadowMapCube, VShadowSampler);
         diffuse *= shadowFactor;
@@ -0,0 +1,39 @@
+//================================================================================================
+// Filename:      ObjectData.hlsl
+// Description:   메시 배치 패스의 오브젝트별 데이터 (FObjectDataBuffer가 패스마다 한 번 업로드)
+//                드로우의 StartInstanceLocation이 인스턴스 스트림(OBJECTINDEX)으로 전달되어 인덱스로 사용됨
+//                VS/PS 시작 시 LoadObjectData를 호출하면 기존 ModelBuffer/ColorBuffer 이름으로 접근 가능
+//================================================================================================
+
+// FObjectGPUData와 정확히 일치 (192 bytes)
+struct FObjectData
+{
+    row_major float4x4 WorldMatrix;
+    row_major float4x4 WorldInverseTranspose;   // 올바른 노멀 변환을 위함
+    float4 PositionDequantScale;                // 압축 정점 위치 복원 (COMPRESSED_VERTEX 변형만 사용)
+    float4 PositionDequantOffset;
+    float4 InstanceColor;
+    uint ObjectID;
+    uint3 Padding;
+};
+
+// t20: VS+PS
+StructuredBuffer<FObjectData> g_ObjectData : register(t20);
+
+static float4x4 WorldMatrix;
+static float4x4 WorldInverseTranspose;
+static float4 PositionDequantScale;
+static float4 PositionDequantOffset;
+static float4 LerpColor;    // 인스턴스 색상 (셰이더마다 블렌드/곱셈으로 사용)
+static uint UUID;           // 피킹용 오브젝트 ID
+
+void LoadObjectData(uint ObjectIndex)
+{
+    FObjectData Data = g_ObjectData[ObjectIndex];
+    WorldMatrix = Data.WorldMatrix;
+    WorldInverseTranspose = Data.WorldInverseTranspose;
+    PositionDequantScale = Data.PositionDequantScale;
+    PositionDequantOffset = Data.PositionDequantOffset;
+    LerpColor = Data.InstanceColor;
+    UUID = Data.ObjectID;
+}
@@ -0,0 +1,36 @@
+//================================================================================================
+// Filename:      VertexCompression.hlsl
+// Description:   스태틱 메시 압축 정점(FCompressedVertex, 20 bytes) 디코드
+//                COMPRESSED_VERTEX 매크로 변형에서만 include
+//                CPU 쪽 FVertexCompression::DecompressVertex와 같은 식을 사용
+//================================================================================================
+
+// 주의: 이 파일은 PositionDequantScale/Offset 선언(ModelBuffer 또는 ObjectData.hlsl) 이후에 include 되어야 하며,
+//       ObjectData.hlsl을 쓰는 셰이더는 디코드 전에 LoadObjectData를 호출해야 함
+
+// 입력 레이아웃: UResourceManager::InitShaderILMap의 압축 레이아웃과 일치
+struct FCompressedVertexInput
+{
+    float4 PositionQ : POSITION;    // R16G16B16A16_UNORM, w = 탄젠트 부호 (0 → -1, 1 → +1)
+    float2 NormalOct : NORMAL0;     // R16G16_SNORM 옥타헤드럴
+    float2 TexCoord : TEXCOORD0;    // R16G16_FLOAT
+    float2 TangentOct : TANGENT0;   // R16G16_SNORM 옥타헤드럴
+};
+
+float3 DecodeOctahedral(float2 Encoded)
+{
+    float3 Direction = float3(Encoded, 1.0f - abs(Encoded.x) - abs(Encoded.y));
+    float Fold = saturate(-Direction.z);
+    Direction.xy += (Direction.xy >= 0.0f) ? -Fold : Fold;
+    return normalize(Direction);
+}
+
+float3 DecodeCompressedPosition(float4 PositionQ)
+{
+    return PositionDequantOffset.xyz + PositionQ.xyz * PositionDequantScale.xyz;
+}
+
+float4 DecodeCompressedTangent(float4 PositionQ, float2 TangentOct)
+{
+    return float4(DecodeOctahedral(TangentOct), PositionQ.w * 2.0f - 1.0f);
+}
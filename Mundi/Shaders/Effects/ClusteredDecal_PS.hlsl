@@ -0,0 +1,201 @@
+//================================================================================================
+// Filename:      ClusteredDecal_PS.hlsl
+// Description:   클러스터드(타일) 데칼 - 화면 타일에 비닝된 데칼을 깊이로 복원한 월드 좌표에 한 번에 적용
+//                FTileDecalBinner가 데칼 데이터/타일 목록을 채우고, 타일 격자는 타일 목록 헤더로 받음
+//                (b11은 라이트 컬링이 도는 Lit 모드에서만 갱신되므로 타일 탐색에 쓰지 않음)
+//                조명 모델 매크로는 Decal.hlsl과 같음 (정점 단계가 없으므로 GOURAUD는 픽셀 단위 PHONG으로 대체)
+//================================================================================================
+
+cbuffer ViewProjBuffer : register(b1)
+{
+    row_major float4x4 ViewMatrix;
+    row_major float4x4 ProjectionMatrix;
+    row_major float4x4 InverseViewMatrix;
+    row_major float4x4 InverseProjectionMatrix;
+}
+
+// --- 공통 조명 시스템 include ---
+#include "../Common/LightStructures.hlsl"
+#include "../Common/LightingBuffers.hlsl"
+#include "../Common/LightingCommon.hlsl"
+
+cbuffer ViewportConstants : register(b10)
+{
+    float4 ViewportRect;  // (MinX, MinY, Width, Height)
+    float4 ScreenSize;    // (Width, Height, 1/Width, 1/Height)
+};
+
+// FDecalGPUData와 정확히 일치 (80 bytes)
+struct FDecalData
+{
+    row_major float4x4 DecalMatrix;
+    float Opacity;
+    uint TextureSlot;
+    uint2 Padding;
+};
+
+// --- 리소스 (FTileDecalBinner의 슬롯 상수와 일치) ---
+Texture2D g_SceneDepth : register(t1);
+StructuredBuffer<FDecalData> g_DecalData : register(t6);
+StructuredBuffer<uint> g_TileDecalList : register(t7);     // 격자 헤더 + [타일 수 * 2] (오프셋, 개수) 헤더 뒤에 데칼 인덱스
+Texture2D g_DecalTextures[8] : register(t11);               // MaxTexturesPerPass
+TextureCubeArray<float2> g_ShadowAtlasCube : register(t8);
+Texture2D<float2> g_ShadowAtlas2D : register(t9);
+Texture2D<float2> g_VSMShadowAtlas : register(t9);  // VSM shadow map (동일 슬롯)
+SamplerState g_Sample : register(s0);
+SamplerState g_VSMSampler : register(s0);  // VSM sampler (동일 슬롯)
+SamplerComparisonState g_ShadowSample : register(s2);
+
+struct PS_INPUT
+{
+    float4 position : SV_POSITION;
+    float2 texCoord : TEXCOORD0;
+};
+
+// SM5.0은 텍스처 배열을 리터럴 인덱스로만 접근할 수 있으므로 슬롯마다 분기
+float4 SampleDecalTexture(uint Slot, float2 UV, float2 UVDX, float2 UVDY)
+{
+    switch (Slot)
+    {
+    case 0: return g_DecalTextures[0].SampleGrad(g_Sample, UV, UVDX, UVDY);
+    case 1: return g_DecalTextures[1].SampleGrad(g_Sample, UV, UVDX, UVDY);
+    case 2: return g_DecalTextures[2].SampleGrad(g_Sample, UV, UVDX, UVDY);
+    case 3: return g_DecalTextures[3].SampleGrad(g_Sample, UV, UVDX, UVDY);
+    case 4: return g_DecalTextures[4].SampleGrad(g_Sample, UV, UVDX, UVDY);
+    case 5: return g_DecalTextures[5].SampleGrad(g_Sample, UV, UVDX, UVDY);
+    case 6: return g_DecalTextures[6].SampleGrad(g_Sample, UV, UVDX, UVDY);
+    case 7: return g_DecalTextures[7].SampleGrad(g_Sample, UV, UVDX, UVDY);
+    default: return float4(0.0f, 0.0f, 0.0f, 0.0f);
+    }
+}
+
+// 데칼 투영 공간 좌표 (Decal.hlsl과 같은 규칙: x는 [0, 1], y/z는 [-1, 1]이 데칼 볼륨)
+float3 ProjectToDecal(float3 WorldPos, float4x4 DecalMatrix)
+{
+    float4 decalPos = mul(float4(WorldPos, 1.0f), DecalMatrix);
+    return decalPos.xyz / decalPos.w;
+}
+
+float2 DecalUV(float3 DecalNdc)
+{
+    float2 uv = (DecalNdc.yz + 1.0f) / 2.0f;
+    uv.y = 1.0f - uv.y;
+    return uv;
+}
+
+// 타일 목록 앞의 격자 헤더 크기와 배치 (FTileDecalBinner::GridHeaderSize와 일치)
+static const uint DecalGridHeaderSize = 8;
+
+// 픽셀이 속한 타일의 (오프셋, 개수) 헤더 위치
+uint GetDecalTileHeader(float4 screenPos)
+{
+    uint tileSize = g_TileDecalList[0];
+    uint tileCountX = g_TileDecalList[1];
+    uint tileCountY = g_TileDecalList[2];
+    uint2 viewportStart = uint2(g_TileDecalList[3], g_TileDecalList[4]);
+
+    uint2 tile = (uint2(screenPos.xy) - viewportStart) / tileSize;
+    tile = min(tile, uint2(tileCountX - 1, tileCountY - 1));
+    return DecalGridHeaderSize + (tile.y * tileCountX + tile.x) * 2;
+}
+
+float4 mainPS(PS_INPUT input) : SV_TARGET
+{
+    // 부동 소수점 오차 무시를 위해 Epsilon 사용
+    static const float Epsilon = 1e-6f;
+
+    // 1. 깊이 → 월드 좌표 (HeightFog_PS와 같은 방식)
+    float depth = g_SceneDepth.Load(int3(input.position.xy, 0)).r;
+    float2 localUV = (input.position.xy - ViewportRect.xy) / ViewportRect.zw;
+    float4 ndcPos = float4(localUV.x * 2.0f - 1.0f, 1.0f - localUV.y * 2.0f, depth, 1.0f);
+    float4 viewPos = mul(ndcPos, InverseProjectionMatrix);
+    viewPos /= viewPos.w;
+    float3 worldPos = mul(viewPos, InverseViewMatrix).xyz;
+
+    // 미분은 분기 전에 계산 (텍스처 LOD, 노멀 복원에 사용)
+    float3 worldDX = ddx(worldPos);
+    float3 worldDY = ddy(worldPos);
+
+    // 아무것도 그려지지 않은 픽셀
+    if (depth >= 1.0f)
+    {
+        discard;
+    }
+
+    // 2. 이 픽셀이 속한 타일의 데칼을 비닝 순서대로 합성 (메시 경로의 드로우 순서와 같음)
+    uint tileHeader = GetDecalTileHeader(input.position);
+    uint listOffset = g_TileDecalList[tileHeader];
+    uint decalCount = g_TileDecalList[tileHeader + 1];
+
+    float3 accumColor = float3(0.0f, 0.0f, 0.0f);   // 불투명도를 곱한 색 (premultiplied)
+    float accumAlpha = 0.0f;
+
+    for (uint i = 0; i < decalCount; ++i)
+    {
+        FDecalData decal = g_DecalData[g_TileDecalList[listOffset + i]];
+
+        float3 ndc = ProjectToDecal(worldPos, decal.DecalMatrix);
+        if (ndc.x < 0.0f - Epsilon || 1.0f + Epsilon < ndc.x ||
+            ndc.y < -1.0f - Epsilon || 1.0f + Epsilon < ndc.y ||
+            ndc.z < -1.0f - Epsilon || 1.0f + Epsilon < ndc.z)
+        {
+            continue;
+        }
+
+        // 분기 안에서는 ddx/ddy를 쓸 수 없으므로 이웃 픽셀의 월드 좌표를 투영해 UV 미분을 구함
+        float2 uv = DecalUV(ndc);
+        float2 uvDX = DecalUV(ProjectToDecal(worldPos + worldDX, decal.DecalMatrix)) - uv;
+        float2 uvDY = DecalUV(ProjectToDecal(worldPos + worldDY, decal.DecalMatrix)) - uv;
+
+        float4 decalTexture = SampleDecalTexture(decal.TextureSlot, uv, uvDX, uvDY);
+        float alpha = decalTexture.a * decal.Opacity;
+        accumColor = decalTexture.rgb * alpha + accumColor * (1.0f - alpha);
+        accumAlpha = alpha + accumAlpha * (1.0f - alpha);
+    }
+
+    if (accumAlpha <= 0.0f)
+    {
+        discard;
+    }
+
+    // 합성된 알베도 (조명은 알베도에 선형이므로 데칼마다 조명한 뒤 합성한 결과와 같음)
+    float4 baseColor = float4(accumColor / accumAlpha, accumAlpha);
+
+    // 3. 조명 계산 (매크로에 따라)
+#if defined(LIGHTING_MODEL_LAMBERT) || defined(LIGHTING_MODEL_PHONG)
+    // G-버퍼가 없으므로 깊이 미분으로 면 노멀을 복원 (카메라 쪽을 향하도록)
+    float3 normal = normalize(cross(worldDY, worldDX));
+    if (dot(normal, CameraPosition - worldPos) < 0.0f)
+    {
+        normal = -normal;
+    }
+    float specPower = 32.0f;
+
+    #ifdef LIGHTING_MODEL_PHONG
+        float3 viewDir = normalize(CameraPosition - worldPos);
+    #else
+        float3 viewDir = float3(0, 0, 0);  // Lambert는 사용 안 함
+    #endif
+
+    float3 litColor = CalculateAllLights(
+        worldPos,
+        viewPos.xyz,
+        normal,
+        viewDir,
+        baseColor,
+        specPower,
+        input.position,
+        g_Sample,
+        g_ShadowAtlas2D,
+        g_ShadowAtlasCube,
+        g_ShadowAtlasCube,
+        g_VSMShadowAtlas,
+        g_VSMSampler
+    );
+
+    return float4(litColor, accumAlpha);
+#else
+    // No lighting model - 단순 텍스처
+    return baseColor;
+#endif
+}
@@ -12,13 +12,10 @@
 // - LIGHTING_MODEL_PHONG
 // - (매크로 없음 = Unlit)
 
-// --- Decal 전용 상수 버퍼 (LightingCommon.hlsl include 전에 정의 필요) ---
-cbuffer ModelBuffer : register(b0)
-{
-    row_major float4x4 WorldMatrix;
-    row_major float4x4 WorldInverseTranspose;
-}
+// --- 오브젝트 데이터 (t20, VS에서만 사용) ---
+#include "../Common/ObjectData.hlsl"
 
+// --- Decal 전용 상수 버퍼 (LightingCommon.hlsl include 전에 정의 필요) ---
 cbuffer ViewProjBuffer : register(b1)
 {
     row_major float4x4 ViewMatrix;
@@ -64,6 +61,21 @@ struct VS_INPUT
     float4 color : COLOR;
 };
 
+#if COMPRESSED_VERTEX
+#include "../Common/VertexCompression.hlsl"
+
+VS_INPUT DecodeVertexInput(FCompressedVertexInput Compressed)
+{
+    VS_INPUT Input;
+    Input.position = DecodeCompressedPosition(Compressed.PositionQ);
+    Input.normal = DecodeOctahedral(Compressed.NormalOct);
+    Input.texCoord = Compressed.TexCoord;
+    Input.Tangent = DecodeCompressedTangent(Compressed.PositionQ, Compressed.TangentOct);
+    Input.color = float4(1.0f, 1.0f, 1.0f, 1.0f); // 압축 포맷은 상수 색상만 허용
+    return Input;
+}
+#endif // COMPRESSED_VERTEX
+
 struct PS_INPUT
 {
     float4 position : SV_POSITION;
@@ -78,8 +90,16 @@ struct PS_INPUT
 //================================================================================================
 // 버텍스 셰이더
 //================================================================================================
-PS_INPUT mainVS(VS_INPUT input)
+#if COMPRESSED_VERTEX
+PS_INPUT mainVS(FCompressedVertexInput CompressedInput, uint ObjectIndex : OBJECTINDEX)
 {
+    LoadObjectData(ObjectIndex);
+    VS_INPUT input = DecodeVertexInput(CompressedInput);
+#else
+PS_INPUT mainVS(VS_INPUT input, uint ObjectIndex : OBJECTINDEX)
+{
+    LoadObjectData(ObjectIndex);
+#endif
     PS_INPUT output;
 
     // World position
@@ -6,13 +6,11 @@
 //                - 카메라 이동에 따른 시차 효과 제거 (회전만 유지)
 //================================================================================================
 
+// --- 오브젝트 데이터 ---
+// t20: WorldMatrix, PositionDequantScale/Offset (VS), UUID (PS)
+#include "../Common/ObjectData.hlsl"
+
 // --- 상수 버퍼 ---
-// b0: ModelBuffer (VS)
-cbuffer ModelBuffer : register(b0)
-{
-    row_major float4x4 WorldMatrix;              // 64 bytes
-    row_major float4x4 WorldInverseTranspose;    // 64 bytes
-};
 
 // b1: ViewProjBuffer (VS)
 cbuffer ViewProjBuffer : register(b1)
@@ -23,13 +21,6 @@ cbuffer ViewProjBuffer : register(b1)
     row_major float4x4 InverseProjectionMatrix;
 };
 
-// b3: ColorBuffer (PS)
-cbuffer ColorBuffer : register(b3)
-{
-    float4 LerpColor;   // 색상 블렌딩용
-    uint UUID;
-};
-
 // --- 텍스처 및 샘플러 ---
 Texture2D g_SkyTexture : register(t0);
 SamplerState g_Sample : register(s0);
@@ -44,11 +35,27 @@ struct VS_INPUT
     float4 Color : COLOR;
 };
 
+#if COMPRESSED_VERTEX
+#include "../Common/VertexCompression.hlsl"
+
+VS_INPUT DecodeVertexInput(FCompressedVertexInput Compressed)
+{
+    VS_INPUT Input;
+    Input.Position = DecodeCompressedPosition(Compressed.PositionQ);
+    Input.Normal = DecodeOctahedral(Compressed.NormalOct);
+    Input.TexCoord = Compressed.TexCoord;
+    Input.Tangent = DecodeCompressedTangent(Compressed.PositionQ, Compressed.TangentOct);
+    Input.Color = float4(1.0f, 1.0f, 1.0f, 1.0f); // 압축 포맷은 상수 색상만 허용
+    return Input;
+}
+#endif // COMPRESSED_VERTEX
+
 struct PS_INPUT
 {
     float4 Position : SV_POSITION;
     float2 TexCoord : TEXCOORD0;
     float3 WorldPos : POSITION;  // 디버깅용
+    nointerpolation uint ObjectIndex : OBJECTINDEX;
 };
 
 struct PS_OUTPUT
@@ -60,9 +67,18 @@ struct PS_OUTPUT
 //================================================================================================
 // 버텍스 셰이더 (Vertex Shader)
 //================================================================================================
-PS_INPUT mainVS(VS_INPUT Input)
+#if COMPRESSED_VERTEX
+PS_INPUT mainVS(FCompressedVertexInput CompressedInput, uint ObjectIndex : OBJECTINDEX)
+{
+    LoadObjectData(ObjectIndex);
+    VS_INPUT Input = DecodeVertexInput(CompressedInput);
+#else
+PS_INPUT mainVS(VS_INPUT Input, uint ObjectIndex : OBJECTINDEX)
 {
+    LoadObjectData(ObjectIndex);
+#endif
     PS_INPUT Out;
+    Out.ObjectIndex = ObjectIndex;
 
     // 1. 로컬 위치를 월드 공간으로 변환
     float4 worldPos = mul(float4(Input.Position, 1.0f), WorldMatrix);
@@ -97,6 +113,7 @@ PS_INPUT mainVS(VS_INPUT Input)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+    LoadObjectData(Input.ObjectIndex);
 
     // 텍스처 샘플링 (조명 계산 없음)
     float4 skyColor = g_SkyTexture.Sample(g_Sample, Input.TexCoord);
@@ -28,12 +28,10 @@ struct FMaterial
 // --- 상수 버퍼 (Constant Buffers) ---
 // 조명과 StaticMeshShader 기능을 모두 지원하도록 확장
 
-// b0: ModelBuffer (VS) - ModelBufferType과 정확히 일치 (128 bytes)
-cbuffer ModelBuffer : register(b0)
-{
-    row_major float4x4 WorldMatrix;              // 64 bytes
-    row_major float4x4 WorldInverseTranspose;    // 64 bytes - 올바른 노멀 변환을 위함
-};
+// t20: 오브젝트 데이터 (FObjectGPUData) - 기존 ModelBuffer(b0)/ColorBuffer(b3) 대체
+// VS: WorldMatrix, WorldInverseTranspose, PositionDequantScale/Offset
+// PS: LerpColor (블렌드할 색상, 알파가 블렌드 양 제어), UUID
+#include "../Common/ObjectData.hlsl"
 
 // b1: ViewProjBuffer (VS) - ViewProjBufferType과 일치
 cbuffer ViewProjBuffer : register(b1)
@@ -44,13 +42,6 @@ cbuffer ViewProjBuffer : register(b1)
     row_major float4x4 InverseProjectionMatrix;
 };
 
-// b3: ColorBuffer (PS) - 색상 블렌딩/lerp용
-cbuffer ColorBuffer : register(b3)
-{
-    float4 LerpColor;   // 블렌드할 색상 (알파가 블렌드 양 제어)
-    uint UUID;
-};
-
 // b4: PixelConstBuffer (VS+PS) - OBJ 파일의 머티리얼 정보
 // FPixelConstBufferType과 정확히 일치해야 함!
 // 주의: GOURAUD 조명 모델에서는 Vertex Shader에서 사용됨
@@ -102,6 +93,21 @@ struct VS_INPUT
     float4 Color : COLOR;
 };
 
+#if COMPRESSED_VERTEX
+#include "../Common/VertexCompression.hlsl"
+
+VS_INPUT DecodeVertexInput(FCompressedVertexInput Compressed)
+{
+    VS_INPUT Input;
+    Input.Position = DecodeCompressedPosition(Compressed.PositionQ);
+    Input.Normal = DecodeOctahedral(Compressed.NormalOct);
+    Input.TexCoord = Compressed.TexCoord;
+    Input.Tangent = DecodeCompressedTangent(Compressed.PositionQ, Compressed.TangentOct);
+    Input.Color = float4(1.0f, 1.0f, 1.0f, 1.0f); // 압축 포맷은 상수 색상만 허용
+    return Input;
+}
+#endif // COMPRESSED_VERTEX
+
 struct PS_INPUT
 {
     float4 Position : SV_POSITION;
@@ -110,6 +116,7 @@ struct PS_INPUT
     row_major float3x3 TBN : TBN;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+    nointerpolation uint ObjectIndex : OBJECTINDEX;
 };
 
 struct PS_OUTPUT
@@ -228,9 +235,18 @@ struct PS_OUTPUT
 //================================================================================================
 // 버텍스 셰이더 (Vertex Shader)
 //================================================================================================
-PS_INPUT mainVS(VS_INPUT Input)
+#if COMPRESSED_VERTEX
+PS_INPUT mainVS(FCompressedVertexInput CompressedInput, uint ObjectIndex : OBJECTINDEX)
 {
+    LoadObjectData(ObjectIndex);
+    VS_INPUT Input = DecodeVertexInput(CompressedInput);
+#else
+PS_INPUT mainVS(VS_INPUT Input, uint ObjectIndex : OBJECTINDEX)
+{
+    LoadObjectData(ObjectIndex);
+#endif
     PS_INPUT Out;
+    Out.ObjectIndex = ObjectIndex;
     
     // 위치를 월드 공간으로 먼저 변환
     float4 worldPos = mul(float4(Input.Position, 1.0f), WorldMatrix);
@@ -334,6 +350,7 @@ PS_INPUT mainVS(VS_INPUT Input)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+    LoadObjectData(Input.ObjectIndex);
     Output.UUID = UUID;
     
     //CSM 구간 시각화
@@ -409,7 +426,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
         {
             shadowFactor *= CalculatePointLightShadowFactor(
                 Input.WorldPos, Input.Normal, g_PointLightList[i].Position, g_PointLightList[i].AttenuationRadius,
-                g_PointLightList[i].LightIndex, g_PointLightList[i].SampleCount,
+                g_PointLightList[i].LightIndex, g_PointLightList[i].ShadowTile, g_PointLightList[i].SampleCount,
                 g_PointLightList[i].ShadowBias, g_PointLightList[i].ShadowSlopeBias, g_PointLightList[i].ShadowSharpen,
                 g_ShadowAtlasCube, g_Sample);
         }
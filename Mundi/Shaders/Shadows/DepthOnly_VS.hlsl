@@ -3,6 +3,8 @@ cbuffer ModelBuffer : register(b0)
 {
     row_major float4x4 WorldMatrix; // 64 bytes
     row_major float4x4 WorldInverseTranspose; // 64 bytes - 올바른 노멀 변환을 위함
+    float4 PositionDequantScale;                 // 압축 정점 위치 복원 (COMPRESSED_VERTEX 변형만 사용)
+    float4 PositionDequantOffset;
 };
 
 // b1: ViewProjBuffer (VS) - ViewProjBufferType과 일치
@@ -24,6 +26,21 @@ struct VS_INPUT
     float4 Color : COLOR;
 };
 
+#if COMPRESSED_VERTEX
+#include "../Common/VertexCompression.hlsl"
+
+VS_INPUT DecodeVertexInput(FCompressedVertexInput Compressed)
+{
+    VS_INPUT Input;
+    Input.Position = DecodeCompressedPosition(Compressed.PositionQ);
+    Input.Normal = DecodeOctahedral(Compressed.NormalOct);
+    Input.TexCoord = Compressed.TexCoord;
+    Input.Tangent = DecodeCompressedTangent(Compressed.PositionQ, Compressed.TangentOct);
+    Input.Color = float4(1.0f, 1.0f, 1.0f, 1.0f); // 압축 포맷은 상수 색상만 허용
+    return Input;
+}
+#endif // COMPRESSED_VERTEX
+
 // 출력은 오직 클립 공간 위치만 필요
 struct VS_OUT
 {
@@ -31,8 +48,14 @@ struct VS_OUT
     float3 WorldPosition : TEXCOORD0;
 };
 
+#if COMPRESSED_VERTEX
+VS_OUT mainVS(FCompressedVertexInput CompressedInput)
+{
+    VS_INPUT Input = DecodeVertexInput(CompressedInput);
+#else
 VS_OUT mainVS(VS_INPUT Input)
 {
+#endif
     VS_OUT Output = (VS_OUT) 0;
     
     // 모델 좌표 -> 월드 좌표 -> 뷰 좌표 -> 클립 좌표
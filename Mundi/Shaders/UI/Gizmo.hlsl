@@ -6,14 +6,12 @@
 //                - Custom color per gizmo with highlight support
 //================================================================================================
 
-// --- Constant Buffers ---
+// --- Object Data ---
 
-// b0: ModelBuffer (VS) - World transform
-cbuffer ModelBuffer : register(b0)
-{
-    row_major float4x4 WorldMatrix;
-    row_major float4x4 WorldInverseTranspose; // Not used for gizmos, kept for compatibility
-}
+// t20: World transform + color (VS), UUID for object picking (PS)
+#include "../Common/ObjectData.hlsl"
+
+// --- Constant Buffers ---
 
 // b1: ViewProjBuffer (VS) - Camera matrices
 cbuffer ViewProjBuffer : register(b1)
@@ -24,13 +22,6 @@ cbuffer ViewProjBuffer : register(b1)
     row_major float4x4 InverseProjectionMatrix;
 }
 
-// b3: ColorBuffer (PS) - UUID for object picking
-cbuffer ColorBuffer : register(b3)
-{
-    float4 LerpColor;
-    uint UUID;          // Object ID for picking
-}
-
 // --- Input/Output Structures ---
 
 struct VS_INPUT
@@ -38,10 +29,22 @@ struct VS_INPUT
     float3 position : POSITION;     // Vertex position
 };
 
+#if COMPRESSED_VERTEX
+#include "../Common/VertexCompression.hlsl"
+
+VS_INPUT DecodeVertexInput(FCompressedVertexInput Compressed)
+{
+    VS_INPUT Input;
+    Input.position = DecodeCompressedPosition(Compressed.PositionQ);
+    return Input;
+}
+#endif // COMPRESSED_VERTEX
+
 struct PS_INPUT
 {
     float4 position : SV_POSITION;  // Clip-space position
     float4 color : COLOR;           // Gizmo color (from vertex shader)
+    nointerpolation uint ObjectIndex : OBJECTINDEX; // Object data index for picking
 };
 
 struct PS_OUTPUT
@@ -53,9 +56,18 @@ struct PS_OUTPUT
 //================================================================================================
 // Vertex Shader
 //================================================================================================
-PS_INPUT mainVS(VS_INPUT input)
+#if COMPRESSED_VERTEX
+PS_INPUT mainVS(FCompressedVertexInput CompressedInput, uint ObjectIndex : OBJECTINDEX)
+{
+    LoadObjectData(ObjectIndex);
+    VS_INPUT input = DecodeVertexInput(CompressedInput);
+#else
+PS_INPUT mainVS(VS_INPUT input, uint ObjectIndex : OBJECTINDEX)
 {
+    LoadObjectData(ObjectIndex);
+#endif
     PS_INPUT output;
+    output.ObjectIndex = ObjectIndex;
 
     // Transform vertex position: Model -> World -> View -> Clip space
     float4x4 MVP = mul(mul(WorldMatrix, ViewMatrix), ProjectionMatrix);
@@ -71,6 +83,7 @@ PS_INPUT mainVS(VS_INPUT input)
 PS_OUTPUT mainPS(PS_INPUT input)
 {
     PS_OUTPUT Output;
+    LoadObjectData(input.ObjectIndex);
 
     // Gizmo is unlit - just pass through the color from vertex shader
     Output.Color = input.color;
@@ -12,6 +12,7 @@
 #include "FViewport.h"
 #include "Picking.h"
 #include "EditorEngine.h"
+#include "RenderScene.h"
 
 IMPLEMENT_CLASS(AGizmoActor)
 
@@ -162,8 +163,13 @@ void AGizmoActor::Tick(float DeltaSeconds)
 		{
 			// OnDrag 함수가 컴포넌트의 위치를 변경하면,
 			// Tick 함수는 그 변경된 위치를 읽어 기즈모 액터 자신을 이동시킵니다.
+			// 값이 같으면 다시 설정하지 않음 (매 틱 트랜스폼 갱신이 자식 화살표까지 전파되고 렌더 상태가 바뀐 것으로 처리됨)
 			SetSpaceWorldMatrix(CurrentSpace, SelectedComponent);
-			SetActorLocation(SelectedComponent->GetWorldLocation());
+			const FVector TargetLocation = SelectedComponent->GetWorldLocation();
+			if (GetActorLocation() != TargetLocation)
+			{
+				SetActorLocation(TargetLocation);
+			}
 		}
 	}
 	UpdateComponentVisibility();
@@ -198,12 +204,18 @@ void AGizmoActor::SetSpaceWorldMatrix(EGizmoSpace NewSpace, USceneComponent* Sel
 	{
 		// 기즈모 액터 자체를 타겟의 회전으로 설정합니다.
 		FQuat TargetRot = SelectedComponent->GetWorldRotation();
-		SetActorRotation(TargetRot);
+		if (GetActorRotation() != TargetRot)
+		{
+			SetActorRotation(TargetRot);
+		}
 	}
 	else if (NewSpace == EGizmoSpace::World)
 	{
 		// 기즈모 액터를 월드 축에 정렬 (단위 회전으로 설정)
-		SetActorRotation(FQuat::Identity());
+		if (GetActorRotation() != FQuat::Identity())
+		{
+			SetActorRotation(FQuat::Identity());
+		}
 	}
 }
 
@@ -638,6 +650,23 @@ void AGizmoActor::UpdateComponentVisibility()
 	if (ScaleX) { ScaleX->SetActive(bShowScales); ScaleX->SetHighlighted(HighlightAxis == 1, 1); }
 	if (ScaleY) { ScaleY->SetActive(bShowScales); ScaleY->SetHighlighted(HighlightAxis == 2, 2); }
 	if (ScaleZ) { ScaleZ->SetActive(bShowScales); ScaleZ->SetHighlighted(HighlightAxis == 3, 3); }
+
+	// 선택/모드/공간/강조 축이 바뀌면 모든 뷰포트가 다시 그리도록 렌더 상태 리비전을 올림
+	USceneComponent* VisualTarget = bHasSelection ? SelectionManager->GetSelectedComponent() : nullptr;
+	const uint32 VisualState = (static_cast<uint32>(CurrentMode) << 24) | (static_cast<uint32>(CurrentSpace) << 16)
+		| (HighlightAxis << 8) | static_cast<uint32>(SelectionManager ? SelectionManager->GetSelectionCount() : 0);
+	if (VisualTarget != LastVisualTarget || VisualState != LastVisualState)
+	{
+		LastVisualTarget = VisualTarget;
+		LastVisualState = VisualState;
+		if (UWorld* World = GetWorld())
+		{
+			if (FRenderScene* RenderScene = World->GetRenderScene())
+			{
+				RenderScene->MarkRenderStateDirty();
+			}
+		}
+	}
 }
 
 void AGizmoActor::OnDrag(USceneComponent* SelectedComponent, uint32 GizmoAxis, float MouseDeltaX, float MouseDeltaY, const ACameraActor* Camera)
@@ -131,4 +131,8 @@ private:
     FVector DragImpactPoint;
     // (회전용) 계산된 2D 스크린 드래그 벡터
     FVector2D DragScreenVector;
+
+    // 마지막으로 렌더 상태에 반영한 기즈모 표시 상태 (바뀔 때만 리비전 증가)
+    USceneComponent* LastVisualTarget = nullptr;
+    uint32 LastVisualState = ~0u;
 };
@@ -152,7 +152,9 @@ void UGizmoArrowComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		// 머티리얼과 셰이더는 루프 밖에서 이미 결정되었습니다.
 		FMeshBatchElement BatchElement;
 
-		FShaderVariant* ShaderVariant = ShaderToUse->GetShaderVariant(MaterialToUse->GetShaderMacros());
+		FShaderVariant* ShaderVariant = StaticMesh->IsVertexCompressed()
+			? ShaderToUse->GetBatchShaderVariant(UResourceManager::GetInstance().GetDevice(), MaterialToUse->GetShaderMacros(), true)
+			: ShaderToUse->GetShaderVariant(MaterialToUse->GetShaderMacros());
 
 		// --- 정렬 키 ---
 		BatchElement.VertexShader = ShaderVariant->VertexShader;
@@ -162,6 +164,14 @@ void UGizmoArrowComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		BatchElement.VertexBuffer = StaticMesh->GetVertexBuffer();
 		BatchElement.IndexBuffer = StaticMesh->GetIndexBuffer();
 		BatchElement.VertexStride = StaticMesh->GetVertexStride();
+		if (StaticMesh->IsVertexCompressed())
+		{
+			const FVector DequantScale = StaticMesh->GetPositionDequantScale();
+			const FVector DequantOffset = StaticMesh->GetPositionDequantOffset();
+			BatchElement.bCompressedVertex = true;
+			BatchElement.PositionDequantScale = FVector4(DequantScale.X, DequantScale.Y, DequantScale.Z, 0.0f);
+			BatchElement.PositionDequantOffset = FVector4(DequantOffset.X, DequantOffset.Y, DequantOffset.Z, 0.0f);
+		}
 
 		// --- 드로우 데이터 (1번에서 결정된 값 사용) ---
 		BatchElement.IndexCount = IndexCount;
@@ -7,6 +7,12 @@
 #include "Enums.h"
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "MeshletBuilder.h"
+#include "TangentGenerator.h"
+#include "Renderer.h"
+#include "VertexCompression.h"
 #include <filesystem>
 #include <unordered_set>
 
@@ -344,6 +350,12 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 			NewFStaticMesh->CacheFilePath = BinPathFileName;
 
+			// 메쉴릿 없이 저장된 캐시(이전 최적화 OFF 빌드)는 로드 시 보충
+			if (NewFStaticMesh->Meshlets.empty())
+			{
+				FMeshletBuilder::BuildStaticMeshMeshlets(NewFStaticMesh);
+			}
+
 			// 모든 로드가 성공적으로 완료됨
 			bLoadedSuccessfully = true;
 			UE_LOG("Successfully loaded '%s' from cache.", NormalizedPathStr.c_str());
@@ -410,9 +422,27 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 
 		FObjImporter::ConvertToStaticMesh(RawObjInfo, MaterialInfos, NewFStaticMesh);
 
+#ifdef USE_MESH_OPTIMIZATION
+		// 캐시에 기록하기 전에 버텍스 캐시/overdraw/fetch 순서 최적화
+		FMeshOptimizer::OptimizeStaticMesh(NewFStaticMesh);
+#endif // USE_MESH_OPTIMIZATION
+
+		// 삼각형 순서를 그대로 잘라 메쉴릿 생성 (최적화를 거쳤으면 공간적으로 뭉친 클러스터가 됨)
+		FMeshletBuilder::BuildStaticMeshMeshlets(NewFStaticMesh);
+
 		// 캐시 저장 *직전에* 기본 머티리얼 로직을 호출합니다.
 		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
 
+#ifdef USE_STATIC_MESH_LOD
+		// 최적화된 LOD0과 확정된 그룹 정보로부터 LOD 생성 (캐시에 함께 저장됨)
+		FMeshSimplifier::BuildStaticMeshLODs(NewFStaticMesh);
+#endif // USE_STATIC_MESH_LOD
+
+#ifdef USE_COMPRESSED_VERTEX
+		// 정점 순서가 확정된 뒤 압축 (LOD는 LOD0 정점 버퍼를 공유하므로 마지막에 수행)
+		FVertexCompression::CompressStaticMesh(NewFStaticMesh);
+#endif // USE_COMPRESSED_VERTEX
+
 #ifdef USE_OBJ_CACHE
 		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
 		FWindowsBinWriter Writer(BinPathFileName);
@@ -430,11 +460,14 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	{
 		// 캐시 로드에 성공한 경우(bLoadedSuccessfully == true)
 		// 구버전 캐시(기본 머티리얼이 없는)일 수 있으므로, 동일한 검사를 수행합니다.
-		if (EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos))
+		// (플래그를 토글하기 전에 만들어진 캐시는 빌드 옵션 비트마스크가 달라 로드 단계에서 재생성됨)
+		bool bCacheOutdated = EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
+
+		if (bCacheOutdated)
 		{
 #ifdef USE_OBJ_CACHE
 			// 변경된 경우, 캐시를 갱신합니다.
-			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
+			UE_LOG("Updating outdated cache for '%s'.", NormalizedPathStr.c_str());
 			try
 			{
 				FWindowsBinWriter Writer(BinPathFileName);
@@ -446,7 +479,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			}
 			catch (const std::exception& e)
 			{
-				UE_LOG("Failed to update cache for default material: %s", e.what());
+				UE_LOG("Failed to update outdated cache: %s", e.what());
 			}
 #endif // USE_OBJ_CACHE
 		}
@@ -863,44 +896,10 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 {
 	OutStaticMesh->PathFileName = InObjInfo.ObjFileName;
 	uint32 NumDuplicatedVertex = static_cast<uint32>(InObjInfo.PositionIndices.size());
-	TArray<FVector> TangentForVertex;
-	TArray<FVector> BiTangentForVertex;
-	TangentForVertex.SetNum(NumDuplicatedVertex, FVector(0.f, 0.f, 0.f));
-	BiTangentForVertex.SetNum(NumDuplicatedVertex, FVector(0.f, 0.f, 0.f));
-
-	for (uint32 Index = 0; Index < NumDuplicatedVertex; Index += 3)
-	{
-		FVector P0 = InObjInfo.Positions[InObjInfo.PositionIndices[Index]];
-		FVector P1 = InObjInfo.Positions[InObjInfo.PositionIndices[Index + 1]];
-		FVector P2 = InObjInfo.Positions[InObjInfo.PositionIndices[Index + 2]];
-
-		FVector E1 = P1 - P0;
-		FVector E2 = P2 - P0;
-
-		FVector2D UvP0 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index]];
-		FVector2D UvP1 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index + 1]];
-		FVector2D UvP2 = InObjInfo.TexCoords[InObjInfo.TexCoordIndices[Index + 2]];
-
-		float DeltaU1 = UvP1.X - UvP0.X;
-		float DeltaV1 = UvP1.Y - UvP0.Y;
-		float DeltaU2 = UvP2.X - UvP0.X;
-		float DeltaV2 = UvP2.Y - UvP0.Y;
-
-		float DeterminantInv = 1.0f / (DeltaU1 * DeltaV2 - DeltaV1 * DeltaU2);
-
-		FVector Tangent = (E1 * DeltaV2 - E2 * DeltaV1) * DeterminantInv;
-		FVector BiTangent = (-E1 * DeltaU2 + E2 * DeltaU1) * DeterminantInv;
-
-		TangentForVertex[Index] += Tangent;
-		TangentForVertex[Index + 1] += Tangent;
-		TangentForVertex[Index + 2] += Tangent;
-
-		BiTangentForVertex[Index] += BiTangent;
-		BiTangentForVertex[Index + 1] += BiTangent;
-		BiTangentForVertex[Index + 2] += BiTangent;
-	}
 
 	std::unordered_map<VertexKey, uint32, VertexKeyHash> VertexMap;
+	VertexMap.reserve(NumDuplicatedVertex);
+	OutStaticMesh->Indices.reserve(NumDuplicatedVertex);
 
 	for (uint32 CurIndex = 0; CurIndex < NumDuplicatedVertex; ++CurIndex)
 	{
@@ -912,20 +911,12 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		}
 		else
 		{
-			FVector Tangent = TangentForVertex[CurIndex];
-			FVector Normal = InObjInfo.Normals[Key.NormalIndex];
-			FVector BiTangent = BiTangentForVertex[CurIndex];
-
-			Tangent = Tangent - Normal * FVector::Dot(Tangent, Normal);
-			Tangent.Normalize();
-			FVector4 FinalTangent(Tangent.X, Tangent.Y, Tangent.Z);
-			FinalTangent.W = FVector::Dot(FVector::Cross(Tangent, Normal), BiTangent) > 0.0f ? 1.0f : -1.0f;
-
+			// 탄젠트는 용접이 끝난 뒤 FTangentGenerator에서 채움
 			FNormalVertex NormalVertex(
 				InObjInfo.Positions[Key.PosIndex],
-				Normal,
+				InObjInfo.Normals[Key.NormalIndex],
 				InObjInfo.TexCoords[Key.TexIndex],
-				FinalTangent,
+				FVector4(1, 0, 0, 1),
 				FVector4(1, 1, 1, 1)
 			);
 			OutStaticMesh->Vertices.push_back(NormalVertex);
@@ -935,6 +926,15 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		}
 	}
 
+	// 용접된 메시에서 MikkTSpace 호환 탄젠트 생성 (미러링 이음새 정점은 분리되어 뒤에 추가됨)
+	auto TangentTimeStart = std::chrono::high_resolution_clock::now();
+	// 렌더러가 먼저 만들어지므로 렌더러의 워커 풀을 빌려 씀 (없으면 단일 스레드)
+	FTaskPool* TaskPool = GEngine.GetRenderer() ? GEngine.GetRenderer()->GetTaskPool() : nullptr;
+	uint32 SplitVertexCount = FTangentGenerator::GenerateTangents(OutStaticMesh->Vertices, OutStaticMesh->Indices, TaskPool);
+	std::chrono::duration<double, std::milli> TangentTimeMs = std::chrono::high_resolution_clock::now() - TangentTimeStart;
+	UE_LOG("[ObjImporter] %s: tangents for %zu vertices (%u split at mirrored UV seams) in %.2f ms",
+		InObjInfo.ObjFileName.c_str(), OutStaticMesh->Vertices.size(), SplitVertexCount, TangentTimeMs.count());
+
 	// bHasMtl 체크를 제거하거나 bHasMaterial = true로 설정 (이후 로더에서 기본값을 주입할 것이므로)
 	OutStaticMesh->bHasMaterial = true;
 
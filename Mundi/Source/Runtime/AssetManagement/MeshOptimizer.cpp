@@ -0,0 +1,487 @@
+﻿#include "pch.h"
+#include "MeshOptimizer.h"
+
+namespace
+{
+	// Forsyth 점수 계산용 상수 (Tom Forsyth, "Linear-Speed Vertex Cache Optimisation")
+	constexpr uint32 ForsythCacheSize = 32;
+	constexpr float CacheDecayPower = 1.5f;
+	constexpr float LastTriScore = 0.75f;
+	constexpr float ValenceBoostScale = 2.0f;
+	constexpr float ValenceBoostPower = 0.5f;
+
+	float ComputeVertexScore(int32 CachePosition, uint32 RemainingValence)
+	{
+		// 더 이상 사용할 삼각형이 없는 정점은 선택 대상이 아님
+		if (RemainingValence == 0)
+		{
+			return -1.0f;
+		}
+
+		float Score = 0.0f;
+		if (CachePosition >= 0)
+		{
+			if (CachePosition < 3)
+			{
+				// 직전 삼각형의 정점은 일부러 낮은 고정 점수를 줘서 strip 형태로 흐르지 않게 함
+				Score = LastTriScore;
+			}
+			else
+			{
+				const float Scaler = 1.0f / static_cast<float>(ForsythCacheSize - 3);
+				Score = std::pow(1.0f - static_cast<float>(CachePosition - 3) * Scaler, CacheDecayPower);
+			}
+		}
+
+		// 남은 삼각형이 적은 정점을 우선 처리해서 고립된 삼각형이 뒤에 남지 않게 함
+		Score += ValenceBoostScale * std::pow(static_cast<float>(RemainingValence), -ValenceBoostPower);
+		return Score;
+	}
+
+	// FIFO 캐시 시뮬레이션. 타임스탬프 차이로 캐시 적중 여부를 판단하므로 큐를 실제로 유지할 필요가 없음
+	uint32 UpdateFifoCache(uint32 A, uint32 B, uint32 C, uint32 CacheSize, TArray<uint32>& CacheTimestamps, uint32& Timestamp)
+	{
+		uint32 Misses = 0;
+		const uint32 Verts[3] = { A, B, C };
+		for (uint32 Vertex : Verts)
+		{
+			if (Timestamp - CacheTimestamps[Vertex] > CacheSize)
+			{
+				CacheTimestamps[Vertex] = Timestamp++;
+				++Misses;
+			}
+		}
+		return Misses;
+	}
+}
+
+void FMeshOptimizer::OptimizeVertexCache(uint32* InOutIndices, uint32 IndexCount, uint32 VertexCount)
+{
+	const uint32 TriCount = IndexCount / 3;
+	if (!InOutIndices || TriCount == 0 || VertexCount == 0)
+	{
+		return;
+	}
+
+	// 1. 정점 → 인접 삼각형 목록 (CSR 형태)
+	TArray<uint32> AdjOffsets(VertexCount + 1, 0);
+	for (uint32 i = 0; i < TriCount * 3; ++i)
+	{
+		++AdjOffsets[InOutIndices[i] + 1];
+	}
+	for (uint32 v = 0; v < VertexCount; ++v)
+	{
+		AdjOffsets[v + 1] += AdjOffsets[v];
+	}
+
+	TArray<uint32> AdjTriangles(TriCount * 3);
+	TArray<uint32> Remaining(VertexCount, 0); // 아직 출력되지 않은 인접 삼각형 수
+	for (uint32 Tri = 0; Tri < TriCount; ++Tri)
+	{
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			const uint32 Vertex = InOutIndices[Tri * 3 + k];
+			AdjTriangles[AdjOffsets[Vertex] + Remaining[Vertex]++] = Tri;
+		}
+	}
+
+	// 2. 초기 점수
+	TArray<int32> CachePosition(VertexCount, -1);
+	TArray<float> VertexScore(VertexCount);
+	for (uint32 v = 0; v < VertexCount; ++v)
+	{
+		VertexScore[v] = ComputeVertexScore(-1, Remaining[v]);
+	}
+
+	TArray<float> TriScore(TriCount);
+	TArray<uint8> bEmitted(TriCount, 0);
+	int64 BestTri = -1;
+	float BestScore = -1.0f;
+	for (uint32 Tri = 0; Tri < TriCount; ++Tri)
+	{
+		const uint32* T = &InOutIndices[Tri * 3];
+		TriScore[Tri] = VertexScore[T[0]] + VertexScore[T[1]] + VertexScore[T[2]];
+		if (TriScore[Tri] > BestScore)
+		{
+			BestScore = TriScore[Tri];
+			BestTri = Tri;
+		}
+	}
+
+	// 3. 점수가 가장 높은 삼각형을 반복해서 출력
+	TArray<uint32> Output;
+	Output.Reserve(TriCount * 3);
+
+	uint32 Cache[ForsythCacheSize + 3];
+	uint32 CacheCount = 0;
+	uint32 ScanCursor = 0;
+
+	for (uint32 EmittedCount = 0; EmittedCount < TriCount; ++EmittedCount)
+	{
+		if (BestTri < 0)
+		{
+			// 캐시 안에 후보가 없으면 아직 출력되지 않은 삼각형 중 아무거나 선택
+			while (ScanCursor < TriCount && bEmitted[ScanCursor])
+			{
+				++ScanCursor;
+			}
+			if (ScanCursor == TriCount)
+			{
+				break;
+			}
+			BestTri = ScanCursor;
+		}
+
+		const uint32 Tri = static_cast<uint32>(BestTri);
+		const uint32 TriVerts[3] = { InOutIndices[Tri * 3], InOutIndices[Tri * 3 + 1], InOutIndices[Tri * 3 + 2] };
+		bEmitted[Tri] = 1;
+		Output.Add(TriVerts[0]);
+		Output.Add(TriVerts[1]);
+		Output.Add(TriVerts[2]);
+
+		// 출력한 삼각형을 각 정점의 활성 인접 목록에서 제거 (swap-remove)
+		uint32 NewCache[ForsythCacheSize + 3];
+		uint32 NewCount = 0;
+		for (uint32 Vertex : TriVerts)
+		{
+			uint32* Adj = &AdjTriangles[AdjOffsets[Vertex]];
+			for (uint32 i = 0; i < Remaining[Vertex]; ++i)
+			{
+				if (Adj[i] == Tri)
+				{
+					Adj[i] = Adj[Remaining[Vertex] - 1];
+					--Remaining[Vertex];
+					break;
+				}
+			}
+
+			// 퇴화 삼각형(같은 정점 중복)은 캐시에 한 번만 넣음
+			bool bAlreadyAdded = false;
+			for (uint32 i = 0; i < NewCount; ++i)
+			{
+				bAlreadyAdded |= (NewCache[i] == Vertex);
+			}
+			if (!bAlreadyAdded)
+			{
+				NewCache[NewCount++] = Vertex;
+			}
+		}
+
+		// 기존 캐시 정점은 뒤로 밀림 (LRU)
+		const uint32 TriVertCount = NewCount;
+		for (uint32 i = 0; i < CacheCount; ++i)
+		{
+			const uint32 Vertex = Cache[i];
+			bool bInTriangle = false;
+			for (uint32 k = 0; k < TriVertCount; ++k)
+			{
+				bInTriangle |= (NewCache[k] == Vertex);
+			}
+			if (!bInTriangle)
+			{
+				NewCache[NewCount++] = Vertex;
+			}
+		}
+
+		// 캐시 위치가 바뀐 정점들의 점수를 갱신하고, 변화량을 인접 삼각형 점수에 반영
+		for (uint32 i = 0; i < NewCount; ++i)
+		{
+			const uint32 Vertex = NewCache[i];
+			CachePosition[Vertex] = (i < ForsythCacheSize) ? static_cast<int32>(i) : -1;
+
+			const float NewScore = ComputeVertexScore(CachePosition[Vertex], Remaining[Vertex]);
+			const float Delta = NewScore - VertexScore[Vertex];
+			VertexScore[Vertex] = NewScore;
+
+			const uint32* Adj = &AdjTriangles[AdjOffsets[Vertex]];
+			for (uint32 a = 0; a < Remaining[Vertex]; ++a)
+			{
+				TriScore[Adj[a]] += Delta;
+			}
+		}
+
+		// 다음 후보는 캐시에 남아있는 정점의 인접 삼각형 중에서만 고름
+		BestTri = -1;
+		BestScore = -1.0f;
+		CacheCount = std::min(NewCount, ForsythCacheSize);
+		for (uint32 i = 0; i < CacheCount; ++i)
+		{
+			const uint32 Vertex = NewCache[i];
+			Cache[i] = Vertex;
+
+			const uint32* Adj = &AdjTriangles[AdjOffsets[Vertex]];
+			for (uint32 a = 0; a < Remaining[Vertex]; ++a)
+			{
+				if (TriScore[Adj[a]] > BestScore)
+				{
+					BestScore = TriScore[Adj[a]];
+					BestTri = Adj[a];
+				}
+			}
+		}
+	}
+
+	std::copy(Output.begin(), Output.end(), InOutIndices);
+}
+
+void FMeshOptimizer::OptimizeOverdraw(uint32* InOutIndices, uint32 IndexCount, const TArray<FNormalVertex>& Vertices, float Threshold)
+{
+	const uint32 TriCount = IndexCount / 3;
+	const uint32 VertexCount = static_cast<uint32>(Vertices.size());
+	if (!InOutIndices || TriCount < 2 || VertexCount == 0)
+	{
+		return;
+	}
+
+	TArray<uint32> CacheTimestamps(VertexCount, 0);
+	uint32 Timestamp = DefaultCacheSize + 1;
+
+	// 1. Hard boundary: 세 정점이 모두 캐시 미스인 삼각형은 새 패치의 시작으로 간주
+	TArray<uint32> HardClusters;
+	for (uint32 Tri = 0; Tri < TriCount; ++Tri)
+	{
+		const uint32* T = &InOutIndices[Tri * 3];
+		const uint32 Misses = UpdateFifoCache(T[0], T[1], T[2], DefaultCacheSize, CacheTimestamps, Timestamp);
+		if (Tri == 0 || Misses == 3)
+		{
+			HardClusters.Add(Tri);
+		}
+	}
+
+	// 2. Soft boundary: 클러스터 ACMR이 Threshold 배 이내로 유지되는 지점마다 더 잘게 자름
+	TArray<uint32> Clusters;
+	for (int32 c = 0; c < HardClusters.Num(); ++c)
+	{
+		const uint32 Start = HardClusters[c];
+		const uint32 End = (c + 1 < HardClusters.Num()) ? HardClusters[c + 1] : TriCount;
+
+		Timestamp += DefaultCacheSize + 1;
+		uint32 ClusterMisses = 0;
+		for (uint32 Tri = Start; Tri < End; ++Tri)
+		{
+			const uint32* T = &InOutIndices[Tri * 3];
+			ClusterMisses += UpdateFifoCache(T[0], T[1], T[2], DefaultCacheSize, CacheTimestamps, Timestamp);
+		}
+		const float ClusterThreshold = Threshold * static_cast<float>(ClusterMisses) / static_cast<float>(End - Start);
+
+		Clusters.Add(Start);
+		Timestamp += DefaultCacheSize + 1;
+		uint32 RunningMisses = 0;
+		uint32 RunningTris = 0;
+		for (uint32 Tri = Start; Tri < End; ++Tri)
+		{
+			const uint32* T = &InOutIndices[Tri * 3];
+			RunningMisses += UpdateFifoCache(T[0], T[1], T[2], DefaultCacheSize, CacheTimestamps, Timestamp);
+			++RunningTris;
+
+			if (Tri + 1 < End && static_cast<float>(RunningMisses) <= ClusterThreshold * static_cast<float>(RunningTris))
+			{
+				// 목표 ACMR에 도달했으므로 다음 삼각형부터 새 클러스터 시작 (캐시도 비운 것으로 간주)
+				Clusters.Add(Tri + 1);
+				Timestamp += DefaultCacheSize + 1;
+				RunningMisses = 0;
+				RunningTris = 0;
+			}
+		}
+	}
+
+	if (Clusters.Num() < 2)
+	{
+		return;
+	}
+
+	// 3. 클러스터별 중심/법선 계산
+	// 법선은 와인딩 규약에 의존하지 않도록 정점 법선을 면적 가중 합산해서 사용
+	struct FClusterSortData
+	{
+		uint32 Start;
+		uint32 End;
+		FVector Centroid;
+		FVector Normal;
+		float Area;
+		float SortKey;
+	};
+
+	TArray<FClusterSortData> ClusterData;
+	ClusterData.Reserve(Clusters.Num());
+
+	FVector MeshCentroid(0.0f, 0.0f, 0.0f);
+	float MeshArea = 0.0f;
+
+	for (int32 c = 0; c < Clusters.Num(); ++c)
+	{
+		FClusterSortData Data;
+		Data.Start = Clusters[c];
+		Data.End = (c + 1 < Clusters.Num()) ? Clusters[c + 1] : TriCount;
+		Data.Centroid = FVector(0.0f, 0.0f, 0.0f);
+		Data.Normal = FVector(0.0f, 0.0f, 0.0f);
+		Data.Area = 0.0f;
+		Data.SortKey = 0.0f;
+
+		for (uint32 Tri = Data.Start; Tri < Data.End; ++Tri)
+		{
+			const FNormalVertex& V0 = Vertices[InOutIndices[Tri * 3]];
+			const FNormalVertex& V1 = Vertices[InOutIndices[Tri * 3 + 1]];
+			const FNormalVertex& V2 = Vertices[InOutIndices[Tri * 3 + 2]];
+
+			const float Area = FVector::Cross(V1.pos - V0.pos, V2.pos - V0.pos).Size() * 0.5f;
+			Data.Centroid += (V0.pos + V1.pos + V2.pos) * (Area / 3.0f);
+			Data.Normal += (V0.normal + V1.normal + V2.normal) * Area;
+			Data.Area += Area;
+		}
+
+		MeshCentroid += Data.Centroid;
+		MeshArea += Data.Area;
+
+		if (Data.Area > 0.0f)
+		{
+			Data.Centroid = Data.Centroid * (1.0f / Data.Area);
+		}
+		ClusterData.Add(Data);
+	}
+
+	if (MeshArea > 0.0f)
+	{
+		MeshCentroid = MeshCentroid * (1.0f / MeshArea);
+	}
+
+	// 4. 메쉬 중심에서 바깥쪽을 향하는 클러스터(가리는 쪽)를 먼저 그림
+	for (FClusterSortData& Data : ClusterData)
+	{
+		const float NormalLength = Data.Normal.Size();
+		if (NormalLength > KINDA_SMALL_NUMBER)
+		{
+			Data.SortKey = FVector::Dot(Data.Centroid - MeshCentroid, Data.Normal * (1.0f / NormalLength));
+		}
+	}
+
+	std::stable_sort(ClusterData.begin(), ClusterData.end(),
+		[](const FClusterSortData& A, const FClusterSortData& B) { return A.SortKey > B.SortKey; });
+
+	TArray<uint32> Output;
+	Output.Reserve(TriCount * 3);
+	for (const FClusterSortData& Data : ClusterData)
+	{
+		Output.insert(Output.end(), InOutIndices + Data.Start * 3, InOutIndices + Data.End * 3);
+	}
+
+	std::copy(Output.begin(), Output.end(), InOutIndices);
+}
+
+void FMeshOptimizer::OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices)
+{
+	const uint32 VertexCount = static_cast<uint32>(InOutVertices.size());
+	if (VertexCount == 0 || InOutIndices.empty())
+	{
+		return;
+	}
+
+	// 인덱스 버퍼에서 처음 등장하는 순서대로 정점 번호를 다시 매김 (참조되지 않는 정점은 제거됨)
+	constexpr uint32 Unassigned = ~0u;
+	TArray<uint32> Remap(VertexCount, Unassigned);
+	uint32 NextVertex = 0;
+
+	for (uint32& Index : InOutIndices)
+	{
+		if (Remap[Index] == Unassigned)
+		{
+			Remap[Index] = NextVertex++;
+		}
+		Index = Remap[Index];
+	}
+
+	TArray<FNormalVertex> NewVertices(NextVertex);
+	for (uint32 v = 0; v < VertexCount; ++v)
+	{
+		if (Remap[v] != Unassigned)
+		{
+			NewVertices[Remap[v]] = InOutVertices[v];
+		}
+	}
+
+	InOutVertices = std::move(NewVertices);
+}
+
+FVertexCacheStats FMeshOptimizer::AnalyzeVertexCache(const uint32* Indices, uint32 IndexCount, uint32 VertexCount, uint32 CacheSize)
+{
+	FVertexCacheStats Stats;
+	const uint32 TriCount = IndexCount / 3;
+	if (!Indices || TriCount == 0 || VertexCount == 0)
+	{
+		return Stats;
+	}
+
+	TArray<uint32> CacheTimestamps(VertexCount, 0);
+	TArray<uint8> bReferenced(VertexCount, 0);
+	uint32 Timestamp = CacheSize + 1;
+
+	for (uint32 Tri = 0; Tri < TriCount; ++Tri)
+	{
+		const uint32* T = &Indices[Tri * 3];
+		Stats.VerticesTransformed += UpdateFifoCache(T[0], T[1], T[2], CacheSize, CacheTimestamps, Timestamp);
+
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			if (!bReferenced[T[k]])
+			{
+				bReferenced[T[k]] = 1;
+				++Stats.UniqueVertexCount;
+			}
+		}
+	}
+
+	Stats.TriangleCount = TriCount;
+	Stats.ACMR = static_cast<float>(Stats.VerticesTransformed) / static_cast<float>(TriCount);
+	Stats.ATVR = (Stats.UniqueVertexCount > 0) ? static_cast<float>(Stats.VerticesTransformed) / static_cast<float>(Stats.UniqueVertexCount) : 0.0f;
+	return Stats;
+}
+
+void FMeshOptimizer::OptimizeStaticMesh(FStaticMesh* InOutStaticMesh, bool bOptimizeOverdraw)
+{
+	if (!InOutStaticMesh || InOutStaticMesh->Vertices.empty() || InOutStaticMesh->Indices.empty())
+	{
+		return;
+	}
+
+	TArray<FNormalVertex>& Vertices = InOutStaticMesh->Vertices;
+	TArray<uint32>& Indices = InOutStaticMesh->Indices;
+	const uint32 VertexCount = static_cast<uint32>(Vertices.size());
+	const uint32 IndexCount = static_cast<uint32>(Indices.size());
+
+	const FVertexCacheStats Before = AnalyzeVertexCache(Indices.data(), IndexCount, VertexCount);
+
+	// 머티리얼 그룹 경계를 넘지 않도록 그룹 단위로 삼각형 순서를 재배치
+	auto OptimizeRange = [&](uint32 Start, uint32 Count)
+		{
+			if (Start >= IndexCount)
+			{
+				return;
+			}
+			Count = std::min(Count, IndexCount - Start);
+			OptimizeVertexCache(&Indices[Start], Count, VertexCount);
+			if (bOptimizeOverdraw)
+			{
+				OptimizeOverdraw(&Indices[Start], Count, Vertices);
+			}
+		};
+
+	if (InOutStaticMesh->GroupInfos.empty())
+	{
+		OptimizeRange(0, IndexCount);
+	}
+	else
+	{
+		for (const FGroupInfo& Group : InOutStaticMesh->GroupInfos)
+		{
+			OptimizeRange(Group.StartIndex, Group.IndexCount);
+		}
+	}
+
+	// 인덱스 순서가 확정된 뒤 정점 버퍼를 재배치 (인덱스 값만 바뀌므로 그룹 범위는 그대로 유효)
+	OptimizeVertexFetch(Vertices, Indices);
+
+	const FVertexCacheStats After = AnalyzeVertexCache(Indices.data(), IndexCount, static_cast<uint32>(Vertices.size()));
+
+	UE_LOG("[MeshOptimizer] %s: %u tris, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+		InOutStaticMesh->PathFileName.c_str(), After.TriangleCount, Before.ACMR, After.ACMR, Before.ATVR, After.ATVR);
+}
@@ -0,0 +1,43 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+
+// 버텍스 캐시 효율 측정 결과
+struct FVertexCacheStats
+{
+	uint32 VerticesTransformed = 0; // 시뮬레이션된 캐시 미스 수 (= 버텍스 셰이더 실행 횟수)
+	uint32 TriangleCount = 0;
+	uint32 UniqueVertexCount = 0;   // 인덱스가 참조하는 고유 정점 수
+
+	// Average Cache Miss Ratio: 삼각형당 버텍스 셰이더 실행 수 (0.5 ~ 3.0, 낮을수록 좋음)
+	float ACMR = 0.0f;
+	// Average Transformed Vertex Ratio: 고유 정점당 실행 수 (1.0이 이상적)
+	float ATVR = 0.0f;
+};
+
+/**
+ * 임포트 시점에 수행하는 CPU 메쉬 최적화 모음.
+ * 1) OptimizeVertexCache: Forsyth 알고리즘으로 삼각형 순서를 post-transform 캐시 친화적으로 재배치
+ * 2) OptimizeOverdraw: 캐시 효율을 크게 해치지 않는 선에서 클러스터 단위로 바깥쪽 면을 먼저 그리도록 정렬
+ * 3) OptimizeVertexFetch: 인덱스 첫 등장 순서대로 정점 버퍼를 재배치 (pre-transform 캐시/메모리 지역성)
+ * 모든 함수는 머티리얼 그룹(FGroupInfo) 범위를 보존합니다.
+ */
+struct FMeshOptimizer
+{
+	// 캐시 효율 측정에 사용하는 FIFO 캐시 크기 (일반적인 GPU post-transform 캐시 근사값)
+	static constexpr uint32 DefaultCacheSize = 16;
+
+	// Overdraw 정렬 시 허용하는 ACMR 악화 비율 (1.05 = 5%)
+	static constexpr float DefaultOverdrawThreshold = 1.05f;
+
+	static void OptimizeVertexCache(uint32* InOutIndices, uint32 IndexCount, uint32 VertexCount);
+
+	static void OptimizeOverdraw(uint32* InOutIndices, uint32 IndexCount, const TArray<FNormalVertex>& Vertices, float Threshold = DefaultOverdrawThreshold);
+
+	static void OptimizeVertexFetch(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices);
+
+	static FVertexCacheStats AnalyzeVertexCache(const uint32* Indices, uint32 IndexCount, uint32 VertexCount, uint32 CacheSize = DefaultCacheSize);
+
+	// 그룹별 캐시/overdraw 최적화 후 전체 fetch 최적화까지 수행하고 전후 지표를 로그로 남깁니다.
+	static void OptimizeStaticMesh(FStaticMesh* InOutStaticMesh, bool bOptimizeOverdraw = true);
+};
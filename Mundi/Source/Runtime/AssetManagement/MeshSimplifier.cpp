@@ -0,0 +1,797 @@
+﻿#include "pch.h"
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include "StaticMesh.h"
+#include "ResourceManager.h"
+
+namespace
+{
+	// 대칭 4x4 행렬을 10개 계수로 저장한 quadric. 누적 오차가 커지므로 double 사용
+	struct FQuadric
+	{
+		double A00 = 0.0, A11 = 0.0, A22 = 0.0;
+		double A10 = 0.0, A20 = 0.0, A21 = 0.0;
+		double B0 = 0.0, B1 = 0.0, B2 = 0.0;
+		double C = 0.0;
+		double Weight = 0.0; // 누적 면적 (오차를 거리 단위로 정규화할 때 사용)
+
+		// 평면 (N·P + D = 0) 까지의 거리 제곱을 Weight 가중치로 누적
+		void AddPlane(const FVector& N, double D, double InWeight)
+		{
+			const double X = N.X, Y = N.Y, Z = N.Z;
+			A00 += InWeight * X * X; A11 += InWeight * Y * Y; A22 += InWeight * Z * Z;
+			A10 += InWeight * X * Y; A20 += InWeight * X * Z; A21 += InWeight * Y * Z;
+			B0 += InWeight * X * D;  B1 += InWeight * Y * D;  B2 += InWeight * Z * D;
+			C += InWeight * D * D;
+			Weight += InWeight;
+		}
+
+		void Add(const FQuadric& Other)
+		{
+			A00 += Other.A00; A11 += Other.A11; A22 += Other.A22;
+			A10 += Other.A10; A20 += Other.A20; A21 += Other.A21;
+			B0 += Other.B0; B1 += Other.B1; B2 += Other.B2;
+			C += Other.C;
+			Weight += Other.Weight;
+		}
+
+		// P^T A P + 2 B·P + C
+		double Evaluate(const FVector& P) const
+		{
+			const double X = P.X, Y = P.Y, Z = P.Z;
+			const double Result =
+				A00 * X * X + A11 * Y * Y + A22 * Z * Z +
+				2.0 * (A10 * X * Y + A20 * X * Z + A21 * Y * Z) +
+				2.0 * (B0 * X + B1 * Y + B2 * Z) + C;
+			return std::fabs(Result);
+		}
+	};
+
+	struct FCollapse
+	{
+		uint32 Source;
+		uint32 Target;
+		float Error; // 메시 크기 대비 상대 오차
+	};
+
+	uint64 MakeEdgeKey(uint32 A, uint32 B)
+	{
+		return A < B ? (static_cast<uint64>(A) << 32) | B : (static_cast<uint64>(B) << 32) | A;
+	}
+
+	FVector TriangleNormal(const FVector& P0, const FVector& P1, const FVector& P2)
+	{
+		return FVector::Cross(P1 - P0, P2 - P0);
+	}
+
+	// 위치가 완전히 같은 정점들을 하나의 대표 인덱스로 묶음 (UV/노멀만 다른 seam 정점 탐지용)
+	void BuildPositionRemap(const TArray<FNormalVertex>& Vertices, TArray<uint32>& OutRemap)
+	{
+		struct FPositionHash
+		{
+			size_t operator()(const FVector& P) const
+			{
+				uint32 Bits[3];
+				std::memcpy(Bits, &P.X, sizeof(Bits));
+				return (Bits[0] * 73856093u) ^ (Bits[1] * 19349663u) ^ (Bits[2] * 83492791u);
+			}
+		};
+		struct FPositionEqual
+		{
+			bool operator()(const FVector& A, const FVector& B) const
+			{
+				return A.X == B.X && A.Y == B.Y && A.Z == B.Z;
+			}
+		};
+
+		const uint32 VertexCount = static_cast<uint32>(Vertices.size());
+		OutRemap.resize(VertexCount);
+
+		std::unordered_map<FVector, uint32, FPositionHash, FPositionEqual> FirstByPosition;
+		FirstByPosition.reserve(VertexCount);
+		for (uint32 v = 0; v < VertexCount; ++v)
+		{
+			auto Result = FirstByPosition.emplace(Vertices[v].pos, v);
+			OutRemap[v] = Result.first->second;
+		}
+	}
+
+	// --- 자체 검사용 합성 메시 / 거리 측정 ---
+
+	// XY 평면 격자. Amplitude > 0이면 높이맵처럼 굴곡을 줌 (경계는 열린 상태라 잠김)
+	void MakeTestGrid(uint32 Size, float Amplitude, TArray<FNormalVertex>& OutVertices, TArray<uint32>& OutIndices)
+	{
+		OutVertices.clear();
+		OutIndices.clear();
+		for (uint32 y = 0; y <= Size; ++y)
+		{
+			for (uint32 x = 0; x <= Size; ++x)
+			{
+				const float U = static_cast<float>(x) / Size;
+				const float V = static_cast<float>(y) / Size;
+				FNormalVertex Vertex = {};
+				Vertex.pos = FVector(U, V, Amplitude * std::sin(U * 6.0f) * std::cos(V * 4.0f));
+				Vertex.tex = FVector2D(U, V);
+				OutVertices.push_back(Vertex);
+			}
+		}
+		for (uint32 y = 0; y < Size; ++y)
+		{
+			for (uint32 x = 0; x < Size; ++x)
+			{
+				const uint32 I0 = y * (Size + 1) + x;
+				const uint32 I1 = I0 + 1;
+				const uint32 I2 = I0 + Size + 1;
+				const uint32 I3 = I2 + 1;
+				OutIndices.insert(OutIndices.end(), { I0, I1, I3, I0, I3, I2 });
+			}
+		}
+	}
+
+	// 닫힌 UV 구 (seam 없이 정점을 공유하므로 잠긴 정점이 없음)
+	void MakeTestSphere(uint32 Rings, uint32 Segments, TArray<FNormalVertex>& OutVertices, TArray<uint32>& OutIndices)
+	{
+		OutVertices.clear();
+		OutIndices.clear();
+
+		FNormalVertex Pole = {};
+		Pole.pos = FVector(0.0f, 0.0f, 1.0f);
+		OutVertices.push_back(Pole);
+		for (uint32 r = 1; r < Rings; ++r)
+		{
+			const float Theta = PI * r / Rings;
+			for (uint32 s = 0; s < Segments; ++s)
+			{
+				const float Phi = 2.0f * PI * s / Segments;
+				FNormalVertex Vertex = {};
+				Vertex.pos = FVector(std::sin(Theta) * std::cos(Phi), std::sin(Theta) * std::sin(Phi), std::cos(Theta));
+				OutVertices.push_back(Vertex);
+			}
+		}
+		Pole.pos = FVector(0.0f, 0.0f, -1.0f);
+		OutVertices.push_back(Pole);
+
+		const uint32 SouthPole = static_cast<uint32>(OutVertices.size()) - 1;
+		auto Ring = [Segments](uint32 r, uint32 s) { return 1 + (r - 1) * Segments + s % Segments; };
+		for (uint32 s = 0; s < Segments; ++s)
+		{
+			OutIndices.insert(OutIndices.end(), { 0, Ring(1, s), Ring(1, s + 1) });
+			for (uint32 r = 1; r + 1 < Rings; ++r)
+			{
+				OutIndices.insert(OutIndices.end(), { Ring(r, s), Ring(r + 1, s), Ring(r + 1, s + 1) });
+				OutIndices.insert(OutIndices.end(), { Ring(r, s), Ring(r + 1, s + 1), Ring(r, s + 1) });
+			}
+			OutIndices.insert(OutIndices.end(), { SouthPole, Ring(Rings - 1, s + 1), Ring(Rings - 1, s) });
+		}
+	}
+
+	// 점 P에서 삼각형 ABC까지의 최단 거리 제곱 (Ericson, Real-Time Collision Detection 5.1.5)
+	float PointTriangleDistanceSquared(const FVector& P, const FVector& A, const FVector& B, const FVector& C)
+	{
+		const FVector AB = B - A, AC = C - A, AP = P - A;
+		const float D1 = FVector::Dot(AB, AP), D2 = FVector::Dot(AC, AP);
+		if (D1 <= 0.0f && D2 <= 0.0f) return AP.SizeSquared();
+
+		const FVector BP = P - B;
+		const float D3 = FVector::Dot(AB, BP), D4 = FVector::Dot(AC, BP);
+		if (D3 >= 0.0f && D4 <= D3) return BP.SizeSquared();
+
+		const float VC = D1 * D4 - D3 * D2;
+		if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+		{
+			return (AP - AB * (D1 / (D1 - D3))).SizeSquared();
+		}
+
+		const FVector CP = P - C;
+		const float D5 = FVector::Dot(AB, CP), D6 = FVector::Dot(AC, CP);
+		if (D6 >= 0.0f && D5 <= D6) return CP.SizeSquared();
+
+		const float VB = D5 * D2 - D1 * D6;
+		if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+		{
+			return (AP - AC * (D2 / (D2 - D6))).SizeSquared();
+		}
+
+		const float VA = D3 * D6 - D5 * D4;
+		if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+		{
+			return (BP - (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6)))).SizeSquared();
+		}
+
+		const float Denom = 1.0f / (VA + VB + VC);
+		const FVector Closest = A + AB * (VB * Denom) + AC * (VC * Denom);
+		return (P - Closest).SizeSquared();
+	}
+
+	// 원본이 쓰던 정점에서 단순화된 표면까지의 최대 거리 (메시 크기 대비 비율)
+	// 정점 x 삼각형 전수 비교라 큰 메시는 MaxSamples 개까지 일정 간격으로 표본 추출
+	float MeasureSurfaceError(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& SourceIndices, const uint32* LODIndices, uint32 LODIndexCount,
+		uint32 MaxSamples = UINT32_MAX)
+	{
+		TArray<uint8> bUsed(Vertices.size(), 0);
+		TArray<uint32> Samples;
+		for (uint32 Index : SourceIndices)
+		{
+			if (!bUsed[Index])
+			{
+				bUsed[Index] = 1;
+				Samples.push_back(Index);
+			}
+		}
+
+		const uint32 SampleCount = static_cast<uint32>(Samples.size());
+		const uint32 Stride = MaxSamples == 0 ? 1 : std::max(1u, (SampleCount + MaxSamples - 1) / MaxSamples);
+		float MaxDistanceSquared = 0.0f;
+		for (uint32 s = 0; s < SampleCount; s += Stride)
+		{
+			const uint32 v = Samples[s];
+			float Best = FLT_MAX;
+			for (uint32 i = 0; i + 2 < LODIndexCount && Best > 0.0f; i += 3)
+			{
+				Best = std::min(Best, PointTriangleDistanceSquared(Vertices[v].pos,
+					Vertices[LODIndices[i]].pos, Vertices[LODIndices[i + 1]].pos, Vertices[LODIndices[i + 2]].pos));
+			}
+			MaxDistanceSquared = std::max(MaxDistanceSquared, Best);
+		}
+		return std::sqrt(MaxDistanceSquared) / FMeshSimplifier::ComputeMeshScale(Vertices);
+	}
+}
+
+float FMeshSimplifier::ComputeMeshScale(const TArray<FNormalVertex>& Vertices)
+{
+	if (Vertices.empty())
+	{
+		return 0.0f;
+	}
+
+	FVector Min = Vertices[0].pos;
+	FVector Max = Vertices[0].pos;
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		Min = Min.ComponentMin(Vertex.pos);
+		Max = Max.ComponentMax(Vertex.pos);
+	}
+	return (Max - Min).Size();
+}
+
+uint32 FMeshSimplifier::Simplify(uint32* OutIndices, const uint32* Indices, uint32 IndexCount, const TArray<FNormalVertex>& Vertices,
+	uint32 TargetIndexCount, float TargetError, float* OutError)
+{
+	if (OutError)
+	{
+		*OutError = 0.0f;
+	}
+
+	const uint32 VertexCount = static_cast<uint32>(Vertices.size());
+	IndexCount -= IndexCount % 3;
+	if (!OutIndices || !Indices || IndexCount == 0 || VertexCount == 0)
+	{
+		return 0;
+	}
+
+	if (OutIndices != Indices)
+	{
+		std::memcpy(OutIndices, Indices, sizeof(uint32) * IndexCount);
+	}
+	if (IndexCount <= TargetIndexCount)
+	{
+		return IndexCount;
+	}
+
+	const float MeshScale = ComputeMeshScale(Vertices);
+	if (MeshScale <= KINDA_SMALL_NUMBER)
+	{
+		return IndexCount;
+	}
+	const double InvScale = 1.0 / MeshScale;
+
+	// 1. 잠금 정점 분류: seam(같은 위치에 다른 인덱스가 있음) + border/non-manifold edge 끝점
+	TArray<uint32> PositionRemap;
+	BuildPositionRemap(Vertices, PositionRemap);
+
+	TArray<uint32> IndicesPerPosition(VertexCount, 0);
+	TArray<uint8> bUsed(VertexCount, 0);
+	for (uint32 i = 0; i < IndexCount; ++i)
+	{
+		const uint32 Vertex = OutIndices[i];
+		if (!bUsed[Vertex])
+		{
+			bUsed[Vertex] = 1;
+			++IndicesPerPosition[PositionRemap[Vertex]];
+		}
+	}
+
+	std::unordered_map<uint64, uint32> EdgeUseCount;
+	EdgeUseCount.reserve(IndexCount);
+	for (uint32 i = 0; i < IndexCount; i += 3)
+	{
+		for (uint32 e = 0; e < 3; ++e)
+		{
+			const uint32 A = PositionRemap[OutIndices[i + e]];
+			const uint32 B = PositionRemap[OutIndices[i + (e + 1) % 3]];
+			if (A != B)
+			{
+				++EdgeUseCount[MakeEdgeKey(A, B)];
+			}
+		}
+	}
+
+	TArray<uint8> bLockedPosition(VertexCount, 0);
+	for (const auto& Pair : EdgeUseCount)
+	{
+		if (Pair.second != 2)
+		{
+			bLockedPosition[static_cast<uint32>(Pair.first >> 32)] = 1;
+			bLockedPosition[static_cast<uint32>(Pair.first & 0xFFFFFFFFu)] = 1;
+		}
+	}
+
+	TArray<uint8> bLocked(VertexCount, 0);
+	for (uint32 v = 0; v < VertexCount; ++v)
+	{
+		const uint32 Position = PositionRemap[v];
+		bLocked[v] = (IndicesPerPosition[Position] > 1 || bLockedPosition[Position]) ? 1 : 0;
+	}
+
+	// 2. 정점별 quadric 초기화 (면적 가중 평면)
+	TArray<FQuadric> Quadrics(VertexCount);
+	for (uint32 i = 0; i < IndexCount; i += 3)
+	{
+		const FVector& P0 = Vertices[OutIndices[i + 0]].pos;
+		const FVector& P1 = Vertices[OutIndices[i + 1]].pos;
+		const FVector& P2 = Vertices[OutIndices[i + 2]].pos;
+
+		FVector Normal = TriangleNormal(P0, P1, P2);
+		const float DoubleArea = Normal.Size();
+		if (DoubleArea <= KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+		Normal = Normal * (1.0f / DoubleArea);
+
+		const double D = -static_cast<double>(FVector::Dot(Normal, P0));
+		const double Area = 0.5 * DoubleArea;
+		for (uint32 c = 0; c < 3; ++c)
+		{
+			Quadrics[OutIndices[i + c]].AddPlane(Normal, D, Area);
+		}
+	}
+
+	// 3. 패스 단위 greedy collapse: 비용 순으로 정렬 후 서로 겹치지 않는 collapse만 한 번에 적용
+	uint32 CurrentIndexCount = IndexCount;
+	float ResultError = 0.0f;
+	TargetIndexCount -= TargetIndexCount % 3;
+
+	TArray<uint32> AdjOffsets;
+	TArray<uint32> AdjTriangles;
+	TArray<FCollapse> Collapses;
+	TArray<uint32> Remap(VertexCount);
+	TArray<uint8> bTouched(VertexCount);
+
+	constexpr uint32 MaxPasses = 100;
+	for (uint32 Pass = 0; Pass < MaxPasses && CurrentIndexCount > TargetIndexCount; ++Pass)
+	{
+		const uint32 TriCount = CurrentIndexCount / 3;
+
+		// 정점 → 인접 삼각형 (CSR)
+		AdjOffsets.assign(VertexCount + 1, 0);
+		for (uint32 i = 0; i < CurrentIndexCount; ++i)
+		{
+			++AdjOffsets[OutIndices[i] + 1];
+		}
+		for (uint32 v = 0; v < VertexCount; ++v)
+		{
+			AdjOffsets[v + 1] += AdjOffsets[v];
+		}
+		AdjTriangles.resize(CurrentIndexCount);
+		{
+			TArray<uint32> Fill(AdjOffsets.begin(), AdjOffsets.end() - 1);
+			for (uint32 Tri = 0; Tri < TriCount; ++Tri)
+			{
+				for (uint32 c = 0; c < 3; ++c)
+				{
+					AdjTriangles[Fill[OutIndices[Tri * 3 + c]]++] = Tri;
+				}
+			}
+		}
+
+		// 후보 collapse 수집 (방향별로 잠기지 않은 쪽만 Source가 될 수 있음)
+		Collapses.clear();
+		for (uint32 i = 0; i < CurrentIndexCount; i += 3)
+		{
+			for (uint32 e = 0; e < 3; ++e)
+			{
+				const uint32 A = OutIndices[i + e];
+				const uint32 B = OutIndices[i + (e + 1) % 3];
+				if (A == B)
+				{
+					continue;
+				}
+
+				const FVector& PA = Vertices[A].pos;
+				const FVector& PB = Vertices[B].pos;
+				auto AddCandidate = [&](uint32 Source, uint32 Target, const FVector& TargetPos)
+					{
+						const double Cost = Quadrics[Source].Evaluate(TargetPos) + Quadrics[Target].Evaluate(TargetPos);
+						const double Weight = Quadrics[Source].Weight + Quadrics[Target].Weight;
+						const double Distance = Weight > 0.0 ? std::sqrt(Cost / Weight) : 0.0;
+						Collapses.push_back({ Source, Target, static_cast<float>(Distance * InvScale) });
+					};
+
+				if (!bLocked[A])
+				{
+					AddCandidate(A, B, PB);
+				}
+				if (!bLocked[B])
+				{
+					AddCandidate(B, A, PA);
+				}
+			}
+		}
+
+		if (Collapses.empty())
+		{
+			break;
+		}
+
+		std::sort(Collapses.begin(), Collapses.end(), [](const FCollapse& L, const FCollapse& R)
+			{
+				return L.Error < R.Error;
+			});
+
+		for (uint32 v = 0; v < VertexCount; ++v)
+		{
+			Remap[v] = v;
+		}
+		std::fill(bTouched.begin(), bTouched.end(), 0);
+
+		// 한 패스에서 너무 많이 collapse 하면 비용이 낮은 쪽만 골고루 줄지 않으므로 목표의 절반 정도씩 진행
+		const uint32 TrianglesToRemove = (CurrentIndexCount - TargetIndexCount) / 3;
+		const uint32 PassBudget = std::max<uint32>(1, (TrianglesToRemove + 1) / 2);
+		uint32 RemovedThisPass = 0;
+		uint32 CollapsedThisPass = 0;
+
+		for (const FCollapse& Collapse : Collapses)
+		{
+			if (Collapse.Error > TargetError || RemovedThisPass >= PassBudget)
+			{
+				break;
+			}
+
+			const uint32 Source = Collapse.Source;
+			const uint32 Target = Collapse.Target;
+			if (bTouched[Source] || bTouched[Target])
+			{
+				continue;
+			}
+
+			// 삼각형 뒤집힘 검사: Source를 Target 위치로 옮겼을 때 남는 면의 방향이 크게 바뀌면 거부
+			const FVector& NewPos = Vertices[Target].pos;
+			bool bValid = true;
+			uint32 Removed = 0;
+			for (uint32 a = AdjOffsets[Source]; a < AdjOffsets[Source + 1]; ++a)
+			{
+				const uint32 Tri = AdjTriangles[a];
+				const uint32 I0 = OutIndices[Tri * 3 + 0];
+				const uint32 I1 = OutIndices[Tri * 3 + 1];
+				const uint32 I2 = OutIndices[Tri * 3 + 2];
+				if (I0 == Target || I1 == Target || I2 == Target)
+				{
+					++Removed;
+					continue;
+				}
+
+				const FVector& P0 = Vertices[I0].pos;
+				const FVector& P1 = Vertices[I1].pos;
+				const FVector& P2 = Vertices[I2].pos;
+				const FVector OldNormal = TriangleNormal(P0, P1, P2);
+				const FVector NewNormal = TriangleNormal(I0 == Source ? NewPos : P0, I1 == Source ? NewPos : P1, I2 == Source ? NewPos : P2);
+
+				// cos(θ) < 0.25 이면 거부 (퇴화 삼각형 포함)
+				const float Dot = FVector::Dot(OldNormal, NewNormal);
+				if (Dot <= 0.25f * OldNormal.Size() * NewNormal.Size())
+				{
+					bValid = false;
+					break;
+				}
+			}
+			if (!bValid)
+			{
+				continue;
+			}
+
+			// Source 주변 정점은 이번 패스에서 더 건드리지 않음 (뒤집힘 검사가 현재 위치 기준이므로)
+			for (uint32 a = AdjOffsets[Source]; a < AdjOffsets[Source + 1]; ++a)
+			{
+				const uint32 Tri = AdjTriangles[a];
+				bTouched[OutIndices[Tri * 3 + 0]] = 1;
+				bTouched[OutIndices[Tri * 3 + 1]] = 1;
+				bTouched[OutIndices[Tri * 3 + 2]] = 1;
+			}
+
+			Remap[Source] = Target;
+			Quadrics[Target].Add(Quadrics[Source]);
+			ResultError = std::max(ResultError, Collapse.Error);
+			RemovedThisPass += Removed;
+			++CollapsedThisPass;
+		}
+
+		if (CollapsedThisPass == 0)
+		{
+			break;
+		}
+
+		// 인덱스 갱신 및 퇴화 삼각형 제거
+		uint32 WriteIndex = 0;
+		for (uint32 i = 0; i < CurrentIndexCount; i += 3)
+		{
+			const uint32 I0 = Remap[OutIndices[i + 0]];
+			const uint32 I1 = Remap[OutIndices[i + 1]];
+			const uint32 I2 = Remap[OutIndices[i + 2]];
+			if (I0 == I1 || I1 == I2 || I0 == I2)
+			{
+				continue;
+			}
+			OutIndices[WriteIndex++] = I0;
+			OutIndices[WriteIndex++] = I1;
+			OutIndices[WriteIndex++] = I2;
+		}
+		CurrentIndexCount = WriteIndex;
+	}
+
+	if (OutError)
+	{
+		*OutError = ResultError;
+	}
+	return CurrentIndexCount;
+}
+
+void FMeshSimplifier::BuildStaticMeshLODs(FStaticMesh* InOutStaticMesh, uint32 LODCount)
+{
+	if (!InOutStaticMesh || InOutStaticMesh->Vertices.empty() || InOutStaticMesh->Indices.empty())
+	{
+		return;
+	}
+
+	InOutStaticMesh->LODs.clear();
+
+	const TArray<FNormalVertex>& Vertices = InOutStaticMesh->Vertices;
+	const TArray<uint32>& SourceIndices = InOutStaticMesh->Indices;
+	const uint32 SourceIndexCount = static_cast<uint32>(SourceIndices.size());
+	const uint32 VertexCount = static_cast<uint32>(Vertices.size());
+
+	// 그룹이 없는 메시는 전체를 하나의 그룹으로 취급
+	TArray<FGroupInfo> SourceGroups = InOutStaticMesh->GroupInfos;
+	if (SourceGroups.empty())
+	{
+		FGroupInfo Whole;
+		Whole.StartIndex = 0;
+		Whole.IndexCount = SourceIndexCount;
+		SourceGroups.push_back(Whole);
+	}
+
+	uint32 PrevIndexCount = SourceIndexCount;
+	float PrevScreenSize = 1.0f;
+	FString Summary;
+	for (uint32 LODIndex = 1; LODIndex < LODCount; ++LODIndex)
+	{
+		const float TriangleRatio = std::pow(DefaultLODReduction, static_cast<float>(LODIndex));
+
+		FStaticMeshLOD LOD;
+		LOD.Error = 0.0f;
+		LOD.Indices.reserve(static_cast<size_t>(SourceIndexCount * TriangleRatio) + 3);
+
+		// 그룹별로 LOD0에서 직접 단순화 (단계적으로 단순화하면 오차가 누적됨)
+		TArray<uint32> Scratch;
+		for (const FGroupInfo& Group : SourceGroups)
+		{
+			FGroupInfo LODGroup = Group;
+			LODGroup.StartIndex = static_cast<uint32>(LOD.Indices.size());
+			LODGroup.IndexCount = 0;
+
+			const uint32 Start = std::min(Group.StartIndex, SourceIndexCount);
+			const uint32 Count = std::min(Group.IndexCount, SourceIndexCount - Start);
+			if (Count >= 3)
+			{
+				const uint32 Target = std::max<uint32>(3, static_cast<uint32>(Count * TriangleRatio));
+
+				Scratch.resize(Count);
+				float GroupError = 0.0f;
+				const uint32 ResultCount = Simplify(Scratch.data(), &SourceIndices[Start], Count, Vertices, Target, DefaultMaxError, &GroupError);
+
+				FMeshOptimizer::OptimizeVertexCache(Scratch.data(), ResultCount, VertexCount);
+				LOD.Indices.insert(LOD.Indices.end(), Scratch.begin(), Scratch.begin() + ResultCount);
+				LODGroup.IndexCount = ResultCount;
+				LOD.Error = std::max(LOD.Error, GroupError);
+			}
+			LOD.GroupInfos.push_back(LODGroup);
+		}
+
+		const uint32 LODIndexCount = static_cast<uint32>(LOD.Indices.size());
+		if (LODIndexCount == 0 || LODIndexCount > PrevIndexCount * MinLODReduction)
+		{
+			// 잠긴 정점/오차 한계로 더 줄일 수 없음
+			break;
+		}
+
+		// 원래 그룹이 없던 메시는 LOD에도 그룹 정보를 남기지 않음 (LOD0과 동일한 규칙)
+		if (InOutStaticMesh->GroupInfos.empty())
+		{
+			LOD.GroupInfos.clear();
+		}
+
+		// 전환 화면 크기는 삼각형 비율이 아니라 이 LOD가 실제로 낸 오차로 결정
+		LOD.ScreenSize = ComputeLODScreenSize(LOD.Error, PrevScreenSize);
+
+		char Buffer[96];
+		std::snprintf(Buffer, sizeof(Buffer), " LOD%u %u tris (err %.4f, screen %.3f)", LODIndex, LODIndexCount / 3, LOD.Error, LOD.ScreenSize);
+		Summary += Buffer;
+
+		PrevIndexCount = LODIndexCount;
+		PrevScreenSize = LOD.ScreenSize;
+		InOutStaticMesh->LODs.push_back(std::move(LOD));
+	}
+
+	UE_LOG("[MeshSimplifier] %s: LOD0 %u tris%s", InOutStaticMesh->PathFileName.c_str(), SourceIndexCount / 3, Summary.c_str());
+}
+
+float FMeshSimplifier::ComputeLODScreenSize(float LODError, float PrevScreenSize)
+{
+	// 화면상 오차 = LOD 오차 x 화면 크기 이므로 허용 화면 오차를 넘지 않는 가장 큰 화면 크기에서 전환
+	// 이전 LOD보다 커지면 선택 순서가 뒤집히므로 PrevScreenSize 이하로 제한
+	if (LODError <= KINDA_SMALL_NUMBER)
+	{
+		return PrevScreenSize;
+	}
+	return std::min(PrevScreenSize, DefaultMaxScreenError / LODError);
+}
+
+bool FMeshSimplifier::ValidateStaticMeshLODs(const FStaticMesh& InStaticMesh)
+{
+	constexpr float SurfaceToReportedErrorRatio = 4.0f;
+	constexpr uint32 MaxErrorSamples = 2048;
+
+	const TArray<FNormalVertex>& Vertices = InStaticMesh.Vertices;
+	const uint32 VertexCount = static_cast<uint32>(Vertices.size());
+	const uint32 SourceIndexCount = static_cast<uint32>(InStaticMesh.Indices.size());
+
+	uint32 Failures = 0;
+	float PrevScreenSize = 1.0f;
+	for (uint32 LODIndex = 0; LODIndex < InStaticMesh.LODs.size(); ++LODIndex)
+	{
+		const FStaticMeshLOD& LOD = InStaticMesh.LODs[LODIndex];
+		const uint32 IndexCount = static_cast<uint32>(LOD.Indices.size());
+
+		// 인덱스 유효성 + 퇴화 삼각형 없음 + 그룹 구성이 LOD0과 같음
+		bool bValid = IndexCount > 0 && IndexCount % 3 == 0 && IndexCount < SourceIndexCount
+			&& LOD.GroupInfos.size() == InStaticMesh.GroupInfos.size();
+		for (uint32 i = 0; bValid && i < IndexCount; i += 3)
+		{
+			const uint32 A = LOD.Indices[i], B = LOD.Indices[i + 1], C = LOD.Indices[i + 2];
+			bValid = A < VertexCount && B < VertexCount && C < VertexCount && A != B && B != C && A != C;
+		}
+		for (const FGroupInfo& Group : LOD.GroupInfos)
+		{
+			bValid = bValid && Group.IndexCount % 3 == 0 && Group.StartIndex + Group.IndexCount <= IndexCount;
+		}
+
+		const float MeasuredError = bValid ? MeasureSurfaceError(Vertices, InStaticMesh.Indices, LOD.Indices.data(), IndexCount, MaxErrorSamples) : FLT_MAX;
+		const bool bErrorOk = LOD.Error <= DefaultMaxError && MeasuredError <= LOD.Error * SurfaceToReportedErrorRatio + 1e-4f;
+		// 전환 화면 크기는 LOD 순서대로 줄어들고, 그 크기에서의 화면상 오차가 허용치 이내여야 함
+		const bool bScreenSizeOk = LOD.ScreenSize > 0.0f && LOD.ScreenSize <= PrevScreenSize
+			&& LOD.Error * LOD.ScreenSize <= DefaultMaxScreenError * 1.001f;
+		const bool bPassed = bValid && bErrorOk && bScreenSizeOk;
+		if (!bPassed)
+		{
+			++Failures;
+		}
+
+		UE_LOG("[MeshSimplifierTest] %s LOD%u: %u -> %u tris, reported %.4f, measured %.4f, screen size %.3f %s",
+			InStaticMesh.PathFileName.c_str(), LODIndex + 1, SourceIndexCount / 3, IndexCount / 3,
+			LOD.Error, MeasuredError, LOD.ScreenSize, bPassed ? "OK" : "FAILED");
+		PrevScreenSize = LOD.ScreenSize;
+	}
+	return Failures == 0;
+}
+
+bool FMeshSimplifier::RunSelfTest()
+{
+	constexpr float SurfaceToReportedErrorRatio = 4.0f;
+
+	struct FTestCase
+	{
+		const char* Name;
+		TArray<FNormalVertex> Vertices;
+		TArray<uint32> Indices;
+		float TargetError;			// Simplify에 넘기는 허용 오차
+		float MaxSurfaceError;		// 원본 정점 → LOD 표면 최대 거리 허용치 (메시 크기 대비)
+		bool bMustReachTarget;		// 오차 없이 줄일 수 있는 메시는 목표 삼각형 수까지 줄어야 함
+	};
+
+	TArray<FTestCase> Cases(4);
+	Cases[0].Name = "Plane";
+	MakeTestGrid(48, 0.0f, Cases[0].Vertices, Cases[0].Indices);
+	Cases[0].TargetError = DefaultMaxError;
+	Cases[0].MaxSurfaceError = 1e-4f;
+	Cases[0].bMustReachTarget = true;
+
+	Cases[1].Name = "Heightfield";
+	MakeTestGrid(48, 0.1f, Cases[1].Vertices, Cases[1].Indices);
+	Cases[1].TargetError = DefaultMaxError;
+	Cases[1].MaxSurfaceError = DefaultMaxError;
+	Cases[1].bMustReachTarget = false;
+
+	Cases[2].Name = "Sphere";
+	MakeTestSphere(32, 48, Cases[2].Vertices, Cases[2].Indices);
+	Cases[2].TargetError = DefaultMaxError;
+	Cases[2].MaxSurfaceError = DefaultMaxError;
+	Cases[2].bMustReachTarget = false;
+
+	// 허용 오차가 작으면 목표 수에 못 미치더라도 오차 한계에서 멈춰야 함
+	Cases[3].Name = "Sphere (tight)";
+	Cases[3].Vertices = Cases[2].Vertices;
+	Cases[3].Indices = Cases[2].Indices;
+	Cases[3].TargetError = 0.002f;
+	Cases[3].MaxSurfaceError = 0.002f * SurfaceToReportedErrorRatio;
+	Cases[3].bMustReachTarget = false;
+
+	uint32 Failures = 0;
+	for (const FTestCase& Case : Cases)
+	{
+		const uint32 SourceIndexCount = static_cast<uint32>(Case.Indices.size());
+		const uint32 VertexCount = static_cast<uint32>(Case.Vertices.size());
+		TArray<uint32> LODIndices(SourceIndexCount);
+
+		for (uint32 LODIndex = 1; LODIndex < DefaultLODCount; ++LODIndex)
+		{
+			const float TriangleRatio = std::pow(DefaultLODReduction, static_cast<float>(LODIndex));
+			const uint32 Target = static_cast<uint32>(SourceIndexCount * TriangleRatio) / 3 * 3;
+
+			float ReportedError = 0.0f;
+			const uint32 ResultCount = Simplify(LODIndices.data(), Case.Indices.data(), SourceIndexCount, Case.Vertices, Target, Case.TargetError, &ReportedError);
+
+			// 인덱스 유효성 + 퇴화 삼각형 없음
+			bool bValid = ResultCount % 3 == 0 && ResultCount <= SourceIndexCount && ResultCount > 0;
+			for (uint32 i = 0; bValid && i < ResultCount; i += 3)
+			{
+				const uint32 A = LODIndices[i], B = LODIndices[i + 1], C = LODIndices[i + 2];
+				bValid = A < VertexCount && B < VertexCount && C < VertexCount && A != B && B != C && A != C;
+			}
+
+			const float MeasuredError = bValid ? MeasureSurfaceError(Case.Vertices, Case.Indices, LODIndices.data(), ResultCount) : FLT_MAX;
+			// 보고 오차는 면적 가중 평균 거리라 최대 거리보다 작을 수 있으므로 일정 배율까지 허용
+			const bool bReportedOk = ReportedError <= Case.TargetError;
+			const bool bMeasuredOk = MeasuredError <= Case.MaxSurfaceError && MeasuredError <= ReportedError * SurfaceToReportedErrorRatio + 1e-4f;
+			const bool bTargetOk = !Case.bMustReachTarget || ResultCount <= Target;
+			const bool bPassed = bValid && bReportedOk && bMeasuredOk && bTargetOk;
+			if (!bPassed)
+			{
+				++Failures;
+			}
+
+			UE_LOG("[MeshSimplifierTest] %s LOD%u: %u -> %u tris (target %u), reported %.4f, measured %.4f (limit %.4f) %s",
+				Case.Name, LODIndex, SourceIndexCount / 3, ResultCount / 3, Target / 3,
+				ReportedError, MeasuredError, Case.MaxSurfaceError, bPassed ? "OK" : "FAILED");
+		}
+	}
+
+	// 실제 에셋: 시작 시 Preload로 로드된 Data/*.obj의 LOD (임포트 또는 캐시에서 읽은 그대로)
+	uint32 MeshCount = 0;
+	for (UStaticMesh* Mesh : UResourceManager::GetInstance().GetAll<UStaticMesh>())
+	{
+		const FStaticMesh* Asset = Mesh ? Mesh->GetStaticMeshAsset() : nullptr;
+		if (!Asset || Asset->Vertices.empty())
+		{
+			continue;
+		}
+		++MeshCount;
+		if (!ValidateStaticMeshLODs(*Asset))
+		{
+			++Failures;
+		}
+	}
+	UE_LOG("[MeshSimplifierTest] %u loaded static meshes checked", MeshCount);
+
+	UE_LOG("[MeshSimplifierTest] %s (%u failures)", Failures == 0 ? "PASSED" : "FAILED", Failures);
+	return Failures == 0;
+}
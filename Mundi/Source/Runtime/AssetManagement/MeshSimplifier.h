@@ -0,0 +1,51 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+
+/**
+ * Quadric Error Metric(Garland & Heckbert) 기반 인덱스 전용 메쉬 단순화.
+ * 새 정점을 만들지 않고 기존 정점 위로만 edge collapse 하므로 모든 LOD가 LOD0 정점 버퍼를 공유합니다.
+ * UV/노멀 seam 정점과 열린 경계(border) 정점은 잠궈서 텍스처가 찢어지거나 실루엣이 무너지지 않게 합니다.
+ */
+struct FMeshSimplifier
+{
+	// LOD0 포함 생성할 최대 LOD 수
+	static constexpr uint32 DefaultLODCount = 4;
+
+	// LOD 단계마다 목표 삼각형 비율에 곱하는 값
+	static constexpr float DefaultLODReduction = 0.5f;
+
+	// 허용 오차 (메시 바운딩 박스 대각선 대비 비율)
+	static constexpr float DefaultMaxError = 0.05f;
+
+	// LOD 전환 시 허용하는 화면상 오차 (화면 높이 대비, 1080p 기준 약 2px)
+	// LOD 오차(바운드 대각선 대비) x 화면 크기(바운드 대각선 / 화면 높이) 가 이 값 이하가 되는 화면 크기에서 전환
+	static constexpr float DefaultMaxScreenError = 0.002f;
+
+	// 이전 LOD 대비 삼각형이 이 비율 밑으로 줄지 않으면 LOD 생성을 중단
+	static constexpr float MinLODReduction = 0.9f;
+
+	/**
+	 * Indices를 TargetIndexCount 이하로 단순화해 OutIndices에 씁니다. (OutIndices는 IndexCount 이상 크기여야 하며 Indices와 같아도 됨)
+	 * TargetError를 넘는 collapse는 하지 않으므로 목표 수에 도달하지 못할 수 있습니다.
+	 * @return 결과 인덱스 수
+	 */
+	static uint32 Simplify(uint32* OutIndices, const uint32* Indices, uint32 IndexCount, const TArray<FNormalVertex>& Vertices,
+		uint32 TargetIndexCount, float TargetError = DefaultMaxError, float* OutError = nullptr);
+
+	// 상대 오차 계산 기준이 되는 메시 크기 (바운딩 박스 대각선 길이)
+	static float ComputeMeshScale(const TArray<FNormalVertex>& Vertices);
+
+	// LOD0(Indices/GroupInfos)로부터 LOD1..N을 생성해 LODs에 채웁니다. 그룹(머티리얼 섹션) 구성은 LOD0과 동일하게 유지됩니다.
+	static void BuildStaticMeshLODs(FStaticMesh* InOutStaticMesh, uint32 LODCount = DefaultLODCount);
+
+	// LOD 오차(바운드 대각선 대비)를 전환 화면 크기로 변환. 오차가 없으면 PrevScreenSize를 그대로 사용
+	static float ComputeLODScreenSize(float LODError, float PrevScreenSize = 1.0f);
+
+	// 빌드된 LODs의 인덱스/그룹 유효성, 보고된 오차와 실제 표면 거리, 전환 화면 크기가 오차와 일치하는지 검사
+	static bool ValidateStaticMeshLODs(const FStaticMesh& InStaticMesh);
+
+	// 합성 메시(평면/높이맵/구)를 LOD 단계별로 단순화해 인덱스 유효성, 보고된 오차, 원본 정점에서 LOD 표면까지의
+	// 실제 거리가 허용 오차 안에 있는지 검사한 뒤, 로드된 모든 스태틱 메시(Data/*.obj)의 LOD도 검사. 모두 통과하면 true
+	static bool RunSelfTest();
+};
@@ -0,0 +1,193 @@
+﻿#include "pch.h"
+#include "MeshletBuilder.h"
+
+namespace
+{
+	// 노멀 콘 반각이 이보다 넓으면 (cos 기준) backface 컬링 효과가 거의 없으므로 콘을 비활성화
+	constexpr float MinConeDot = 0.1f;
+
+	void ComputeMeshletBounds(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, FMeshlet& InOutMeshlet)
+	{
+		const uint32 Begin = InOutMeshlet.StartIndex;
+		const uint32 End = InOutMeshlet.StartIndex + InOutMeshlet.IndexCount;
+
+		// 바운딩 구: AABB 중심 + 최대 거리
+		FVector Min = Vertices[Indices[Begin]].pos;
+		FVector Max = Min;
+		for (uint32 i = Begin; i < End; ++i)
+		{
+			const FVector& Pos = Vertices[Indices[i]].pos;
+			Min = Min.ComponentMin(Pos);
+			Max = Max.ComponentMax(Pos);
+		}
+
+		const FVector Center = (Min + Max) * 0.5f;
+		float RadiusSquared = 0.0f;
+		for (uint32 i = Begin; i < End; ++i)
+		{
+			RadiusSquared = std::max(RadiusSquared, (Vertices[Indices[i]].pos - Center).SizeSquared());
+		}
+		InOutMeshlet.Center = Center;
+		InOutMeshlet.Radius = std::sqrt(RadiusSquared);
+
+		// 노멀 콘: 삼각형 노멀 평균을 축으로, 축과 가장 많이 벌어진 노멀로 반각 결정
+		TArray<FVector> Normals;
+		Normals.reserve(InOutMeshlet.IndexCount / 3);
+		FVector AxisSum(0.0f, 0.0f, 0.0f);
+		for (uint32 i = Begin; i + 2 < End; i += 3)
+		{
+			const FVector& P0 = Vertices[Indices[i + 0]].pos;
+			const FVector& P1 = Vertices[Indices[i + 1]].pos;
+			const FVector& P2 = Vertices[Indices[i + 2]].pos;
+			const FVector Normal = FVector::Cross(P1 - P0, P2 - P0);
+			const float Length = Normal.Size();
+			if (Length <= KINDA_SMALL_NUMBER * KINDA_SMALL_NUMBER)
+			{
+				continue; // 퇴화 삼각형은 래스터화되지 않으므로 콘 계산에서 제외
+			}
+			Normals.push_back(Normal * (1.0f / Length));
+			AxisSum = AxisSum + Normals.back();
+		}
+
+		InOutMeshlet.ConeAxis = FVector(0.0f, 0.0f, 0.0f);
+		InOutMeshlet.ConeCutoff = 1.0f;
+
+		const float AxisLength = AxisSum.Size();
+		if (Normals.empty() || AxisLength <= KINDA_SMALL_NUMBER)
+		{
+			return;
+		}
+
+		const FVector Axis = AxisSum * (1.0f / AxisLength);
+		float MinDot = 1.0f;
+		for (const FVector& Normal : Normals)
+		{
+			MinDot = std::min(MinDot, FVector::Dot(Normal, Axis));
+		}
+
+		if (MinDot < MinConeDot)
+		{
+			return;
+		}
+
+		// 카메라 방향과 축의 각도가 (90° - 반각)보다 작으면 모든 삼각형이 뒷면 → cutoff = sin(반각)
+		InOutMeshlet.ConeAxis = Axis;
+		InOutMeshlet.ConeCutoff = std::sqrt(std::max(0.0f, 1.0f - MinDot * MinDot));
+	}
+}
+
+void FMeshletBuilder::BuildMeshlets(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, uint32 StartIndex, uint32 IndexCount, TArray<FMeshlet>& OutMeshlets)
+{
+	const uint32 TotalIndexCount = static_cast<uint32>(Indices.size());
+	if (StartIndex >= TotalIndexCount)
+	{
+		return;
+	}
+	IndexCount = std::min(IndexCount, TotalIndexCount - StartIndex);
+	IndexCount -= IndexCount % 3;
+	if (IndexCount == 0)
+	{
+		return;
+	}
+
+	// 정점이 현재 메쉴릿에 이미 포함됐는지를 메쉴릿 번호 스탬프로 판단 (매번 초기화할 필요 없음)
+	TArray<uint32> VertexStamp(Vertices.size(), UINT32_MAX);
+	uint32 Stamp = 0;
+
+	FMeshlet Current;
+	Current.StartIndex = StartIndex;
+	uint32 CurrentVertexCount = 0;
+
+	auto FlushMeshlet = [&]()
+		{
+			if (Current.IndexCount > 0)
+			{
+				ComputeMeshletBounds(Vertices, Indices, Current);
+				OutMeshlets.push_back(Current);
+			}
+			Current = FMeshlet();
+			CurrentVertexCount = 0;
+			++Stamp;
+		};
+
+	const uint32 End = StartIndex + IndexCount;
+	for (uint32 i = StartIndex; i < End; i += 3)
+	{
+		// 삼각형 안에서 같은 정점이 반복되면 중복 계산되지만 한도를 넘지 않는 쪽(보수적)이므로 문제없음
+		uint32 NewVertices = 0;
+		for (uint32 c = 0; c < 3; ++c)
+		{
+			NewVertices += (VertexStamp[Indices[i + c]] != Stamp) ? 1 : 0;
+		}
+
+		if (CurrentVertexCount + NewVertices > MaxVertices || Current.IndexCount / 3 >= MaxTriangles)
+		{
+			FlushMeshlet();
+			Current.StartIndex = i;
+		}
+
+		for (uint32 c = 0; c < 3; ++c)
+		{
+			const uint32 Vertex = Indices[i + c];
+			if (VertexStamp[Vertex] != Stamp)
+			{
+				VertexStamp[Vertex] = Stamp;
+				++CurrentVertexCount;
+			}
+		}
+		Current.IndexCount += 3;
+	}
+	FlushMeshlet();
+}
+
+void FMeshletBuilder::BuildStaticMeshMeshlets(FStaticMesh* InOutStaticMesh)
+{
+	if (!InOutStaticMesh || InOutStaticMesh->Vertices.empty() || InOutStaticMesh->Indices.empty())
+	{
+		return;
+	}
+
+	TArray<FMeshlet>& Meshlets = InOutStaticMesh->Meshlets;
+	Meshlets.clear();
+
+	const uint32 IndexCount = static_cast<uint32>(InOutStaticMesh->Indices.size());
+	auto BuildRange = [&](uint32 Start, uint32 Count)
+		{
+			if (Count / 3 >= MinGroupTriangles)
+			{
+				BuildMeshlets(InOutStaticMesh->Vertices, InOutStaticMesh->Indices, Start, Count, Meshlets);
+			}
+		};
+
+	if (InOutStaticMesh->GroupInfos.empty())
+	{
+		BuildRange(0, IndexCount);
+	}
+	else
+	{
+		for (const FGroupInfo& Group : InOutStaticMesh->GroupInfos)
+		{
+			BuildRange(Group.StartIndex, Group.IndexCount);
+		}
+	}
+
+	// 렌더러가 섹션 범위로 이진 탐색하므로 시작 위치 순으로 정렬
+	std::sort(Meshlets.begin(), Meshlets.end(), [](const FMeshlet& A, const FMeshlet& B)
+		{
+			return A.StartIndex < B.StartIndex;
+		});
+
+	if (!Meshlets.empty())
+	{
+		uint32 TriangleCount = 0;
+		uint32 ConeCount = 0;
+		for (const FMeshlet& Meshlet : Meshlets)
+		{
+			TriangleCount += Meshlet.IndexCount / 3;
+			ConeCount += (Meshlet.ConeCutoff < 1.0f) ? 1 : 0;
+		}
+		UE_LOG("[MeshletBuilder] %s: %u meshlets (%.1f tris avg, %u with normal cone)",
+			InOutStaticMesh->PathFileName.c_str(), static_cast<uint32>(Meshlets.size()),
+			static_cast<float>(TriangleCount) / static_cast<float>(Meshlets.size()), ConeCount);
+	}
+}
@@ -0,0 +1,25 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+
+/**
+ * 정적 메시를 메쉴릿(작은 삼각형 클러스터)으로 나눕니다.
+ * 버텍스 캐시 최적화가 끝난 인덱스 순서를 그대로 앞에서부터 잘라 만들기 때문에
+ * 인덱스 버퍼를 재배치하지 않고도 공간적으로 뭉친 클러스터를 얻습니다.
+ * 각 메쉴릿은 CPU 컬링용 바운딩 구와 노멀 콘을 가집니다.
+ */
+struct FMeshletBuilder
+{
+	// 메쉴릿당 최대 고유 정점/삼각형 수
+	static constexpr uint32 MaxVertices = 64;
+	static constexpr uint32 MaxTriangles = 124;
+
+	// 이보다 작은 그룹은 컴포넌트 단위 컬링으로 충분하므로 메쉴릿을 만들지 않음
+	static constexpr uint32 MinGroupTriangles = 2 * MaxTriangles;
+
+	// [StartIndex, StartIndex + IndexCount) 구간을 메쉴릿으로 나눠 OutMeshlets 뒤에 추가
+	static void BuildMeshlets(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices, uint32 StartIndex, uint32 IndexCount, TArray<FMeshlet>& OutMeshlets);
+
+	// 그룹(머티리얼 섹션)별로 LOD0 메쉴릿을 만들어 Meshlets에 채움
+	static void BuildStaticMeshMeshlets(FStaticMesh* InOutStaticMesh);
+};
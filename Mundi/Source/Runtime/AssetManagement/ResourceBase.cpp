@@ -2,3 +2,5 @@
 #include "ResourceBase.h"
 
 IMPLEMENT_CLASS(UResourceBase)
+
+uint32 UResourceBase::ContentRevision = 0;
@@ -18,7 +18,14 @@ public:
 	std::filesystem::file_time_type GetLastModifiedTime() const { return LastModifiedTime; }
 	void SetLastModifiedTime(std::filesystem::file_time_type InTime) { LastModifiedTime = InTime; }
 
+	// 텍스처 재로드, 머티리얼 파라미터 변경처럼 렌더 결과를 바꾸는 리소스 내용 변경 시 증가 (뷰포트 프레임 캐시 무효화용)
+	static uint32 GetContentRevision() { return ContentRevision; }
+	static void MarkContentChanged() { ++ContentRevision; }
+
 protected:
 	FString FilePath;	// 원본 파일의 경로이자, UResourceManager에 등록된 Key 
 	std::filesystem::file_time_type LastModifiedTime;
+
+private:
+	static uint32 ContentRevision;
 };
\ No newline at end of file
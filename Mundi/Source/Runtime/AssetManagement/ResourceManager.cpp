@@ -450,7 +450,11 @@ void UResourceManager::InitShaderILMap()
 {
     TArray<D3D11_INPUT_ELEMENT_DESC> layout;
 
+    // 메시 배치로 그리는 셰이더의 오브젝트 데이터 인덱스 (FObjectDataBuffer의 인스턴스 스트림, IA 슬롯 1)
+    const D3D11_INPUT_ELEMENT_DESC ObjectIndexElement = { "OBJECTINDEX", 0, DXGI_FORMAT_R32_UINT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 };
+
     layout.Add({ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    layout.Add(ObjectIndexElement);
     ShaderToInputLayoutMap["Shaders/UI/Gizmo.hlsl"] = layout;
 	layout.clear();
 
@@ -465,14 +469,24 @@ void UResourceManager::InitShaderILMap()
     layout.Add({ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 });
     layout.Add({ "TANGENT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 });
     layout.Add({ "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 48, D3D11_INPUT_PER_VERTEX_DATA, 0 });
-   
+
+	ShaderToInputLayoutMap["Shaders/Shadow/PointLightShadow.hlsl"] = layout;  // Shadow map rendering uses same vertex format
+	ShaderToInputLayoutMap["Shaders/Shadows/DepthOnly_VS.hlsl"] = layout;    // 그림자 패스는 ModelBuffer(b0)를 직접 갱신
+
+    layout.Add(ObjectIndexElement);
     ShaderToInputLayoutMap["Shaders/Effects/Decal.hlsl"] = layout;
 	ShaderToInputLayoutMap["Shaders/Materials/UberLit.hlsl"] = layout;
     ShaderToInputLayoutMap["Shaders/Materials/SkyDome.hlsl"] = layout;
-	ShaderToInputLayoutMap["Shaders/Shadow/PointLightShadow.hlsl"] = layout;  // Shadow map rendering uses same vertex format
-	ShaderToInputLayoutMap["Shaders/Shadows/DepthOnly_VS.hlsl"] = layout;
     layout.clear();
 
+    // FCompressedVertex (20 bytes). 디코드는 Shaders/Common/VertexCompression.hlsl
+    CompressedVertexInputLayout.clear();
+    CompressedVertexInputLayout.Add({ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    CompressedVertexInputLayout.Add({ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, 8, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    CompressedVertexInputLayout.Add({ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    CompressedVertexInputLayout.Add({ "TANGENT", 0, DXGI_FORMAT_R16G16_SNORM, 0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    CompressedVertexInputLayout.Add(ObjectIndexElement); // DepthOnly 압축 변형은 읽지 않으므로 무시됨
+
     layout.Add({ "WORLDPOSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 });
     layout.Add({ "SIZE", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 });
     layout.Add({ "UVRECT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 });
@@ -486,6 +500,7 @@ void UResourceManager::InitShaderILMap()
                  D3D11_INPUT_PER_VERTEX_DATA, 0 });
     layout.Add({ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,    0, 12,
                  D3D11_INPUT_PER_VERTEX_DATA, 0 });
+    layout.Add(ObjectIndexElement);
     ShaderToInputLayoutMap["Shaders/UI/Billboard.hlsl"] = layout;
     layout.clear();
     
@@ -541,15 +556,14 @@ void UResourceManager::CreateTextBillboardTexture()
     Add<UTexture>("TextBillboard.dds", TextBillboardTexture);
 }
 
-void UResourceManager::CheckAndReloadShaders(float DeltaTime)
+void UResourceManager::CheckAndReloadShaders()
 {
-    // Throttle check frequency to reduce file system overhead
-    ShaderCheckTimer += DeltaTime;
-    if (ShaderCheckTimer < ShaderCheckInterval)
+    // 파일 변경 알림이 없으면 파일 시스템에 접근하지 않음
+    if (!bShaderFilesChanged)
     {
         return;
     }
-    ShaderCheckTimer = 0.0f;
+    bShaderFilesChanged = false;
 
     // Get all shader resources
     uint8 ShaderTypeIndex = static_cast<uint8>(ResourceType::Shader);
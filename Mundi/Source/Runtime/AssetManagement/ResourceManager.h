@@ -63,10 +63,14 @@ public:
 	ID3D11Device* GetDevice() { return Device; }
 	ID3D11DeviceContext* GetDeviceContext() { return Context; }
 	TArray<D3D11_INPUT_ELEMENT_DESC>& GetProperInputLayout(const FString& InShaderName);
+	// 스태틱 메시 압축 정점(FCompressedVertex) 레이아웃. COMPRESSED_VERTEX 변형은 셰이더와 무관하게 이 레이아웃 사용
+	TArray<D3D11_INPUT_ELEMENT_DESC>& GetCompressedVertexInputLayout() { return CompressedVertexInputLayout; }
 	FString& GetProperShader(const FString& InTextureName);
 
 	// --- Shader Hot Reload ---
-	void CheckAndReloadShaders(float DeltaTime);
+	// FFileWatcher가 셰이더/Include 파일 변경을 알렸을 때만 변경된 셰이더를 찾아 재컴파일
+	void CheckAndReloadShaders();
+	void RequestShaderHotReload() { bShaderFilesChanged = true; }
 
 	// --- 리소스 생성 및 관리 ---
 	FTextureData* CreateOrGetTextureData(const FWideString& FilePath);
@@ -109,6 +113,7 @@ protected:
 	TArray<TMap<FString, UResourceBase*>> Resources;
 
 	TMap<FString, TArray<D3D11_INPUT_ELEMENT_DESC>> ShaderToInputLayoutMap;
+	TArray<D3D11_INPUT_ELEMENT_DESC> CompressedVertexInputLayout;
 	TMap<FString, FString> TextureToShaderMap;
 
 	TArray<UStaticMesh*> StaticMeshs;
@@ -126,9 +131,8 @@ private:
 
 	UMaterial* DefaultMaterialInstance;
 
-	// Shader Hot Reload
-	float ShaderCheckTimer = 0.0f;
-	const float ShaderCheckInterval = 0.5f; // Check every 0.5 seconds
+	// Shader Hot Reload (파일 변경 알림 수신 여부)
+	bool bShaderFilesChanged = false;
 };
 
 //-----definition
@@ -2,22 +2,33 @@
 #include "StaticMesh.h"
 #include "ObjManager.h"
 #include "ResourceManager.h"
+#include "MeshletCuller.h"
 
 IMPLEMENT_CLASS(UStaticMesh)
 
 UStaticMesh::~UStaticMesh()
 {
     ReleaseResources();
+
+    delete MeshletCullData;
+    MeshletCullData = nullptr;
 }
 
 void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVertexLayoutType InVertexType)
 {
     assert(InDevice);
 
-    SetVertexType(InVertexType);
-
     StaticMeshAsset = FObjManager::LoadObjStaticMeshAsset(InFilePath);
 
+#ifdef USE_COMPRESSED_VERTEX
+    // 임포트 시 압축에 성공한 메시만 압축 레이아웃 사용 (색상이 있거나 UV 범위가 큰 메시는 기존 포맷)
+    if (StaticMeshAsset && !StaticMeshAsset->CompressedVertices.empty())
+    {
+        InVertexType = EVertexLayoutType::PositionNormalTexTangentCompressed;
+    }
+#endif // USE_COMPRESSED_VERTEX
+    SetVertexType(InVertexType);
+
     // 빈 버텍스, 인덱스로 버퍼 생성 방지
     if (StaticMeshAsset && 0 < StaticMeshAsset->Vertices.size() && 0 < StaticMeshAsset->Indices.size())
     {
@@ -27,6 +38,25 @@ void UStaticMesh::Load(const FString& InFilePath, ID3D11Device* InDevice, EVerte
         CreateLocalBound(StaticMeshAsset);
         VertexCount = static_cast<uint32>(StaticMeshAsset->Vertices.size());
         IndexCount = static_cast<uint32>(StaticMeshAsset->Indices.size());
+
+        // D3D11RHI::CreateIndexBuffer가 LOD0 뒤에 LOD1..N 인덱스를 순서대로 붙임
+        LODIndexOffsets.clear();
+        LODIndexOffsets.Add(0);
+        uint32 Offset = IndexCount;
+        for (const FStaticMeshLOD& LOD : StaticMeshAsset->LODs)
+        {
+            LODIndexOffsets.Add(Offset);
+            Offset += static_cast<uint32>(LOD.Indices.size());
+        }
+
+        // 메쉴릿은 LOD0 인덱스의 연속 구간이므로 CPU 인덱스를 그대로 참조
+        delete MeshletCullData;
+        MeshletCullData = nullptr;
+        if (!StaticMeshAsset->Meshlets.empty())
+        {
+            MeshletCullData = new FMeshletCullData();
+            MeshletCullData->Build(StaticMeshAsset->Meshlets, &StaticMeshAsset->Indices);
+        }
     }
 }
 
@@ -51,6 +81,9 @@ void UStaticMesh::Load(FMeshData* InData, ID3D11Device* InDevice, EVertexLayoutT
 
     VertexCount = static_cast<uint32>(InData->Vertices.size());
     IndexCount = static_cast<uint32>(InData->Indices.size());
+
+    LODIndexOffsets.clear();
+    LODIndexOffsets.Add(0);
 }
 
 void UStaticMesh::SetVertexType(EVertexLayoutType InVertexType)
@@ -72,6 +105,9 @@ void UStaticMesh::SetVertexType(EVertexLayoutType InVertexType)
     case EVertexLayoutType::PositionBillBoard:
         Stride = sizeof(FBillboardVertex);
         break;
+    case EVertexLayoutType::PositionNormalTexTangentCompressed:
+        Stride = sizeof(FCompressedVertex);
+        break;
     default:
         assert(false && "Unknown vertex type!");
     }
@@ -106,7 +142,14 @@ void UStaticMesh::CreateVertexBuffer(FMeshData* InMeshData, ID3D11Device* InDevi
 void UStaticMesh::CreateVertexBuffer(FStaticMesh* InStaticMesh, ID3D11Device* InDevice, EVertexLayoutType InVertexType)
 {
     HRESULT hr;
-    hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(InDevice, InStaticMesh->Vertices, &VertexBuffer);
+    if (InVertexType == EVertexLayoutType::PositionNormalTexTangentCompressed)
+    {
+        hr = D3D11RHI::CreateVertexBuffer(InDevice, InStaticMesh->CompressedVertices, &VertexBuffer);
+    }
+    else
+    {
+        hr = D3D11RHI::CreateVertexBuffer<FVertexDynamic>(InDevice, InStaticMesh->Vertices, &VertexBuffer);
+    }
     assert(SUCCEEDED(hr));
 }
 
@@ -133,6 +176,7 @@ void UStaticMesh::CreateLocalBound(const FMeshData* InMeshData)
         Max = Max.ComponentMax(Vertex);
     }
     LocalBound = FAABB(Min, Max);
+    BoundsRadius = LocalBound.GetHalfExtent().Size();
 }
 
 void UStaticMesh::CreateLocalBound(const FStaticMesh* InStaticMesh)
@@ -147,6 +191,7 @@ void UStaticMesh::CreateLocalBound(const FStaticMesh* InStaticMesh)
         Max = Max.ComponentMax(Pos);
     }
     LocalBound = FAABB(Min, Max);
+    BoundsRadius = LocalBound.GetHalfExtent().Size();
 }
 
 void UStaticMesh::ReleaseResources()
@@ -5,6 +5,7 @@
 #include <d3d11.h>
 
 class FMeshBVH;
+struct FMeshletCullData;
 class UStaticMesh : public UResourceBase
 {
 public:
@@ -25,6 +26,11 @@ public:
     void SetIndexCount(uint32 Cnt) { IndexCount = Cnt; }
     uint32 GetVertexStride() const { return VertexStride; };
 
+    // 압축 정점 포맷(FCompressedVertex)이면 셰이더에서 위치를 Offset + Q * Scale로 복원
+    bool IsVertexCompressed() const { return VertexType == EVertexLayoutType::PositionNormalTexTangentCompressed; }
+    FVector GetPositionDequantScale() const { return StaticMeshAsset->CompressedPositionExtent; }
+    FVector GetPositionDequantOffset() const { return StaticMeshAsset->CompressedPositionMin; }
+
 	const FString& GetAssetPathFileName() const { return StaticMeshAsset ? StaticMeshAsset->PathFileName : FilePath; }
     void SetStaticMeshAsset(FStaticMesh* InStaticMesh) { StaticMeshAsset = InStaticMesh; }
 	FStaticMesh* GetStaticMeshAsset() const { return StaticMeshAsset; }
@@ -35,6 +41,18 @@ public:
     uint64 GetMeshGroupCount() const { return StaticMeshAsset->GroupInfos.size(); }
     
     FAABB GetLocalBound() const {return LocalBound; }
+
+    // LOD (LOD0 포함). LOD 인덱스는 인덱스 버퍼에서 LOD0 뒤에 이어져 있음
+    uint32 GetLODCount() const { return static_cast<uint32>(LODIndexOffsets.size()); }
+    uint32 GetLODIndexOffset(uint32 LODIndex) const { return LODIndexOffsets[LODIndex]; }
+    const TArray<FGroupInfo>& GetLODGroupInfo(uint32 LODIndex) const { return LODIndex == 0 ? StaticMeshAsset->GroupInfos : StaticMeshAsset->LODs[LODIndex - 1].GroupInfos; }
+    uint32 GetLODIndexCount(uint32 LODIndex) const { return LODIndex == 0 ? IndexCount : static_cast<uint32>(StaticMeshAsset->LODs[LODIndex - 1].Indices.size()); }
+    float GetLODScreenSize(uint32 LODIndex) const { return LODIndex == 0 ? 1.0f : StaticMeshAsset->LODs[LODIndex - 1].ScreenSize; }
+    // 로컬 바운드를 감싸는 구의 반지름 (LOD 선택 시 화면 크기 계산용)
+    float GetBoundsRadius() const { return BoundsRadius; }
+
+    // LOD0 메쉴릿 컬링 데이터 (메쉴릿이 없으면 nullptr)
+    const FMeshletCullData* GetMeshletCullData() const { return MeshletCullData; }
     
     bool EraseUsingComponets(UStaticMeshComponent* InStaticMeshComponent);
     bool AddUsingComponents(UStaticMeshComponent* InStaticMeshComponent);
@@ -63,6 +81,7 @@ private:
     uint32 VertexCount = 0;     // 정점 개수
     uint32 IndexCount = 0;     // 버텍스 점의 개수 
     uint32 VertexStride = 0;
+    TArray<uint32> LODIndexOffsets; // LOD별 인덱스 버퍼 내 시작 위치 (LOD0 = 0)
     EVertexLayoutType VertexType = EVertexLayoutType::PositionColorTexturNormal;  // Stride를 계산하기 위한 버텍스 타입
 
 	// CPU 리소스
@@ -74,6 +93,9 @@ private:
 
     // 로컬 AABB. (스태틱메시 액터 전체 경계 계산에 사용. StaticMeshAsset 로드할 때마다 갱신)
     FAABB LocalBound;
+    float BoundsRadius = 0.0f;
+
+    FMeshletCullData* MeshletCullData = nullptr;
     
     TArray<UStaticMeshComponent*> UsingComponents; // 유저에 의해 Material이 안 바뀐 이 Mesh를 사용 중인 Component들(render state sorting 위함)
 };
@@ -0,0 +1,217 @@
+﻿#include "pch.h"
+#include "TangentGenerator.h"
+#include "ParallelFor.h"
+
+namespace
+{
+	// 퇴화 판정용 (제곱 길이/UV 면적 기준)
+	constexpr float DegenerateEpsilon = 1e-20f;
+
+	FVector ProjectOnPlane(const FVector& V, const FVector& Normal)
+	{
+		return V - Normal * FVector::Dot(V, Normal);
+	}
+
+	bool SafeNormalize(FVector& InOutV)
+	{
+		const float LengthSquared = InOutV.SizeSquared();
+		if (!(LengthSquared > DegenerateEpsilon) || !std::isfinite(LengthSquared))
+		{
+			return false;
+		}
+		InOutV = InOutV * (1.0f / std::sqrt(LengthSquared));
+		return true;
+	}
+
+	// 노멀에 수직인 임의 단위 벡터 (탄젠트를 정할 수 없는 정점용)
+	FVector MakePerpendicular(const FVector& Normal)
+	{
+		const FVector Axis = (std::fabs(Normal.X) < 0.9f) ? FVector(1.0f, 0.0f, 0.0f) : FVector(0.0f, 1.0f, 0.0f);
+		FVector Result = ProjectOnPlane(Axis, Normal);
+		if (!SafeNormalize(Result))
+		{
+			Result = FVector(1.0f, 0.0f, 0.0f);
+		}
+		return Result;
+	}
+
+	struct FFaceTangent
+	{
+		FVector Tangent;        // UV u 증가 방향 (크기 무관)
+		bool bPositive = true;  // 바이탄젠트 부호 (cross(T, N) 과 v 방향이 같은 쪽이면 true)
+		bool bValid = false;    // UV/위치가 퇴화되지 않음
+	};
+
+	// 정점 하나의 한쪽 handedness 누적 결과
+	struct FVertexAccum
+	{
+		FVector Sum = FVector(0.0f, 0.0f, 0.0f);
+		float Weight = 0.0f;
+	};
+}
+
+uint32 FTangentGenerator::GenerateTangents(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices, FTaskPool* InTaskPool)
+{
+	const uint32 VertexCount = static_cast<uint32>(InOutVertices.size());
+	const uint32 TriangleCount = static_cast<uint32>(InOutIndices.size() / 3);
+	if (VertexCount == 0 || TriangleCount == 0)
+	{
+		return 0;
+	}
+
+	// --- 1. 면 탄젠트 (병렬) ---
+	// 1/det 대신 det의 부호만 사용: 방향은 같고 크기는 어차피 정규화되므로 UV가 퇴화돼도 inf/NaN이 생기지 않음
+	TArray<FFaceTangent> Faces(TriangleCount);
+	ParallelForChunks(InTaskPool, TriangleCount, ParallelChunkSize, [&](uint32 Begin, uint32 End)
+		{
+			for (uint32 Tri = Begin; Tri < End; ++Tri)
+			{
+				const FNormalVertex& V0 = InOutVertices[InOutIndices[Tri * 3 + 0]];
+				const FNormalVertex& V1 = InOutVertices[InOutIndices[Tri * 3 + 1]];
+				const FNormalVertex& V2 = InOutVertices[InOutIndices[Tri * 3 + 2]];
+
+				const FVector E1 = V1.pos - V0.pos;
+				const FVector E2 = V2.pos - V0.pos;
+				const float DeltaU1 = V1.tex.X - V0.tex.X;
+				const float DeltaV1 = V1.tex.Y - V0.tex.Y;
+				const float DeltaU2 = V2.tex.X - V0.tex.X;
+				const float DeltaV2 = V2.tex.Y - V0.tex.Y;
+
+				const float Determinant = DeltaU1 * DeltaV2 - DeltaV1 * DeltaU2;
+				FFaceTangent& Face = Faces[Tri];
+				if (!(std::fabs(Determinant) > DegenerateEpsilon))
+				{
+					continue;
+				}
+
+				const float Sign = Determinant > 0.0f ? 1.0f : -1.0f;
+				FVector Tangent = (E1 * DeltaV2 - E2 * DeltaV1) * Sign;
+				const FVector BiTangent = (E2 * DeltaU1 - E1 * DeltaU2) * Sign;
+				if (!SafeNormalize(Tangent))
+				{
+					continue;
+				}
+
+				// handedness 기준 노멀: 정점 노멀 합 (노멀이 없으면 기하 노멀)
+				FVector ReferenceNormal = V0.normal + V1.normal + V2.normal;
+				if (!SafeNormalize(ReferenceNormal))
+				{
+					ReferenceNormal = FVector::Cross(E1, E2);
+				}
+
+				Face.Tangent = Tangent;
+				Face.bPositive = FVector::Dot(FVector::Cross(Tangent, ReferenceNormal), BiTangent) > 0.0f;
+				Face.bValid = true;
+			}
+		});
+
+	// --- 2. 정점 → 코너 인접 리스트 (CSR) ---
+	TArray<uint32> CornerOffsets(VertexCount + 1, 0);
+	for (uint32 Index : InOutIndices)
+	{
+		++CornerOffsets[Index + 1];
+	}
+	for (uint32 v = 0; v < VertexCount; ++v)
+	{
+		CornerOffsets[v + 1] += CornerOffsets[v];
+	}
+	TArray<uint32> Corners(TriangleCount * 3);
+	{
+		TArray<uint32> Cursor(CornerOffsets.begin(), CornerOffsets.end() - 1);
+		for (uint32 Corner = 0; Corner < TriangleCount * 3; ++Corner)
+		{
+			Corners[Cursor[InOutIndices[Corner]]++] = Corner;
+		}
+	}
+
+	// --- 3. 정점별 각도 가중 누적 (병렬, 정점마다 독립) ---
+	TArray<FVertexAccum> PositiveAccum(VertexCount);
+	TArray<FVertexAccum> NegativeAccum(VertexCount);
+	ParallelForChunks(InTaskPool, VertexCount, ParallelChunkSize, [&](uint32 Begin, uint32 End)
+		{
+			for (uint32 v = Begin; v < End; ++v)
+			{
+				const FVector& Normal = InOutVertices[v].normal;
+				for (uint32 c = CornerOffsets[v]; c < CornerOffsets[v + 1]; ++c)
+				{
+					const uint32 Corner = Corners[c];
+					const uint32 Tri = Corner / 3;
+					const FFaceTangent& Face = Faces[Tri];
+					if (!Face.bValid)
+					{
+						continue;
+					}
+
+					FVector Tangent = ProjectOnPlane(Face.Tangent, Normal);
+					if (!SafeNormalize(Tangent))
+					{
+						continue;
+					}
+
+					// 코너 각도 (노멀 평면에 투영한 두 변 사이)
+					const uint32 Local = Corner % 3;
+					const FVector& P = InOutVertices[v].pos;
+					FVector ToNext = ProjectOnPlane(InOutVertices[InOutIndices[Tri * 3 + (Local + 1) % 3]].pos - P, Normal);
+					FVector ToPrev = ProjectOnPlane(InOutVertices[InOutIndices[Tri * 3 + (Local + 2) % 3]].pos - P, Normal);
+					if (!SafeNormalize(ToNext) || !SafeNormalize(ToPrev))
+					{
+						continue;
+					}
+					const float Angle = std::acos(std::clamp(FVector::Dot(ToNext, ToPrev), -1.0f, 1.0f));
+
+					FVertexAccum& Accum = Face.bPositive ? PositiveAccum[v] : NegativeAccum[v];
+					Accum.Sum = Accum.Sum + Tangent * Angle;
+					Accum.Weight += Angle;
+				}
+			}
+		});
+
+	// --- 4. handedness가 섞인 정점 분리 (미러링 UV 이음새, 드묾) ---
+	uint32 SplitCount = 0;
+	for (uint32 v = 0; v < VertexCount; ++v)
+	{
+		if (PositiveAccum[v].Weight <= 0.0f || NegativeAccum[v].Weight <= 0.0f)
+		{
+			continue;
+		}
+
+		const uint32 NewIndex = static_cast<uint32>(InOutVertices.size());
+		InOutVertices.push_back(InOutVertices[v]);
+		for (uint32 c = CornerOffsets[v]; c < CornerOffsets[v + 1]; ++c)
+		{
+			const uint32 Corner = Corners[c];
+			const FFaceTangent& Face = Faces[Corner / 3];
+			if (Face.bValid && !Face.bPositive)
+			{
+				InOutIndices[Corner] = NewIndex;
+			}
+		}
+
+		FVertexAccum NewAccum;
+		NewAccum.Sum = NegativeAccum[v].Sum;
+		NewAccum.Weight = NegativeAccum[v].Weight;
+		NegativeAccum[v] = FVertexAccum();
+		NegativeAccum.push_back(NewAccum);
+		PositiveAccum.push_back(FVertexAccum());
+		++SplitCount;
+	}
+
+	// --- 5. 최종 탄젠트 (병렬) ---
+	const uint32 FinalVertexCount = static_cast<uint32>(InOutVertices.size());
+	ParallelForChunks(InTaskPool, FinalVertexCount, ParallelChunkSize, [&](uint32 Begin, uint32 End)
+		{
+			for (uint32 v = Begin; v < End; ++v)
+			{
+				FNormalVertex& Vertex = InOutVertices[v];
+				const bool bPositive = PositiveAccum[v].Weight >= NegativeAccum[v].Weight;
+				FVector Tangent = ProjectOnPlane(bPositive ? PositiveAccum[v].Sum : NegativeAccum[v].Sum, Vertex.normal);
+				if (!SafeNormalize(Tangent))
+				{
+					Tangent = MakePerpendicular(Vertex.normal);
+				}
+				Vertex.Tangent = FVector4(Tangent.X, Tangent.Y, Tangent.Z, bPositive ? 1.0f : -1.0f);
+			}
+		});
+
+	return SplitCount;
+}
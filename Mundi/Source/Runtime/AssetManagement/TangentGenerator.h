@@ -0,0 +1,22 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+
+class FTaskPool;
+
+/**
+ * 용접(인덱스)된 메시에서 MikkTSpace 방식으로 탄젠트를 생성합니다.
+ * - 면 탄젠트를 정점 노멀 평면에 투영/정규화한 뒤 코너 각도로 가중 합산
+ * - UV가 퇴화된 삼각형은 기여하지 않고, 탄젠트가 정해지지 않는 정점은 노멀에 수직인 임의 축을 사용
+ * - 한 정점에서 UV 방향(handedness)이 갈리는 미러링 이음새는 정점을 복제해 분리
+ * 면/정점 단위 계산은 청크로 나눠 InTaskPool의 워커에서 병렬 처리합니다. (풀이 없으면 단일 스레드)
+ */
+struct FTangentGenerator
+{
+	// 이보다 작은 작업은 워커에 나눠 주는 비용이 더 크므로 단일 스레드로 처리
+	static constexpr uint32 ParallelChunkSize = 16 * 1024;
+
+	// Tangent(xyz = 탄젠트, w = 바이탄젠트 부호)를 채웁니다. 미러링 이음새 정점은 InOutVertices 뒤에 추가되고 InOutIndices가 갱신됩니다.
+	// @return 분리를 위해 추가된 정점 수
+	static uint32 GenerateTangents(TArray<FNormalVertex>& InOutVertices, TArray<uint32>& InOutIndices, FTaskPool* InTaskPool = nullptr);
+};
@@ -140,6 +140,9 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 			Height = desc.Height;
 			Format = desc.Format;
 		}
+
+		// 같은 텍스처 객체가 다시 로드되면 이를 참조하는 뷰포트 캐시도 갱신되어야 함
+		MarkContentChanged();
 	}
 	else
 	{
@@ -0,0 +1,421 @@
+﻿#include "pch.h"
+#include "VertexCompression.h"
+#include <random>
+
+namespace
+{
+	constexpr float Unorm16Max = 65535.0f;
+	constexpr float Snorm16Max = 32767.0f;
+
+	// 축 범위가 0인 경우(평면 메시) 0으로 나누지 않도록 최소값 보장
+	float SafeExtent(float Extent)
+	{
+		return Extent > KINDA_SMALL_NUMBER ? Extent : 1.0f;
+	}
+
+	uint16 QuantizeUnorm16(float Value, float Min, float Extent)
+	{
+		const float Normalized = std::clamp((Value - Min) / SafeExtent(Extent), 0.0f, 1.0f);
+		return static_cast<uint16>(std::lround(Normalized * Unorm16Max));
+	}
+
+	float DequantizeUnorm16(uint16 Value, float Min, float Extent)
+	{
+		return Min + (static_cast<float>(Value) / Unorm16Max) * SafeExtent(Extent);
+	}
+
+	// D3D SNORM 변환 규칙과 동일 (-32768도 -1로 클램프)
+	float SnormToFloat(int16 Value)
+	{
+		return std::max(static_cast<float>(Value) / Snorm16Max, -1.0f);
+	}
+
+	float SignNotZero(float Value)
+	{
+		return Value >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	float AngleBetween(const FVector& A, const FVector& B)
+	{
+		const float LengthProduct = A.Size() * B.Size();
+		if (LengthProduct <= KINDA_SMALL_NUMBER)
+		{
+			return 0.0f;
+		}
+		return std::acos(std::clamp(FVector::Dot(A, B) / LengthProduct, -1.0f, 1.0f));
+	}
+}
+
+uint16 FVertexCompression::FloatToHalf(float Value)
+{
+	uint32 Bits;
+	std::memcpy(&Bits, &Value, sizeof(Bits));
+
+	const uint32 Sign = (Bits >> 16) & 0x8000u;
+	const uint32 FloatExponent = (Bits >> 23) & 0xFFu;
+	uint32 Mantissa = Bits & 0x7FFFFFu;
+
+	// Inf / NaN
+	if (FloatExponent == 0xFFu)
+	{
+		return static_cast<uint16>(Sign | 0x7C00u | (Mantissa ? 0x200u : 0u));
+	}
+
+	const int32 Exponent = static_cast<int32>(FloatExponent) - 127 + 15;
+	if (Exponent >= 31)
+	{
+		return static_cast<uint16>(Sign | 0x7C00u); // 범위 초과 → Inf
+	}
+
+	if (Exponent <= 0)
+	{
+		// half 비정규화 수 (또는 0)
+		if (Exponent < -10)
+		{
+			return static_cast<uint16>(Sign);
+		}
+		Mantissa |= 0x800000u;
+		const uint32 Shift = static_cast<uint32>(14 - Exponent);
+		uint32 Half = Mantissa >> Shift;
+		const uint32 Remainder = Mantissa & ((1u << Shift) - 1u);
+		const uint32 HalfWay = 1u << (Shift - 1u);
+		if (Remainder > HalfWay || (Remainder == HalfWay && (Half & 1u)))
+		{
+			++Half;
+		}
+		return static_cast<uint16>(Sign | Half);
+	}
+
+	// 최근접 짝수 반올림. 가수 올림이 지수로 넘어가도 올바른 결과가 됨
+	uint32 Half = (static_cast<uint32>(Exponent) << 10) | (Mantissa >> 13);
+	const uint32 Remainder = Mantissa & 0x1FFFu;
+	if (Remainder > 0x1000u || (Remainder == 0x1000u && (Half & 1u)))
+	{
+		++Half;
+	}
+	return static_cast<uint16>(Sign | Half);
+}
+
+float FVertexCompression::HalfToFloat(uint16 Value)
+{
+	const uint32 Sign = (static_cast<uint32>(Value) & 0x8000u) << 16;
+	const uint32 Exponent = (Value >> 10) & 0x1Fu;
+	const uint32 Mantissa = Value & 0x3FFu;
+
+	if (Exponent == 0)
+	{
+		// 0 또는 비정규화 수
+		const float Magnitude = static_cast<float>(Mantissa) * (1.0f / 16777216.0f); // 2^-24
+		return Sign ? -Magnitude : Magnitude;
+	}
+
+	uint32 Bits;
+	if (Exponent == 31)
+	{
+		Bits = Sign | 0x7F800000u | (Mantissa << 13);
+	}
+	else
+	{
+		Bits = Sign | ((Exponent + 112u) << 23) | (Mantissa << 13);
+	}
+
+	float Result;
+	std::memcpy(&Result, &Bits, sizeof(Result));
+	return Result;
+}
+
+void FVertexCompression::EncodeOctahedral(const FVector& Direction, int16 OutEncoded[2])
+{
+	const float L1Norm = std::fabs(Direction.X) + std::fabs(Direction.Y) + std::fabs(Direction.Z);
+	if (L1Norm <= KINDA_SMALL_NUMBER)
+	{
+		// 노멀이 없는 정점: +Z로 인코딩
+		OutEncoded[0] = 0;
+		OutEncoded[1] = 0;
+		return;
+	}
+
+	float X = Direction.X / L1Norm;
+	float Y = Direction.Y / L1Norm;
+	if (Direction.Z < 0.0f)
+	{
+		const float FoldedX = (1.0f - std::fabs(Y)) * SignNotZero(X);
+		const float FoldedY = (1.0f - std::fabs(X)) * SignNotZero(Y);
+		X = FoldedX;
+		Y = FoldedY;
+	}
+
+	// 내림/올림 4가지 조합 중 디코드 결과가 원본과 가장 가까운 것을 선택 (단순 반올림보다 오차가 작음)
+	const FVector Target = Direction.GetNormalized();
+	const float ScaledX = std::clamp(X, -1.0f, 1.0f) * Snorm16Max;
+	const float ScaledY = std::clamp(Y, -1.0f, 1.0f) * Snorm16Max;
+	float BestDot = -2.0f;
+	for (uint32 Candidate = 0; Candidate < 4; ++Candidate)
+	{
+		const int16 Encoded[2] = {
+			static_cast<int16>((Candidate & 1u) ? std::ceil(ScaledX) : std::floor(ScaledX)),
+			static_cast<int16>((Candidate & 2u) ? std::ceil(ScaledY) : std::floor(ScaledY)) };
+		const float Dot = FVector::Dot(DecodeOctahedral(Encoded), Target);
+		if (Dot > BestDot)
+		{
+			BestDot = Dot;
+			OutEncoded[0] = Encoded[0];
+			OutEncoded[1] = Encoded[1];
+		}
+	}
+}
+
+FVector FVertexCompression::DecodeOctahedral(const int16 Encoded[2])
+{
+	FVector Direction(SnormToFloat(Encoded[0]), SnormToFloat(Encoded[1]), 0.0f);
+	Direction.Z = 1.0f - std::fabs(Direction.X) - std::fabs(Direction.Y);
+
+	// 아래쪽 반구 펼침 복원 (셰이더와 같은 식)
+	const float Fold = std::clamp(-Direction.Z, 0.0f, 1.0f);
+	Direction.X += Direction.X >= 0.0f ? -Fold : Fold;
+	Direction.Y += Direction.Y >= 0.0f ? -Fold : Fold;
+	return Direction.GetNormalized();
+}
+
+bool FVertexCompression::CanCompress(const TArray<FNormalVertex>& Vertices, FString* OutReason)
+{
+	if (Vertices.empty())
+	{
+		if (OutReason) *OutReason = "no vertices";
+		return false;
+	}
+
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		// 압축 포맷에는 색상이 없으므로 셰이더 기본값(1,1,1,1)과 같을 때만 허용
+		if (Vertex.color.X != 1.0f || Vertex.color.Y != 1.0f || Vertex.color.Z != 1.0f || Vertex.color.W != 1.0f)
+		{
+			if (OutReason) *OutReason = "non-constant vertex color";
+			return false;
+		}
+		if (!(std::fabs(Vertex.tex.X) <= MaxHalfTexCoord) || !(std::fabs(Vertex.tex.Y) <= MaxHalfTexCoord))
+		{
+			if (OutReason) *OutReason = "texcoord out of half precision range";
+			return false;
+		}
+	}
+	return true;
+}
+
+FCompressedVertex FVertexCompression::CompressVertex(const FNormalVertex& Vertex, const FVector& PositionMin, const FVector& PositionExtent)
+{
+	FCompressedVertex Result;
+	Result.Position[0] = QuantizeUnorm16(Vertex.pos.X, PositionMin.X, PositionExtent.X);
+	Result.Position[1] = QuantizeUnorm16(Vertex.pos.Y, PositionMin.Y, PositionExtent.Y);
+	Result.Position[2] = QuantizeUnorm16(Vertex.pos.Z, PositionMin.Z, PositionExtent.Z);
+	Result.Position[3] = Vertex.Tangent.W < 0.0f ? 0 : 65535;
+
+	EncodeOctahedral(Vertex.normal, Result.Normal);
+	EncodeOctahedral(FVector(Vertex.Tangent.X, Vertex.Tangent.Y, Vertex.Tangent.Z), Result.Tangent);
+
+	Result.TexCoord[0] = FloatToHalf(Vertex.tex.X);
+	Result.TexCoord[1] = FloatToHalf(Vertex.tex.Y);
+	return Result;
+}
+
+FNormalVertex FVertexCompression::DecompressVertex(const FCompressedVertex& Vertex, const FVector& PositionMin, const FVector& PositionExtent)
+{
+	FNormalVertex Result{};
+	Result.pos = FVector(
+		DequantizeUnorm16(Vertex.Position[0], PositionMin.X, PositionExtent.X),
+		DequantizeUnorm16(Vertex.Position[1], PositionMin.Y, PositionExtent.Y),
+		DequantizeUnorm16(Vertex.Position[2], PositionMin.Z, PositionExtent.Z));
+	Result.normal = DecodeOctahedral(Vertex.Normal);
+
+	const FVector Tangent = DecodeOctahedral(Vertex.Tangent);
+	Result.Tangent = FVector4(Tangent.X, Tangent.Y, Tangent.Z, Vertex.Position[3] >= 32768 ? 1.0f : -1.0f);
+
+	Result.tex = FVector2D(HalfToFloat(Vertex.TexCoord[0]), HalfToFloat(Vertex.TexCoord[1]));
+	Result.color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+	return Result;
+}
+
+float FVertexCompression::GetPositionErrorBound(const FVector& PositionExtent)
+{
+	const FVector Step(
+		SafeExtent(PositionExtent.X) / Unorm16Max,
+		SafeExtent(PositionExtent.Y) / Unorm16Max,
+		SafeExtent(PositionExtent.Z) / Unorm16Max);
+	// float 연산 오차 여유를 조금 둠
+	return Step.Size() * 0.5f * 1.01f;
+}
+
+FVertexCompressionError FVertexCompression::MeasureError(const TArray<FNormalVertex>& Vertices, const TArray<FCompressedVertex>& Compressed, const FVector& PositionMin, const FVector& PositionExtent)
+{
+	FVertexCompressionError Error;
+	const size_t Count = std::min(Vertices.size(), Compressed.size());
+	for (size_t i = 0; i < Count; ++i)
+	{
+		const FNormalVertex& Original = Vertices[i];
+		const FNormalVertex Decoded = DecompressVertex(Compressed[i], PositionMin, PositionExtent);
+
+		Error.MaxPositionError = std::max(Error.MaxPositionError, (Decoded.pos - Original.pos).Size());
+		if (Original.normal.SizeSquared() > KINDA_SMALL_NUMBER)
+		{
+			Error.MaxNormalAngle = std::max(Error.MaxNormalAngle, AngleBetween(Decoded.normal, Original.normal));
+		}
+		const FVector OriginalTangent(Original.Tangent.X, Original.Tangent.Y, Original.Tangent.Z);
+		if (OriginalTangent.SizeSquared() > KINDA_SMALL_NUMBER)
+		{
+			Error.MaxTangentAngle = std::max(Error.MaxTangentAngle, AngleBetween(FVector(Decoded.Tangent.X, Decoded.Tangent.Y, Decoded.Tangent.Z), OriginalTangent));
+		}
+		Error.MaxTexCoordError = std::max(Error.MaxTexCoordError, std::max(std::fabs(Decoded.tex.X - Original.tex.X), std::fabs(Decoded.tex.Y - Original.tex.Y)));
+	}
+	return Error;
+}
+
+bool FVertexCompression::CompressStaticMesh(FStaticMesh* InOutStaticMesh)
+{
+	if (!InOutStaticMesh)
+	{
+		return false;
+	}
+
+	InOutStaticMesh->CompressedVertices.clear();
+
+	FString Reason;
+	if (!CanCompress(InOutStaticMesh->Vertices, &Reason))
+	{
+		UE_LOG("[VertexCompression] %s: kept uncompressed (%s)", InOutStaticMesh->PathFileName.c_str(), Reason.c_str());
+		return false;
+	}
+
+	const TArray<FNormalVertex>& Vertices = InOutStaticMesh->Vertices;
+	FVector Min = Vertices[0].pos;
+	FVector Max = Min;
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		Min = Min.ComponentMin(Vertex.pos);
+		Max = Max.ComponentMax(Vertex.pos);
+	}
+	const FVector Extent = Max - Min;
+
+	TArray<FCompressedVertex> Compressed;
+	Compressed.reserve(Vertices.size());
+	for (const FNormalVertex& Vertex : Vertices)
+	{
+		Compressed.push_back(CompressVertex(Vertex, Min, Extent));
+	}
+
+	// 디코드 오차가 양자화 한계를 넘으면(인코딩 버그 또는 비정상 입력) 압축하지 않음
+	const FVertexCompressionError Error = MeasureError(Vertices, Compressed, Min, Extent);
+	const float PositionBound = GetPositionErrorBound(Extent);
+	const float TexCoordBound = MaxHalfTexCoord / 2048.0f;
+	if (Error.MaxPositionError > PositionBound || Error.MaxNormalAngle > MaxOctahedralAngleError ||
+		Error.MaxTangentAngle > MaxOctahedralAngleError || Error.MaxTexCoordError > TexCoordBound)
+	{
+		UE_LOG("[VertexCompression] %s: kept uncompressed (error over bound: pos %.6f/%.6f, normal %.5f, tangent %.5f, uv %.6f)",
+			InOutStaticMesh->PathFileName.c_str(), Error.MaxPositionError, PositionBound,
+			Error.MaxNormalAngle, Error.MaxTangentAngle, Error.MaxTexCoordError);
+		return false;
+	}
+
+	InOutStaticMesh->CompressedVertices = std::move(Compressed);
+	InOutStaticMesh->CompressedPositionMin = Min;
+	InOutStaticMesh->CompressedPositionExtent = Extent;
+
+	UE_LOG("[VertexCompression] %s: %zu vertices, %zu -> %zu bytes (max error pos %.6f, normal %.4f deg, uv %.6f)",
+		InOutStaticMesh->PathFileName.c_str(), Vertices.size(),
+		Vertices.size() * 64, Vertices.size() * sizeof(FCompressedVertex),
+		Error.MaxPositionError, RadiansToDegrees(Error.MaxNormalAngle), Error.MaxTexCoordError);
+	return true;
+}
+
+bool FVertexCompression::RunSelfTest(uint32 InVertexCount)
+{
+	uint32 Failures = 0;
+
+	// 1. half: 유한한 half 값은 float로 풀었다가 다시 인코딩하면 비트가 그대로여야 함
+	uint32 HalfMismatches = 0;
+	for (uint32 Bits = 0; Bits <= 0xFFFFu; ++Bits)
+	{
+		const uint16 Half = static_cast<uint16>(Bits);
+		if (((Half >> 10) & 0x1Fu) == 0x1Fu)
+		{
+			continue; // Inf / NaN
+		}
+		if (FloatToHalf(HalfToFloat(Half)) != Half)
+		{
+			++HalfMismatches;
+		}
+	}
+	Failures += HalfMismatches ? 1 : 0;
+	UE_LOG("[VertexCompressionTest] half round trip: %u mismatches %s", HalfMismatches, HalfMismatches ? "FAILED" : "OK");
+
+	// 2. 합성 정점: 고정 시드 난수 + 옥타헤드럴 접힘 경계/축 방향/UV 경계 같은 특수값
+	std::mt19937 Random(12345u);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	auto RandomDirection = [&]()
+	{
+		FVector Direction;
+		do
+		{
+			Direction = FVector(Unit(Random), Unit(Random), Unit(Random));
+		} while (Direction.SizeSquared() < 1e-4f || Direction.SizeSquared() > 1.0f);
+		return Direction.GetNormalized();
+	};
+
+	const FVector SpecialDirections[] = {
+		FVector(1, 0, 0), FVector(-1, 0, 0), FVector(0, 1, 0), FVector(0, -1, 0), FVector(0, 0, 1), FVector(0, 0, -1),
+		FVector(0.7071068f, 0.0f, -0.7071068f), FVector(0.5f, 0.5f, -0.7071068f), FVector(-0.5f, -0.5f, -0.7071068f),
+		FVector(0.577f, 0.577f, 0.577f), FVector(0.577f, -0.577f, -0.577f), FVector(1.0f, 1e-4f, -1e-4f) };
+	const float SpecialTexCoords[] = { 0.0f, 1.0f, 0.5f, -1.0f, 3.999f, -3.999f, MaxHalfTexCoord, 1.0f / 3.0f };
+
+	// 한 축이 평평한 메시(범위 0)도 포함하도록 Z 범위를 0으로 둔 경우를 별도로 검사
+	const FVector PositionMins[2] = { FVector(-123.4f, 5.0f, -0.25f), FVector(-1.0f, -1.0f, 2.0f) };
+	const FVector PositionExtents[2] = { FVector(250.0f, 0.5f, 1000.0f), FVector(2.0f, 2.0f, 0.0f) };
+
+	const uint32 VertexCount = std::max(InVertexCount, static_cast<uint32>(std::size(SpecialDirections) + std::size(SpecialTexCoords)));
+	for (uint32 Case = 0; Case < 2; ++Case)
+	{
+		const FVector& Min = PositionMins[Case];
+		const FVector& Extent = PositionExtents[Case];
+
+		TArray<FNormalVertex> Vertices(VertexCount);
+		std::uniform_real_distribution<float> Fraction(0.0f, 1.0f);
+		std::uniform_real_distribution<float> TexCoord(-MaxHalfTexCoord, MaxHalfTexCoord);
+		for (uint32 i = 0; i < VertexCount; ++i)
+		{
+			FNormalVertex& Vertex = Vertices[i];
+			// 양 끝(Min, Min + Extent)이 반드시 포함되도록 처음 두 정점은 모서리에 둠
+			const float T = i == 0 ? 0.0f : (i == 1 ? 1.0f : Fraction(Random));
+			Vertex.pos = FVector(Min.X + Extent.X * T, Min.Y + Extent.Y * Fraction(Random), Min.Z + Extent.Z * Fraction(Random));
+			Vertex.normal = i < std::size(SpecialDirections) ? SpecialDirections[i].GetNormalized() : RandomDirection();
+			const FVector Tangent = RandomDirection();
+			Vertex.Tangent = FVector4(Tangent.X, Tangent.Y, Tangent.Z, (i & 1u) ? 1.0f : -1.0f);
+			Vertex.tex = i < std::size(SpecialTexCoords)
+				? FVector2D(SpecialTexCoords[i], -SpecialTexCoords[i])
+				: FVector2D(TexCoord(Random), TexCoord(Random));
+			Vertex.color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+		}
+
+		TArray<FCompressedVertex> Compressed;
+		Compressed.reserve(VertexCount);
+		uint32 SignMismatches = 0;
+		for (const FNormalVertex& Vertex : Vertices)
+		{
+			Compressed.push_back(CompressVertex(Vertex, Min, Extent));
+			const FNormalVertex Decoded = DecompressVertex(Compressed.back(), Min, Extent);
+			SignMismatches += (Decoded.Tangent.W < 0.0f) != (Vertex.Tangent.W < 0.0f) ? 1 : 0;
+		}
+
+		const FVertexCompressionError Error = MeasureError(Vertices, Compressed, Min, Extent);
+		const float PositionBound = GetPositionErrorBound(Extent);
+		const float TexCoordBound = MaxHalfTexCoord / 2048.0f;
+		const bool bPassed = Error.MaxPositionError <= PositionBound && Error.MaxNormalAngle <= MaxOctahedralAngleError &&
+			Error.MaxTangentAngle <= MaxOctahedralAngleError && Error.MaxTexCoordError <= TexCoordBound && SignMismatches == 0;
+		Failures += bPassed ? 0 : 1;
+
+		UE_LOG("[VertexCompressionTest] case %u: %u vertices, pos %.6f/%.6f, normal %.5f/%.5f, tangent %.5f/%.5f rad, uv %.6f/%.6f, sign mismatches %u %s",
+			Case, VertexCount, Error.MaxPositionError, PositionBound, Error.MaxNormalAngle, MaxOctahedralAngleError,
+			Error.MaxTangentAngle, MaxOctahedralAngleError, Error.MaxTexCoordError, TexCoordBound, SignMismatches, bPassed ? "OK" : "FAILED");
+	}
+
+	UE_LOG("[VertexCompressionTest] %s (%u failures)", Failures == 0 ? "PASSED" : "FAILED", Failures);
+	return Failures == 0;
+}
@@ -0,0 +1,52 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Enums.h"
+
+// 디코드 결과의 최대 오차 (압축 검증/로그용)
+struct FVertexCompressionError
+{
+	float MaxPositionError = 0.0f;  // 로컬 단위
+	float MaxNormalAngle = 0.0f;    // 라디안
+	float MaxTangentAngle = 0.0f;   // 라디안
+	float MaxTexCoordError = 0.0f;
+};
+
+/**
+ * 스태틱 메시 정점 압축 (FNormalVertex 64바이트 → FCompressedVertex 20바이트)
+ * - 위치: 메시 AABB 기준 UNORM16
+ * - 노멀/탄젠트: 옥타헤드럴 인코딩 SNORM16x2, 탄젠트 부호는 위치 w에 저장
+ * - UV: half float
+ * - 색상: 상수(1,1,1,1)인 경우에만 압축하고 버림
+ * 디코드는 셰이더(Shaders/Common/VertexCompression.hlsl)와 같은 식을 사용합니다.
+ */
+struct FVertexCompression
+{
+	// half UV 정밀도 한계. 이보다 큰 UV(타일링)가 있으면 압축하지 않음 (|uv| < 4 에서 간격 2^-9 이하)
+	static constexpr float MaxHalfTexCoord = 4.0f;
+
+	// 옥타헤드럴 SNORM16 인코딩 후 허용하는 최대 각도 오차 (라디안)
+	static constexpr float MaxOctahedralAngleError = 1e-3f;
+
+	static uint16 FloatToHalf(float Value);
+	static float HalfToFloat(uint16 Value);
+
+	static void EncodeOctahedral(const FVector& Direction, int16 OutEncoded[2]);
+	static FVector DecodeOctahedral(const int16 Encoded[2]);
+
+	static bool CanCompress(const TArray<FNormalVertex>& Vertices, FString* OutReason = nullptr);
+
+	static FCompressedVertex CompressVertex(const FNormalVertex& Vertex, const FVector& PositionMin, const FVector& PositionExtent);
+	static FNormalVertex DecompressVertex(const FCompressedVertex& Vertex, const FVector& PositionMin, const FVector& PositionExtent);
+
+	// 양자화 간격으로 계산한 위치 오차 한계 (축별 간격의 절반을 합친 대각선)
+	static float GetPositionErrorBound(const FVector& PositionExtent);
+
+	static FVertexCompressionError MeasureError(const TArray<FNormalVertex>& Vertices, const TArray<FCompressedVertex>& Compressed, const FVector& PositionMin, const FVector& PositionExtent);
+
+	// CompressedVertices/Min/Extent를 채움. 압축할 수 없거나 디코드 검증에 실패하면 비워 두고 false
+	static bool CompressStaticMesh(FStaticMesh* InOutStaticMesh);
+
+	// 합성 정점(고정 시드 난수 + 접힘 경계/축 방향/UV 경계)을 인코드/디코드해 위치/노멀/탄젠트/UV 최대 오차가
+	// 위 한계 안에 있는지, 모든 유한 half 값이 왕복 후 그대로인지 검사 (에셋 불필요). 모두 통과하면 true
+	static bool RunSelfTest(uint32 InVertexCount);
+};
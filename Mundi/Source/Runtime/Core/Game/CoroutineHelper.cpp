@@ -1,7 +1,9 @@
 ﻿#include "pch.h"
 #include "CoroutineHelper.h"
+#include "CoroutineScheduler.h"
 #include "YieldInstruction.h"
 #include "Source/Runtime/ScriptSys/ScriptComponent.h"
+#include "World.h"
 
 FCoroutineHelper::FCoroutineHelper(UScriptComponent* InOwner)
 	: OwnerComponent(InOwner)
@@ -10,228 +12,90 @@ FCoroutineHelper::FCoroutineHelper(UScriptComponent* InOwner)
 
 FCoroutineHelper::~FCoroutineHelper()
 {
-	StopAllCoroutines();
+	if (Scheduler)
+	{
+		Scheduler->Unbind(this);
+		Scheduler = nullptr;
+	}
 	OwnerComponent = nullptr;
 }
 
-void FCoroutineHelper::RunScheduler(float DeltaTime)
+int FCoroutineHelper::StartCoroutine(sol::function EntryPoint)
 {
-    if (ActiveCoroutines.empty()) { return; }
-
-    for (auto it = ActiveCoroutines.begin(); it != ActiveCoroutines.end();)
-    {
-        FCoroutineState& State = *it;
-
-        if (!State.Coroutine.valid())
-        {
-            UE_LOG(("[CoroutineHelper] Coroutine " + std::to_string(State.ID) + " is invalid, removing\n").c_str());
-
-            // Release thread reference
-            if (State.ThreadRef != LUA_NOREF && State.MainState)
-            {
-                luaL_unref(State.MainState, LUA_REGISTRYINDEX, State.ThreadRef);
-            }
-
-            it = ActiveCoroutines.erase(it);
-            continue;
-        }
-
-        // lua_State 상태 확인
-        lua_State* L = State.Coroutine.lua_state();
-        if (!L)
-        {
-            UE_LOG(("[CoroutineHelper] Coroutine " + std::to_string(State.ID) + " has null lua_state, removing\n").c_str());
-
-            // Release thread reference
-            if (State.ThreadRef != LUA_NOREF && State.MainState)
-            {
-                luaL_unref(State.MainState, LUA_REGISTRYINDEX, State.ThreadRef);
-            }
-
-            it = ActiveCoroutines.erase(it);
-            continue;
-        }
-
-        // YieldInstruction이 남아있으면 대기 처리
-        if (State.CurrentInstruction)
-        {
-            if (!State.CurrentInstruction->IsReady(this, DeltaTime))
-            {
-                ++it;
-                continue;
-            }
-
-            delete State.CurrentInstruction;
-            State.CurrentInstruction = nullptr;
-        }
-
-        // 한 스텝 실행
-        UE_LOG(("[CoroutineHelper] Executing coroutine " + std::to_string(State.ID) + "...\n").c_str());
-        sol::protected_function_result Result = State.Coroutine();
-
-        if (!Result.valid())
-        {
-            sol::error Err = Result;
-            FString ErrorMsg = FString("[Coroutine] resume error: ") + Err.what() + "\n";
-            UE_LOG(ErrorMsg.c_str());
-
-            if (State.CurrentInstruction)
-            {
-                delete State.CurrentInstruction;
-            }
-
-            // Release thread reference
-            if (State.ThreadRef != LUA_NOREF && State.MainState)
-            {
-                luaL_unref(State.MainState, LUA_REGISTRYINDEX, State.ThreadRef);
-            }
-
-            it = ActiveCoroutines.erase(it);
-            continue;
-        }
-
-        int status = lua_status(L);
-        
-        // dead = 0 (LUA_OK), yield = LUA_YIELD(1)
-        if (status == LUA_OK)
-        {
-            if (State.CurrentInstruction)
-            {
-                delete State.CurrentInstruction;
-            }
-
-            // Release thread reference
-            if (State.ThreadRef != LUA_NOREF && State.MainState)
-            {
-                luaL_unref(State.MainState, LUA_REGISTRYINDEX, State.ThreadRef);
-            }
-
-            it = ActiveCoroutines.erase(it);
-            continue;
-        }
+	if (!OwnerComponent)
+	{
+		UE_LOG("[CoroutineHelper] ERROR: OwnerComponent is null\n");
+		return -1;
+	}
 
-        // yield된 경우, YieldInstruction 처리
-        sol::object YieldValue = Result.get<sol::object>();
-        if (YieldValue.is<FYieldInstruction*>())
-        {
-            State.CurrentInstruction = YieldValue.as<FYieldInstruction*>();
-        }
+	FCoroutineScheduler* WorldScheduler = ResolveScheduler();
+	if (!WorldScheduler)
+	{
+		UE_LOG("[CoroutineHelper] ERROR: no coroutine scheduler (component is not in a world)\n");
+		return -1;
+	}
 
-        ++it;
-    }
+	return WorldScheduler->StartCoroutine(this, EntryPoint, OwnerComponent->GetScriptEnv(), OwnerComponent->GetLuaAllocScopeId());
 }
 
-int FCoroutineHelper::StartCoroutine(sol::function EntryPoint)
+void FCoroutineHelper::StopCoroutine(int CoroutineID)
 {
-    if (!EntryPoint.valid())
-    {
-        UE_LOG("[CoroutineHelper] ERROR: EntryPoint is invalid\n");
-        return -1;
-    }
-
-    if (!OwnerComponent)
-    {
-        UE_LOG("[CoroutineHelper] ERROR: OwnerComponent is null\n");
-        return -1;
-    }
-
-    // 1️. OwnerComponent의 스크립트 환경 가져오기
-    sol::environment scriptEnv = OwnerComponent->GetScriptEnv();
-    if (!scriptEnv.valid())
-    {
-        UE_LOG("[CoroutineHelper] ERROR: ScriptEnv is invalid\n");
-        return -1;
-    }
-
-    // 2️. 메인 state 가져오기
-    lua_State* MainState = EntryPoint.lua_state();
-    UE_LOG(("[CoroutineHelper] MainState: " + std::to_string((uintptr_t)MainState) + "\n").c_str());
-
-    // 3️. 독립적인 Lua 스레드 생성 및 레지스트리에 참조 저장 (GC 방지)
-    lua_State* NewThread = lua_newthread(MainState);
-    UE_LOG(("[CoroutineHelper] NewThread: " + std::to_string((uintptr_t)NewThread) + "\n").c_str());
-    int threadRef = luaL_ref(MainState, LUA_REGISTRYINDEX);  // Thread를 registry에 저장하고 pop
-    UE_LOG(("[CoroutineHelper] Thread reference stored in registry: " + std::to_string(threadRef) + "\n").c_str());
-
-    // 4️. EntryPoint 함수를 NewThread에 직접 push
-    EntryPoint.push(NewThread);
-    UE_LOG(("[CoroutineHelper] EntryPoint pushed to NewThread, top: " + std::to_string(lua_gettop(NewThread)) + "\n").c_str());
-
-    // 5️. CRITICAL: NewThread에서 scriptEnv를 push하고 upvalue 설정
-    scriptEnv.push(NewThread);
-    UE_LOG(("[CoroutineHelper] scriptEnv pushed to NewThread, top: " + std::to_string(lua_gettop(NewThread)) + "\n").c_str());
-
-    // 6️. NewThread 스택의 함수(-2)의 첫 번째 upvalue를 scriptEnv(-1)로 설정
-    const char* upvalueName = lua_setupvalue(NewThread, -2, 1);
-    if (upvalueName)
-    {
-        UE_LOG(("[CoroutineHelper] Set upvalue on NewThread: " + std::string(upvalueName) + "\n").c_str());
-    }
-    else
-    {
-        UE_LOG("[CoroutineHelper] WARNING: Failed to set upvalue on NewThread\n");
-        lua_pop(NewThread, 1);  // env 제거
-    }
+	if (Scheduler)
+	{
+		Scheduler->StopCoroutine(this, CoroutineID);
+	}
+}
 
-    // 7️. 코루틴 생성
-    sol::coroutine NewCoroutine(NewThread, -1);
+void FCoroutineHelper::StopAllCoroutines()
+{
+	if (Scheduler)
+	{
+		Scheduler->StopAllCoroutines(this);
+	}
+}
 
-    if (!NewCoroutine.valid())
-    {
-        UE_LOG("[CoroutineHelper] ERROR: failed to create coroutine\n");
-        luaL_unref(MainState, LUA_REGISTRYINDEX, threadRef);  // Clean up thread reference
-        return -1;
-    }
+FYieldInstruction* FCoroutineHelper::CreateWaitForSeconds(float Seconds)
+{
+	return Track(FYieldInstructionPool::AcquireWaitForSeconds(Seconds));
+}
 
-    int ID = NextCoroutineID++;
-    ActiveCoroutines.push_back({ ID, std::move(NewCoroutine), scriptEnv, nullptr, threadRef, MainState });
+FYieldInstruction* FCoroutineHelper::CreateWaitForFrames(int32 Frames)
+{
+	return Track(FYieldInstructionPool::AcquireWaitForFrames(Frames));
+}
 
-    UE_LOG(("[CoroutineHelper] Coroutine created with ID: " + std::to_string(ID) + "\n").c_str());
-    return ID;
+FYieldInstruction* FCoroutineHelper::CreateWaitForEvent(const FString& EventName)
+{
+	return Track(FYieldInstructionPool::AcquireWaitForEvent(EventName));
 }
 
-void FCoroutineHelper::StopCoroutine(int CoroutineID)
+FYieldInstruction* FCoroutineHelper::Track(FYieldInstruction* Instruction)
 {
-	for (auto it = ActiveCoroutines.begin(); it != ActiveCoroutines.end(); ++it)
+	if (FCoroutineScheduler* WorldScheduler = ResolveScheduler())
 	{
-		if (it->ID == CoroutineID)
-		{
-			if (it->CurrentInstruction)
-			{
-				delete it->CurrentInstruction;
-			}
-
-			// Release thread reference from registry
-			if (it->ThreadRef != LUA_NOREF && it->MainState)
-			{
-				luaL_unref(it->MainState, LUA_REGISTRYINDEX, it->ThreadRef);
-			}
-
-			ActiveCoroutines.erase(it);
-			return;
-		}
+		WorldScheduler->TrackInstruction(Instruction);
 	}
+	return Instruction;
 }
 
-void FCoroutineHelper::StopAllCoroutines()
+FCoroutineScheduler* FCoroutineHelper::ResolveScheduler()
 {
-	for (auto& State : ActiveCoroutines)
+	UWorld* World = OwnerComponent ? OwnerComponent->GetWorld() : nullptr;
+	FCoroutineScheduler* WorldScheduler = World ? World->GetCoroutineScheduler() : nullptr;
+	if (WorldScheduler == Scheduler)
 	{
-		if (State.CurrentInstruction)
-		{
-			delete State.CurrentInstruction;
-		}
-
-		// Release thread reference from registry
-		if (State.ThreadRef != LUA_NOREF && State.MainState)
-		{
-			luaL_unref(State.MainState, LUA_REGISTRYINDEX, State.ThreadRef);
-		}
+		return Scheduler;
 	}
-	ActiveCoroutines.clear();
-}
 
-FYieldInstruction* FCoroutineHelper::CreateWaitForSeconds(float Seconds)
-{
-	return new FWaitForSeconds(Seconds);
+	// 다른 월드로 옮겨진 경우 이전 스케줄러의 코루틴은 정리
+	if (Scheduler)
+	{
+		Scheduler->Unbind(this);
+	}
+	Scheduler = WorldScheduler;
+	if (Scheduler)
+	{
+		Scheduler->Bind(this);
+	}
+	return Scheduler;
 }
@@ -2,11 +2,13 @@
 #include "sol.hpp"
 
 class FYieldInstruction;
+class FCoroutineScheduler;
 class UScriptComponent;
 
 
 /* *
 * @param OwnerComponent - 참조만 할 뿐, 사이클 관리 대상에 포함되지 않으니 소멸 시 nullptr만 선언합니다.
+* @brief 컴포넌트별 코루틴 창구. 실제 실행/대기는 월드의 FCoroutineScheduler가 일괄 처리합니다.
 */
 class FCoroutineHelper
 {
@@ -14,26 +16,24 @@ public:
 	FCoroutineHelper(UScriptComponent* InOwner);
 	~FCoroutineHelper();
 
-	void RunScheduler(float DeltaTime = 0.f);
 	int StartCoroutine(sol::function EntryPoint);
 	void StopCoroutine(int CoroutineID);
 	void StopAllCoroutines();
 
-	// Lua에서 C++ FYieldInstruction 객체를 생성하기 위한 팩토리 함수
+	// Lua에서 C++ FYieldInstruction 객체를 얻기 위한 팩토리 함수 (풀에서 할당)
 	FYieldInstruction* CreateWaitForSeconds(float Seconds);
+	FYieldInstruction* CreateWaitForFrames(int32 Frames);
+	FYieldInstruction* CreateWaitForEvent(const FString& EventName);
 
 private:
-	struct FCoroutineState
-	{
-		int ID;
-		sol::coroutine Coroutine;
-		sol::environment Env;  // 코루틴의 환경 저장
-		FYieldInstruction* CurrentInstruction{ nullptr };
-		int ThreadRef{ LUA_NOREF };  // Registry reference to keep thread alive
-		lua_State* MainState{ nullptr };  // Main state for unreferencing
-	};
+	friend class FCoroutineScheduler;
+
+	// 소유 컴포넌트의 월드 스케줄러를 찾아 연결
+	FCoroutineScheduler* ResolveScheduler();
+
+	// 재개 중인 코루틴에 대기 명령서 소유를 기록
+	FYieldInstruction* Track(FYieldInstruction* Instruction);
 
 	UScriptComponent* OwnerComponent{ nullptr };
-	TArray<FCoroutineState> ActiveCoroutines;
-	int NextCoroutineID{ 1 };
+	FCoroutineScheduler* Scheduler{ nullptr };  // 스케줄러가 먼저 해제되면 nullptr로 초기화됨
 };
@@ -0,0 +1,455 @@
+﻿#include "pch.h"
+#include "CoroutineScheduler.h"
+#include "CoroutineHelper.h"
+#include "YieldInstruction.h"
+#include "LuaMemoryTracker.h"
+
+FCoroutineScheduler::~FCoroutineScheduler()
+{
+	// 월드가 먼저 사라지는 경우 helper가 해제된 스케줄러에 접근하지 않도록 역참조를 끊음
+	for (FCoroutineHelper* Helper : BoundHelpers)
+	{
+		Helper->Scheduler = nullptr;
+	}
+	BoundHelpers.Empty();
+
+	for (FCoroutineState& State : PendingStarts)
+	{
+		Kill(State);
+	}
+	for (FCoroutineState& State : Coroutines)
+	{
+		Kill(State);
+	}
+}
+
+int32 FCoroutineScheduler::StartCoroutine(FCoroutineHelper* Owner, sol::function EntryPoint, sol::environment Env, int32 AllocScopeId)
+{
+	if (!EntryPoint.valid())
+	{
+		UE_LOG("[CoroutineScheduler] ERROR: EntryPoint is invalid\n");
+		return -1;
+	}
+
+	if (!Env.valid())
+	{
+		UE_LOG("[CoroutineScheduler] ERROR: ScriptEnv is invalid\n");
+		return -1;
+	}
+
+	// 1. 독립적인 Lua 스레드 생성 및 레지스트리에 참조 저장 (GC 방지)
+	lua_State* MainState = EntryPoint.lua_state();
+	lua_State* NewThread = lua_newthread(MainState);
+	const int ThreadRef = luaL_ref(MainState, LUA_REGISTRYINDEX);  // Thread를 registry에 저장하고 pop
+
+	// 2. EntryPoint 함수와 스크립트 환경을 NewThread에 push 후 함수의 첫 번째 upvalue(_ENV)를 환경으로 설정
+	EntryPoint.push(NewThread);
+	Env.push(NewThread);
+	if (!lua_setupvalue(NewThread, -2, 1))
+	{
+		UE_LOG("[CoroutineScheduler] WARNING: Failed to set upvalue on NewThread\n");
+		lua_pop(NewThread, 1);  // env 제거
+	}
+
+	// 3. 코루틴 생성
+	sol::coroutine NewCoroutine(NewThread, -1);
+	if (!NewCoroutine.valid())
+	{
+		UE_LOG("[CoroutineScheduler] ERROR: failed to create coroutine\n");
+		luaL_unref(MainState, LUA_REGISTRYINDEX, ThreadRef);
+		return -1;
+	}
+
+	FCoroutineState NewState;
+	NewState.ID = NextCoroutineID++;
+	NewState.Owner = Owner;
+	NewState.Coroutine = std::move(NewCoroutine);
+	NewState.Env = std::move(Env);
+	NewState.ThreadRef = ThreadRef;
+	NewState.MainState = MainState;
+	NewState.AllocScopeId = AllocScopeId;
+	NewState.WaitSerial = 1;
+
+	const int32 ID = NewState.ID;
+	const FReadyEntry Ready{ ID, NewState.WaitSerial };
+
+	// 재개 루프 중에는 배열 재할당을 피하기 위해 대기 목록에 넣음 (음수 인덱스로 구분)
+	if (bResuming)
+	{
+		IndexByID.Add(ID, -static_cast<int32>(PendingStarts.size()) - 1);
+		PendingStarts.push_back(std::move(NewState));
+	}
+	else
+	{
+		IndexByID.Add(ID, static_cast<int32>(Coroutines.size()));
+		Coroutines.push_back(std::move(NewState));
+	}
+
+	// 첫 실행은 다음 Tick에서
+	ReadyQueue.push_back(Ready);
+	return ID;
+}
+
+void FCoroutineScheduler::StopCoroutine(FCoroutineHelper* Owner, int32 CoroutineID)
+{
+	FCoroutineState* State = FindState(CoroutineID);
+	if (!State || State->Owner != Owner || State->bPendingKill)
+	{
+		return;
+	}
+
+	if (bResuming)
+	{
+		State->bPendingKill = true;
+		bHasPendingKills = true;
+		return;
+	}
+
+	RemoveAt(*IndexByID.Find(CoroutineID));
+}
+
+void FCoroutineScheduler::StopAllCoroutines(FCoroutineHelper* Owner)
+{
+	if (bResuming)
+	{
+		for (FCoroutineState& State : Coroutines)
+		{
+			if (State.Owner == Owner)
+			{
+				State.bPendingKill = true;
+				bHasPendingKills = true;
+			}
+		}
+		for (FCoroutineState& State : PendingStarts)
+		{
+			if (State.Owner == Owner)
+			{
+				State.bPendingKill = true;
+				bHasPendingKills = true;
+			}
+		}
+		return;
+	}
+
+	for (int32 i = static_cast<int32>(Coroutines.size()) - 1; i >= 0; --i)
+	{
+		if (Coroutines[i].Owner == Owner)
+		{
+			RemoveAt(i);
+		}
+	}
+}
+
+void FCoroutineScheduler::Bind(FCoroutineHelper* Owner)
+{
+	BoundHelpers.Add(Owner);
+}
+
+void FCoroutineScheduler::Unbind(FCoroutineHelper* Owner)
+{
+	StopAllCoroutines(Owner);
+
+	// 재개 루프 중이면 실제 제거는 나중이지만 helper는 곧 사라지므로 역참조는 지금 끊음
+	for (FCoroutineState& State : Coroutines)
+	{
+		if (State.Owner == Owner)
+		{
+			State.Owner = nullptr;
+		}
+	}
+	for (FCoroutineState& State : PendingStarts)
+	{
+		if (State.Owner == Owner)
+		{
+			State.Owner = nullptr;
+		}
+	}
+
+	BoundHelpers.Remove(Owner);
+}
+
+void FCoroutineScheduler::Tick(float DeltaTime)
+{
+	++FrameCount;
+	ElapsedMS += static_cast<double>(DeltaTime) * 1000.0;
+
+	// 1. 만료된 대기를 ready 큐로 (대기 중인 코루틴은 여기서 건드리지 않음)
+	ExpiredScratch.clear();
+	FrameWheel.Advance(FrameCount, ExpiredScratch);
+	TimeWheel.Advance(static_cast<uint64>(ElapsedMS), ExpiredScratch);
+	for (const FTimerWheel::FEntry& Expired : ExpiredScratch)
+	{
+		FCoroutineState* State = FindState(Expired.Id);
+		if (State && State->WaitSerial == Expired.Serial && !State->bPendingKill)
+		{
+			MakeReady(*State);
+		}
+	}
+
+	if (ReadyQueue.empty())
+	{
+		return;
+	}
+
+	// 2. ready 코루틴 재개. 재개 중 새로 ready가 된 코루틴은 다음 프레임에 실행
+	ResumeScratch.clear();
+	ResumeScratch.swap(ReadyQueue);
+
+	bResuming = true;
+	for (const FReadyEntry& Ready : ResumeScratch)
+	{
+		const int32* Index = IndexByID.Find(Ready.ID);
+		if (!Index || *Index < 0)
+		{
+			continue;
+		}
+
+		FCoroutineState& State = Coroutines[*Index];
+		if (State.bPendingKill || State.WaitSerial != Ready.Serial || State.Wait != EWaitState::Ready)
+		{
+			continue;
+		}
+
+		Resume(State);
+	}
+	bResuming = false;
+
+	FlushDeferred();
+}
+
+void FCoroutineScheduler::SignalEvent(const FString& EventName, const sol::object& EventData)
+{
+	if (EventWaiters.empty())
+	{
+		return;
+	}
+
+	TArray<FReadyEntry>* Waiters = EventWaiters.Find(EventName);
+	if (!Waiters)
+	{
+		return;
+	}
+
+	TArray<FReadyEntry> Signaled = std::move(*Waiters);
+	EventWaiters.Remove(EventName);
+
+	for (const FReadyEntry& Waiter : Signaled)
+	{
+		FCoroutineState* State = FindState(Waiter.ID);
+		if (!State || State->bPendingKill || State->Wait != EWaitState::Event || State->WaitSerial != Waiter.Serial)
+		{
+			continue;
+		}
+
+		State->ResumeValue = EventData;
+		MakeReady(*State);
+	}
+}
+
+void FCoroutineScheduler::TrackInstruction(FYieldInstruction* Instruction)
+{
+	FCoroutineState* State = Instruction && ResumingID != 0 ? FindState(ResumingID) : nullptr;
+	if (!State)
+	{
+		return;
+	}
+
+	Instruction->OwnerScheduler = this;
+	Instruction->OwnerCoroutineID = State->ID;
+	State->Instructions.push_back(Instruction);
+}
+
+FCoroutineScheduler::FCoroutineState* FCoroutineScheduler::FindState(int32 CoroutineID)
+{
+	const int32* Index = IndexByID.Find(CoroutineID);
+	if (!Index)
+	{
+		return nullptr;
+	}
+	return *Index >= 0 ? &Coroutines[*Index] : &PendingStarts[-*Index - 1];
+}
+
+void FCoroutineScheduler::MakeReady(FCoroutineState& State)
+{
+	State.Wait = EWaitState::Ready;
+	++State.WaitSerial;
+	ReadyQueue.push_back({ State.ID, State.WaitSerial });
+}
+
+void FCoroutineScheduler::BeginWait(FCoroutineState& State, const FYieldInstruction& Instruction)
+{
+	++State.WaitSerial;
+
+	switch (Instruction.Type)
+	{
+	case EYieldType::Seconds:
+	{
+		if (Instruction.Seconds <= 0.0f)
+		{
+			MakeReady(State);
+			return;
+		}
+		// 올림해서 요청 시간보다 일찍 깨어나지 않도록 함
+		const uint64 ExpireTick = static_cast<uint64>(std::ceil(ElapsedMS + Instruction.Seconds * 1000.0));
+		State.Wait = EWaitState::Seconds;
+		TimeWheel.Schedule(ExpireTick, State.ID, State.WaitSerial);
+		break;
+	}
+	case EYieldType::Frames:
+	{
+		const uint64 Frames = static_cast<uint64>(std::max(1, Instruction.Frames));
+		State.Wait = EWaitState::Frames;
+		FrameWheel.Schedule(FrameCount + Frames, State.ID, State.WaitSerial);
+		break;
+	}
+	case EYieldType::Event:
+	{
+		State.Wait = EWaitState::Event;
+		TArray<FReadyEntry>* Waiters = EventWaiters.Find(Instruction.EventName);
+		if (!Waiters)
+		{
+			EventWaiters.Add(Instruction.EventName, TArray<FReadyEntry>());
+			Waiters = EventWaiters.Find(Instruction.EventName);
+		}
+		Waiters->push_back({ State.ID, State.WaitSerial });
+		break;
+	}
+	}
+}
+
+void FCoroutineScheduler::Resume(FCoroutineState& State)
+{
+	FLuaAllocScope AllocScope(State.AllocScopeId);
+
+	// 한 스텝 실행 (이벤트 대기였다면 이벤트 데이터를 yield 반환값으로 전달)
+	const int32 PrevResumingID = ResumingID;
+	ResumingID = State.ID;
+	sol::protected_function_result Result = State.ResumeValue.valid()
+		? State.Coroutine(State.ResumeValue)
+		: State.Coroutine();
+	ResumingID = PrevResumingID;
+	State.ResumeValue = sol::object();
+
+	if (!Result.valid())
+	{
+		sol::error Err = Result;
+		UE_LOG("[Coroutine] resume error: %s\n", Err.what());
+		State.bPendingKill = true;
+		bHasPendingKills = true;
+		return;
+	}
+
+	// 재개 도중 스스로 중단된 경우
+	if (State.bPendingKill)
+	{
+		return;
+	}
+
+	// dead = 0 (LUA_OK), yield = LUA_YIELD(1)
+	lua_State* L = State.Coroutine.lua_state();
+	if (!L || lua_status(L) == LUA_OK)
+	{
+		State.bPendingKill = true;
+		bHasPendingKills = true;
+		return;
+	}
+
+	// yield된 경우: 대기 명령서를 해석하고 풀에 반환, 명령서가 없으면 다음 프레임 재개
+	sol::object YieldValue = Result.get<sol::object>();
+	if (YieldValue.is<FYieldInstruction*>())
+	{
+		FYieldInstruction* Instruction = YieldValue.as<FYieldInstruction*>();
+		if (Instruction)
+		{
+			BeginWait(State, *Instruction);
+			FYieldInstructionPool::Release(Instruction);
+			ForgetReleasedInstructions(State);
+			return;
+		}
+	}
+
+	MakeReady(State);
+}
+
+void FCoroutineScheduler::ForgetReleasedInstructions(FCoroutineState& State)
+{
+	// 반환됐거나(다른 코루틴이 yield한 경우 포함) 다른 곳에서 다시 꺼내간 명령서는 목록에서 제외
+	TArray<FYieldInstruction*>& Instructions = State.Instructions;
+	Instructions.erase(std::remove_if(Instructions.begin(), Instructions.end(), [&](const FYieldInstruction* Instruction)
+	{
+		return !IsOwnedBy(*Instruction, State);
+	}), Instructions.end());
+}
+
+bool FCoroutineScheduler::IsOwnedBy(const FYieldInstruction& Instruction, const FCoroutineState& State) const
+{
+	return Instruction.bInUse && Instruction.OwnerScheduler == this && Instruction.OwnerCoroutineID == State.ID;
+}
+
+void FCoroutineScheduler::Kill(FCoroutineState& State)
+{
+	// Release thread reference
+	if (State.ThreadRef != LUA_NOREF && State.MainState)
+	{
+		luaL_unref(State.MainState, LUA_REGISTRYINDEX, State.ThreadRef);
+		State.ThreadRef = LUA_NOREF;
+	}
+
+	// yield하지 못한 대기 명령서는 다시 재개될 일이 없으므로 풀에 반환
+	for (FYieldInstruction* Instruction : State.Instructions)
+	{
+		if (IsOwnedBy(*Instruction, State))
+		{
+			FYieldInstructionPool::Release(Instruction);
+		}
+	}
+	State.Instructions.clear();
+}
+
+void FCoroutineScheduler::RemoveAt(int32 Index)
+{
+	FCoroutineState& State = Coroutines[Index];
+	Kill(State);
+	IndexByID.Remove(State.ID);
+
+	// swap-remove
+	const int32 LastIndex = static_cast<int32>(Coroutines.size()) - 1;
+	if (Index != LastIndex)
+	{
+		Coroutines[Index] = std::move(Coroutines[LastIndex]);
+		IndexByID[Coroutines[Index].ID] = Index;
+	}
+	Coroutines.pop_back();
+}
+
+void FCoroutineScheduler::FlushDeferred()
+{
+	if (bHasPendingKills)
+	{
+		bHasPendingKills = false;
+		for (int32 i = static_cast<int32>(Coroutines.size()) - 1; i >= 0; --i)
+		{
+			if (Coroutines[i].bPendingKill)
+			{
+				RemoveAt(i);
+			}
+		}
+	}
+
+	if (!PendingStarts.empty())
+	{
+		TArray<FCoroutineState> Starts = std::move(PendingStarts);
+		PendingStarts.clear();
+		for (FCoroutineState& State : Starts)
+		{
+			if (State.bPendingKill)
+			{
+				Kill(State);
+				IndexByID.Remove(State.ID);
+				continue;
+			}
+			IndexByID[State.ID] = static_cast<int32>(Coroutines.size());
+			Coroutines.push_back(std::move(State));
+		}
+	}
+}
@@ -0,0 +1,108 @@
+﻿#pragma once
+#include "sol.hpp"
+#include "TimerWheel.h"
+
+class FCoroutineHelper;
+class FYieldInstruction;
+
+/**
+ * 월드별 Lua 코루틴 스케줄러
+ * - 코루틴은 밀집 배열에 저장하고 ID → 인덱스 맵으로 찾음 (제거는 swap-remove)
+ * - WaitForSeconds는 ms 단위 타이머 휠, WaitForFrames는 프레임 단위 타이머 휠에 넣어 만료 전까지 비용 없음
+ * - WaitForEvent는 이벤트 이름별 대기 목록에 넣고 SignalEvent에서 깨움 (폴링 없음)
+ * - 매 프레임 Tick에서는 만료/신호된 코루틴(ready 큐)만 재개
+ * 재개 중 시작/중단 요청은 배열을 건드리지 않고 재개 루프가 끝난 뒤 반영
+ */
+class FCoroutineScheduler
+{
+public:
+	FCoroutineScheduler() = default;
+	~FCoroutineScheduler();
+
+	// AllocScopeId: 재개 중 Lua 할당을 귀속할 FLuaMemoryTracker 스코프 (-1이면 귀속 안 함)
+	int32 StartCoroutine(FCoroutineHelper* Owner, sol::function EntryPoint, sol::environment Env, int32 AllocScopeId = -1);
+	void StopCoroutine(FCoroutineHelper* Owner, int32 CoroutineID);
+	void StopAllCoroutines(FCoroutineHelper* Owner);
+
+	// FCoroutineHelper 수명 관리: 해제되는 helper의 코루틴을 모두 중단하고 역참조 제거
+	void Bind(FCoroutineHelper* Owner);
+	void Unbind(FCoroutineHelper* Owner);
+
+	void Tick(float DeltaTime);
+
+	// 이벤트를 기다리는 코루틴을 다음 Tick에 재개 (EventData는 yield의 반환값)
+	void SignalEvent(const FString& EventName, const sol::object& EventData);
+
+	bool HasEventWaiters() const { return !EventWaiters.empty(); }
+
+	// 재개 중인 코루틴이 만든 대기 명령서를 기록 (yield 없이 끝나거나 중단되면 Kill에서 풀에 반환)
+	void TrackInstruction(FYieldInstruction* Instruction);
+
+	uint32 Num() const { return static_cast<uint32>(Coroutines.size()); }
+	uint32 NumSleeping() const { return TimeWheel.Num() + FrameWheel.Num(); }
+
+private:
+	enum class EWaitState : uint8
+	{
+		Ready,   // ready 큐에 들어있거나 다음 프레임 재개 대기
+		Seconds,
+		Frames,
+		Event,
+	};
+
+	struct FCoroutineState
+	{
+		int32 ID = 0;
+		FCoroutineHelper* Owner = nullptr;
+		sol::coroutine Coroutine;
+		sol::environment Env;                 // 코루틴의 환경 저장
+		int ThreadRef = LUA_NOREF;            // Registry reference to keep thread alive
+		lua_State* MainState = nullptr;       // Main state for unreferencing
+		int32 AllocScopeId = -1;              // Lua 할당 통계 스코프
+		EWaitState Wait = EWaitState::Ready;
+		uint32 WaitSerial = 0;                // 대기가 바뀔 때마다 증가 (휠/큐에 남은 오래된 항목 무시용)
+		sol::object ResumeValue;              // 다음 재개 시 전달할 값 (이벤트 데이터)
+		bool bPendingKill = false;            // 재개 루프 중 중단된 경우
+		TArray<FYieldInstruction*> Instructions; // 만들었지만 아직 yield하지 않은 대기 명령서
+	};
+
+	struct FReadyEntry
+	{
+		int32 ID = 0;
+		uint32 Serial = 0;
+	};
+
+	FCoroutineState* FindState(int32 CoroutineID);
+	void MakeReady(FCoroutineState& State);
+	void BeginWait(FCoroutineState& State, const FYieldInstruction& Instruction);
+	void Resume(FCoroutineState& State);
+	void Kill(FCoroutineState& State);
+	void ForgetReleasedInstructions(FCoroutineState& State);
+	bool IsOwnedBy(const FYieldInstruction& Instruction, const FCoroutineState& State) const;
+	void RemoveAt(int32 Index);
+	void FlushDeferred();
+
+	TArray<FCoroutineState> Coroutines;
+	TMap<int32, int32> IndexByID;
+	int32 NextCoroutineID = 1;
+
+	TArray<FReadyEntry> ReadyQueue;
+	FTimerWheel TimeWheel;   // tick = 1ms
+	FTimerWheel FrameWheel;  // tick = 1프레임
+	TMap<FString, TArray<FReadyEntry>> EventWaiters;
+
+	double ElapsedMS = 0.0;
+	uint64 FrameCount = 0;
+
+	TSet<FCoroutineHelper*> BoundHelpers;
+
+	// 재개 루프 중 상태
+	bool bResuming = false;
+	int32 ResumingID = 0;  // 지금 실행 중인 코루틴 (0이면 없음)
+	bool bHasPendingKills = false;
+	TArray<FCoroutineState> PendingStarts;
+
+	// Tick마다 재사용하는 임시 버퍼
+	TArray<FTimerWheel::FEntry> ExpiredScratch;
+	TArray<FReadyEntry> ResumeScratch;
+};
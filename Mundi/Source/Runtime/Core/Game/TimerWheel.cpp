@@ -0,0 +1,231 @@
+﻿#include "pch.h"
+#include "TimerWheel.h"
+#include <random>
+
+void FTimerWheel::Schedule(uint64 ExpireTick, int32 Id, uint32 Serial)
+{
+	FEntry Entry;
+	Entry.ExpireTick = ExpireTick;
+	Entry.Id = Id;
+	Entry.Serial = Serial;
+	Insert(Entry);
+	++NumEntries;
+}
+
+void FTimerWheel::Advance(uint64 TargetTick, TArray<FEntry>& OutExpired)
+{
+	// 대기 항목이 없으면 칸을 돌 필요 없이 시간만 이동
+	if (NumEntries == 0)
+	{
+		if (TargetTick >= CurrentTick)
+		{
+			CurrentTick = TargetTick + 1;
+		}
+		return;
+	}
+
+	while (CurrentTick <= TargetTick)
+	{
+		const uint32 RootIndex = static_cast<uint32>(CurrentTick & (RootSize - 1));
+
+		// 0단계가 한 바퀴 돌았으면 상위 단계의 현재 칸을 아래로 재분배
+		if (RootIndex == 0)
+		{
+			for (uint32 Level = 0; Level < NumUpperLevels; ++Level)
+			{
+				const uint32 Slot = UpperSlotIndex(CurrentTick, Level);
+				Cascade(Level, Slot);
+				if (Slot != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		TArray<FEntry>& Bucket = Root[RootIndex];
+		if (!Bucket.empty())
+		{
+			NumEntries -= static_cast<uint32>(Bucket.size());
+			OutExpired.insert(OutExpired.end(), Bucket.begin(), Bucket.end());
+			Bucket.clear();
+		}
+
+		++CurrentTick;
+
+		if (NumEntries == 0 && CurrentTick <= TargetTick)
+		{
+			CurrentTick = TargetTick + 1;
+		}
+	}
+}
+
+void FTimerWheel::Clear()
+{
+	for (TArray<FEntry>& Bucket : Root)
+	{
+		Bucket.clear();
+	}
+	for (auto& Level : Upper)
+	{
+		for (TArray<FEntry>& Bucket : Level)
+		{
+			Bucket.clear();
+		}
+	}
+	NumEntries = 0;
+}
+
+void FTimerWheel::Insert(const FEntry& Entry)
+{
+	// 이미 지난 시각이면 바로 다음 처리 칸에 넣음
+	const uint64 Delta = Entry.ExpireTick > CurrentTick ? Entry.ExpireTick - CurrentTick : 0;
+
+	if (Delta < RootSize)
+	{
+		const uint64 Tick = std::max(Entry.ExpireTick, CurrentTick);
+		Root[Tick & (RootSize - 1)].push_back(Entry);
+		return;
+	}
+
+	for (uint32 Level = 0; Level < NumUpperLevels; ++Level)
+	{
+		const uint32 RangeBits = RootBits + (Level + 1) * LevelBits;
+		if (Delta < (1ull << RangeBits) || Level == NumUpperLevels - 1)
+		{
+			// 최상위 단계 범위를 넘는 대기는 범위 끝 칸에 두고, 재분배될 때 원래 만료 시각으로 다시 배치
+			const uint64 SlotTick = Delta < (1ull << RangeBits) ? Entry.ExpireTick : CurrentTick + (1ull << RangeBits) - 1;
+			Upper[Level][UpperSlotIndex(SlotTick, Level)].push_back(Entry);
+			return;
+		}
+	}
+}
+
+void FTimerWheel::Cascade(uint32 Level, uint32 Slot)
+{
+	TArray<FEntry>& Bucket = Upper[Level][Slot];
+	if (Bucket.empty())
+	{
+		return;
+	}
+
+	TArray<FEntry> Moving;
+	Moving.swap(Bucket);
+	for (const FEntry& Entry : Moving)
+	{
+		Insert(Entry);
+	}
+}
+
+bool FTimerWheel::RunSelfTest(uint32 InEntryCount)
+{
+	// 기준: 각 항목은 처리 가능 tick(만료 시각, 이미 지났으면 삽입 당시 현재 tick)을 포함하는 Advance에서 정확히 한 번 나와야 함
+	struct FReference
+	{
+		uint64 ReadyTick = 0;
+		uint32 Count = 0;
+		bool bWrongAdvance = false;
+	};
+
+	std::mt19937_64 Random(12345u);
+	const uint64 TopRange = 1ull << (RootBits + NumUpperLevels * LevelBits);
+	// 0단계 / 각 상위 단계 / 최상위 범위 초과까지 고르게 섞음
+	const uint64 DelayRanges[] = { 1, RootSize, RootSize * LevelSize, RootSize * LevelSize * LevelSize, TopRange, TopRange * 3 };
+
+	FTimerWheel Wheel;
+	TArray<FReference> References;
+	References.reserve(InEntryCount);
+	TArray<FEntry> Expired;
+
+	uint32 Failures = 0;
+	uint32 Scheduled = 0;
+	uint64 Now = 0; // 마지막으로 처리한 TargetTick
+	uint32 Steps = 0;
+	while (Scheduled < InEntryCount || Wheel.Num() > 0)
+	{
+		// 일부는 처리 도중에 추가 (재분배가 이미 진행된 칸 기준으로 다시 배치되는지 확인)
+		const uint32 BatchCount = Scheduled < InEntryCount ? std::min<uint32>(InEntryCount - Scheduled, 1 + static_cast<uint32>(Random() % 64)) : 0;
+		for (uint32 i = 0; i < BatchCount; ++i)
+		{
+			const uint64 Range = DelayRanges[Random() % std::size(DelayRanges)];
+			// 과거 시각(지금보다 이전)도 일부 포함
+			const uint64 Delay = Random() % (Range * 2);
+			const uint64 ExpireTick = (Random() % 16 == 0 && Now > Delay) ? Now - Delay : Wheel.GetCurrentTick() + Delay;
+
+			FReference Reference;
+			Reference.ReadyTick = std::max(ExpireTick, Wheel.GetCurrentTick());
+			References.push_back(Reference);
+			Wheel.Schedule(ExpireTick, static_cast<int32>(Scheduled), 0);
+			++Scheduled;
+		}
+
+		// 짧은 전진과 긴 건너뛰기를 섞음
+		const uint64 Step = (Random() % 8 == 0) ? Random() % (RootSize * LevelSize * LevelSize) : Random() % (RootSize * 2);
+		const uint64 StartTick = Wheel.GetCurrentTick();
+		const uint64 TargetTick = StartTick + Step;
+
+		Expired.clear();
+		Wheel.Advance(TargetTick, Expired);
+		for (const FEntry& Entry : Expired)
+		{
+			FReference& Reference = References[Entry.Id];
+			++Reference.Count;
+			Reference.bWrongAdvance |= Reference.ReadyTick < StartTick || Reference.ReadyTick > TargetTick;
+		}
+		Now = TargetTick;
+		++Steps;
+
+		if (Steps > 200000)
+		{
+			UE_LOG("[TimerWheelTest] did not drain (%u entries left) FAILED", Wheel.Num());
+			return false;
+		}
+	}
+
+	uint32 WrongAdvance = 0;
+	uint32 Missing = 0;
+	uint32 Duplicated = 0;
+	for (const FReference& Reference : References)
+	{
+		Missing += Reference.Count == 0 ? 1 : 0;
+		Duplicated += Reference.Count > 1 ? 1 : 0;
+		WrongAdvance += Reference.bWrongAdvance ? 1 : 0;
+	}
+	const bool bDrainPassed = WrongAdvance == 0 && Missing == 0 && Duplicated == 0;
+	Failures += bDrainPassed ? 0 : 1;
+	UE_LOG("[TimerWheelTest] random: %u entries, %u advances, early/late %u, missing %u, duplicated %u %s",
+		InEntryCount, Steps, WrongAdvance, Missing, Duplicated, bDrainPassed ? "OK" : "FAILED");
+
+	// tick 단위 재생: 한 tick씩 전진하면 모든 항목이 정확히 ExpireTick(과거 시각이면 삽입 직후 tick)에 나와야 함
+	{
+		FTimerWheel TickWheel;
+		TArray<uint64> ExpectedTicks;
+		const uint32 TickCount = std::min<uint32>(InEntryCount, 4096);
+		const uint64 Horizon = RootSize * LevelSize * 4;
+		for (uint32 i = 0; i < TickCount; ++i)
+		{
+			const uint64 ExpireTick = Random() % Horizon;
+			ExpectedTicks.push_back(ExpireTick);
+			TickWheel.Schedule(ExpireTick, static_cast<int32>(i), 0);
+		}
+
+		uint32 Late = 0;
+		uint32 Seen = 0;
+		for (uint64 Tick = 0; Tick < Horizon; ++Tick)
+		{
+			Expired.clear();
+			TickWheel.Advance(Tick, Expired);
+			for (const FEntry& Entry : Expired)
+			{
+				Late += ExpectedTicks[Entry.Id] != Tick ? 1 : 0;
+				++Seen;
+			}
+		}
+		const bool bTickPassed = Late == 0 && Seen == TickCount && TickWheel.Num() == 0;
+		Failures += bTickPassed ? 0 : 1;
+		UE_LOG("[TimerWheelTest] per tick: %u entries over %llu ticks, wrong tick %u, seen %u %s",
+			TickCount, static_cast<unsigned long long>(Horizon), Late, Seen, bTickPassed ? "OK" : "FAILED");
+	}
+
+	UE_LOG("[TimerWheelTest] %s (%u failures)", Failures == 0 ? "PASSED" : "FAILED", Failures);
+	return Failures == 0;
+}
@@ -0,0 +1,55 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 계층형 타이머 휠 (tick 단위는 사용하는 쪽이 정함: 코루틴 스케줄러는 ms/프레임)
+ * - 0단계: 256칸 x 1tick, 1~3단계: 64칸씩 (256, 256*64, 256*64^2 tick 단위)
+ * - 상위 단계 칸은 하위 단계가 한 바퀴 돌 때만 아래로 재분배(cascade)
+ * - 삽입 O(1), 만료 처리 비용은 지나간 tick 수와 만료된 항목 수에만 비례 (대기 중 항목은 비용 없음)
+ * 취소는 지원하지 않으며, 사용하는 쪽에서 Serial로 오래된 항목을 걸러냄
+ */
+class FTimerWheel
+{
+public:
+	struct FEntry
+	{
+		uint64 ExpireTick = 0;
+		int32 Id = 0;
+		uint32 Serial = 0;
+	};
+
+	// 다음에 처리할 tick
+	uint64 GetCurrentTick() const { return CurrentTick; }
+
+	void Schedule(uint64 ExpireTick, int32 Id, uint32 Serial);
+
+	// CurrentTick부터 TargetTick까지(포함) 처리하며 만료된 항목을 OutExpired에 추가
+	void Advance(uint64 TargetTick, TArray<FEntry>& OutExpired);
+
+	void Clear();
+
+	uint32 Num() const { return NumEntries; }
+
+	// 고정 시드 무작위 일정을 전수 비교 기준과 대조 (모든 단계/재분배/범위 초과 대기 포함)
+	static bool RunSelfTest(uint32 InEntryCount);
+
+private:
+	static constexpr uint32 RootBits = 8;
+	static constexpr uint32 LevelBits = 6;
+	static constexpr uint32 RootSize = 1u << RootBits;
+	static constexpr uint32 LevelSize = 1u << LevelBits;
+	static constexpr uint32 NumUpperLevels = 3;
+
+	void Insert(const FEntry& Entry);
+	void Cascade(uint32 Level, uint32 Slot);
+
+	static uint32 UpperSlotIndex(uint64 Tick, uint32 Level)
+	{
+		return static_cast<uint32>((Tick >> (RootBits + Level * LevelBits)) & (LevelSize - 1));
+	}
+
+	TArray<FEntry> Root[RootSize];
+	TArray<FEntry> Upper[NumUpperLevels][LevelSize];
+	uint64 CurrentTick = 0;
+	uint32 NumEntries = 0;
+};
@@ -1,8 +1,66 @@
 ﻿#include "pch.h"
 #include "YieldInstruction.h"
 
-bool FWaitForSeconds::IsReady(FCoroutineHelper* CoroutineHelper, float DeltaTime)
+namespace
 {
-	TimeLeft -= DeltaTime;
-	return TimeLeft <= 0.0f;
+	// 풀은 프로그램 종료 시까지 유지 (Lua 쪽에 남은 포인터가 해제된 메모리를 가리키지 않도록)
+	TArray<FYieldInstruction*>& GetFreeList()
+	{
+		static TArray<FYieldInstruction*> FreeList;
+		return FreeList;
+	}
+}
+
+FYieldInstruction* FYieldInstructionPool::Acquire()
+{
+	TArray<FYieldInstruction*>& FreeList = GetFreeList();
+	if (FreeList.empty())
+	{
+		FYieldInstruction* Instruction = new FYieldInstruction();
+		Instruction->bInUse = true;
+		return Instruction;
+	}
+
+	FYieldInstruction* Instruction = FreeList.back();
+	FreeList.pop_back();
+	Instruction->bInUse = true;
+	return Instruction;
+}
+
+FYieldInstruction* FYieldInstructionPool::AcquireWaitForSeconds(float Seconds)
+{
+	FYieldInstruction* Instruction = Acquire();
+	Instruction->Type = EYieldType::Seconds;
+	Instruction->Seconds = Seconds;
+	return Instruction;
+}
+
+FYieldInstruction* FYieldInstructionPool::AcquireWaitForFrames(int32 Frames)
+{
+	FYieldInstruction* Instruction = Acquire();
+	Instruction->Type = EYieldType::Frames;
+	Instruction->Frames = Frames;
+	return Instruction;
+}
+
+FYieldInstruction* FYieldInstructionPool::AcquireWaitForEvent(const FString& EventName)
+{
+	FYieldInstruction* Instruction = Acquire();
+	Instruction->Type = EYieldType::Event;
+	Instruction->EventName = EventName;
+	return Instruction;
+}
+
+void FYieldInstructionPool::Release(FYieldInstruction* Instruction)
+{
+	if (!Instruction || !Instruction->bInUse)
+	{
+		return;
+	}
+
+	Instruction->bInUse = false;
+	Instruction->OwnerScheduler = nullptr;
+	Instruction->OwnerCoroutineID = 0;
+	Instruction->EventName.clear();
+	GetFreeList().push_back(Instruction);
 }
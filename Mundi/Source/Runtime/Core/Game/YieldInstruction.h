@@ -1,29 +1,49 @@
 ﻿#pragma once
+#include "UEContainer.h"
 
-class FCoroutineHelper;
+/* *
+* @brief 코루틴 대기 종류
+*/
+enum class EYieldType : uint8
+{
+	Seconds, // 지정 시간 (타이머 휠)
+	Frames,  // 지정 프레임 수
+	Event,   // GameMode 이벤트 발생 시 (이벤트 데이터가 yield의 반환값으로 전달됨)
+};
 
 /* *
-* @brief 모든 코루틴 명령서의 기반이 되는 추상 클래스입니다.
-*		 코루틴을 다시 재개할 조건의 여부를 매 프레임 검사합니다.
+* @brief 코루틴 대기 명령서입니다. Lua에서 coroutine.yield()로 넘기면 스케줄러가 읽고 풀에 반환합니다.
+*		 매 프레임 검사하지 않으며, 대기 조건은 FCoroutineScheduler가 타이머 휠/이벤트 목록으로 처리합니다.
+*		 한 번 yield한 객체는 재사용할 수 없습니다.
+*		 yield하지 못한 채 코루틴이 끝나거나 중단되면 만든 코루틴이 정리될 때 풀에 반환됩니다.
 */
 class FYieldInstruction
 {
 public:
-	virtual ~FYieldInstruction() = default;
+	EYieldType Type = EYieldType::Seconds;
+	float Seconds = 0.0f;
+	int32 Frames = 0;
+	FString EventName;
 
-	virtual bool IsReady(FCoroutineHelper* CoroutineHelper, float DeltaTime) = 0;
+	// 풀 관리용: 만든 코루틴 (스케줄러 + ID, 코루틴 밖에서 만들었으면 nullptr/0)
+	const void* OwnerScheduler = nullptr;
+	int32 OwnerCoroutineID = 0;
+	bool bInUse = false;
 };
 
 /* *
-* @brief 지정된 시간 만큼 대기하는 명령서입니다.
+* @brief FYieldInstruction 풀 (yield마다 힙 할당하지 않도록 재사용)
 */
-class FWaitForSeconds : public FYieldInstruction
+class FYieldInstructionPool
 {
 public:
-	explicit FWaitForSeconds(float Seconds) : TimeLeft(Seconds) {}
+	static FYieldInstruction* AcquireWaitForSeconds(float Seconds);
+	static FYieldInstruction* AcquireWaitForFrames(int32 Frames);
+	static FYieldInstruction* AcquireWaitForEvent(const FString& EventName);
 
-	bool IsReady(FCoroutineHelper* CoroutineHelper, float DeltaTime) override;
+	// 이미 반환된 객체는 무시
+	static void Release(FYieldInstruction* Instruction);
 
 private:
-	float TimeLeft{};
+	static FYieldInstruction* Acquire();
 };
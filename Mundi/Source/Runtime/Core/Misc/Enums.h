@@ -160,6 +160,53 @@ namespace Serialization {
     }
 }
 
+// 압축 정점 (20바이트, FNormalVertex 64바이트 대비). 위치는 FStaticMesh::CompressedPositionMin/Extent 기준 UNORM16
+struct FCompressedVertex
+{
+    uint16 Position[4]; // xyz: AABB 내 양자화 위치, w: 탄젠트 부호 (0 = -1, 65535 = +1)
+    int16 Normal[2];    // 옥타헤드럴 인코딩 SNORM16
+    uint16 TexCoord[2]; // half float
+    int16 Tangent[2];   // 옥타헤드럴 인코딩 SNORM16
+};
+static_assert(sizeof(FCompressedVertex) == 20, "FCompressedVertex must match the compressed input layout");
+
+// 메쉴릿: LOD0 인덱스 버퍼의 연속 구간(그룹 경계를 넘지 않음) + CPU 컬링용 바운드
+struct FMeshlet
+{
+    uint32 StartIndex = 0;
+    uint32 IndexCount = 0;
+    FVector Center;          // 바운딩 구 (메시 로컬 공간)
+    float Radius = 0.0f;
+    FVector ConeAxis;        // 삼각형 노멀 콘 축
+    float ConeCutoff = 1.0f; // sin(콘 반각). 1이면 backface 컬링 불가
+};
+
+// 자동 생성된 LOD. 정점은 FStaticMesh::Vertices를 공유하고 인덱스/그룹만 따로 가짐
+struct FStaticMeshLOD
+{
+    TArray<uint32> Indices;
+    TArray<FGroupInfo> GroupInfos; // StartIndex는 이 LOD의 Indices 기준
+    float ScreenSize = 0.0f;       // 화면 높이 대비 투영 크기가 이 값보다 작아지면 이 LOD 사용
+    float Error = 0.0f;            // 단순화 오차 (메시 크기 대비 비율)
+
+    friend FArchive& operator<<(FArchive& Ar, FStaticMeshLOD& LOD)
+    {
+        if (Ar.IsSaving())
+            Serialization::WriteArray(Ar, LOD.Indices);
+        else if (Ar.IsLoading())
+            Serialization::ReadArray(Ar, LOD.Indices);
+
+        uint32_t gCount = (uint32_t)LOD.GroupInfos.size();
+        Ar << gCount;
+        LOD.GroupInfos.resize(gCount);
+        for (auto& g : LOD.GroupInfos) Ar << g;
+
+        Ar << LOD.ScreenSize;
+        Ar << LOD.Error;
+        return Ar;
+    }
+};
+
 //// Cooked Data
 struct FStaticMesh
 {
@@ -173,10 +220,62 @@ struct FStaticMesh
 
     bool bHasMaterial;
 
+    // LOD1 이후 (LOD0은 위 Indices/GroupInfos). ScreenSize 내림차순
+    TArray<FStaticMeshLOD> LODs;
+
+    // LOD0 메쉴릿 (StartIndex 오름차순)
+    TArray<FMeshlet> Meshlets;
+
+    // GPU 업로드용 압축 정점 (비어 있으면 Vertices를 FVertexDynamic으로 업로드). Vertices와 순서가 같음
+    TArray<FCompressedVertex> CompressedVertices;
+    FVector CompressedPositionMin;
+    FVector CompressedPositionExtent;
+
+    // 캐시(.bin) 포맷이나 임포트 후처리가 바뀌면 버전을 올려 구버전 캐시를 재생성하게 함
+    // 1: 버텍스 캐시/overdraw/fetch 최적화 적용
+    // 2: QEM 자동 LOD 추가
+    // 3: 메쉴릿 추가
+    // 4: MikkTSpace 호환 탄젠트
+    // 5: 압축 정점 포맷
+    // 6: 빌드 옵션 비트마스크 기록
+    // 7: LOD 전환 화면 크기를 LOD 오차로 계산
+    static constexpr uint32 CacheMagic = 0x4853454D; // 'MESH'
+    static constexpr uint32 CacheVersion = 7;
+
+    // 캐시 내용을 바꾸는 pch.h 빌드 옵션 (옵션을 토글하면 버전 불일치처럼 캐시를 재생성)
+    enum ECacheFeature : uint32
+    {
+        CacheFeature_MeshOptimization = 1 << 0,   // USE_MESH_OPTIMIZATION
+        CacheFeature_StaticMeshLOD = 1 << 1,      // USE_STATIC_MESH_LOD
+        CacheFeature_CompressedVertex = 1 << 2,   // USE_COMPRESSED_VERTEX
+    };
+
+    static constexpr uint32 GetCacheFeatureMask()
+    {
+        uint32 Mask = 0;
+#ifdef USE_MESH_OPTIMIZATION
+        Mask |= CacheFeature_MeshOptimization;
+#endif
+#ifdef USE_STATIC_MESH_LOD
+        Mask |= CacheFeature_StaticMeshLOD;
+#endif
+#ifdef USE_COMPRESSED_VERTEX
+        Mask |= CacheFeature_CompressedVertex;
+#endif
+        return Mask;
+    }
+
     friend FArchive& operator<<(FArchive& Ar, FStaticMesh& Mesh)
     {
         if (Ar.IsSaving())
         {
+            uint32 Magic = CacheMagic;
+            uint32 Version = CacheVersion;
+            uint32 FeatureMask = GetCacheFeatureMask();
+            Ar << Magic;
+            Ar << Version;
+            Ar << FeatureMask;
+
             Serialization::WriteString(Ar, Mesh.PathFileName);
             Serialization::WriteArray(Ar, Mesh.Vertices);
             Serialization::WriteArray(Ar, Mesh.Indices);
@@ -186,9 +285,35 @@ struct FStaticMesh
             for (auto& g : Mesh.GroupInfos) Ar << g;
 
             Ar << Mesh.bHasMaterial;
+
+            uint32_t lodCount = (uint32_t)Mesh.LODs.size();
+            Ar << lodCount;
+            for (auto& lod : Mesh.LODs) Ar << lod;
+
+            Serialization::WriteArray(Ar, Mesh.Meshlets);
+
+            Serialization::WriteArray(Ar, Mesh.CompressedVertices);
+            Ar << Mesh.CompressedPositionMin;
+            Ar << Mesh.CompressedPositionExtent;
         }
         else if (Ar.IsLoading())
         {
+            uint32 Magic = 0;
+            uint32 Version = 0;
+            Ar << Magic;
+            Ar << Version;
+            if (Magic != CacheMagic || Version != CacheVersion)
+            {
+                throw std::runtime_error("Cache outdated: StaticMesh cache version mismatch.");
+            }
+
+            uint32 FeatureMask = 0;
+            Ar << FeatureMask;
+            if (FeatureMask != GetCacheFeatureMask())
+            {
+                throw std::runtime_error("Cache outdated: StaticMesh cache built with different mesh build options.");
+            }
+
             Serialization::ReadString(Ar, Mesh.PathFileName);
             Serialization::ReadArray(Ar, Mesh.Vertices);
             Serialization::ReadArray(Ar, Mesh.Indices);
@@ -199,6 +324,17 @@ struct FStaticMesh
             for (auto& g : Mesh.GroupInfos) Ar << g;
 
             Ar << Mesh.bHasMaterial;
+
+            uint32_t lodCount;
+            Ar << lodCount;
+            Mesh.LODs.resize(lodCount);
+            for (auto& lod : Mesh.LODs) Ar << lod;
+
+            Serialization::ReadArray(Ar, Mesh.Meshlets);
+
+            Serialization::ReadArray(Ar, Mesh.CompressedVertices);
+            Ar << Mesh.CompressedPositionMin;
+            Ar << Mesh.CompressedPositionExtent;
         }
         return Ar;
     }
@@ -309,6 +445,7 @@ enum class EVertexLayoutType : uint8
     PositionTextBillBoard,
     PositionCollisionDebug,
     PositionBillBoard,
+    PositionNormalTexTangentCompressed, // FCompressedVertex (스태틱 메시 압축 정점)
 
     End,
 };
@@ -414,8 +551,11 @@ enum class EEngineShowFlags : uint64
     SF_Shadows = 1ull << 16,
     SF_ShadowAntiAliasing = 1ull << 17,
 
+    SF_StaticMeshLOD = 1ull << 18,    // Enable/disable distance-based static mesh LOD selection
+    SF_MeshletCulling = 1ull << 19,   // Enable/disable per-meshlet CPU frustum/backface culling
+
     // Default enabled flags
-    SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_Grid | SF_Lighting | SF_Decals | SF_Fog | SF_FXAA |SF_Billboard | SF_Shadows | SF_ShadowAntiAliasing,
+    SF_DefaultEnabled = SF_Primitives | SF_StaticMeshes | SF_Grid | SF_Lighting | SF_Decals | SF_Fog | SF_FXAA |SF_Billboard | SF_Shadows | SF_ShadowAntiAliasing | SF_StaticMeshLOD | SF_MeshletCulling,
 
     // All flags (for initialization/reset)
     SF_All = 0xFFFFFFFFFFFFFFFFull
@@ -433,6 +573,12 @@ enum class EShadowAATechnique : uint8
     VSM		// Variance Shadow Maps
 };
 
+enum class EDecalRenderPath : uint8
+{
+    MeshProjection,	// 데칼마다 수신 메시를 다시 그림
+    Clustered		// 화면 타일에 비닝한 데칼을 전체 화면 패스로 한 번에 적용
+};
+
 // Bit flag operators for EEngineShowFlags
 inline EEngineShowFlags operator|(EEngineShowFlags a, EEngineShowFlags b)
 {
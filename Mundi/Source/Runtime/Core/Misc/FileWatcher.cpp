@@ -0,0 +1,319 @@
+﻿#include "pch.h"
+#include "FileWatcher.h"
+#include <windows.h>
+
+namespace fs = std::filesystem;
+
+FFileWatcher::~FFileWatcher()
+{
+	Shutdown();
+}
+
+void FFileWatcher::Startup()
+{
+	if (bRunning)
+	{
+		return;
+	}
+
+	WakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+	if (!WakeEvent)
+	{
+		UE_LOG("[FileWatcher] ERROR: Failed to create wake event\n");
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bWatchListDirty = true;
+	}
+
+	bRunning = true;
+	Worker = std::thread(&FFileWatcher::WorkerMain, this);
+	UE_LOG("[FileWatcher] Started (%u files watched)\n", GetWatchedFileCount());
+}
+
+void FFileWatcher::Shutdown()
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	bRunning = false;
+	SetEvent(static_cast<HANDLE>(WakeEvent));
+	if (Worker.joinable())
+	{
+		Worker.join();
+	}
+
+	CloseHandle(static_cast<HANDLE>(WakeEvent));
+	WakeEvent = nullptr;
+
+	// 종료 이후에는 콜백을 호출하지 않음 (캡처된 객체가 먼저 소멸될 수 있음)
+	Subscribers.Empty();
+	std::lock_guard<std::mutex> Lock(Mutex);
+	Files.Empty();
+	PendingChanges.clear();
+}
+
+FFileWatchHandle FFileWatcher::WatchFile(const fs::path& InPath, FFileChangedCallback InCallback)
+{
+	if (InPath.empty() || !InCallback)
+	{
+		return InvalidHandle;
+	}
+
+	const FWideString Key = MakeKey(InPath);
+	bool bNewFile = false;
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		FWatchedFile* File = Files.Find(Key);
+		if (!File)
+		{
+			FWatchedFile NewFile;
+			NewFile.Path = fs::path(Key);
+			NewFile.DirectoryKey = NewFile.Path.parent_path().wstring();
+			NewFile.WriteTime_ms = QueryWriteTime(NewFile.Path);
+			Files.Add(Key, NewFile);
+			File = Files.Find(Key);
+			bWatchListDirty = true;
+			bNewFile = true;
+		}
+		++File->RefCount;
+	}
+
+	if (bNewFile && WakeEvent)
+	{
+		SetEvent(static_cast<HANDLE>(WakeEvent));
+	}
+
+	const FFileWatchHandle Handle = NextHandle++;
+	Subscribers.Add(Handle, FSubscriber{ Key, std::move(InCallback) });
+	return Handle;
+}
+
+void FFileWatcher::Unwatch(FFileWatchHandle& InOutHandle)
+{
+	if (InOutHandle == InvalidHandle)
+	{
+		return;
+	}
+
+	FSubscriber* Subscriber = Subscribers.Find(InOutHandle);
+	if (Subscriber)
+	{
+		const FWideString Key = Subscriber->FileKey;
+		Subscribers.Remove(InOutHandle);
+
+		std::lock_guard<std::mutex> Lock(Mutex);
+		FWatchedFile* File = Files.Find(Key);
+		if (File && --File->RefCount == 0)
+		{
+			Files.Remove(Key);
+			bWatchListDirty = true;
+		}
+	}
+
+	InOutHandle = InvalidHandle;
+}
+
+void FFileWatcher::DispatchChanges()
+{
+	TArray<FWideString> Changed;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		if (PendingChanges.empty())
+		{
+			return;
+		}
+		Changed.swap(PendingChanges);
+	}
+
+	for (const FWideString& Key : Changed)
+	{
+		// 콜백 안에서 구독이 추가/해제될 수 있으므로 대상 핸들을 먼저 모아둠
+		TArray<FFileWatchHandle> Targets;
+		for (const auto& Pair : Subscribers)
+		{
+			if (Pair.second.FileKey == Key)
+			{
+				Targets.push_back(Pair.first);
+			}
+		}
+
+		const fs::path ChangedPath(Key);
+		for (FFileWatchHandle Handle : Targets)
+		{
+			FSubscriber* Subscriber = Subscribers.Find(Handle);
+			if (!Subscriber)
+			{
+				continue;
+			}
+
+			// 콜백이 자기 자신을 해제해도 안전하도록 복사본 호출
+			FFileChangedCallback Callback = Subscriber->Callback;
+			Callback(ChangedPath);
+		}
+	}
+}
+
+uint32 FFileWatcher::GetWatchedFileCount() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	return static_cast<uint32>(Files.size());
+}
+
+void FFileWatcher::WorkerMain()
+{
+	// 디렉토리별 변경 알림 핸들 (워커 스레드 전용)
+	TMap<FWideString, HANDLE> DirectoryHandles;
+	TArray<FWideString> PolledDirectories;
+	unsigned long long LastPollTime = GetTickCount64();
+
+	while (bRunning)
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			if (bWatchListDirty)
+			{
+				bWatchListDirty = false;
+
+				TSet<FWideString> Directories;
+				for (const auto& Pair : Files)
+				{
+					Directories.Add(Pair.second.DirectoryKey);
+				}
+
+				for (auto It = DirectoryHandles.begin(); It != DirectoryHandles.end();)
+				{
+					if (!Directories.Contains(It->first))
+					{
+						FindCloseChangeNotification(It->second);
+						It = DirectoryHandles.erase(It);
+					}
+					else
+					{
+						++It;
+					}
+				}
+
+				// 새 디렉토리는 알림 핸들을 만들고, 실패하거나 대기 한도를 넘으면 폴링으로 처리
+				PolledDirectories.clear();
+				for (const FWideString& Directory : Directories)
+				{
+					if (DirectoryHandles.Contains(Directory))
+					{
+						continue;
+					}
+
+					HANDLE Notification = INVALID_HANDLE_VALUE;
+					if (DirectoryHandles.size() + 1 < MAXIMUM_WAIT_OBJECTS)
+					{
+						Notification = FindFirstChangeNotificationW(Directory.c_str(), FALSE,
+							FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE);
+					}
+
+					if (Notification != INVALID_HANDLE_VALUE)
+					{
+						DirectoryHandles.Add(Directory, Notification);
+					}
+					else
+					{
+						PolledDirectories.push_back(Directory);
+					}
+				}
+			}
+		}
+
+		TArray<HANDLE> WaitHandles;
+		TArray<FWideString> WaitDirectories;
+		WaitHandles.push_back(static_cast<HANDLE>(WakeEvent));
+		for (const auto& Pair : DirectoryHandles)
+		{
+			WaitHandles.push_back(Pair.second);
+			WaitDirectories.push_back(Pair.first);
+		}
+
+		const DWORD Result = WaitForMultipleObjects(static_cast<DWORD>(WaitHandles.size()), WaitHandles.data(), FALSE, PollIntervalMs);
+		if (!bRunning)
+		{
+			break;
+		}
+
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		const DWORD SignaledIndex = Result - WAIT_OBJECT_0;
+		if (SignaledIndex >= 1 && SignaledIndex < WaitHandles.size())
+		{
+			ScanDirectoryLocked(WaitDirectories[SignaledIndex - 1]);
+			FindNextChangeNotification(WaitHandles[SignaledIndex]);
+		}
+
+		const unsigned long long Now = GetTickCount64();
+		if (!PolledDirectories.empty() && Now - LastPollTime >= PollIntervalMs)
+		{
+			LastPollTime = Now;
+			for (const FWideString& Directory : PolledDirectories)
+			{
+				ScanDirectoryLocked(Directory);
+			}
+		}
+	}
+
+	for (const auto& Pair : DirectoryHandles)
+	{
+		FindCloseChangeNotification(Pair.second);
+	}
+}
+
+void FFileWatcher::ScanDirectoryLocked(const FWideString& InDirectoryKey)
+{
+	for (auto& Pair : Files)
+	{
+		FWatchedFile& File = Pair.second;
+		if (File.DirectoryKey != InDirectoryKey)
+		{
+			continue;
+		}
+
+		const long long WriteTime_ms = QueryWriteTime(File.Path);
+		if (WriteTime_ms == 0 || WriteTime_ms == File.WriteTime_ms)
+		{
+			continue;
+		}
+
+		File.WriteTime_ms = WriteTime_ms;
+		if (std::find(PendingChanges.begin(), PendingChanges.end(), Pair.first) == PendingChanges.end())
+		{
+			PendingChanges.push_back(Pair.first);
+		}
+	}
+}
+
+FWideString FFileWatcher::MakeKey(const fs::path& InPath)
+{
+	std::error_code Ec;
+	fs::path Absolute = fs::absolute(InPath, Ec);
+	if (Ec)
+	{
+		Absolute = InPath;
+	}
+
+	// Windows 경로는 대소문자를 구분하지 않으므로 같은 파일이 다른 키로 등록되지 않도록 소문자로 통일
+	FWideString Key = Absolute.lexically_normal().make_preferred().wstring();
+	std::transform(Key.begin(), Key.end(), Key.begin(), ::towlower);
+	return Key;
+}
+
+long long FFileWatcher::QueryWriteTime(const fs::path& InPath)
+{
+	std::error_code Ec;
+	const auto WriteTime = fs::last_write_time(InPath, Ec);
+	if (Ec)
+	{
+		return 0;
+	}
+	return std::chrono::duration_cast<std::chrono::milliseconds>(WriteTime.time_since_epoch()).count();
+}
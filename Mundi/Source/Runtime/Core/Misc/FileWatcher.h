@@ -0,0 +1,92 @@
+﻿#pragma once
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "UEContainer.h"
+
+using FFileWatchHandle = uint32;
+using FFileChangedCallback = std::function<void(const std::filesystem::path&)>;
+
+/**
+ * 파일 변경 감시 서비스 (싱글톤)
+ * - 백그라운드 스레드가 감시 대상 파일이 있는 디렉토리마다 OS 변경 알림(FindFirstChangeNotification)을 대기
+ * - 알림이 온 디렉토리의 감시 파일만 수정 시간을 확인해 변경 목록에 쌓음
+ * - 알림 핸들을 만들 수 없는 디렉토리는 PollIntervalMs 주기로 폴링
+ * - 콜백은 메인 스레드의 DispatchChanges()에서만 호출되므로 엔진 객체를 바로 다뤄도 안전
+ */
+class FFileWatcher
+{
+public:
+	static FFileWatcher& GetInstance()
+	{
+		static FFileWatcher Instance;
+		return Instance;
+	}
+
+	static constexpr FFileWatchHandle InvalidHandle = 0;
+
+	// 알림 대기 타임아웃이자 폴링 대체 경로의 검사 주기
+	static constexpr uint32 PollIntervalMs = 500;
+
+	void Startup();
+	void Shutdown();
+
+	/**
+	 * @brief 파일 감시 등록. 같은 파일을 여러 곳에서 등록해도 파일 상태는 하나만 유지
+	 * @return 구독 핸들 (Unwatch에 사용)
+	 */
+	FFileWatchHandle WatchFile(const std::filesystem::path& InPath, FFileChangedCallback InCallback);
+
+	// 구독 해제 후 핸들을 InvalidHandle로 초기화
+	void Unwatch(FFileWatchHandle& InOutHandle);
+
+	// 메인 스레드에서 매 프레임 호출: 쌓인 변경을 경로별로 한 번씩 구독자에게 전달
+	void DispatchChanges();
+
+	uint32 GetWatchedFileCount() const;
+
+private:
+	FFileWatcher() = default;
+	~FFileWatcher();
+	FFileWatcher(const FFileWatcher&) = delete;
+	FFileWatcher& operator=(const FFileWatcher&) = delete;
+
+	struct FWatchedFile
+	{
+		std::filesystem::path Path;
+		FWideString DirectoryKey;
+		long long WriteTime_ms = 0;
+		uint32 RefCount = 0;
+	};
+
+	struct FSubscriber
+	{
+		FWideString FileKey;
+		FFileChangedCallback Callback;
+	};
+
+	void WorkerMain();
+
+	// Files 락을 잡은 상태에서 호출: 디렉토리 안의 감시 파일 수정 시간을 비교해 변경분을 PendingChanges에 추가
+	void ScanDirectoryLocked(const FWideString& InDirectoryKey);
+
+	static FWideString MakeKey(const std::filesystem::path& InPath);
+	static long long QueryWriteTime(const std::filesystem::path& InPath);
+
+	// 워커 스레드와 공유 (Mutex로 보호)
+	mutable std::mutex Mutex;
+	TMap<FWideString, FWatchedFile> Files;
+	TArray<FWideString> PendingChanges;
+	bool bWatchListDirty = false;
+
+	// 메인 스레드 전용
+	TMap<FFileWatchHandle, FSubscriber> Subscribers;
+	FFileWatchHandle NextHandle = 1;
+
+	std::thread Worker;
+	std::atomic<bool> bRunning{ false };
+	void* WakeEvent = nullptr;
+};
@@ -0,0 +1,55 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "TaskPool.h"
+
+// 작업 NumTasks개를 풀의 워커와 호출 스레드가 나눠 실행. Func(TaskIndex)
+// 풀이 없으면 호출 스레드에서 순서대로 실행하고, 어느 경우든 모든 작업이 끝난 뒤 반환
+template<typename TFunc>
+void ParallelFor(FTaskPool* InTaskPool, uint32 NumTasks, const TFunc& Func)
+{
+	if (!InTaskPool)
+	{
+		for (uint32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+		{
+			Func(TaskIndex);
+		}
+		return;
+	}
+	InTaskPool->ParallelFor(NumTasks, Func);
+}
+
+// 병렬로 나눌 스레드 수 (청크 수와 풀의 스레드 수 중 작은 값, 최소 1)
+inline uint32 GetParallelThreadCount(const FTaskPool* InTaskPool, uint32 Count, uint32 ChunkSize, uint32 MaxThreads = 0)
+{
+	const uint32 ChunkCount = (Count + ChunkSize - 1) / ChunkSize;
+	uint32 ThreadCount = InTaskPool ? InTaskPool->GetThreadCount() : 1;
+	if (MaxThreads > 0)
+	{
+		ThreadCount = std::min(ThreadCount, MaxThreads);
+	}
+	return std::max(1u, std::min(ChunkCount, ThreadCount));
+}
+
+// [0, Count)를 청크로 나눠 병렬 실행. Func(Begin, End)
+template<typename TFunc>
+void ParallelForChunks(FTaskPool* InTaskPool, uint32 Count, uint32 ChunkSize, const TFunc& Func)
+{
+	const uint32 ThreadCount = GetParallelThreadCount(InTaskPool, Count, ChunkSize);
+	if (ThreadCount <= 1)
+	{
+		Func(0u, Count);
+		return;
+	}
+
+	// 스레드마다 연속된 구간을 맡김 (작업량이 고르므로 정적 분할로 충분)
+	const uint32 PerThread = (Count + ThreadCount - 1) / ThreadCount;
+	ParallelFor(InTaskPool, ThreadCount, [&](uint32 ThreadIndex)
+	{
+		const uint32 Begin = std::min(Count, ThreadIndex * PerThread);
+		const uint32 End = std::min(Count, Begin + PerThread);
+		if (Begin < End)
+		{
+			Func(Begin, End);
+		}
+	});
+}
@@ -116,11 +116,30 @@ inline FString ConvertDataPathToCachePath(const FString& InAssetPath)
 	}
 
 	// Data/로 시작하지 않는 경로 (예: 절대 경로, Data 외부의 상대 경로)
-	// GetDDSCachePath의 기존 정책을 따라 파일명만 사용
+	// 파일명만 쓰면 다른 폴더의 같은 이름 파일끼리 캐시가 겹치므로, 전체 경로의 해시를 폴더 이름으로 둠
+	// 예: "D:/Scenes/A/Level.scene" -> "DerivedDataCache/External/<해시>/Level.scene"
 	FWideString WPath = UTF8ToWide(InAssetPath);
-	fs::path FileName = fs::path(WPath).filename();
+	std::error_code Error;
+	fs::path FullPath = fs::absolute(fs::path(WPath), Error);
+	if (Error)
+	{
+		FullPath = fs::path(WPath);
+	}
+	FullPath = FullPath.lexically_normal();
+
+	// Windows 경로는 대소문자를 구분하지 않으므로 소문자로 통일한 뒤 FNV-1a 64비트 해시
+	FString Key = NormalizePath(WideToUTF8(FullPath.wstring()));
+	std::transform(Key.begin(), Key.end(), Key.begin(), [](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+	uint64 Hash = 14695981039346656037ull;
+	for (const unsigned char C : Key)
+	{
+		Hash = (Hash ^ C) * 1099511628211ull;
+	}
+
+	char HashText[17];
+	snprintf(HashText, sizeof(HashText), "%016llx", static_cast<unsigned long long>(Hash));
 
-	return GCacheDir + "/" + WideToUTF8(FileName.wstring());
+	return GCacheDir + "/External/" + HashText + "/" + WideToUTF8(FullPath.filename().wstring());
 }
 
 /**
@@ -0,0 +1,563 @@
+﻿#include "pch.h"
+#include "SceneBinary.h"
+#include "PathUtils.h"
+#include <filesystem>
+
+namespace
+{
+	enum class EValueTag : uint8
+	{
+		Null,
+		Object,
+		Array,
+		String,
+		Float,
+		Int,
+		False,
+		True,
+		FloatArray,  // 실수만 담은 배열 (벡터/색상 등): 원소마다 태그 없이 double 연속 저장
+	};
+
+	constexpr uint32 MaxValueDepth = 64;
+
+	// JSON::ToString()은 이스케이프된 문자열을 돌려주므로 원본 문자열로 복원
+	FString GetRawString(const JSON& InValue)
+	{
+		const FString Escaped = InValue.ToString();
+		if (Escaped.find('\\') == FString::npos)
+		{
+			return Escaped;
+		}
+
+		FString Raw;
+		Raw.reserve(Escaped.size());
+		for (size_t i = 0; i < Escaped.size(); ++i)
+		{
+			const char C = Escaped[i];
+			if (C != '\\' || i + 1 >= Escaped.size())
+			{
+				Raw += C;
+				continue;
+			}
+
+			switch (Escaped[++i])
+			{
+			case '\"': Raw += '\"'; break;
+			case '\\': Raw += '\\'; break;
+			case 'b':  Raw += '\b'; break;
+			case 'f':  Raw += '\f'; break;
+			case 'n':  Raw += '\n'; break;
+			case 'r':  Raw += '\r'; break;
+			case 't':  Raw += '\t'; break;
+			default:   Raw += '\\'; Raw += Escaped[i]; break;
+			}
+		}
+		return Raw;
+	}
+
+	class FSceneBinaryEncoder
+	{
+	public:
+		uint32 InternString(const FString& InString)
+		{
+			if (const uint32* Existing = StringIndices.Find(InString))
+			{
+				return *Existing;
+			}
+			const uint32 Index = static_cast<uint32>(Strings.size());
+			Strings.push_back(InString);
+			StringIndices.Add(InString, Index);
+			return Index;
+		}
+
+		void WriteBytes(TArray<uint8>& Out, const void* Data, size_t Size)
+		{
+			const uint8* Bytes = static_cast<const uint8*>(Data);
+			Out.insert(Out.end(), Bytes, Bytes + Size);
+		}
+
+		template<typename T>
+		void WritePod(TArray<uint8>& Out, const T& Value)
+		{
+			WriteBytes(Out, &Value, sizeof(T));
+		}
+
+		void WriteVarUInt(TArray<uint8>& Out, uint64 Value)
+		{
+			while (Value >= 0x80)
+			{
+				Out.push_back(static_cast<uint8>(Value | 0x80));
+				Value >>= 7;
+			}
+			Out.push_back(static_cast<uint8>(Value));
+		}
+
+		void EncodeValue(TArray<uint8>& Out, const JSON& InValue)
+		{
+			switch (InValue.JSONType())
+			{
+			case JSON::Class::Object:
+			{
+				Out.push_back(static_cast<uint8>(EValueTag::Object));
+				WriteVarUInt(Out, static_cast<uint64>(InValue.size()));
+				for (const auto& Pair : InValue.ObjectRange())
+				{
+					WriteVarUInt(Out, InternString(Pair.first));
+					EncodeValue(Out, Pair.second);
+				}
+				break;
+			}
+			case JSON::Class::Array:
+			{
+				bool bAllFloats = InValue.size() > 0;
+				for (const JSON& Element : InValue.ArrayRange())
+				{
+					if (Element.JSONType() != JSON::Class::Floating)
+					{
+						bAllFloats = false;
+						break;
+					}
+				}
+
+				Out.push_back(static_cast<uint8>(bAllFloats ? EValueTag::FloatArray : EValueTag::Array));
+				WriteVarUInt(Out, static_cast<uint64>(InValue.size()));
+				for (const JSON& Element : InValue.ArrayRange())
+				{
+					if (bAllFloats)
+					{
+						WritePod(Out, Element.ToFloat());
+					}
+					else
+					{
+						EncodeValue(Out, Element);
+					}
+				}
+				break;
+			}
+			case JSON::Class::String:
+				Out.push_back(static_cast<uint8>(EValueTag::String));
+				WriteVarUInt(Out, InternString(GetRawString(InValue)));
+				break;
+			case JSON::Class::Floating:
+				Out.push_back(static_cast<uint8>(EValueTag::Float));
+				WritePod(Out, InValue.ToFloat());
+				break;
+			case JSON::Class::Integral:
+			{
+				// zigzag 인코딩으로 음수도 짧게 저장
+				const int64 Value = static_cast<int64>(InValue.ToInt());
+				Out.push_back(static_cast<uint8>(EValueTag::Int));
+				WriteVarUInt(Out, (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+				break;
+			}
+			case JSON::Class::Boolean:
+				Out.push_back(static_cast<uint8>(InValue.ToBool() ? EValueTag::True : EValueTag::False));
+				break;
+			default:
+				Out.push_back(static_cast<uint8>(EValueTag::Null));
+				break;
+			}
+		}
+
+		TArray<FString> Strings;
+		TMap<FString, uint32> StringIndices;
+	};
+}
+
+FString SceneBinary::GetCookedScenePath(const FString& InScenePath)
+{
+	return ConvertDataPathToCachePath(NormalizePath(InScenePath)) + ".bin";
+}
+
+bool SceneBinary::GetSourceStamp(const FString& InScenePath, FSourceStamp& OutStamp)
+{
+	std::error_code Error;
+	const std::filesystem::path Path(UTF8ToWide(InScenePath));
+
+	const uintmax_t Size = std::filesystem::file_size(Path, Error);
+	if (Error)
+	{
+		return false;
+	}
+	const auto WriteTime = std::filesystem::last_write_time(Path, Error);
+	if (Error)
+	{
+		return false;
+	}
+
+	OutStamp.FileSize = static_cast<uint64>(Size);
+	OutStamp.WriteTime = static_cast<int64>(WriteTime.time_since_epoch().count());
+	return true;
+}
+
+void FSceneBinaryWriter::CookToBuffer(const JSON& InLevelJson, const SceneBinary::FSourceStamp& InSourceStamp, TArray<uint8>& OutBuffer)
+{
+	FSceneBinaryEncoder Encoder;
+
+	// 1. 레벨 데이터 ("Actors" 제외)
+	TArray<uint8> LevelData;
+	{
+		JSON LevelOnly = JSON::Make(JSON::Class::Object);
+		for (const auto& Pair : InLevelJson.ObjectRange())
+		{
+			if (Pair.first != "Actors")
+			{
+				LevelOnly[Pair.first] = Pair.second;
+			}
+		}
+		Encoder.EncodeValue(LevelData, LevelOnly);
+	}
+
+	// 2. 액터 청크 (JSON 로드와 같은 순서)
+	TArray<uint8> ActorData;
+	uint32 ActorCount = 0;
+	if (InLevelJson.hasKey("Actors"))
+	{
+		TArray<uint8> Chunk;
+		for (const auto& Pair : InLevelJson.at("Actors").ObjectRange())
+		{
+			FString TypeName;
+			if (Pair.second.hasKey("Type"))
+			{
+				TypeName = GetRawString(Pair.second.at("Type"));
+			}
+
+			Chunk.clear();
+			Encoder.EncodeValue(Chunk, Pair.second);
+
+			Encoder.WriteVarUInt(ActorData, Encoder.InternString(TypeName));
+			Encoder.WriteVarUInt(ActorData, Encoder.InternString(Pair.first));
+			Encoder.WriteVarUInt(ActorData, Chunk.size());
+			Encoder.WriteBytes(ActorData, Chunk.data(), Chunk.size());
+			++ActorCount;
+		}
+	}
+
+	// 3. 헤더 + 문자열 테이블 + 본문
+	OutBuffer.clear();
+	OutBuffer.reserve(64 + LevelData.size() + ActorData.size() + Encoder.Strings.size() * 16);
+	Encoder.WritePod(OutBuffer, SceneBinary::Magic);
+	Encoder.WritePod(OutBuffer, SceneBinary::Version);
+	Encoder.WritePod(OutBuffer, InSourceStamp.FileSize);
+	Encoder.WritePod(OutBuffer, InSourceStamp.WriteTime);
+	Encoder.WritePod(OutBuffer, static_cast<uint32>(Encoder.Strings.size()));
+	Encoder.WritePod(OutBuffer, ActorCount);
+	Encoder.WritePod(OutBuffer, static_cast<uint64>(LevelData.size()));
+
+	for (const FString& String : Encoder.Strings)
+	{
+		Encoder.WriteVarUInt(OutBuffer, String.size());
+		Encoder.WriteBytes(OutBuffer, String.data(), String.size());
+	}
+
+	Encoder.WriteBytes(OutBuffer, LevelData.data(), LevelData.size());
+	Encoder.WriteBytes(OutBuffer, ActorData.data(), ActorData.size());
+}
+
+bool FSceneBinaryWriter::CookToFile(const JSON& InLevelJson, const FString& InOutputPath, const SceneBinary::FSourceStamp& InSourceStamp)
+{
+	TArray<uint8> Buffer;
+	CookToBuffer(InLevelJson, InSourceStamp, Buffer);
+
+	std::error_code Error;
+	const std::filesystem::path OutputPath(UTF8ToWide(InOutputPath));
+	if (OutputPath.has_parent_path())
+	{
+		std::filesystem::create_directories(OutputPath.parent_path(), Error);
+	}
+
+	std::ofstream File(OutputPath, std::ios::binary | std::ios::trunc);
+	if (!File.is_open())
+	{
+		UE_LOG("[SceneBinary] Failed to open cooked scene for writing: %s", InOutputPath.c_str());
+		return false;
+	}
+	File.write(reinterpret_cast<const char*>(Buffer.data()), static_cast<std::streamsize>(Buffer.size()));
+	return File.good();
+}
+
+bool FSceneBinaryReader::LoadFromFile(const FString& InPath)
+{
+	std::ifstream File(std::filesystem::path(UTF8ToWide(InPath)), std::ios::binary | std::ios::ate);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	const std::streamsize Size = File.tellg();
+	if (Size <= 0)
+	{
+		return false;
+	}
+
+	TArray<uint8> FileData(static_cast<size_t>(Size));
+	File.seekg(0, std::ios::beg);
+	if (!File.read(reinterpret_cast<char*>(FileData.data()), Size))
+	{
+		return false;
+	}
+
+	return LoadFromBuffer(std::move(FileData));
+}
+
+bool FSceneBinaryReader::LoadFromBuffer(TArray<uint8>&& InBuffer)
+{
+	Buffer = std::move(InBuffer);
+	Cursor = 0;
+	ActorsRead = 0;
+	Strings.clear();
+
+	if (!ParseHeader())
+	{
+		Buffer.clear();
+		return false;
+	}
+	return true;
+}
+
+bool FSceneBinaryReader::ParseHeader()
+{
+	struct FHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 SourceSize;
+		int64 SourceWriteTime;
+		uint32 StringCount;
+		uint32 ActorCount;
+		uint64 LevelDataSize;
+	};
+
+	constexpr size_t HeaderSize = sizeof(uint32) * 2 + sizeof(uint64) + sizeof(int64) + sizeof(uint32) * 2 + sizeof(uint64);
+	if (Buffer.size() < HeaderSize)
+	{
+		return false;
+	}
+
+	FHeader Header;
+	auto ReadPod = [this](auto& Out)
+	{
+		std::memcpy(&Out, Buffer.data() + Cursor, sizeof(Out));
+		Cursor += sizeof(Out);
+	};
+	ReadPod(Header.Magic);
+	ReadPod(Header.Version);
+	ReadPod(Header.SourceSize);
+	ReadPod(Header.SourceWriteTime);
+	ReadPod(Header.StringCount);
+	ReadPod(Header.ActorCount);
+	ReadPod(Header.LevelDataSize);
+
+	if (Header.Magic != SceneBinary::Magic || Header.Version != SceneBinary::Version)
+	{
+		return false;
+	}
+
+	SourceStamp.FileSize = Header.SourceSize;
+	SourceStamp.WriteTime = Header.SourceWriteTime;
+	ActorCount = Header.ActorCount;
+
+	// 문자열 하나당 최소 1바이트이므로 개수가 남은 크기보다 크면 손상된 파일
+	if (Header.StringCount > Buffer.size() - Cursor)
+	{
+		return false;
+	}
+
+	Strings.resize(Header.StringCount);
+	for (FString& String : Strings)
+	{
+		uint64 Length = 0;
+		if (!ReadVarUInt(Length) || Length > Buffer.size() - Cursor)
+		{
+			return false;
+		}
+		String.assign(reinterpret_cast<const char*>(Buffer.data() + Cursor), static_cast<size_t>(Length));
+		Cursor += static_cast<size_t>(Length);
+	}
+
+	if (Header.LevelDataSize > Buffer.size() - Cursor)
+	{
+		return false;
+	}
+	LevelDataOffset = Cursor;
+	FirstActorOffset = Cursor + static_cast<size_t>(Header.LevelDataSize);
+	Cursor = FirstActorOffset;
+	return true;
+}
+
+bool FSceneBinaryReader::ReadLevelData(JSON& OutLevelData)
+{
+	if (Buffer.empty())
+	{
+		return false;
+	}
+
+	const size_t SavedCursor = Cursor;
+	Cursor = LevelDataOffset;
+	const bool bResult = DecodeValue(OutLevelData, 0) && Cursor == FirstActorOffset;
+	Cursor = SavedCursor;
+	return bResult;
+}
+
+bool FSceneBinaryReader::ReadNextActor(uint32& OutTypeIndex, JSON& OutActorData)
+{
+	if (Buffer.empty() || ActorsRead >= ActorCount)
+	{
+		return false;
+	}
+
+	uint32 KeyIndex = 0;
+	uint64 ChunkSize = 0;
+	if (!ReadStringIndex(OutTypeIndex) || !ReadStringIndex(KeyIndex) || !ReadVarUInt(ChunkSize) || ChunkSize > Buffer.size() - Cursor)
+	{
+		return false;
+	}
+
+	const size_t ChunkEnd = Cursor + static_cast<size_t>(ChunkSize);
+	if (!DecodeValue(OutActorData, 0) || Cursor != ChunkEnd)
+	{
+		return false;
+	}
+
+	++ActorsRead;
+	return true;
+}
+
+bool FSceneBinaryReader::ReadVarUInt(uint64& OutValue)
+{
+	OutValue = 0;
+	for (uint32 Shift = 0; Shift < 64; Shift += 7)
+	{
+		if (Cursor >= Buffer.size())
+		{
+			return false;
+		}
+		const uint8 Byte = Buffer[Cursor++];
+		OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FSceneBinaryReader::ReadStringIndex(uint32& OutIndex)
+{
+	uint64 Index = 0;
+	if (!ReadVarUInt(Index) || Index >= Strings.size())
+	{
+		return false;
+	}
+	OutIndex = static_cast<uint32>(Index);
+	return true;
+}
+
+bool FSceneBinaryReader::DecodeValue(JSON& OutValue, uint32 Depth)
+{
+	if (Depth > MaxValueDepth || Cursor >= Buffer.size())
+	{
+		return false;
+	}
+
+	const EValueTag Tag = static_cast<EValueTag>(Buffer[Cursor++]);
+	switch (Tag)
+	{
+	case EValueTag::Null:
+		OutValue = JSON();
+		return true;
+	case EValueTag::Object:
+	{
+		uint64 Count = 0;
+		if (!ReadVarUInt(Count))
+		{
+			return false;
+		}
+		OutValue = JSON::Make(JSON::Class::Object);
+		for (uint64 i = 0; i < Count; ++i)
+		{
+			uint32 KeyIndex = 0;
+			if (!ReadStringIndex(KeyIndex) || !DecodeValue(OutValue[Strings[KeyIndex]], Depth + 1))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	case EValueTag::Array:
+	{
+		uint64 Count = 0;
+		if (!ReadVarUInt(Count) || Count > Buffer.size() - Cursor)
+		{
+			return false;
+		}
+		OutValue = JSON::Make(JSON::Class::Array);
+		for (uint32 i = 0; i < static_cast<uint32>(Count); ++i)
+		{
+			if (!DecodeValue(OutValue[i], Depth + 1))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	case EValueTag::FloatArray:
+	{
+		uint64 Count = 0;
+		if (!ReadVarUInt(Count) || Count > (Buffer.size() - Cursor) / sizeof(double))
+		{
+			return false;
+		}
+		OutValue = JSON::Make(JSON::Class::Array);
+		for (uint32 i = 0; i < static_cast<uint32>(Count); ++i)
+		{
+			double Value;
+			std::memcpy(&Value, Buffer.data() + Cursor, sizeof(double));
+			Cursor += sizeof(double);
+			OutValue[i] = Value;
+		}
+		return true;
+	}
+	case EValueTag::String:
+	{
+		uint32 Index = 0;
+		if (!ReadStringIndex(Index))
+		{
+			return false;
+		}
+		OutValue = Strings[Index];
+		return true;
+	}
+	case EValueTag::Float:
+	{
+		if (Buffer.size() - Cursor < sizeof(double))
+		{
+			return false;
+		}
+		double Value;
+		std::memcpy(&Value, Buffer.data() + Cursor, sizeof(double));
+		Cursor += sizeof(double);
+		OutValue = Value;
+		return true;
+	}
+	case EValueTag::Int:
+	{
+		uint64 Encoded = 0;
+		if (!ReadVarUInt(Encoded))
+		{
+			return false;
+		}
+		const int64 Value = static_cast<int64>(Encoded >> 1) ^ -static_cast<int64>(Encoded & 1);
+		OutValue = static_cast<long>(Value);
+		return true;
+	}
+	case EValueTag::False:
+		OutValue = false;
+		return true;
+	case EValueTag::True:
+		OutValue = true;
+		return true;
+	default:
+		return false;
+	}
+}
@@ -0,0 +1,85 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "JsonSerializer.h"
+
+/**
+ * 쿠킹된 바이너리 씬 (.Scene JSON의 로드 전용 캐시)
+ *
+ * 레이아웃:
+ *   헤더 (매직, 버전, 원본 파일 크기/수정 시간, 문자열/액터 개수)
+ *   문자열 테이블 (키/클래스 이름/문자열 값을 한 번씩만 저장)
+ *   레벨 데이터 ("Actors"를 제외한 레벨 JSON)
+ *   액터 청크 반복: 클래스 이름 인덱스, 액터 키 인덱스, 바이트 크기, 값 트리
+ *
+ * 값 트리는 Serialize가 만드는 JSON과 같은 구조를 타입 태그 + 가변 길이 정수로 기록하므로
+ * 텍스트 파싱 없이 액터 하나 분량의 JSON만 만들어 기존 Serialize 경로에 넘길 수 있음
+ */
+namespace SceneBinary
+{
+	constexpr uint32 Magic = 0x4243534D; // "MSCB"
+	constexpr uint32 Version = 1;
+
+	// 씬 파일에 대응하는 쿠킹 파일 경로 (DerivedDataCache/<이름>.Scene.bin)
+	FString GetCookedScenePath(const FString& InScenePath);
+
+	// 원본 파일 정보 (쿠킹 파일이 최신인지 확인용)
+	struct FSourceStamp
+	{
+		uint64 FileSize = 0;
+		int64 WriteTime = 0;
+
+		bool operator==(const FSourceStamp& Other) const { return FileSize == Other.FileSize && WriteTime == Other.WriteTime; }
+	};
+
+	bool GetSourceStamp(const FString& InScenePath, FSourceStamp& OutStamp);
+}
+
+class FSceneBinaryWriter
+{
+public:
+	// ULevel::Serialize(false)가 만든 레벨 JSON을 쿠킹
+	static bool CookToFile(const JSON& InLevelJson, const FString& InOutputPath, const SceneBinary::FSourceStamp& InSourceStamp);
+
+	// 메모리 버퍼로 쿠킹 (벤치마크/테스트용)
+	static void CookToBuffer(const JSON& InLevelJson, const SceneBinary::FSourceStamp& InSourceStamp, TArray<uint8>& OutBuffer);
+};
+
+/**
+ * 쿠킹된 씬 스트리밍 리더
+ * 파일 전체를 한 번에 읽은 뒤 액터 청크를 순서대로 하나씩 디코딩 (씬 전체 DOM을 만들지 않음)
+ */
+class FSceneBinaryReader
+{
+public:
+	bool LoadFromFile(const FString& InPath);
+	bool LoadFromBuffer(TArray<uint8>&& InBuffer);
+
+	const SceneBinary::FSourceStamp& GetSourceStamp() const { return SourceStamp; }
+
+	uint32 GetStringCount() const { return static_cast<uint32>(Strings.size()); }
+	const FString& GetString(uint32 Index) const { return Strings[Index]; }
+
+	// 레벨 데이터 ("Actors" 제외)
+	bool ReadLevelData(JSON& OutLevelData);
+
+	uint32 GetActorCount() const { return ActorCount; }
+
+	// 다음 액터 청크 디코딩. OutTypeIndex는 문자열 테이블 인덱스 (클래스 조회 캐시 키로 사용)
+	bool ReadNextActor(uint32& OutTypeIndex, JSON& OutActorData);
+
+private:
+	bool ParseHeader();
+	bool ReadVarUInt(uint64& OutValue);
+	bool ReadStringIndex(uint32& OutIndex);
+	bool DecodeValue(JSON& OutValue, uint32 Depth);
+
+	TArray<uint8> Buffer;
+	size_t Cursor = 0;
+	size_t LevelDataOffset = 0;
+	size_t FirstActorOffset = 0;
+	uint32 ActorCount = 0;
+	uint32 ActorsRead = 0;
+
+	SceneBinary::FSourceStamp SourceStamp;
+	TArray<FString> Strings;
+};
@@ -0,0 +1,100 @@
+﻿#include "pch.h"
+#include "TaskPool.h"
+
+FTaskPool::FTaskPool(uint32 InNumWorkers)
+{
+	const uint32 NumWorkers = InNumWorkers > 0 ? InNumWorkers : std::max(1u, std::thread::hardware_concurrency()) - 1;
+	Workers.reserve(NumWorkers);
+	for (uint32 i = 0; i < NumWorkers; ++i)
+	{
+		Workers.emplace_back(&FTaskPool::WorkerMain, this);
+	}
+}
+
+FTaskPool::~FTaskPool()
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bStopping = true;
+	}
+	WorkCondition.notify_all();
+	for (std::thread& Worker : Workers)
+	{
+		Worker.join();
+	}
+}
+
+void FTaskPool::Dispatch(uint32 NumTasks, const void* Context, FTaskInvoker Invoker)
+{
+	bool bExpected = false;
+	if (NumTasks <= 1 || Workers.empty() || !bDispatching.compare_exchange_strong(bExpected, true))
+	{
+		for (uint32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+		{
+			Invoker(Context, TaskIndex);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		TaskContext = Context;
+		TaskInvoker = Invoker;
+		TaskCount = NumTasks;
+		NextTask.store(0);
+		FinishedWorkers = 0;
+		++Generation;
+	}
+	WorkCondition.notify_all();
+
+	ExecuteTasks();
+
+	// 모든 워커가 이번 묶음을 마쳐야 다음 묶음이 작업 정보를 덮어써도 안전
+	{
+		std::unique_lock<std::mutex> Lock(Mutex);
+		DoneCondition.wait(Lock, [this]() { return FinishedWorkers == static_cast<uint32>(Workers.size()); });
+	}
+	bDispatching.store(false);
+}
+
+void FTaskPool::WorkerMain()
+{
+	uint64 SeenGeneration = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> Lock(Mutex);
+			WorkCondition.wait(Lock, [this, SeenGeneration]() { return bStopping || Generation != SeenGeneration; });
+			if (bStopping)
+			{
+				return;
+			}
+			SeenGeneration = Generation;
+		}
+
+		ExecuteTasks();
+
+		bool bLastWorker = false;
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			bLastWorker = ++FinishedWorkers == static_cast<uint32>(Workers.size());
+		}
+		if (bLastWorker)
+		{
+			DoneCondition.notify_one();
+		}
+	}
+}
+
+void FTaskPool::ExecuteTasks()
+{
+	while (true)
+	{
+		const uint32 TaskIndex = NextTask.fetch_add(1);
+		if (TaskIndex >= TaskCount)
+		{
+			return;
+		}
+		TaskInvoker(TaskContext, TaskIndex);
+	}
+}
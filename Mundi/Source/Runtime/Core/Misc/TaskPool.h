@@ -0,0 +1,57 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "UEContainer.h"
+
+/**
+ * 상주 워커 스레드 풀 (렌더러가 한 번 만들어 소유)
+ * - ParallelFor마다 스레드를 만들고 join하지 않고, 잠들어 있는 워커를 깨워 작업 인덱스를 나눠 가져가게 함
+ * - 호출 스레드도 작업에 참여하고, 모든 작업과 워커가 끝날 때까지 대기
+ * - 한 번에 한 묶음만 실행. 다른 스레드가 이미 실행 중이거나 작업 안에서 다시 호출하면 호출 스레드에서 순서대로 실행
+ */
+class FTaskPool
+{
+public:
+	// InNumWorkers가 0이면 하드웨어 스레드 수 - 1 (호출 스레드 몫 제외)
+	explicit FTaskPool(uint32 InNumWorkers = 0);
+	~FTaskPool();
+	FTaskPool(const FTaskPool&) = delete;
+	FTaskPool& operator=(const FTaskPool&) = delete;
+
+	// 작업을 동시에 실행할 수 있는 스레드 수 (워커 + 호출 스레드)
+	uint32 GetThreadCount() const { return static_cast<uint32>(Workers.size()) + 1; }
+
+	// Func(TaskIndex)를 [0, NumTasks) 범위에서 한 번씩 실행하고 모두 끝나면 반환
+	template<typename TFunc>
+	void ParallelFor(uint32 NumTasks, const TFunc& Func)
+	{
+		Dispatch(NumTasks, &Func, [](const void* Context, uint32 TaskIndex) { (*static_cast<const TFunc*>(Context))(TaskIndex); });
+	}
+
+private:
+	using FTaskInvoker = void(*)(const void* Context, uint32 TaskIndex);
+
+	void Dispatch(uint32 NumTasks, const void* Context, FTaskInvoker Invoker);
+	void WorkerMain();
+	// 남은 작업 인덱스를 하나씩 가져가 실행
+	void ExecuteTasks();
+
+	TArray<std::thread> Workers;
+	std::atomic<bool> bDispatching{ false };
+
+	// 워커와 공유 (작업 정보는 Mutex 안에서 쓰고 Generation으로 알림)
+	std::mutex Mutex;
+	std::condition_variable WorkCondition;
+	std::condition_variable DoneCondition;
+	uint64 Generation = 0;
+	uint32 FinishedWorkers = 0;
+	bool bStopping = false;
+
+	const void* TaskContext = nullptr;
+	FTaskInvoker TaskInvoker = nullptr;
+	uint32 TaskCount = 0;
+	std::atomic<uint32> NextTask{ 0 };
+};
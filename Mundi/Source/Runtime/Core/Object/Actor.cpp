@@ -415,6 +415,29 @@ void AActor::SetActorHiddenInEditor(bool bNewHidden)
 {
 	bHiddenInEditor = bNewHidden; 
 	GWorld->GetLightManager()->SetDirtyFlag();
+	RefreshSceneProxies();
+}
+
+void AActor::SetActorHiddenInGame(bool bNewHidden)
+{
+	if (bHiddenInGame == bNewHidden)
+	{
+		return;
+	}
+	bHiddenInGame = bNewHidden;
+	RefreshSceneProxies();
+}
+
+void AActor::RefreshSceneProxies()
+{
+	// 렌더 프록시는 액터 숨김 여부도 캐시하므로 소유 컴포넌트 프록시를 모두 갱신
+	for (USceneComponent* Component : SceneComponents)
+	{
+		if (Component)
+		{
+			Component->RefreshSceneProxy();
+		}
+	}
 }
 
 bool AActor::IsActorVisible() const
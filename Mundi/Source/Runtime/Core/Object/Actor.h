@@ -143,8 +143,8 @@ public:
     void SetActorHiddenInEditor(bool bNewHidden);
     bool GetActorHiddenInEditor() const { return bHiddenInEditor; }
     // Visible false인 경우 게임, 에디터 모두 안 보임
-    void SetActorHiddenInGame(bool bNewHidden) { bHiddenInGame = bNewHidden; }
-    bool GetActorHiddenInGame() { return bHiddenInGame; }
+    void SetActorHiddenInGame(bool bNewHidden);
+    bool GetActorHiddenInGame() const { return bHiddenInGame; }
     bool IsActorVisible() const;
 
     bool CanTickInEditor() const
@@ -190,6 +190,9 @@ public:
     UTextRenderComponent* TextComp = nullptr;
 
 protected:
+    // 숨김 상태가 바뀌면 소유 씬 컴포넌트의 렌더 프록시 갱신
+    void RefreshSceneProxies();
+
     // NOTE: RootComponent, CollisionComponent 등 기본 보호 컴포넌트들도
     // OwnedComponents와 SceneComponents에 포함되어 관리됨.
     TSet<UActorComponent*> OwnedComponents;   // 모든 컴포넌트 (씬/비씬)
@@ -39,7 +39,14 @@ public:
     void DestroyComponent();                           // 소멸(EndPlay 포함)
 
     // ─────────────── 활성화/틱
-    void SetActive(bool bNewActive) { bIsActive = bNewActive; }
+    void SetActive(bool bNewActive)
+    {
+        if (bIsActive != bNewActive)
+        {
+            bIsActive = bNewActive;
+            OnVisibilityStateChanged();
+        }
+    }
     bool IsActive() const { return bIsActive; }
 
     void SetTickEnabled(bool bEnabled) { bTickEnabled = bEnabled; }
@@ -48,7 +55,14 @@ public:
     void SetEditability(bool InEditable) { bIsEditable = InEditable; }
     bool IsEditable() const { return bIsEditable; }
 
-    void SetHiddenInGame(bool bInHidden) { bHiddenInGame = bInHidden; }
+    void SetHiddenInGame(bool bInHidden)
+    {
+        if (bHiddenInGame != bInHidden)
+        {
+            bHiddenInGame = bInHidden;
+            OnVisibilityStateChanged();
+        }
+    }
     bool GetHiddenInGame() const { return bHiddenInGame; }
 
     void SetCanEverTick(bool b) { bCanEverTick = b; }
@@ -84,6 +98,9 @@ public:
     virtual void OnSerialized() override;
 
 protected:
+    // 활성/숨김 상태가 바뀐 뒤 호출 (씬 컴포넌트는 렌더 프록시 갱신)
+    virtual void OnVisibilityStateChanged() {}
+
     AActor* Owner = nullptr;     // 소유 액터
     bool bIsNative = false;      // 액터의 기본 구성 컴포넌트인지 여부. 활성화되면 보호되어 UI에서 삭제 불가 상태가 됨 
     bool bIsActive = true;       // 활성 상태(사용자 on/off), 물리 적용
@@ -28,6 +28,9 @@ struct UClass
     const char* Description = nullptr;         // 툴팁 설명
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
+    // 프로퍼티 이름 → GetAllProperties() 인덱스 (직렬화 키 매칭용, 최초 조회 시 생성)
+    // constexpr 생성자를 유지하기 위해 포인터로 보관. UClass는 정적 수명이므로 해제하지 않음
+    mutable TMap<FString, int32>* CachedPropertyIndexByName = nullptr;
 
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, std::size_t z)
@@ -102,6 +105,24 @@ struct UClass
         return CachedAllProperties;
     }
 
+    // 이름으로 GetAllProperties() 인덱스 찾기 (없으면 -1). 같은 이름이면 파생 클래스 프로퍼티 우선
+    int32 FindPropertyIndex(const FString& InName) const
+    {
+        if (!CachedPropertyIndexByName)
+        {
+            const TArray<FProperty>& AllProperties = GetAllProperties();
+            CachedPropertyIndexByName = new TMap<FString, int32>();
+            CachedPropertyIndexByName->reserve(AllProperties.size());
+            for (int32 i = 0; i < static_cast<int32>(AllProperties.size()); ++i)
+            {
+                (*CachedPropertyIndexByName)[AllProperties[i].Name] = i;
+            }
+        }
+
+        const int32* Index = CachedPropertyIndexByName->Find(InName);
+        return Index ? *Index : -1;
+    }
+
     static TArray<UClass*> GetAllSpawnableActors()
     {
         TArray<UClass*> Result;
@@ -247,4 +247,5 @@ public:
 	InVariableName->SetupAttachment(this, EAttachmentRule::KeepRelative);\
 	this->GetOwner()->AddOwnedComponent(InVariableName);\
 	InVariableName->SetEditability(false);\
-	InVariableName->SetHiddenInGame(true);
\ No newline at end of file
+	InVariableName->SetHiddenInGame(true);\
+	InVariableName->RegisterSceneProxy(this->GetWorld());
\ No newline at end of file
@@ -0,0 +1,329 @@
+﻿#include "pch.h"
+#include "PropertySerializer.h"
+
+namespace
+{
+	bool ReadNumber(const JSON& InValue, float& OutValue)
+	{
+		switch (InValue.JSONType())
+		{
+		case JSON::Class::Floating:
+			OutValue = static_cast<float>(InValue.ToFloat());
+			return true;
+		case JSON::Class::Integral:
+			OutValue = static_cast<float>(InValue.ToInt());
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// 고정 길이 실수 배열 ([x, y, z] / [r, g, b, a])
+	template<int32 N>
+	bool ReadFloatArray(const JSON& InValue, float (&OutValues)[N])
+	{
+		if (InValue.JSONType() != JSON::Class::Array || InValue.size() != N)
+		{
+			return false;
+		}
+		int32 i = 0;
+		for (const JSON& Element : InValue.ArrayRange())
+		{
+			if (!ReadNumber(Element, OutValues[i++]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename T>
+	T* LoadResourceByPath(const JSON& InValue)
+	{
+		const FString Path = InValue.ToString();
+		return Path.empty() ? nullptr : UResourceManager::GetInstance().Load<T>(Path);
+	}
+
+	void LoadArray(const FProperty& InProperty, void* InObject, const JSON& InValue)
+	{
+		if (InValue.JSONType() != JSON::Class::Array)
+		{
+			return;
+		}
+
+		switch (InProperty.InnerType)
+		{
+		case EPropertyType::Int32:
+		{
+			TArray<int32>* Array = InProperty.GetValuePtr<TArray<int32>>(InObject);
+			Array->clear();
+			Array->reserve(InValue.size());
+			for (const JSON& Element : InValue.ArrayRange())
+			{
+				Array->Add(static_cast<int32>(Element.ToInt()));
+			}
+			break;
+		}
+		case EPropertyType::Float:
+		{
+			TArray<float>* Array = InProperty.GetValuePtr<TArray<float>>(InObject);
+			Array->clear();
+			Array->reserve(InValue.size());
+			for (const JSON& Element : InValue.ArrayRange())
+			{
+				Array->Add(static_cast<float>(Element.ToFloat()));
+			}
+			break;
+		}
+		case EPropertyType::Bool:
+		{
+			TArray<bool>* Array = InProperty.GetValuePtr<TArray<bool>>(InObject);
+			Array->clear();
+			Array->reserve(InValue.size());
+			for (const JSON& Element : InValue.ArrayRange())
+			{
+				Array->Add(Element.ToBool());
+			}
+			break;
+		}
+		case EPropertyType::FString:
+		{
+			TArray<FString>* Array = InProperty.GetValuePtr<TArray<FString>>(InObject);
+			Array->clear();
+			Array->reserve(InValue.size());
+			for (const JSON& Element : InValue.ArrayRange())
+			{
+				Array->Add(Element.ToString());
+			}
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void LoadProperty(const FProperty& InProperty, void* InObject, const JSON& InValue)
+	{
+		switch (InProperty.Type)
+		{
+		case EPropertyType::Bool:
+			if (InValue.JSONType() == JSON::Class::Boolean)
+			{
+				*InProperty.GetValuePtr<bool>(InObject) = InValue.ToBool();
+			}
+			break;
+		case EPropertyType::Int32:
+			if (InValue.JSONType() == JSON::Class::Integral)
+			{
+				*InProperty.GetValuePtr<int32>(InObject) = static_cast<int32>(InValue.ToInt());
+			}
+			break;
+		case EPropertyType::Float:
+			ReadNumber(InValue, *InProperty.GetValuePtr<float>(InObject));
+			break;
+		case EPropertyType::FVector:
+		{
+			float Values[3];
+			if (ReadFloatArray(InValue, Values))
+			{
+				*InProperty.GetValuePtr<FVector>(InObject) = FVector(Values[0], Values[1], Values[2]);
+			}
+			break;
+		}
+		case EPropertyType::FLinearColor:
+		{
+			float Values[4];
+			if (ReadFloatArray(InValue, Values))
+			{
+				*InProperty.GetValuePtr<FLinearColor>(InObject) = FLinearColor(FVector4(Values[0], Values[1], Values[2], Values[3]));
+			}
+			break;
+		}
+		case EPropertyType::FString:
+		case EPropertyType::FScriptPath:
+			if (InValue.JSONType() == JSON::Class::String)
+			{
+				*InProperty.GetValuePtr<FString>(InObject) = InValue.ToString();
+			}
+			break;
+		case EPropertyType::FName:
+			if (InValue.JSONType() == JSON::Class::String)
+			{
+				*InProperty.GetValuePtr<FName>(InObject) = FName(InValue.ToString());
+			}
+			break;
+		case EPropertyType::Texture:
+			if (InValue.JSONType() == JSON::Class::String)
+			{
+				*InProperty.GetValuePtr<UTexture*>(InObject) = LoadResourceByPath<UTexture>(InValue);
+			}
+			break;
+		case EPropertyType::StaticMesh:
+			if (InValue.JSONType() == JSON::Class::String)
+			{
+				*InProperty.GetValuePtr<UStaticMesh*>(InObject) = LoadResourceByPath<UStaticMesh>(InValue);
+			}
+			break;
+		case EPropertyType::Material:
+			if (InValue.JSONType() == JSON::Class::String)
+			{
+				*InProperty.GetValuePtr<UMaterial*>(InObject) = LoadResourceByPath<UMaterial>(InValue);
+			}
+			break;
+		case EPropertyType::Array:
+			LoadArray(InProperty, InObject, InValue);
+			break;
+		default:
+			break;
+		}
+	}
+
+	template<typename T>
+	JSON MakePrimitiveArrayJson(const TArray<T>& InArray)
+	{
+		JSON ArrayJson = JSON::Make(JSON::Class::Array);
+		for (const T& Element : InArray)
+		{
+			if constexpr (std::is_same_v<T, FString>)
+			{
+				ArrayJson.append(Element.c_str());
+			}
+			else
+			{
+				ArrayJson.append(Element);
+			}
+		}
+		return ArrayJson;
+	}
+}
+
+bool FPropertySerializer::IsSupported(const FProperty& InProperty)
+{
+	switch (InProperty.Type)
+	{
+	case EPropertyType::Bool:
+	case EPropertyType::Int32:
+	case EPropertyType::Float:
+	case EPropertyType::FVector:
+	case EPropertyType::FLinearColor:
+	case EPropertyType::FString:
+	case EPropertyType::FScriptPath:
+	case EPropertyType::FName:
+	case EPropertyType::Texture:
+	case EPropertyType::StaticMesh:
+	case EPropertyType::Material:
+		return true;
+	case EPropertyType::Array:
+		return InProperty.InnerType == EPropertyType::Int32
+			|| InProperty.InnerType == EPropertyType::Float
+			|| InProperty.InnerType == EPropertyType::Bool
+			|| InProperty.InnerType == EPropertyType::FString;
+	default:
+		return false;
+	}
+}
+
+void FPropertySerializer::LoadProperties(UObject* InObject, const UClass* InClass, const JSON& InJson)
+{
+	if (!InObject || !InClass || InJson.JSONType() != JSON::Class::Object)
+	{
+		return;
+	}
+
+	const TArray<FProperty>& Properties = InClass->GetAllProperties();
+
+	// 데이터에 있는 키만 순회: 비용은 프로퍼티 수가 아니라 저장된 필드 수에 비례
+	for (const auto& Pair : InJson.ObjectRange())
+	{
+		const int32 PropertyIndex = InClass->FindPropertyIndex(Pair.first);
+		if (PropertyIndex < 0)
+		{
+			// 클래스별 Serialize가 처리하는 키 (Type, Id, MaterialSlots 등)
+			continue;
+		}
+
+		const FProperty& Property = Properties[PropertyIndex];
+		if (IsSupported(Property))
+		{
+			LoadProperty(Property, InObject, Pair.second);
+		}
+	}
+}
+
+void FPropertySerializer::SaveProperties(const UObject* InObject, const UClass* InClass, JSON& OutJson)
+{
+	if (!InObject || !InClass)
+	{
+		return;
+	}
+
+	for (const FProperty& Prop : InClass->GetAllProperties())
+	{
+		switch (Prop.Type)
+		{
+		case EPropertyType::Bool:
+			OutJson[Prop.Name] = *Prop.GetValuePtr<bool>(InObject);
+			break;
+		case EPropertyType::Int32:
+			OutJson[Prop.Name] = *Prop.GetValuePtr<int32>(InObject);
+			break;
+		case EPropertyType::Float:
+			OutJson[Prop.Name] = *Prop.GetValuePtr<float>(InObject);
+			break;
+		case EPropertyType::FVector:
+			OutJson[Prop.Name] = FJsonSerializer::VectorToJson(*Prop.GetValuePtr<FVector>(InObject));
+			break;
+		case EPropertyType::FLinearColor:
+			OutJson[Prop.Name] = FJsonSerializer::Vector4ToJson(Prop.GetValuePtr<FLinearColor>(InObject)->ToFVector4());
+			break;
+		case EPropertyType::FString:
+		case EPropertyType::FScriptPath:
+			OutJson[Prop.Name] = Prop.GetValuePtr<FString>(InObject)->c_str();
+			break;
+		case EPropertyType::FName:
+			OutJson[Prop.Name] = Prop.GetValuePtr<FName>(InObject)->ToString().c_str();
+			break;
+		case EPropertyType::Texture:
+		{
+			const UTexture* Texture = *Prop.GetValuePtr<UTexture*>(InObject);
+			OutJson[Prop.Name] = Texture ? Texture->GetFilePath().c_str() : "";
+			break;
+		}
+		case EPropertyType::StaticMesh:
+		{
+			const UStaticMesh* StaticMesh = *Prop.GetValuePtr<UStaticMesh*>(InObject);
+			OutJson[Prop.Name] = StaticMesh ? StaticMesh->GetAssetPathFileName().c_str() : "";
+			break;
+		}
+		case EPropertyType::Material:
+		{
+			const UMaterial* Material = *Prop.GetValuePtr<UMaterial*>(InObject);
+			OutJson[Prop.Name] = Material ? Material->GetFilePath().c_str() : "";
+			break;
+		}
+		case EPropertyType::Array:
+			switch (Prop.InnerType)
+			{
+			case EPropertyType::Int32:
+				OutJson[Prop.Name] = MakePrimitiveArrayJson(*Prop.GetValuePtr<TArray<int32>>(InObject));
+				break;
+			case EPropertyType::Float:
+				OutJson[Prop.Name] = MakePrimitiveArrayJson(*Prop.GetValuePtr<TArray<float>>(InObject));
+				break;
+			case EPropertyType::Bool:
+				OutJson[Prop.Name] = MakePrimitiveArrayJson(*Prop.GetValuePtr<TArray<bool>>(InObject));
+				break;
+			case EPropertyType::FString:
+				OutJson[Prop.Name] = MakePrimitiveArrayJson(*Prop.GetValuePtr<TArray<FString>>(InObject));
+				break;
+			default:
+				// Material 배열 등은 클래스별 Serialize에서 같은 키로 기록
+				break;
+			}
+			break;
+		default:
+			// ObjectPtr, Struct, Sound, SRV 등은 필요한 클래스에서 직접 처리
+			break;
+		}
+	}
+}
@@ -0,0 +1,26 @@
+﻿#pragma once
+#include "Property.h"
+#include "nlohmann/json.hpp"
+
+namespace json { class JSON; }
+using JSON = json::JSON;
+
+class UObject;
+struct UClass;
+
+/**
+ * 리플렉션 기반 일괄 프로퍼티 직렬화 (UObject::Serialize에서 사용)
+ * - 로드: JSON 객체의 키를 한 번만 순회하며 UClass::FindPropertyIndex로 프로퍼티를 찾아 오프셋에 직접 기록
+ *   (프로퍼티마다 hasKey/at으로 맵을 다시 찾지 않고, 없는 키는 기본값을 유지하며 로그도 남기지 않음)
+ * - 저장: 캐시된 프로퍼티 목록을 순서대로 기록
+ * 여기서 다루지 않는 타입(Sound, ObjectPtr, Material 배열 등)과 키 이름이 다른 필드는 클래스별 Serialize에서 처리
+ */
+class FPropertySerializer
+{
+public:
+	static void LoadProperties(UObject* InObject, const UClass* InClass, const JSON& InJson);
+	static void SaveProperties(const UObject* InObject, const UClass* InClass, JSON& OutJson);
+
+	// 일괄 직렬화가 처리하는 프로퍼티인지
+	static bool IsSupported(const FProperty& InProperty);
+};
@@ -73,6 +73,8 @@ bool USpringArmComponent::IsCollisionFixApplied() const
 
 void USpringArmComponent::OnRegister(UWorld* InWorld)
 {
+    Super::OnRegister(InWorld);
+
     // ensure tick
     SetCanEverTick(true);
     SetTickEnabled(true);
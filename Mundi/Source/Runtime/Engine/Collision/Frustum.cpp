@@ -220,6 +220,49 @@ bool IsAABBIntersects(const FFrustum& F, const FAABB& B)
     return !fullyInside;
 }
 
+// ------------------------------------------------------------
+// View * Projection 행렬에서 절두체 추출 (라이트 섀도우 뷰 등 카메라가 없는 경우)
+//  - 행벡터 규약(clip = p * VP)이므로 클립 좌표 각 성분은 VP의 "열"과의 내적
+//  - D3D 클립 공간: -w <= x,y <= w, 0 <= z <= w
+//  - 결합 결과 (a,b,c,d)에 대해 a*x + b*y + c*z + d >= 0 이 내부 → N=(a,b,c), D=-d 로 정규화
+// ------------------------------------------------------------
+namespace
+{
+    FPlane MakePlaneFromClipCoefficients(float A, float B, float C, float D)
+    {
+        const float Len = std::sqrt(A * A + B * B + C * C);
+        if (Len <= 0.0f)
+        {
+            // 퇴화 평면: 항상 통과
+            return FPlane{ FVector4(0.0f, 0.0f, 0.0f, 0.0f), -FLT_MAX };
+        }
+        const float InvLen = 1.0f / Len;
+        return FPlane{ FVector4(A * InvLen, B * InvLen, C * InvLen, 0.0f), -D * InvLen };
+    }
+}
+
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection)
+{
+    const auto& M = ViewProjection.M;
+    auto Combine = [&M](int32 Column, float Sign)
+        {
+            return MakePlaneFromClipCoefficients(
+                M[0][3] + Sign * M[0][Column],
+                M[1][3] + Sign * M[1][Column],
+                M[2][3] + Sign * M[2][Column],
+                M[3][3] + Sign * M[3][Column]);
+        };
+
+    FFrustum Result;
+    Result.LeftFace = Combine(0, 1.0f);
+    Result.RightFace = Combine(0, -1.0f);
+    Result.BottomFace = Combine(1, 1.0f);
+    Result.TopFace = Combine(1, -1.0f);
+    Result.NearFace = MakePlaneFromClipCoefficients(M[0][2], M[1][2], M[2][2], M[3][2]);
+    Result.FarFace = Combine(2, -1.0f);
+    return Result;
+}
+
 
 // 추후에 절두체를 VP 행렬에서 바로 추출하는 방법도 필요하다면 아래를 참고.
 // ---------- VP(=View*Proj)에서 평면 추출 ----------
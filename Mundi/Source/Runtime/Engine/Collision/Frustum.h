@@ -26,6 +26,8 @@ struct FFrustum
 };
 
 FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideAspect = -1.0f);
+// 행벡터 규약의 View * Projection 행렬에서 절두체 추출 (D3D 클립 공간, 0 <= z <= w)
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection);
 bool IsAABBVisible(const FFrustum& Frustum, const FAABB& Bound);
 bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 
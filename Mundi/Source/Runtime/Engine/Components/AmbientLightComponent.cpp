@@ -46,6 +46,7 @@ void UAmbientLightComponent::OnRegister(UWorld* InWorld)
 
 void UAmbientLightComponent::OnUnregister()
 {
+	Super::OnUnregister();
 	GWorld->GetLightManager()->DeRegisterLight(this);
 }
 
@@ -57,6 +57,7 @@ void UDecalComponent::TickComponent(float DeltaTime)
 
 void UDecalComponent::OnRegister(UWorld* InWorld)
 {
+	Super::OnRegister(InWorld);
 	if (!SpriteComponent)
 	{
 		CREATE_EDITOR_COMPONENT(SpriteComponent, UBillboardComponent);
@@ -115,11 +116,13 @@ void UDecalComponent::RenderDebugVolume(URenderer* Renderer) const
 void UDecalComponent::SetDecalTexture(UTexture* InTexture)
 {
 	DecalTexture = InTexture;
+	MarkRenderStateDirty();
 }
 
 void UDecalComponent::SetDecalTexture(const FString& TexturePath)
 {
 	DecalTexture = UResourceManager::GetInstance().Load<UTexture>(TexturePath);
+	MarkRenderStateDirty();
 }
 
 FAABB UDecalComponent::GetWorldAABB() const
@@ -36,9 +36,9 @@ public:
 	UTexture* GetDecalTexture() const { return DecalTexture; }
 
 	// Decal Property API
-	void SetVisibility(bool bVisible) { bIsVisible = bVisible; }
+	void SetVisibility(bool bVisible) { bIsVisible = bVisible; RefreshSceneProxy(); }
 	bool IsVisible() const { return bIsVisible; }
-	void SetOpacity(float Opacity) { DecalOpacity = FMath::Clamp(Opacity, 0.0f, 1.0f); }
+	void SetOpacity(float Opacity) { DecalOpacity = FMath::Clamp(Opacity, 0.0f, 1.0f); MarkRenderStateDirty(); }
 	float GetOpacity() const { return DecalOpacity; }
 
 	// Decal Volume & Bounds API
@@ -7,6 +7,10 @@
 
 #include "RenderManager.h"
 #include "D3D11RHI.h"
+#include "WorldPartitionManager.h"
+#include "BVHierarchy.h"
+#include "StaticMeshComponent.h"
+#include "OBB.h"
 
 IMPLEMENT_CLASS(UDirectionalLightComponent)
 
@@ -16,6 +20,8 @@ ADD_PROPERTY(bool, bCascaded, "ShadowMap", true, "Cascaded 사용 여부")
 ADD_PROPERTY_RANGE(int, CascadedCount, "ShadowMap", 1, 8, true, "Cascaded 갯수")
 ADD_PROPERTY_RANGE(float, CascadedLinearBlendingValue, "ShadowMap", 0, 1, true, "Cascaded Log~Linear 가중치 : 0~1")
 ADD_PROPERTY_RANGE(float, CascadedOverlapValue, "ShadowMap", 0, 0.5f, true, "Cascaded 확장 범위 크기")
+ADD_PROPERTY_RANGE(int, CascadedUpdateInterval, "ShadowMap", 1, 8, true, "먼 Cascade 갱신 주기 (프레임, 1 : 매 프레임)")
+ADD_PROPERTY_RANGE(int, CascadedFullRateCount, "ShadowMap", 1, 8, true, "매 프레임 갱신할 가까운 Cascade 갯수")
 ADD_PROPERTY_RANGE(float, CascadedAreaColorDebugValue, "ShadowMap", 0, 1.0f, true, "Cascaded 범위 시각화")
 ADD_PROPERTY_RANGE(int, CascadedAreaShadowDebugValue, "ShadowMap", -1, 8, true, "Cascaded 쉐도우 구역 설정 (-1 : 전체 쉐도우)")
 ADD_PROPERTY_SRV(ID3D11ShaderResourceView*, ShadowMapSRV, "ShadowMap", true, "쉐도우 맵 Far Plane")
@@ -31,96 +37,417 @@ UDirectionalLightComponent::~UDirectionalLightComponent()
 {
 }
 
+namespace
+{
+	// 갱신 주기가 긴 먼 캐스케이드는 카메라가 조금 움직여도 계속 덮을 수 있도록 반경을 여유 있게 잡음
+	constexpr float ScheduledCascadeGuardBand = 0.1f;
+
+	// 카메라 뷰 공간 절두체 조각(꼭짓점 0~3: Near, 4~7: Far, 중심축 +Z)의 바운딩 스피어
+	// 중심은 축 위에서 Near/Far 모서리까지 거리가 같아지는 깊이이므로, 반경은 카메라 회전/이동과 무관
+	void ComputeSliceBoundingSphere(const TArray<FVector>& SliceVertices, float SliceNear, float SliceFar, FVector& OutCenter, float& OutRadius)
+	{
+		const float NearRadiusSq = SliceVertices[0].X * SliceVertices[0].X + SliceVertices[0].Y * SliceVertices[0].Y;
+		const float FarRadiusSq = SliceVertices[4].X * SliceVertices[4].X + SliceVertices[4].Y * SliceVertices[4].Y;
+		const float Depth = SliceFar - SliceNear;
+
+		float CenterZ = (SliceNear + SliceFar) * 0.5f;
+		if (Depth > KINDA_SMALL_NUMBER)
+		{
+			CenterZ = ((SliceFar * SliceFar - SliceNear * SliceNear) + (FarRadiusSq - NearRadiusSq)) / (2.0f * Depth);
+			CenterZ = std::clamp(CenterZ, SliceNear, SliceFar);
+		}
+
+		const float ToNearSq = (CenterZ - SliceNear) * (CenterZ - SliceNear) + NearRadiusSq;
+		const float ToFarSq = (SliceFar - CenterZ) * (SliceFar - CenterZ) + FarRadiusSq;
+		OutCenter = FVector(0.0f, 0.0f, CenterZ);
+		OutRadius = std::sqrt(std::max(ToNearSq, ToFarSq));
+	}
+
+	// 라이트 공간 스피어를 덮는 정사영 XY 범위. 중심을 텍셀 격자에 스냅하면 카메라가 움직여도 정사영이 텍셀 단위로만 이동
+	// 스냅 오차(최대 1텍셀)를 덮도록 반폭을 한 텍셀만큼 키움: HalfSize = Radius + Texel, Texel = 2 * HalfSize / Resolution
+	void SnapCascadeToTexels(const FVector& InLightCenter, float Radius, int32 Resolution, FVector& OutLightCenter, float& OutHalfSize, float& OutTexel)
+	{
+		const float ResolutionF = static_cast<float>(std::max(Resolution, 4));
+		OutHalfSize = Radius * ResolutionF / (ResolutionF - 2.0f);
+		OutTexel = 2.0f * OutHalfSize / ResolutionF;
+		OutLightCenter = InLightCenter;
+		OutLightCenter.X = std::floor(InLightCenter.X / OutTexel) * OutTexel;
+		OutLightCenter.Y = std::floor(InLightCenter.Y / OutTexel) * OutTexel;
+	}
+
+	// 월드 AABB의 라이트 공간 최소 깊이 (XY가 기둥 [Center ± HalfSize]와 겹치지 않으면 false)
+	bool GetLightSpaceNearInColumn(const FAABB& WorldBounds, const FMatrix& ShadowMapView, const FVector& LightSpaceCenter, float HalfSize, float& OutNear)
+	{
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const FVector& Corner : WorldBounds.GetVertices())
+		{
+			const FVector LightSpaceCorner = Corner * ShadowMapView;
+			Min = FVector(std::min(Min.X, LightSpaceCorner.X), std::min(Min.Y, LightSpaceCorner.Y), std::min(Min.Z, LightSpaceCorner.Z));
+			Max = FVector(std::max(Max.X, LightSpaceCorner.X), std::max(Max.Y, LightSpaceCorner.Y), std::max(Max.Z, LightSpaceCorner.Z));
+		}
+		if (Max.X < LightSpaceCenter.X - HalfSize || Min.X > LightSpaceCenter.X + HalfSize ||
+			Max.Y < LightSpaceCenter.Y - HalfSize || Min.Y > LightSpaceCenter.Y + HalfSize)
+		{
+			return false;
+		}
+		OutNear = Min.Z;
+		return true;
+	}
+}
+
 void UDirectionalLightComponent::GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests)
 {
-	FMatrix ShadowMapView = GetWorldRotation().Inverse().ToMatrix() * FMatrix::ZUpToYUp;
-	FMatrix ViewInv = View->Camera->GetViewMatrix().InverseAffine();
+	const FMatrix ShadowMapView = GetWorldRotation().Inverse().ToMatrix() * FMatrix::ZUpToYUp;
+	const uint64 FrameNumber = URenderManager::GetInstance().GetRenderer()->GetFrameNumber();
+
+	// 아틀라스가 실제로 잡아 줄 타일 크기로 텍셀 스냅과 재사용 판정을 해야 격자가 맞음 (CSM 타일은 줄어들지 않음)
+	UWorld* World = GetWorld();
+	FLightManager* LightManager = World ? World->GetLightManager() : nullptr;
+	const uint32 TileSize = LightManager
+		? LightManager->GetDirectionalShadowTileSize(static_cast<uint32>(std::max(ShadowResolutionScale, 1)))
+		: static_cast<uint32>(ShadowResolutionScale);
+
+	BuildCascadeRequests(View, ShadowMapView, FrameNumber, TileSize, OutRequests);
+}
+
+void UDirectionalLightComponent::BuildCascadeRequests(FSceneView* View, const FMatrix& ShadowMapView, uint64 FrameNumber, uint32 TileSize, TArray<FShadowRenderRequest>& OutRequests)
+{
+	// 오래 쓰이지 않은 카메라(삭제된 카메라, 닫힌 뷰포트)의 상태 정리
+	for (auto It = CascadeStates.begin(); It != CascadeStates.end();)
+	{
+		It = FrameNumber - It->second.LastUsedFrame > CascadeStateMaxIdleFrames ? CascadeStates.erase(It) : std::next(It);
+	}
+
+	FCameraCascadeStates& CameraStates = CascadeStates[View->Camera->UUID];
+	CameraStates.LastUsedFrame = FrameNumber;
+	TArray<FCascadeState>& States = CameraStates.Cascades;
+
+	auto AddRequest = [&](FCascadeState& State, int32 SubViewIndex)
+		{
+			FShadowRenderRequest& ShadowRenderRequest = State.Request;
+			ShadowRenderRequest.LightOwner = this;
+			ShadowRenderRequest.Radius = -1.0f; // Directional Light 표시
+			ShadowRenderRequest.Size = TileSize;
+			ShadowRenderRequest.SubViewIndex = SubViewIndex;
+			ShadowRenderRequest.AtlasScaleOffset = 0;
+			ShadowRenderRequest.SampleCount = 16; // PCF 샘플 카운트
+			ShadowRenderRequest.ShadowBias = GetShadowBias();
+			ShadowRenderRequest.ShadowSlopeBias = GetShadowSlopeBias();
+			ShadowRenderRequest.ShadowSharpen = GetShadowSharpen();
+			OutRequests.Add(ShadowRenderRequest);
+		};
+
 	if (bCascaded == false)
 	{
-		TArray<FVector> CameraFrustum = View->Camera->GetFrustumVertices(View->Viewport);
-		float Near = View->Camera->GetNearClip();
-		float Far = View->Camera->GetFarClip();
-		float CenterDepth = (Far + Near) / 2;
-		FVector Center = FVector(0, 0, CenterDepth);
-		float MaxDis = FVector::Distance(Center, CameraFrustum[7]) * 2;
-		float WorldSizePerTexel = MaxDis / ShadowResolutionScale;
-		
-		CameraFrustum *= ViewInv;
-		CameraFrustum *= ShadowMapView;
-		FAABB CameraFrustumAABB = FAABB(CameraFrustum);
-		CameraFrustumAABB.Min = CameraFrustumAABB.Min.SnapToGrid(FVector(WorldSizePerTexel, WorldSizePerTexel,0), true);
-		CameraFrustumAABB.Max = CameraFrustumAABB.Min + FVector(MaxDis, MaxDis, MaxDis);
-		CameraFrustumAABB.Min.Z -= View->Camera->GetFarClip();
-		FMatrix ShadowMapOrtho = FMatrix::OrthoMatrix(CameraFrustumAABB);
-		FShadowRenderRequest ShadowRenderRequest;
-		ShadowRenderRequest.LightOwner = this;
-		ShadowRenderRequest.ViewMatrix = ShadowMapView;
-		ShadowRenderRequest.ProjectionMatrix = ShadowMapOrtho;
-		// AABB 중심을 라이트 뷰 공간에서 월드 공간으로 변환
-		FVector AABBCenter = CameraFrustumAABB.GetCenter();
-		FMatrix InvView = ShadowMapView.InverseAffine();
-		ShadowRenderRequest.WorldLocation = FVector(
-			AABBCenter.X * InvView.VRows[0].X + AABBCenter.Y * InvView.VRows[1].X + AABBCenter.Z * InvView.VRows[2].X + InvView.VRows[3].X,
-			AABBCenter.X * InvView.VRows[0].Y + AABBCenter.Y * InvView.VRows[1].Y + AABBCenter.Z * InvView.VRows[2].Y + InvView.VRows[3].Y,
-			AABBCenter.X * InvView.VRows[0].Z + AABBCenter.Y * InvView.VRows[1].Z + AABBCenter.Z * InvView.VRows[2].Z + InvView.VRows[3].Z
-		);
-		ShadowRenderRequest.Radius = -1.0f; // Directional Light 표시
-		ShadowRenderRequest.Size = ShadowResolutionScale;
-		ShadowRenderRequest.SubViewIndex = 0;
-		ShadowRenderRequest.AtlasScaleOffset = 0;
-		ShadowRenderRequest.SampleCount = 16; // PCF 샘플 카운트
-		ShadowRenderRequest.ShadowBias = GetShadowBias();
-		ShadowRenderRequest.ShadowSlopeBias = GetShadowSlopeBias();
-		ShadowRenderRequest.ShadowSharpen = GetShadowSharpen();
-		OutRequests.Add(ShadowRenderRequest);
+		States.resize(1);
+		FitCascade(View, ShadowMapView, View->Camera->GetNearClip(), View->Camera->GetFarClip(), 0.0f, TileSize, States[0]);
+		AddRequest(States[0], 0);
 	}
 	else 
 	{
 		CascadedSliceDepth = View->Camera->GetCascadedSliceDepth(CascadedCount, CascadedLinearBlendingValue);
+		States.resize(CascadedCount);
+
+		const int32 UpdateInterval = std::max(CascadedUpdateInterval, 1);
+
 		for (int i = 0; i < CascadedCount; i++)
 		{
 			float Near = CascadedSliceDepth[i];
 			float Far = CascadedSliceDepth[i + 1];
 			//Near -= Near * CascadedOverlapValue;
 			Far += Far * CascadedOverlapValue;
-			TArray<FVector> CameraFrustum = View->Camera->GetFrustumVerticesCascaded(View->Viewport, Near, Far);
-			float CenterDepth = (Far + Near) / 2;
-			FVector Center = FVector(0, 0, CenterDepth);
-			float MaxDis = FVector::Distance(Center, CameraFrustum[7]) * 2;
-			float WorldSizePerTexel = MaxDis / ShadowResolutionScale;
-
-			CameraFrustum *= ViewInv;
-			CameraFrustum *= ShadowMapView;
-			FAABB CameraFrustumAABB = FAABB(CameraFrustum);
-			CameraFrustumAABB.Min = CameraFrustumAABB.Min.SnapToGrid(FVector(WorldSizePerTexel, WorldSizePerTexel, 0), true);
-			CameraFrustumAABB.Max = CameraFrustumAABB.Min + FVector(MaxDis, MaxDis, MaxDis);
-			CameraFrustumAABB.Min.Z -= View->Camera->GetFarClip();
-			FMatrix ShadowMapOrtho = FMatrix::OrthoMatrix(CameraFrustumAABB);
-			FShadowRenderRequest ShadowRenderRequest;
-			ShadowRenderRequest.LightOwner = this;
-			ShadowRenderRequest.ViewMatrix = ShadowMapView;
-			ShadowRenderRequest.ProjectionMatrix = ShadowMapOrtho;
-			// AABB 중심을 라이트 뷰 공간에서 월드 공간으로 변환
-			FVector AABBCenter = CameraFrustumAABB.GetCenter();
-			FMatrix InvView = ShadowMapView.InverseAffine();
-			ShadowRenderRequest.WorldLocation = FVector(
-				AABBCenter.X * InvView.VRows[0].X + AABBCenter.Y * InvView.VRows[1].X + AABBCenter.Z * InvView.VRows[2].X + InvView.VRows[3].X,
-				AABBCenter.X * InvView.VRows[0].Y + AABBCenter.Y * InvView.VRows[1].Y + AABBCenter.Z * InvView.VRows[2].Y + InvView.VRows[3].Y,
-				AABBCenter.X * InvView.VRows[0].Z + AABBCenter.Y * InvView.VRows[1].Z + AABBCenter.Z * InvView.VRows[2].Z + InvView.VRows[3].Z
-			);
-			ShadowRenderRequest.Radius = -1.0f; // Directional Light 표시
-			ShadowRenderRequest.Size = ShadowResolutionScale;
-			ShadowRenderRequest.SubViewIndex = i;
-			ShadowRenderRequest.AtlasScaleOffset = 0;
-			ShadowRenderRequest.SampleCount = 16; // PCF 샘플 카운트
-			ShadowRenderRequest.ShadowBias = GetShadowBias();
-			ShadowRenderRequest.ShadowSlopeBias = GetShadowSlopeBias();
-			ShadowRenderRequest.ShadowSharpen = GetShadowSharpen();
-			OutRequests.Add(ShadowRenderRequest);
+
+			// 가까운 캐스케이드는 매 프레임, 먼 캐스케이드는 UpdateInterval 프레임마다 (캐스케이드별로 프레임을 엇갈려 분산)
+			const bool bScheduled = UpdateInterval > 1 && i >= CascadedFullRateCount;
+			FCascadeState& State = States[i];
+
+			bool bReuse = bScheduled && State.bValid
+				&& (FrameNumber + i) % UpdateInterval != 0
+				&& State.Request.ViewMatrix == ShadowMapView
+				&& State.Request.Size == TileSize;
+			if (bReuse)
+			{
+				// 이전 정사영이 현재 조각의 스피어를 여전히 덮을 때만 재사용
+				TArray<FVector> SliceVertices = View->Camera->GetFrustumVerticesCascaded(View->Viewport, Near, Far);
+				FVector ViewCenter;
+				float Radius = 0.0f;
+				ComputeSliceBoundingSphere(SliceVertices, Near, Far, ViewCenter, Radius);
+				const FVector LightCenter = ViewCenter * (View->Camera->GetViewMatrix().InverseAffine() * ShadowMapView);
+
+				bReuse = std::fabs(LightCenter.X - State.LightSpaceCenter.X) + Radius <= State.HalfSize
+					&& std::fabs(LightCenter.Y - State.LightSpaceCenter.Y) + Radius <= State.HalfSize
+					&& LightCenter.Z - Radius >= State.NearDepth
+					&& LightCenter.Z + Radius <= State.FarDepth;
+			}
+
+			if (!bReuse)
+			{
+				FitCascade(View, ShadowMapView, Near, Far, bScheduled ? ScheduledCascadeGuardBand : 0.0f, TileSize, State);
+			}
+			AddRequest(State, i);
 		}
 	}
 }
 
+void UDirectionalLightComponent::FitCascade(FSceneView* View, const FMatrix& ShadowMapView, float SliceNear, float SliceFar, float GuardBand, uint32 TileSize, FCascadeState& OutState)
+{
+	TArray<FVector> SliceVertices = View->Camera->GetFrustumVerticesCascaded(View->Viewport, SliceNear, SliceFar);
+	FVector ViewCenter;
+	float Radius = 0.0f;
+	ComputeSliceBoundingSphere(SliceVertices, SliceNear, SliceFar, ViewCenter, Radius);
+	Radius *= 1.0f + GuardBand;
+
+	// 텍셀 격자에 스냅해 카메라가 움직여도 그림자가 떨리지 않게 함
+	FVector LightCenter;
+	float HalfSize = 0.0f;
+	float WorldSizePerTexel = 0.0f;
+	SnapCascadeToTexels(ViewCenter * (View->Camera->GetViewMatrix().InverseAffine() * ShadowMapView), Radius, static_cast<int32>(TileSize), LightCenter, HalfSize, WorldSizePerTexel);
+
+	// Far는 스피어 끝, Near는 스피어 앞쪽에 그림자를 드리우는 캐스터까지 (둘 다 바깥쪽으로 텍셀 격자에 스냅)
+	const float FarDepth = std::ceil((LightCenter.Z + HalfSize) / WorldSizePerTexel) * WorldSizePerTexel;
+	float NearDepth = FindCasterNearDepth(ShadowMapView, LightCenter, HalfSize, LightCenter.Z - HalfSize, FarDepth, View->Camera->GetFarClip());
+	NearDepth = std::floor(NearDepth / WorldSizePerTexel) * WorldSizePerTexel;
+
+	const FAABB LightSpaceBox(
+		FVector(LightCenter.X - HalfSize, LightCenter.Y - HalfSize, NearDepth),
+		FVector(LightCenter.X + HalfSize, LightCenter.Y + HalfSize, FarDepth));
+
+	OutState.Request.ViewMatrix = ShadowMapView;
+	OutState.Request.ProjectionMatrix = FMatrix::OrthoMatrix(LightSpaceBox);
+	// 박스 중심을 라이트 뷰 공간에서 월드 공간으로 변환
+	OutState.Request.WorldLocation = LightSpaceBox.GetCenter() * ShadowMapView.InverseAffine();
+	OutState.LightSpaceCenter = LightCenter;
+	OutState.HalfSize = HalfSize;
+	OutState.NearDepth = NearDepth;
+	OutState.FarDepth = FarDepth;
+	OutState.bValid = true;
+}
+
+float UDirectionalLightComponent::FindCasterNearDepth(const FMatrix& ShadowMapView, const FVector& LightSpaceCenter, float HalfSize, float InReceiverNear, float InFar, float CameraFarClip)
+{
+	UWorld* World = GetWorld();
+	UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH || BVH->IsRebuildPending())
+	{
+		// BVH를 쓸 수 없으면 이전처럼 카메라 Far만큼 광원 쪽으로 늘림
+		return InReceiverNear - CameraFarClip;
+	}
+
+	// 씬 바운드에서 광원에 가장 가까운 깊이
+	float SceneNear = InReceiverNear;
+	for (const FVector& Corner : BVH->GetBounds().GetVertices())
+	{
+		SceneNear = std::min(SceneNear, (Corner * ShadowMapView).Z);
+	}
+
+	float CasterNear = InReceiverNear;
+	if (SceneNear < InReceiverNear)
+	{
+		// 캐스케이드 XY 범위를 광원 쪽으로 씬 끝까지 늘린 기둥과 겹치는 캐스터만 검사
+		const FAABB LightSpaceColumn(
+			FVector(LightSpaceCenter.X - HalfSize, LightSpaceCenter.Y - HalfSize, SceneNear),
+			FVector(LightSpaceCenter.X + HalfSize, LightSpaceCenter.Y + HalfSize, InFar));
+		const FOBB ColumnBound(LightSpaceColumn, ShadowMapView.InverseAffine());
+
+		for (UStaticMeshComponent* Component : BVH->QueryIntersectedComponents(ColumnBound))
+		{
+			if (!Component || !Component->IsCastShadows() || !Component->IsVisible())
+			{
+				continue;
+			}
+			for (const FVector& Corner : Component->GetWorldAABB().GetVertices())
+			{
+				CasterNear = std::min(CasterNear, (Corner * ShadowMapView).Z);
+			}
+		}
+	}
+
+	// 더티 큐에서 대기 중인 컴포넌트는 BVH 바운드가 옛 위치라 질의에서 빠질 수 있으므로 현재 바운드로 직접 검사
+	for (UStaticMeshComponent* Component : Partition->GetPendingUpdates())
+	{
+		float ComponentNear = 0.0f;
+		if (Component && Component->IsCastShadows() && Component->IsVisible()
+			&& GetLightSpaceNearInColumn(Component->GetWorldAABB(), ShadowMapView, LightSpaceCenter, HalfSize, ComponentNear))
+		{
+			CasterNear = std::min(CasterNear, ComponentNear);
+		}
+	}
+	return CasterNear;
+}
+
+bool UDirectionalLightComponent::RunCascadeStabilityTest(uint32 InFrameCount)
+{
+	// 월드에 등록하지 않은 임시 라이트/카메라로 실제 BuildCascadeRequests(스케줄링 + 재사용 + FitCascade)를 프레임마다 구동
+	// 월드가 없으므로 캐스터 Near는 카메라 Far만큼 늘린 기본값을 쓰지만, 텍셀 스냅과 재사용 판정은 실제 경로 그대로
+	constexpr uint32 TileSize = 2048;
+	UDirectionalLightComponent* Light = NewObject<UDirectionalLightComponent>();
+	Light->bCascaded = true;
+	Light->CascadedCount = 4;
+	Light->CascadedUpdateInterval = 4;
+	Light->CascadedFullRateCount = 2;
+
+	UCameraComponent* Camera = NewObject<UCameraComponent>();
+	Camera->SetFOV(60.0f);
+	Camera->SetClipPlanes(0.1f, 500.0f);
+	FViewport Viewport;
+	Viewport.Resize(0, 0, 1920, 1080);
+
+	const FMatrix ShadowMapView = FQuat::MakeFromEulerZYX(FVector(0.0f, 50.0f, 35.0f)).Inverse().ToMatrix() * FMatrix::ZUpToYUp;
+
+	// 텍셀 위상을 추적할 고정 월드 점 (정사영이 텍셀 단위로만 움직이면 이 점의 텍셀 내 소수 위치가 변하지 않음)
+	const FVector ProbeLight = FVector(13.7f, -42.1f, 3.3f) * ShadowMapView;
+
+	struct FCascadeTrack
+	{
+		float HalfSize = 0.0f;
+		float ProbeFractionX = 0.0f;
+		float ProbeFractionY = 0.0f;
+	};
+	TArray<FCascadeTrack> Tracks(Light->CascadedCount);
+
+	// 텍셀 내 소수 위치 차이 (0과 1 근처는 같은 위상)
+	auto PhaseDelta = [](float A, float B)
+	{
+		const float Delta = std::fabs(A - B);
+		return std::min(Delta, 1.0f - Delta);
+	};
+	auto IsSameFit = [](const FCascadeState& A, const FCascadeState& B)
+	{
+		return A.LightSpaceCenter.X == B.LightSpaceCenter.X && A.LightSpaceCenter.Y == B.LightSpaceCenter.Y
+			&& A.HalfSize == B.HalfSize && A.NearDepth == B.NearDepth && A.FarDepth == B.FarDepth
+			&& A.Request.ProjectionMatrix == B.Request.ProjectionMatrix;
+	};
+
+	uint32 SizeChanges = 0;
+	uint32 PhaseShifts = 0;
+	uint32 Uncovered = 0;
+	uint32 UnsnappedDepths = 0;
+	uint32 MissingRequests = 0;
+	uint32 MissedRefits = 0;		// 갱신 프레임이거나 이전 정사영이 조각을 못 덮는데 새로 피팅하지 않음
+	uint32 UnexpectedRefits = 0;	// 재사용해야 할 프레임에 정사영이 바뀜
+	uint32 ScheduledRefits = 0;
+	uint32 CoverageRefits = 0;
+	uint32 Reused = 0;
+	float MaxPhaseDelta = 0.0f;
+
+	// 카메라 속도는 프레임 수와 무관하게 고정 (한 바퀴 2000프레임, 500프레임마다 급회전 → 최소 한 번은 포함)
+	constexpr float PathFrames = 2000.0f;
+	constexpr uint32 SnapTurnFrames = 500;
+	const int32 UpdateInterval = Light->CascadedUpdateInterval;
+	const uint32 FrameCount = std::max(InFrameCount, SnapTurnFrames + 16);
+	TArray<FCascadeState> Previous;
+	for (uint32 Frame = 0; Frame < FrameCount; ++Frame)
+	{
+		// 원을 따라 걸으며 좌우로 둘러보고 위아래로 흔들리는 카메라. 주기적으로 90도 급회전해 재사용 불가 상황을 만듦
+		const float T = static_cast<float>(Frame) / PathFrames;
+		const FVector Eye(40.0f * std::cos(T * 6.2831853f), 40.0f * std::sin(T * 6.2831853f), 2.0f + 0.5f * std::sin(T * 40.0f));
+		const float Yaw = T * 360.0f * 3.0f + 90.0f * static_cast<float>(Frame / SnapTurnFrames);
+		const float Pitch = 10.0f * std::sin(T * 17.0f);
+		Camera->SetWorldLocationAndRotation(Eye, FQuat::MakeFromEulerZYX(FVector(0.0f, Pitch, Yaw)));
+
+		FSceneView View(Camera, &Viewport, EViewModeIndex::VMI_Lit_Phong);
+		TArray<FShadowRenderRequest> Requests;
+		Light->BuildCascadeRequests(&View, ShadowMapView, Frame, TileSize, Requests);
+
+		const TArray<FCascadeState>& States = Light->CascadeStates[Camera->UUID].Cascades;
+		const FMatrix ViewToLight = Camera->GetViewMatrix().InverseAffine() * ShadowMapView;
+		for (int32 i = 0; i < Light->CascadedCount; ++i)
+		{
+			const FCascadeState& State = States[i];
+			if (i >= Requests.Num() || Requests[i].SubViewIndex != i || !(Requests[i].ProjectionMatrix == State.Request.ProjectionMatrix))
+			{
+				++MissingRequests;
+			}
+
+			// 이번 프레임 조각의 스피어 (재사용 여부와 상관없이 정사영이 덮어야 하는 범위)
+			const float Near = Light->CascadedSliceDepth[i];
+			const float Far = Light->CascadedSliceDepth[i + 1] * (1.0f + Light->CascadedOverlapValue);
+			FVector ViewCenter;
+			float Radius = 0.0f;
+			ComputeSliceBoundingSphere(Camera->GetFrustumVerticesCascaded(&Viewport, Near, Far), Near, Far, ViewCenter, Radius);
+			const FVector SphereCenter = ViewCenter * ViewToLight;
+			// 재사용 판정은 오차 없이, 스냅 결과 검사는 부동소수 오차만큼 허용 (스냅 후 여유가 정확히 한 텍셀)
+			auto Covers = [&](const FCascadeState& Fit, float Tolerance)
+			{
+				return Fit.bValid
+					&& std::fabs(SphereCenter.X - Fit.LightSpaceCenter.X) + Radius <= Fit.HalfSize + Tolerance
+					&& std::fabs(SphereCenter.Y - Fit.LightSpaceCenter.Y) + Radius <= Fit.HalfSize + Tolerance
+					&& Fit.NearDepth <= SphereCenter.Z - Radius && Fit.FarDepth >= SphereCenter.Z + Radius;
+			};
+
+			// 1. 가까운 캐스케이드와 갱신 프레임은 새로 피팅, 그 외에는 이전 정사영이 덮는 동안 그대로 재사용
+			const bool bScheduled = UpdateInterval > 1 && i >= Light->CascadedFullRateCount;
+			const bool bUpdateFrame = (Frame + i) % UpdateInterval == 0;
+			const bool bHasPrevious = i < Previous.Num() && Previous[i].bValid;
+			const bool bMustRefit = !bScheduled || !bHasPrevious || bUpdateFrame || !Covers(Previous[i], 0.0f);
+			if (bMustRefit)
+			{
+				FCascadeState Expected;
+				Light->FitCascade(&View, ShadowMapView, Near, Far, bScheduled ? ScheduledCascadeGuardBand : 0.0f, TileSize, Expected);
+				MissedRefits += IsSameFit(State, Expected) ? 0 : 1;
+				if (bScheduled && bHasPrevious && bUpdateFrame)
+				{
+					++ScheduledRefits;
+				}
+				else if (bScheduled && bHasPrevious)
+				{
+					++CoverageRefits;
+				}
+			}
+			else
+			{
+				UnexpectedRefits += IsSameFit(State, Previous[i]) ? 0 : 1;
+				++Reused;
+			}
+
+			// 2. 스냅된 정사영은 조각의 스피어 전체를 덮어야 함
+			Uncovered += Covers(State, State.HalfSize * 1e-5f) ? 0 : 1;
+
+			// 3. 크기(=텍셀 월드 크기)는 카메라 이동/회전과 무관하게 일정해야 함
+			FCascadeTrack& Track = Tracks[i];
+			const float Texel = 2.0f * State.HalfSize / static_cast<float>(TileSize);
+			const float ProbeTexelX = (ProbeLight.X - (State.LightSpaceCenter.X - State.HalfSize)) / Texel;
+			const float ProbeTexelY = (ProbeLight.Y - (State.LightSpaceCenter.Y - State.HalfSize)) / Texel;
+			const float FractionX = ProbeTexelX - std::floor(ProbeTexelX);
+			const float FractionY = ProbeTexelY - std::floor(ProbeTexelY);
+			if (Frame == 0)
+			{
+				Track.HalfSize = State.HalfSize;
+				Track.ProbeFractionX = FractionX;
+				Track.ProbeFractionY = FractionY;
+			}
+			SizeChanges += State.HalfSize != Track.HalfSize ? 1 : 0;
+
+			// 4. 고정 점의 텍셀 내 위치가 프레임마다 같아야 함 (스냅된 원점이 정수 텍셀만큼만 이동)
+			const float Delta = std::max(PhaseDelta(FractionX, Track.ProbeFractionX), PhaseDelta(FractionY, Track.ProbeFractionY));
+			MaxPhaseDelta = std::max(MaxPhaseDelta, Delta);
+			PhaseShifts += Delta > 0.02f ? 1 : 0;
+
+			// 5. Near/Far 깊이도 텍셀 격자 위에 있어야 함
+			const float NearPhase = State.NearDepth / Texel - std::round(State.NearDepth / Texel);
+			const float FarPhase = State.FarDepth / Texel - std::round(State.FarDepth / Texel);
+			UnsnappedDepths += (std::fabs(NearPhase) > 1e-3f || std::fabs(FarPhase) > 1e-3f) ? 1 : 0;
+		}
+		Previous = States;
+	}
+
+	const int32 CascadeCount = Light->CascadedCount;
+	ObjectFactory::DeleteObject(Light);
+	ObjectFactory::DeleteObject(Camera);
+
+	// 스케줄이 실제로 재사용과 두 종류의 재피팅(갱신 주기, 커버리지 이탈)을 모두 거쳐야 의미 있는 검사
+	const bool bScheduleExercised = Reused > 0 && ScheduledRefits > 0 && CoverageRefits > 0;
+	const bool bPassed = SizeChanges == 0 && PhaseShifts == 0 && Uncovered == 0 && UnsnappedDepths == 0
+		&& MissingRequests == 0 && MissedRefits == 0 && UnexpectedRefits == 0 && bScheduleExercised;
+	UE_LOG("[CascadeStabilityTest] %u frames x %d cascades: size changes %u, texel phase shifts %u (max %.4f texel), uncovered %u, unsnapped depths %u, missing requests %u",
+		FrameCount, CascadeCount, SizeChanges, PhaseShifts, MaxPhaseDelta, Uncovered, UnsnappedDepths, MissingRequests);
+	UE_LOG("[CascadeStabilityTest] schedule: reused %u, scheduled refits %u, coverage refits %u, missed refits %u, unexpected refits %u %s",
+		Reused, ScheduledRefits, CoverageRefits, MissedRefits, UnexpectedRefits, bPassed ? "PASSED" : "FAILED");
+	return bPassed;
+}
+
 FVector UDirectionalLightComponent::GetLightDirection() const
 {
 	// Z-Up Left-handed 좌표계에서 Forward는 X축
@@ -188,7 +515,9 @@ void UDirectionalLightComponent::OnRegister(UWorld* InWorld)
 
 void UDirectionalLightComponent::OnUnregister()
 {
+	Super::OnUnregister();
 	GWorld->GetLightManager()->DeRegisterLight(this);
+	CascadeStates.clear();
 }
 
 void UDirectionalLightComponent::UpdateLightData()
@@ -216,6 +545,7 @@ void UDirectionalLightComponent::DuplicateSubObjects()
 {
 	Super::DuplicateSubObjects();
 	DirectionGizmo = nullptr;
+	CascadeStates.clear();
 }
 
 void UDirectionalLightComponent::UpdateDirectionGizmo()
@@ -2,6 +2,8 @@
 #include "LightComponent.h"
 #include "LightManager.h"
 
+class UCameraComponent;
+
 // 방향성 라이트 (태양광 같은 평행광)
 class UDirectionalLightComponent : public ULightComponent
 {
@@ -37,17 +39,51 @@ public:
 
 	bool IsOverrideCameraLightPerspective() { return bOverrideCameraLightPerspective; }
 
+	// 임시 카메라를 스크립트된 경로로 움직이며 실제 캐스케이드 요청 생성(스케줄링/재사용/피팅)을 매 프레임 실행해
+	// 정사영이 텍셀 단위로만 움직이고 크기가 변하지 않는지, 먼 캐스케이드가 의도대로 재사용/재피팅되는지 검사
+	static bool RunCascadeStabilityTest(uint32 InFrameCount);
+
 protected:
 	// Direction Gizmo (shows light direction)
 	class UGizmoArrowComponent* DirectionGizmo = nullptr;
 	ID3D11ShaderResourceView* ShadowMapSRV = nullptr;
 private:
+	// 카메라별 캐스케이드 피팅 결과 (먼 캐스케이드를 몇 프레임 동안 재사용)
+	struct FCascadeState
+	{
+		FShadowRenderRequest Request;
+		FVector LightSpaceCenter;   // 텍셀 격자에 스냅된 라이트 공간 중심
+		float HalfSize = 0.0f;      // 정사영 XY 반폭
+		float NearDepth = 0.0f;     // 라이트 공간 Near/Far
+		float FarDepth = 0.0f;
+		bool bValid = false;
+	};
+
+	// 이 프레임 수 동안 쓰이지 않은 카메라의 캐스케이드 상태는 정리
+	static constexpr uint64 CascadeStateMaxIdleFrames = 120;
+
+	struct FCameraCascadeStates
+	{
+		TArray<FCascadeState> Cascades;
+		uint64 LastUsedFrame = 0;
+	};
+
+	// 캐스케이드 분할, 먼 캐스케이드 갱신 스케줄과 이전 피팅 재사용 판정 후 요청 추가 (GetShadowRenderRequests 본체)
+	void BuildCascadeRequests(FSceneView* View, const FMatrix& ShadowMapView, uint64 FrameNumber, uint32 TileSize, TArray<FShadowRenderRequest>& OutRequests);
+	// 카메라 절두체 조각 [SliceNear, SliceFar]를 덮는 정사영 요청 생성 (스피어 피팅 + TileSize 텍셀 격자 스냅 + 캐스터 기반 Near)
+	void FitCascade(FSceneView* View, const FMatrix& ShadowMapView, float SliceNear, float SliceFar, float GuardBand, uint32 TileSize, FCascadeState& OutState);
+	// 라이트 공간 기둥 [Center ± HalfSize] 안에서 광원 쪽으로 가장 가까운 캐스터 깊이 (못 찾으면 InReceiverNear)
+	float FindCasterNearDepth(const FMatrix& ShadowMapView, const FVector& LightSpaceCenter, float HalfSize, float InReceiverNear, float InFar, float CameraFarClip);
+
 	bool bCascaded = true;
 	int CascadedCount = 4;
 	float CascadedLinearBlendingValue = 0.5f;
 	float CascadedOverlapValue = 0.2f;
+	int CascadedUpdateInterval = 4;  // 먼 캐스케이드 갱신 주기 (프레임)
+	int CascadedFullRateCount = 2;   // 매 프레임 갱신하는 가까운 캐스케이드 수
 	bool bOverrideCameraLightPerspective = false;
 	TArray<float> CascadedSliceDepth;
+	TMap<uint32, FCameraCascadeStates> CascadeStates;  // 카메라 UUID별 (해제된 카메라 주소가 재사용돼도 섞이지 않도록)
 
 	//로그용
 	float CascadedAreaColorDebugValue = 0;
@@ -28,12 +28,12 @@ public:
     float GetFogHeight() const { return GetWorldLocation().Z; }
     
     // Fog Parameters Setters
-    void SetFogDensity(float InDensity) { FogDensity = InDensity; }
-    void SetFogHeightFalloff(float InFalloff) { FogHeightFalloff = InFalloff; }
-    void SetStartDistance(float InDistance) { StartDistance = InDistance; }
-    void SetFogCutoffDistance(float InDistance) { FogCutoffDistance = InDistance; }
-    void SetFogMaxOpacity(float InOpacity) { FogMaxOpacity = InOpacity; }
-    void SetFogInscatteringColor(FLinearColor InColor) { FogInscatteringColor = InColor; }
+    void SetFogDensity(float InDensity) { FogDensity = InDensity; MarkRenderStateDirty(); }
+    void SetFogHeightFalloff(float InFalloff) { FogHeightFalloff = InFalloff; MarkRenderStateDirty(); }
+    void SetStartDistance(float InDistance) { StartDistance = InDistance; MarkRenderStateDirty(); }
+    void SetFogCutoffDistance(float InDistance) { FogCutoffDistance = InDistance; MarkRenderStateDirty(); }
+    void SetFogMaxOpacity(float InOpacity) { FogMaxOpacity = InOpacity; MarkRenderStateDirty(); }
+    void SetFogInscatteringColor(FLinearColor InColor) { FogInscatteringColor = InColor; MarkRenderStateDirty(); }
     
     // Rendering
     void RenderHeightFog(URenderer* Renderer);
@@ -23,7 +23,8 @@ ULightComponentBase::~ULightComponentBase()
 
 void ULightComponentBase::UpdateLightData()
 {
-	// 자식 클래스에서 오버라이드
+	// 자식 클래스에서 오버라이드 (Super 호출로 뷰포트 캐시가 변경을 알게 됨)
+	MarkRenderStateDirty();
 }
 
 void ULightComponentBase::OnSerialized()
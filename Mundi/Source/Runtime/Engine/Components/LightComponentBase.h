@@ -18,10 +18,10 @@ public:
 	//void SetEnabled(bool bInEnabled) { bIsEnabled = bInEnabled; }
 	//bool IsEnabled() const { return bIsEnabled; }
 
-	void SetIntensity(float InIntensity) { Intensity = InIntensity;  }
+	void SetIntensity(float InIntensity) { Intensity = InIntensity; MarkRenderStateDirty(); }
 	float GetIntensity() const { return Intensity; }
 
-	void SetLightColor(const FLinearColor& InColor) { LightColor = InColor; }
+	void SetLightColor(const FLinearColor& InColor) { LightColor = InColor; MarkRenderStateDirty(); }
 	const FLinearColor& GetLightColor() const { return LightColor; }
 
 	// Virtual Interface
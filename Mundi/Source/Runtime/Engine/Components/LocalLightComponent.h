@@ -13,7 +13,7 @@ public:
 
 public:
 	// Attenuation Properties
-	void SetAttenuationRadius(float InRadius) { AttenuationRadius = InRadius; }
+	void SetAttenuationRadius(float InRadius) { AttenuationRadius = InRadius; RefreshSceneProxy(); }
 	float GetAttenuationRadius() const { return AttenuationRadius; }
 
 	void SetFalloffExponent(float InExponent) { FalloffExponent = InExponent; }
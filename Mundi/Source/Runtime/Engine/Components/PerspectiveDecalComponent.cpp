@@ -168,13 +168,8 @@ void UPerspectiveDecalComponent::Serialize(const bool bInIsLoading, JSON& InOutH
 	Super::Serialize(bInIsLoading, InOutHandle);
 	if (bInIsLoading)
 	{
-		float FovYTemp;
-		FJsonSerializer::ReadFloat(InOutHandle, "FovY", FovYTemp);
-		SetFovY(FovYTemp);
-	}
-	else
-	{
-		InOutHandle["FovY"] = GetFovY();
+		// FovY 값은 리플렉션 직렬화에서 읽었으므로 파생 상태만 갱신
+		SetFovY(FovY);
 	}
 }
 
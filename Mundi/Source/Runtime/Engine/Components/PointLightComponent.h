@@ -16,7 +16,7 @@ public:
 	void GetShadowRenderRequests(FSceneView* View, TArray<FShadowRenderRequest>& OutRequests) override;
 
 	// Source Radius
-	void SetSourceRadius(float InRadius) { SourceRadius = InRadius; }
+	void SetSourceRadius(float InRadius) { SourceRadius = InRadius; MarkRenderStateDirty(); }
 	float GetSourceRadius() const { return SourceRadius; }
 
 	// Light Info
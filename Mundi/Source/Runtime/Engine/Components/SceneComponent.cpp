@@ -5,6 +5,7 @@
 #include "PrimitiveComponent.h"
 #include "WorldPartitionManager.h"
 #include "BillboardComponent.h"
+#include "RenderScene.h"
 
 IMPLEMENT_CLASS(USceneComponent)
 
@@ -32,6 +33,9 @@ USceneComponent::USceneComponent()
 
 USceneComponent::~USceneComponent()
 {
+    // 등록되지 않은 에디터 보조 컴포넌트도 여기서 프록시 제거
+    UnregisterSceneProxy();
+
     // 자식 메모리 해제
     // 복사본을 만들어 부모 리스트 무효화 문제를 피함
     TArray<USceneComponent*> ChildrenCopy = AttachChildren;
@@ -315,6 +319,7 @@ void USceneComponent::DuplicateSubObjects()
 
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
+    RenderScene = nullptr; // 복제본은 새 월드에 등록될 때 프록시 생성
 
     // AttachChildren 배열의 실제 요소의 포인터 값을 바꿔야 하므로 *이 아닌, *&로 받음
     for (USceneComponent*& Child : AttachChildren)
@@ -368,6 +373,8 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 void USceneComponent::OnRegister(UWorld* InWorld)
 {
+    RegisterSceneProxy(InWorld);
+
     if (!std::strcmp(this->GetClass()->Name , USceneComponent::StaticClass()->Name) && !SpriteComponent)
     {
         CREATE_EDITOR_COMPONENT(SpriteComponent, UBillboardComponent);
@@ -376,6 +383,48 @@ void USceneComponent::OnRegister(UWorld* InWorld)
     }
 }
 
+void USceneComponent::OnUnregister()
+{
+    Super::OnUnregister();
+    UnregisterSceneProxy();
+}
+
+void USceneComponent::RegisterSceneProxy(UWorld* InWorld)
+{
+    if (RenderScene || !InWorld || !Owner)
+    {
+        return;
+    }
+
+    RenderScene = InWorld->GetRenderScene();
+    RenderScene->AddProxy(this, InWorld->IsEditorActor(Owner));
+}
+
+void USceneComponent::UnregisterSceneProxy()
+{
+    if (RenderScene)
+    {
+        RenderScene->RemoveProxy(this);
+        RenderScene = nullptr;
+    }
+}
+
+void USceneComponent::RefreshSceneProxy()
+{
+    if (RenderScene)
+    {
+        RenderScene->UpdateProxy(this);
+    }
+}
+
+void USceneComponent::MarkRenderStateDirty()
+{
+    if (RenderScene)
+    {
+        RenderScene->MarkRenderStateDirty();
+    }
+}
+
 void USceneComponent::OnSerialized()
 {
 	Super::OnSerialized();
@@ -383,12 +432,25 @@ void USceneComponent::OnSerialized()
 
 void USceneComponent::OnTransformUpdated()
 {
+    // 렌더되는 컴포넌트만 프록시 바운드를 갱신하고 리비전을 올림 (에디터 카메라 이동은 뷰 행렬로 따로 감지)
+    RefreshSceneProxy();
+
     for (USceneComponent* Child : GetAttachChildren())
     {
         Child->OnTransformUpdated();
     }
 }
 
+void USceneComponent::SetVisibility(bool bInVisibility)
+{
+    if (bIsVisible == bInVisibility)
+    {
+        return;
+    }
+    bIsVisible = bInVisibility;
+    RefreshSceneProxy();
+}
+
 UWorld* USceneComponent::GetWorld()
 {
     return Owner ? Owner->GetWorld() : nullptr;
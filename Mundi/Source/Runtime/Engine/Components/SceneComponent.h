@@ -10,6 +10,7 @@ enum class EAttachmentRule
 };
 
 class URenderer;
+class FRenderScene;
 class USceneComponent : public UActorComponent
 {
 public:
@@ -101,8 +102,15 @@ public:
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
     void OnRegister(UWorld* InWorld) override;
+    void OnUnregister() override;
     void OnSerialized() override;
 
+    // 렌더 씬 프록시 등록/해제 (에디터 보조 컴포넌트는 RegisterComponent를 거치지 않으므로 직접 호출)
+    void RegisterSceneProxy(UWorld* InWorld);
+    void UnregisterSceneProxy();
+    // 프록시에 캐시된 가시성/바운드를 다시 읽게 함 (가시성, 메시, 소유 액터 숨김 변경 시)
+    void RefreshSceneProxy();
+
     virtual void OnTransformUpdated();
 
     // SceneId
@@ -111,7 +119,8 @@ public:
     uint32 GetParentId() const { return ParentId; }
     void SetParentId(uint32 InParentId) { ParentId = InParentId; }
 
-    void SetVisibility(bool bInVisibility) { bIsVisible = bInVisibility; }
+    void SetVisibility(bool bInVisibility);
+    bool GetVisibility() const { return bIsVisible; }
     // World가 Pie인 경우 컴포넌트 자체의 Visibility, HiddenInGame, 액터 자체의 HiddenInGame을 다 테스트후 렌더링
     // Editor인 경우 Visibility와 HiddenInEditor만 체크
     bool IsVisible() const { return GWorld->bPie ? (bIsActive && bIsVisible && !bHiddenInGame) 
@@ -137,9 +146,16 @@ protected:
      */
    // void PropagateTransformUpdate();
 
+    void OnVisibilityStateChanged() override { RefreshSceneProxy(); }
+    // 바운드/가시성은 그대로이고 렌더 결과만 바뀌는 속성(광원 색, 안개 농도 등) 변경을 렌더 씬에 알림
+    void MarkRenderStateDirty();
+
     //Component 위치 나타내기 위함
     UBillboardComponent* SpriteComponent = nullptr;
 
+    // 프록시가 등록된 렌더 씬 (미등록이면 nullptr)
+    FRenderScene* RenderScene = nullptr;
+
     bool bWantsOnUpdateTransform = false;
     bool bIsVisible = true;
 
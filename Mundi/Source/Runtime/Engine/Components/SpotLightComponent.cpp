@@ -183,6 +183,7 @@ void USpotLightComponent::OnRegister(UWorld* InWorld)
 
 void USpotLightComponent::OnUnregister()
 {
+	Super::OnUnregister();
 	GWorld->GetLightManager()->DeRegisterLight(this);
 }
 
@@ -26,6 +26,7 @@ public:
 		{
 			OuterConeAngle = InnerConeAngle;
 		}
+		MarkRenderStateDirty();
 	}
 	float GetInnerConeAngle() const { return InnerConeAngle; }
 
@@ -37,6 +38,7 @@ public:
 		{
 			InnerConeAngle = OuterConeAngle;
 		}
+		MarkRenderStateDirty();
 	}
 	float GetOuterConeAngle() const { return OuterConeAngle; }
 
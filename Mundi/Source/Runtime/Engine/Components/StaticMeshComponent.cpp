@@ -11,7 +11,9 @@
 #include "CameraActor.h"
 #include "CameraComponent.h"
 #include "MeshBatchElement.h"
+#include "SceneView.h"
 #include "Material.h"
+#include "RenderManager.h"
 
 IMPLEMENT_CLASS(UStaticMeshComponent)
 
@@ -51,6 +53,9 @@ void UStaticMeshComponent::ClearDynamicMaterials()
 	// (이 배열이 MID 포인터를 가리키고 있었을 수 있으므로
 	//  delete 이후에 비워야 안전합니다.)
 	MaterialSlots.Empty();
+
+	// 삭제된 MID 주소가 새 MID에 재사용될 수 있으므로 캐시도 함께 버림
+	InvalidateMeshDrawCommands();
 }
 
 void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
@@ -60,7 +65,75 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		return;
 	}
 
-	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetMeshGroupInfo();
+	const uint32 LODIndex = SelectLOD(View);
+
+	if (!IsMeshDrawCommandCacheValid())
+	{
+		CachedDrawCommands.clear();
+		CachedDrawCommands.resize(std::max(1u, StaticMesh->GetLODCount()));
+		CachedDrawCommandMesh = StaticMesh;
+		CachedDrawCommandMaterials = MaterialSlots;
+		CachedDrawCommandParent = AttachParent;
+		CachedDrawCommandSerial = UShader::GetVariantSelectionSerial();
+		bCachedWorldMatrixDirty = true;
+	}
+
+	// 트랜스폼만 바뀐 경우: 이미 만든 커맨드의 월드 행렬만 갱신
+	if (bCachedWorldMatrixDirty)
+	{
+		CachedWorldMatrix = GetWorldMatrix();
+		for (FCachedLODDrawCommands& LODCommands : CachedDrawCommands)
+		{
+			for (FMeshBatchElement& Element : LODCommands.Elements)
+			{
+				Element.WorldMatrix = CachedWorldMatrix;
+			}
+		}
+		bCachedWorldMatrixDirty = false;
+	}
+
+	// 셰이더 변형이 아직 준비되지 않은 섹션이 있으면 다음 프레임에 다시 만듦
+	FCachedLODDrawCommands& LODCommands = CachedDrawCommands[LODIndex];
+	if (!LODCommands.bCached)
+	{
+		LODCommands.bCached = BuildMeshDrawCommands(LODIndex, CachedWorldMatrix, LODCommands.Elements);
+	}
+
+	// ObjectID(InternalIndex)는 오브젝트 배열 압축 시 바뀔 수 있으므로 복사할 때 기록
+	for (const FMeshBatchElement& Element : LODCommands.Elements)
+	{
+		OutMeshBatchElements.Add(Element);
+		OutMeshBatchElements.Last().ObjectID = InternalIndex;
+	}
+}
+
+void UStaticMeshComponent::InvalidateMeshDrawCommands()
+{
+	CachedDrawCommands.clear();
+	MarkRenderStateDirty();
+}
+
+bool UStaticMeshComponent::IsMeshDrawCommandCacheValid() const
+{
+	// 머티리얼 슬롯은 에디터 프로퍼티 편집으로 직접 바뀔 수 있어 포인터 스냅샷과 비교
+	// 부모 교체(SetupAttachment)는 OnTransformUpdated를 부르지 않으므로 함께 비교
+	return !CachedDrawCommands.IsEmpty()
+		&& CachedDrawCommandMesh == StaticMesh
+		&& CachedDrawCommandParent == AttachParent
+		&& CachedDrawCommandSerial == UShader::GetVariantSelectionSerial()
+		&& CachedDrawCommandMaterials == MaterialSlots;
+}
+
+bool UStaticMeshComponent::BuildMeshDrawCommands(uint32 LODIndex, const FMatrix& WorldMatrix, TArray<FMeshBatchElement>& OutElements)
+{
+	OutElements.clear();
+	bool bComplete = true;
+
+	const TArray<FGroupInfo>& MeshGroupInfos = StaticMesh->GetLODGroupInfo(LODIndex);
+	const uint32 LODIndexOffset = StaticMesh->GetLODIndexOffset(LODIndex);
+
+	// 메쉴릿은 LOD0에만 있음. 실제 컬링은 렌더러 메인 패스에서 수행 (그림자 패스는 전체를 그림)
+	const FMeshletCullData* MeshletCullData = (LODIndex == 0) ? StaticMesh->GetMeshletCullData() : nullptr;
 
 	auto DetermineMaterialAndShader = [&](uint32 SectionIndex) -> TPair<UMaterialInterface*, UShader*>
 		{
@@ -104,9 +177,10 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		}
 		else
 		{
-			IndexCount = StaticMesh->GetIndexCount();
+			IndexCount = StaticMesh->GetLODIndexCount(LODIndex);
 			StartIndex = 0;
 		}
+		StartIndex += LODIndexOffset;
 
 		if (IndexCount == 0)
 		{
@@ -120,7 +194,10 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		}
 
 		FMeshBatchElement BatchElement;
-		FShaderVariant* ShaderVariant = ShaderToUse->GetShaderVariant(MaterialToUse->GetShaderMacros());
+		// 압축 정점 메시는 머티리얼 매크로 + COMPRESSED_VERTEX 변형 사용
+		FShaderVariant* ShaderVariant = StaticMesh->IsVertexCompressed()
+			? ShaderToUse->GetBatchShaderVariant(UResourceManager::GetInstance().GetDevice(), MaterialToUse->GetShaderMacros(), true)
+			: ShaderToUse->GetShaderVariant(MaterialToUse->GetShaderMacros());
 
 		if (ShaderVariant)
 		{
@@ -128,6 +205,10 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			BatchElement.PixelShader = ShaderVariant->PixelShader;
 			BatchElement.InputLayout = ShaderVariant->InputLayout;
 		}
+		else
+		{
+			bComplete = false;
+		}
 
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
 		// 지금은 Material.h 구조상 UMaterialInterface에 필요한 정보가 다 있음.
@@ -138,12 +219,21 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		BatchElement.IndexCount = IndexCount;
 		BatchElement.StartIndex = StartIndex;
 		BatchElement.BaseVertexIndex = 0;
-		BatchElement.WorldMatrix = GetWorldMatrix();
-		BatchElement.ObjectID = InternalIndex;
+		BatchElement.WorldMatrix = WorldMatrix;
 		BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+		BatchElement.MeshletCullData = MeshletCullData;
+		if (StaticMesh->IsVertexCompressed())
+		{
+			const FVector DequantScale = StaticMesh->GetPositionDequantScale();
+			const FVector DequantOffset = StaticMesh->GetPositionDequantOffset();
+			BatchElement.bCompressedVertex = true;
+			BatchElement.PositionDequantScale = FVector4(DequantScale.X, DequantScale.Y, DequantScale.Z, 0.0f);
+			BatchElement.PositionDequantOffset = FVector4(DequantOffset.X, DequantOffset.Y, DequantOffset.Z, 0.0f);
+		}
 
-		OutMeshBatchElements.Add(BatchElement);
+		OutElements.Add(BatchElement);
 	}
+	return bComplete;
 }
 
 void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
@@ -180,6 +270,9 @@ void UStaticMeshComponent::SetStaticMesh(const FString& PathFileName)
 		// (슬롯은 이미 위에서 비워졌습니다.)
 		StaticMesh = nullptr;
 	}
+
+	// 렌더 프록시의 월드 바운드 갱신
+	RefreshSceneProxy();
 }
 
 UMaterialInterface* UStaticMeshComponent::GetMaterial(uint32 InSectionIndex) const
@@ -253,6 +346,9 @@ void UStaticMeshComponent::SetMaterial(uint32 InElementIndex, UMaterialInterface
 
 	// 6. 새 머티리얼을 슬롯에 할당합니다.
 	MaterialSlots[InElementIndex] = InNewMaterial;
+
+	// 삭제된 MID 주소가 재사용될 수 있으므로 포인터 비교에 맡기지 않고 직접 무효화
+	InvalidateMeshDrawCommands();
 }
 
 UMaterialInstanceDynamic* UStaticMeshComponent::CreateAndSetMaterialInstanceDynamic(uint32 ElementIndex)
@@ -282,6 +378,83 @@ UMaterialInstanceDynamic* UStaticMeshComponent::CreateAndSetMaterialInstanceDyna
 	return nullptr;
 }
 
+uint32 UStaticMeshComponent::SelectLOD(const FSceneView* View)
+{
+	const uint32 LODCount = StaticMesh ? StaticMesh->GetLODCount() : 0;
+	UWorld* World = GetWorld();
+	if (LODCount <= 1 || !View || (World && !World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshLOD)))
+	{
+		CurrentLODIndex = 0;
+		return 0;
+	}
+
+	// 이 뷰포트의 상태 찾기 (없으면 가장 오래전에 할당한 슬롯을 재사용)
+	FViewLODState* ViewState = nullptr;
+	for (FViewLODState& State : ViewLODStates)
+	{
+		if (State.Viewport == View->Viewport)
+		{
+			ViewState = &State;
+			break;
+		}
+	}
+	if (!ViewState)
+	{
+		ViewState = &ViewLODStates[NextViewLODState];
+		NextViewLODState = (NextViewLODState + 1) % MaxViewLODStates;
+		*ViewState = FViewLODState();
+		ViewState->Viewport = View->Viewport;
+	}
+
+	// 이번 프레임에 이미 골랐으면 모든 패스가 같은 LOD 사용
+	URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
+	const uint64 FrameNumber = Renderer ? Renderer->GetFrameNumber() : UINT64_MAX;
+	if (FrameNumber != UINT64_MAX && ViewState->FrameNumber == FrameNumber)
+	{
+		CurrentLODIndex = std::min(ViewState->LODIndex, LODCount - 1);
+		return CurrentLODIndex;
+	}
+
+	// 화면 크기 = 바운딩 구 지름이 화면 높이에서 차지하는 비율
+	// (ProjectionMatrix.M[1][1]은 원근일 때 1/tan(FovY/2), 직교일 때 2/Height)
+	const FAABB WorldBound = GetWorldAABB();
+	const float Radius = WorldBound.GetHalfExtent().Size();
+	float ScreenSize = Radius * View->ProjectionMatrix.M[1][1];
+	if (View->ProjectionMode == ECameraProjectionMode::Perspective)
+	{
+		const float Distance = (WorldBound.GetCenter() - View->ViewLocation).Size();
+		ScreenSize = Distance > Radius ? ScreenSize / Distance : FLT_MAX; // 카메라가 바운드 안에 있으면 항상 LOD0
+	}
+
+	uint32 DesiredLOD = 0;
+	for (uint32 LOD = 1; LOD < LODCount; ++LOD)
+	{
+		if (ScreenSize < StaticMesh->GetLODScreenSize(LOD))
+		{
+			DesiredLOD = LOD;
+		}
+	}
+
+	// 거칠어지는 방향은 즉시 전환, 정밀해지는 방향은 기준보다 LODHysteresis 만큼 더 커져야 전환
+	uint32 LODIndex = std::min(ViewState->LODIndex, LODCount - 1);
+	if (DesiredLOD > LODIndex)
+	{
+		LODIndex = DesiredLOD;
+	}
+	else
+	{
+		while (LODIndex > DesiredLOD && ScreenSize >= StaticMesh->GetLODScreenSize(LODIndex) * (1.0f + LODHysteresis))
+		{
+			--LODIndex;
+		}
+	}
+
+	ViewState->LODIndex = LODIndex;
+	ViewState->FrameNumber = FrameNumber;
+	CurrentLODIndex = LODIndex;
+	return LODIndex;
+}
+
 FAABB UStaticMeshComponent::GetWorldAABB() const
 {
 	const FTransform WorldTransform = GetWorldTransform();
@@ -329,6 +502,7 @@ FAABB UStaticMeshComponent::GetWorldAABB() const
 void UStaticMeshComponent::OnTransformUpdated()
 {
 	Super::OnTransformUpdated();
+	bCachedWorldMatrixDirty = true;
 	MarkWorldPartitionDirty();
 }
 
@@ -351,6 +525,9 @@ void UStaticMeshComponent::DuplicateSubObjects()
 	// 현재 'DynamicMaterialInstances'와 'MaterialSlots'는 
 	// '원본' (에디터 컴포넌트)의 포인터를 얕은 복사한 상태입니다.
 
+	// 원본의 드로우 커맨드 캐시는 원본 머티리얼을 가리키므로 버림
+	InvalidateMeshDrawCommands();
+
 	// 원본 MID -> 복사본 MID 매핑 테이블
 	TMap<UMaterialInstanceDynamic*, UMaterialInstanceDynamic*> OldToNewMIDMap;
 
@@ -510,3 +687,98 @@ void UStaticMeshComponent::OnSerialized()
 	// 2. 월드 파티션 업데이트
 	MarkWorldPartitionDirty();
 }
+
+void UStaticMeshComponent::BenchmarkCollectMeshBatches(int32 ComponentCount)
+{
+	ComponentCount = std::max(1, ComponentCount);
+
+	using FClock = std::chrono::high_resolution_clock;
+	auto ElapsedMS = [](FClock::time_point Start)
+	{
+		return std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+	};
+
+	// 프레임마다 불투명/그림자/데칼 대상 패스에서 한 번씩 수집하는 상황
+	constexpr int32 NumFrames = 10;
+	constexpr int32 NumPassesPerFrame = 3;
+
+	TArray<UStaticMeshComponent*> Components;
+	Components.reserve(ComponentCount);
+	for (int32 i = 0; i < ComponentCount; ++i)
+	{
+		UStaticMeshComponent* Component = NewObject<UStaticMeshComponent>();
+		Component->SetRelativeLocation(FVector(static_cast<float>(i % 256) * 2.0f, static_cast<float>(i / 256) * 2.0f, 0.0f));
+		Components.Add(Component);
+	}
+
+	TArray<FMeshBatchElement> Batches;
+	TArray<FMeshBatchElement> SectionElements;
+
+	// 패스 하나 분량의 수집 (프레임당 평균 ms 반환)
+	auto RunFrames = [&](auto&& CollectComponent, auto&& BeginFrame)
+	{
+		const FClock::time_point Start = FClock::now();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			BeginFrame(Frame);
+			for (int32 Pass = 0; Pass < NumPassesPerFrame; ++Pass)
+			{
+				Batches.clear();
+				for (UStaticMeshComponent* Component : Components)
+				{
+					CollectComponent(Component);
+				}
+			}
+		}
+		return ElapsedMS(Start) / NumFrames;
+	};
+	auto NoFrameWork = [](int32) {};
+
+	// 1. 캐시 이전 방식: 패스마다 머티리얼/셰이더 변형 선택과 섹션 커맨드 생성을 반복
+	const double RebuildMS = RunFrames([&](UStaticMeshComponent* Component)
+		{
+			Component->BuildMeshDrawCommands(0, Component->GetWorldMatrix(), SectionElements);
+			for (const FMeshBatchElement& Element : SectionElements)
+			{
+				Batches.Add(Element);
+				Batches.Last().ObjectID = Component->InternalIndex;
+			}
+		}, NoFrameWork);
+
+	// 2. 첫 수집 (캐시 생성 포함)
+	Batches.clear();
+	FClock::time_point Start = FClock::now();
+	for (UStaticMeshComponent* Component : Components)
+	{
+		Component->CollectMeshBatches(Batches, nullptr);
+	}
+	const double FirstCollectMS = ElapsedMS(Start);
+	const uint32 BatchesPerPass = static_cast<uint32>(Batches.Num());
+
+	// 3. 캐시 복사만 하는 경우
+	const double CachedMS = RunFrames([&](UStaticMeshComponent* Component)
+		{
+			Component->CollectMeshBatches(Batches, nullptr);
+		}, NoFrameWork);
+
+	// 4. 매 프레임 10%가 움직이는 경우 (월드 행렬만 갱신)
+	const double MovingMS = RunFrames([&](UStaticMeshComponent* Component)
+		{
+			Component->CollectMeshBatches(Batches, nullptr);
+		}, [&](int32 Frame)
+		{
+			for (int32 i = Frame % 10; i < ComponentCount; i += 10)
+			{
+				Components[i]->AddRelativeLocation(FVector(0.0f, 0.0f, 0.01f));
+			}
+		});
+
+	UE_LOG("[MeshBatchBench] %d components, %u batches x %d passes per frame", ComponentCount, BatchesPerPass, NumPassesPerFrame);
+	UE_LOG("[MeshBatchBench] rebuild %.3f ms/frame, first collect (cache build) %.3f ms, cached %.3f ms/frame (x%.2f), 10%% moving %.3f ms/frame",
+		RebuildMS, FirstCollectMS, CachedMS, CachedMS > 0.0 ? RebuildMS / CachedMS : 0.0, MovingMS);
+
+	for (UStaticMeshComponent* Component : Components)
+	{
+		ObjectFactory::DeleteObject(Component);
+	}
+}
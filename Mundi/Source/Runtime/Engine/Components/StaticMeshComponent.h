@@ -2,10 +2,12 @@
 #include "MeshComponent.h"
 #include "Enums.h"
 #include "AABB.h"
+#include "MeshBatchElement.h"
 
 class UStaticMesh;
 class UShader;
 class UTexture;
+class FViewport;
 class UMaterialInterface;
 class UMaterialInstanceDynamic;
 struct FSceneCompData;
@@ -42,6 +44,15 @@ public:
 
 	FAABB GetWorldAABB() const;
 
+	// 캐시된 섹션 드로우 커맨드를 버림 (다음 CollectMeshBatches에서 다시 만듦)
+	void InvalidateMeshDrawCommands();
+
+	// 스태틱 메시 컴포넌트 ComponentCount개로 배치 수집 시간 측정 (매 프레임 재구성 vs 캐시 복사)
+	static void BenchmarkCollectMeshBatches(int32 ComponentCount = 20000);
+
+	// 마지막으로 선택된 LOD (0 = 원본)
+	uint32 GetCurrentLODIndex() const { return CurrentLODIndex; }
+
 	void DuplicateSubObjects() override;
 	DECLARE_DUPLICATE(UStaticMeshComponent)
 
@@ -49,8 +60,49 @@ protected:
 	void OnTransformUpdated() override;
 	void MarkWorldPartitionDirty();
 
+	// 뷰에 투영된 바운딩 구 크기로 LOD를 고름. 경계에서 LOD가 깜빡이지 않도록 히스테리시스 적용
+	// 뷰포트마다 프레임당 한 번만 고르고, 같은 프레임의 다른 패스(그림자/데칼 등)는 그 결과를 재사용
+	uint32 SelectLOD(const FSceneView* View);
+
+	// 더 정밀한 LOD로 돌아갈 때 전환 기준 화면 크기에 추가로 요구하는 비율
+	static constexpr float LODHysteresis = 0.1f;
+
+	// LOD 하나의 섹션별 드로우 커맨드 생성 (머티리얼/셰이더 변형 선택 포함)
+	// 셰이더 변형을 찾지 못한 섹션이 있으면 false (캐시하지 않고 다음에 다시 생성)
+	bool BuildMeshDrawCommands(uint32 LODIndex, const FMatrix& WorldMatrix, TArray<FMeshBatchElement>& OutElements);
+	// 메시, 머티리얼 슬롯, 셰이더 변형 선택, 부모가 캐시를 만들 때와 같은지
+	bool IsMeshDrawCommandCacheValid() const;
+
 protected:
 	UStaticMesh* StaticMesh = nullptr;
 	TArray<UMaterialInterface*> MaterialSlots;
 	TArray<UMaterialInstanceDynamic*> DynamicMaterialInstances;
+
+	uint32 CurrentLODIndex = 0;
+
+	// 뷰포트별 LOD 히스테리시스 상태 (여러 뷰포트가 서로의 상태를 덮어쓰지 않도록 분리)
+	struct FViewLODState
+	{
+		const FViewport* Viewport = nullptr;
+		uint64 FrameNumber = UINT64_MAX;	// LODIndex를 고른 프레임
+		uint32 LODIndex = 0;
+	};
+	static constexpr uint32 MaxViewLODStates = 4;	// 에디터 쿼드 뷰
+	FViewLODState ViewLODStates[MaxViewLODStates];
+	uint32 NextViewLODState = 0;
+
+	// 섹션별 드로우 커맨드 캐시 (LOD별로 처음 쓰일 때 생성)
+	// 메시/머티리얼/매크로가 바뀌면 전체를 다시 만들고, 트랜스폼만 바뀌면 월드 행렬만 갱신
+	struct FCachedLODDrawCommands
+	{
+		TArray<FMeshBatchElement> Elements;
+		bool bCached = false;
+	};
+	TArray<FCachedLODDrawCommands> CachedDrawCommands;
+	UStaticMesh* CachedDrawCommandMesh = nullptr;
+	TArray<UMaterialInterface*> CachedDrawCommandMaterials;
+	USceneComponent* CachedDrawCommandParent = nullptr;
+	uint32 CachedDrawCommandSerial = 0;
+	FMatrix CachedWorldMatrix;
+	bool bCachedWorldMatrixDirty = true;
 };
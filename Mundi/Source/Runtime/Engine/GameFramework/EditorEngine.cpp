@@ -11,6 +11,7 @@
 #ifdef _GAME
 #include "Level.h"
 #include "JsonSerializer.h"
+#include "FileWatcher.h"
 #include <filesystem>
 #endif
 
@@ -227,6 +228,9 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     // 전역 Lua state 초기화 (모든 스크립트 컴포넌트가 공유)
     SCRIPT.InitializeGlobalLuaState();
 
+    // 스크립트/셰이더 핫 리로드용 파일 감시 스레드 시작
+    FFileWatcher::GetInstance().Startup();
+
     FObjManager::Preload();
     SOUND.Preload();
     
@@ -253,18 +257,17 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 
         if (std::filesystem::exists(scenePath))
         {
-            std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-            JSON LevelJsonData;
+            // 쿠킹된 바이너리 씬이 최신이면 그것으로 로드
+            std::unique_ptr<ULevel> NewLevel = ULevelService::LoadLevelFromFile(scenePath.string());
 
-            if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, scenePath.string()))
+            if (NewLevel)
             {
-                NewLevel->Serialize(true, LevelJsonData);
                 GWorld->SetLevel(std::move(NewLevel));
                 UE_LOG("Successfully loaded scene: %s", scenePath.string().c_str());
             }
             else
             {
-                UE_LOG("ERROR: Failed to load JSON from: %s", scenePath.string().c_str());
+                UE_LOG("ERROR: Failed to load scene from: %s", scenePath.string().c_str());
             }
         }
         else
@@ -399,12 +402,19 @@ void UEditorEngine::MainLoop()
             bChangedPieToEditor = false;
         }
 
+        // 감시 스레드가 모은 파일 변경을 구독자(스크립트/셰이더)에게 전달
+        FFileWatcher::GetInstance().DispatchChanges();
+
         Tick(DeltaSeconds);
+
+        // 프레임 GC 예산 스텝 실행 및 Lua 메모리 통계 확정
+        SCRIPT.TickGarbageCollection();
+
         Render();
         
         // Shader Hot Reloading - Call AFTER render to avoid mid-frame resource conflicts
         // This ensures all GPU commands are submitted before we check for shader updates
-        UResourceManager::GetInstance().CheckAndReloadShaders(DeltaSeconds);
+        UResourceManager::GetInstance().CheckAndReloadShaders();
     }
 }
 
@@ -483,6 +493,9 @@ void UEditorEngine::Shutdown()
     // Resource destructors will properly release D3D resources
     ObjectFactory::DeleteAll(true);
 
+    // 구독자(스크립트 컴포넌트/셰이더)가 모두 해제된 뒤 감시 스레드 종료
+    FFileWatcher::GetInstance().Shutdown();
+
     // Clear FObjManager's static map BEFORE static destruction
     // This must be done in Shutdown() (before main() exits) rather than ~UEditorEngine()
     // because ObjStaticMeshMap is a static member variable that may be destroyed
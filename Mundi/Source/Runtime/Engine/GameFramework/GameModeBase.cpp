@@ -2,6 +2,7 @@
 #include "GameModeBase.h"
 #include "PlayerController.h"
 #include "World.h"
+#include "CoroutineScheduler.h"
 #include "SceneComponent.h"
 #include "Source/Runtime/ScriptSys/ScriptComponent.h"
 #include "Source/Runtime/ScriptSys/UScriptManager.h"
@@ -415,113 +416,234 @@ void AGameModeBase::SetScriptPath(const FString& Path)
 }
 
 // ==================== 동적 이벤트 시스템 ====================
-void AGameModeBase::RegisterEvent(const FString& EventName)
+FGameEventId AGameModeBase::RegisterEvent(const FString& EventName)
 {
-    if (!DynamicEventMap.Contains(EventName))
+    if (const FGameEventId* Existing = EventIdByName.Find(EventName))
     {
-        DynamicEventMap.Add(EventName, TArray<std::pair<FDelegateHandle, sol::function>>());
+        return *Existing;
     }
+
+    const FGameEventId EventId = static_cast<FGameEventId>(DynamicEvents.size());
+    FGameEvent NewEvent;
+    NewEvent.Name = EventName;
+    DynamicEvents.push_back(std::move(NewEvent));
+    EventIdByName.Add(EventName, EventId);
+
+    if (EventIdTable.valid())
+    {
+        EventIdTable[EventName] = EventId;
+    }
+
+    return EventId;
+}
+
+FGameEventId AGameModeBase::FindEventId(const FString& EventName) const
+{
+    const FGameEventId* EventId = EventIdByName.Find(EventName);
+    return EventId ? *EventId : InvalidGameEventId;
 }
 
 void AGameModeBase::FireEvent(const FString& EventName, sol::object EventData)
 {
-    if (!DynamicEventMap.Contains(EventName))
+    const FGameEventId EventId = FindEventId(EventName);
+    if (EventId == InvalidGameEventId)
+    {
+        // 구독자가 없는 이벤트도 WaitForEvent 코루틴은 깨움
+        if (UWorld* World = GetWorld())
+        {
+            World->GetCoroutineScheduler()->SignalEvent(EventName, EventData);
+        }
+        return;
+    }
+
+    FireEventById(EventId, EventData);
+}
+
+void AGameModeBase::FireEventById(FGameEventId EventId, const sol::object& EventData)
+{
+    if (EventId < 0 || EventId >= static_cast<FGameEventId>(DynamicEvents.size()))
     {
-        // 이벤트가 등록되지 않았으면 경고 출력
         return;
     }
 
-    auto& Callbacks = DynamicEventMap[EventName];
+    // WaitForEvent로 대기 중인 코루틴 깨우기 (다음 코루틴 Tick에 EventData와 함께 재개)
+    SignalEventCoroutines(DynamicEvents[EventId], EventData);
 
-    // 모든 구독자에게 이벤트 발행
-    for (auto& [Handle, Callback] : Callbacks)
+    // nil이면 파라미터 없이, 아니면 값 그대로 전달 (userdata는 메타테이블이 유지되므로 타입 검사 불필요)
+    const bool bHasData = EventData.valid();
+
+    BeginEventDispatch();
+    // 발행 중 추가된 구독은 PendingListeners로 가므로 배열 크기/주소는 고정
+    const size_t Count = DynamicEvents[EventId].Listeners.size();
+    for (size_t i = 0; i < Count; ++i)
     {
-        if (Callback.valid())
+        const FGameEventListener& Listener = DynamicEvents[EventId].Listeners[i];
+        if (Listener.Handle == 0)
         {
-            try
-            {
-                // EventData가 유효하고 nil이 아니면 파라미터로 전달
-                if (EventData.valid() && EventData != sol::nil)
-                {
-                    // sol::object를 직접 전달하면 메타테이블이 손실될 수 있으므로
-                    // AActor*로 변환 시도
-                    if (EventData.is<AActor*>())
-                    {
-                        AActor* actor = EventData.as<AActor*>();
-                        Callback(actor);
-                    }
-                    else
-                    {
-                        // AActor*가 아니면 그냥 전달
-                        Callback(EventData);
-                    }
-                }
-                else
-                {
-                    // 파라미터 없이 호출
-                    Callback();
-                }
-            }
-            catch (const sol::error& e)
-            {
-                UE_LOG(("[GameModeBase] Event callback error (" + EventName + "): " + FString(e.what()) + "\n").c_str());
-            }
+            continue;
+        }
+
+        sol::protected_function_result Result = bHasData ? Listener.Callback(EventData) : Listener.Callback();
+        if (!Result.valid())
+        {
+            ReportEventCallbackError(DynamicEvents[EventId], Result);
         }
     }
+    EndEventDispatch();
+}
+
+void AGameModeBase::QueueEvent(FGameEventId EventId, sol::object EventData)
+{
+    if (EventId < 0 || EventId >= static_cast<FGameEventId>(DynamicEvents.size()))
+    {
+        return;
+    }
+
+    FQueuedGameEvent Queued;
+    Queued.EventId = EventId;
+    Queued.EventData = std::move(EventData);
+    QueuedEvents.push_back(std::move(Queued));
+}
+
+void AGameModeBase::FlushQueuedEvents()
+{
+    if (QueuedEvents.empty())
+    {
+        return;
+    }
+
+    FlushingEvents.clear();
+    FlushingEvents.swap(QueuedEvents);
+    for (const FQueuedGameEvent& Queued : FlushingEvents)
+    {
+        FireEventById(Queued.EventId, Queued.EventData);
+    }
+    FlushingEvents.clear();
 }
 
 FDelegateHandle AGameModeBase::SubscribeEvent(const FString& EventName, sol::function Callback)
 {
     // 이벤트가 없으면 자동 등록
-    if (!DynamicEventMap.Contains(EventName))
+    return SubscribeEventById(RegisterEvent(EventName), std::move(Callback));
+}
+
+FDelegateHandle AGameModeBase::SubscribeEventById(FGameEventId EventId, sol::function Callback)
+{
+    if (EventId < 0 || EventId >= static_cast<FGameEventId>(DynamicEvents.size()) || !Callback.valid())
     {
-        RegisterEvent(EventName);
+        return 0;
     }
 
-    FDelegateHandle Handle = NextDynamicHandle++;
-    DynamicEventMap[EventName].Add({ Handle, Callback });
+    FGameEventListener Listener;
+    Listener.Handle = NextDynamicHandle++;
+    Listener.Callback = sol::protected_function(Callback);
+    EventIdByHandle.Add(Listener.Handle, EventId);
+
+    const FDelegateHandle Handle = Listener.Handle;
+    if (EventDispatchDepth > 0)
+    {
+        PendingListeners.push_back({ EventId, std::move(Listener) });
+    }
+    else
+    {
+        DynamicEvents[EventId].Listeners.push_back(std::move(Listener));
+    }
 
     return Handle;
 }
 
 bool AGameModeBase::UnsubscribeEvent(const FString& EventName, FDelegateHandle Handle)
 {
-    if (!DynamicEventMap.Contains(EventName))
+    const FGameEventId* EventId = EventIdByHandle.Find(Handle);
+    if (!EventId || DynamicEvents[*EventId].Name != EventName)
     {
         return false;
     }
 
-    auto& Callbacks = DynamicEventMap[EventName];
-    for (int32 i = 0; i < Callbacks.Num(); ++i)
+    return UnsubscribeHandle(Handle);
+}
+
+bool AGameModeBase::UnsubscribeHandle(FDelegateHandle Handle)
+{
+    const FGameEventId* Found = EventIdByHandle.Find(Handle);
+    if (!Found)
     {
-        if (Callbacks[i].first == Handle)
+        return false;
+    }
+    const FGameEventId EventId = *Found;
+    EventIdByHandle.Remove(Handle);
+
+    // 아직 반영되지 않은 구독
+    for (size_t i = 0; i < PendingListeners.size(); ++i)
+    {
+        if (PendingListeners[i].Listener.Handle == Handle)
         {
-            Callbacks.RemoveAt(i);
-          
+            PendingListeners.erase(PendingListeners.begin() + i);
             return true;
         }
     }
+
+    FGameEvent& Event = DynamicEvents[EventId];
+    for (size_t i = 0; i < Event.Listeners.size(); ++i)
+    {
+        if (Event.Listeners[i].Handle != Handle)
+        {
+            continue;
+        }
+
+        if (EventDispatchDepth > 0)
+        {
+            // 발행 중에는 슬롯만 비우고 발행이 끝난 뒤 정리
+            Event.Listeners[i].Handle = 0;
+            Event.bHasRemovedListeners = true;
+            bHasRemovedListeners = true;
+        }
+        else
+        {
+            Event.Listeners.erase(Event.Listeners.begin() + i);
+        }
+        return true;
+    }
     return false;
 }
 
-void AGameModeBase::PrintRegisteredEvents() const
+sol::table AGameModeBase::GetEventIdTable()
 {
-    if (DynamicEventMap.Num() == 0)
+    if (!EventIdTable.valid())
     {
-        return;
+        if (lua_State* L = GetEventLuaState())
+        {
+            EventIdTable = sol::table(L, sol::create);
+            for (size_t i = 0; i < DynamicEvents.size(); ++i)
+            {
+                EventIdTable[DynamicEvents[i].Name] = static_cast<FGameEventId>(i);
+            }
+        }
     }
+    return EventIdTable;
+}
 
-    for (const auto& [EventName, Callbacks] : DynamicEventMap)
+void AGameModeBase::PrintRegisteredEvents() const
+{
+    for (size_t i = 0; i < DynamicEvents.size(); ++i)
     {
-        UE_LOG(("[GameModeBase] - " + EventName + " (" + std::to_string(Callbacks.Num()) + " listeners)\n").c_str());
+        const FGameEvent& Event = DynamicEvents[i];
+        UE_LOG("[GameModeBase] - [%d] %s (%d listeners)\n", static_cast<int32>(i), Event.Name.c_str(), static_cast<int32>(Event.Listeners.size()));
     }
 }
 
 void AGameModeBase::ClearAllDynamicEvents()
 {
-    // sol::function 참조를 해제하기 위해 동적 이벤트 맵을 명시적으로 비웁니다
+    // sol::function 참조를 해제하기 위해 동적 이벤트를 명시적으로 비웁니다
     // 이렇게 하면 Lua state가 무효화되기 전에 sol::function 소멸자가 호출됩니다
-    DynamicEventMap.Empty();
+    DynamicEvents.Empty();
+    EventIdByName.Empty();
+    EventIdByHandle.Empty();
+    PendingListeners.Empty();
+    QueuedEvents.Empty();
+    FlushingEvents.Empty();
+    bHasRemovedListeners = false;
+    EventIdTable = sol::table();
 
     OnGameStartDelegate.Clear();
     OnGameEndDelegate.Clear();
@@ -530,6 +652,66 @@ void AGameModeBase::ClearAllDynamicEvents()
     OnScoreChangedDelegate.Clear();
 }
 
+void AGameModeBase::EndEventDispatch()
+{
+    if (--EventDispatchDepth > 0)
+    {
+        return;
+    }
+
+    if (bHasRemovedListeners)
+    {
+        bHasRemovedListeners = false;
+        for (FGameEvent& Event : DynamicEvents)
+        {
+            if (!Event.bHasRemovedListeners)
+            {
+                continue;
+            }
+            Event.bHasRemovedListeners = false;
+            Event.Listeners.erase(
+                std::remove_if(Event.Listeners.begin(), Event.Listeners.end(), [](const FGameEventListener& Listener) { return Listener.Handle == 0; }),
+                Event.Listeners.end());
+        }
+    }
+
+    if (!PendingListeners.empty())
+    {
+        TArray<FPendingGameEventListener> Pending;
+        Pending.swap(PendingListeners);
+        for (FPendingGameEventListener& Entry : Pending)
+        {
+            DynamicEvents[Entry.EventId].Listeners.push_back(std::move(Entry.Listener));
+        }
+    }
+}
+
+bool AGameModeBase::HasEventCoroutineWaiters() const
+{
+    UWorld* World = GetWorld();
+    return World && World->GetCoroutineScheduler()->HasEventWaiters();
+}
+
+void AGameModeBase::SignalEventCoroutines(const FGameEvent& Event, const sol::object& EventData)
+{
+    if (HasEventCoroutineWaiters())
+    {
+        GetWorld()->GetCoroutineScheduler()->SignalEvent(Event.Name, EventData);
+    }
+}
+
+lua_State* AGameModeBase::GetEventLuaState()
+{
+    sol::state* Lua = SCRIPT.GetGlobalLuaState();
+    return Lua ? Lua->lua_state() : nullptr;
+}
+
+void AGameModeBase::ReportEventCallbackError(const FGameEvent& Event, sol::protected_function_result& Result)
+{
+    sol::error Err = Result;
+    UE_LOG("[GameModeBase] Event callback error (%s): %s\n", Event.Name.c_str(), Err.what());
+}
+
 // ==================== Serialization ====================
 void AGameModeBase::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
@@ -537,21 +719,12 @@ void AGameModeBase::Serialize(const bool bInIsLoading, JSON& InOutHandle)
     //@TODO UUID를 통해 디폴트 액터 셋하게 변경
     if (bInIsLoading)
     {
-        FJsonSerializer::ReadString(InOutHandle, "ScriptPath", ScriptPath);
-        FJsonSerializer::ReadInt32(InOutHandle, "Score", Score);
-        FJsonSerializer::ReadFloat(InOutHandle, "GameTime", GameTime);
-        FJsonSerializer::ReadBool(InOutHandle, "bIsGameOver", bIsGameOver);
-
+        // ScriptPath, Score, GameTime, bIsGameOver는 리플렉션 직렬화에서 처리
         // DefaultPawnActor 이름 로드
         FJsonSerializer::ReadString(InOutHandle, "DefaultPawnActorName", DefaultPawnActorNameToRestore);
     }
     else
     {
-        InOutHandle["ScriptPath"] = ScriptPath.c_str();
-        InOutHandle["Score"] = Score;
-        InOutHandle["GameTime"] = GameTime;
-        InOutHandle["bIsGameOver"] = bIsGameOver;
-
         // DefaultPawnActor 이름 저장
         if (DefaultPawnActor)
         {
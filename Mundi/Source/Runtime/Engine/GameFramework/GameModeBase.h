@@ -7,6 +7,10 @@
 class APlayerController;
 class UScriptComponent;
 
+// 동적 이벤트 ID (RegisterEvent가 반환하는 이벤트 배열 인덱스)
+using FGameEventId = int32;
+constexpr FGameEventId InvalidGameEventId = -1;
+
 /**
  * @class AGameModeBase
  * @brief 게임의 규칙, 상태, 승리 조건을 관리하는 Actor
@@ -185,10 +189,16 @@ public:
     // ==================== 동적 이벤트 시스템 ====================
 
     /**
-     * @brief 동적 이벤트 등록 (Lua에서 호출)
+     * @brief 동적 이벤트 등록 (Lua에서 호출). 이미 있으면 기존 ID 반환
      * @param EventName 이벤트 이름 (예: "OnPlayerDeath", "OnItemCollected")
+     * @return 이벤트 ID. 매 프레임 발행하는 이벤트는 ID를 캐시해서 FireEvent에 넘기면 이름 조회가 없음
      */
-    void RegisterEvent(const FString& EventName);
+    FGameEventId RegisterEvent(const FString& EventName);
+
+    /**
+     * @brief 등록된 이벤트 ID 조회 (없으면 InvalidGameEventId)
+     */
+    FGameEventId FindEventId(const FString& EventName) const;
 
     /**
      * @brief 이벤트 발행 (Lua에서 호출)
@@ -197,6 +207,27 @@ public:
      */
     void FireEvent(const FString& EventName, sol::object EventData = sol::nil);
 
+    /**
+     * @brief ID로 이벤트 즉시 발행 (EventData는 변환 없이 그대로 콜백에 전달)
+     */
+    void FireEventById(FGameEventId EventId, const sol::object& EventData = sol::nil);
+
+    /**
+     * @brief C++에서 타입이 정해진 값으로 이벤트 발행 (sol::object 생성/타입 검사 없이 바로 push)
+     */
+    template<typename TPayload>
+    void FireEventTyped(FGameEventId EventId, const TPayload& Payload);
+
+    /**
+     * @brief 이벤트를 큐에 넣고 프레임 끝(FlushQueuedEvents)에 한꺼번에 발행
+     */
+    void QueueEvent(FGameEventId EventId, sol::object EventData = sol::nil);
+
+    /**
+     * @brief 큐에 쌓인 이벤트를 순서대로 발행 (UWorld가 프레임 끝에 호출). 발행 중 큐에 넣은 이벤트는 다음 프레임으로
+     */
+    void FlushQueuedEvents();
+
     /**
      * @brief 이벤트 구독 (Lua에서 호출)
      * @param EventName 이벤트 이름
@@ -204,14 +235,21 @@ public:
      * @return 구독 핸들 (구독 해제 시 사용)
      */
     FDelegateHandle SubscribeEvent(const FString& EventName, sol::function Callback);
+    FDelegateHandle SubscribeEventById(FGameEventId EventId, sol::function Callback);
 
     /**
-     * @brief 이벤트 구독 해제
+     * @brief 이벤트 구독 해제 (발행 중이면 다음 발행 전까지 슬롯만 비움)
      * @param EventName 이벤트 이름
      * @param Handle 구독 핸들
      * @return 성공 여부
      */
     bool UnsubscribeEvent(const FString& EventName, FDelegateHandle Handle);
+    bool UnsubscribeHandle(FDelegateHandle Handle);
+
+    /**
+     * @brief 이벤트 이름 -> ID 상수 테이블 (Lua: local Events = gm:GetEventIds(); gm:FireEvent(Events.PlayerHit, data))
+     */
+    sol::table GetEventIdTable();
 
     /**
      * @brief 등록된 모든 이벤트 이름 출력 (디버깅용)
@@ -252,13 +290,94 @@ protected:
     FString ScriptPath;
 
     /** 동적 이벤트 시스템 */
-    // 이벤트 이름 -> (핸들, Lua 콜백) 리스트
-    TMap<FString, TArray<std::pair<FDelegateHandle, sol::function>>> DynamicEventMap;
+    struct FGameEventListener
+    {
+        FDelegateHandle Handle = 0;  // 0이면 해제된 슬롯 (발행 후 정리)
+        sol::protected_function Callback;
+    };
+
+    struct FGameEvent
+    {
+        FString Name;
+        TArray<FGameEventListener> Listeners;
+        bool bHasRemovedListeners = false;
+    };
+
+    struct FPendingGameEventListener
+    {
+        FGameEventId EventId = InvalidGameEventId;
+        FGameEventListener Listener;
+    };
+
+    struct FQueuedGameEvent
+    {
+        FGameEventId EventId = InvalidGameEventId;
+        sol::object EventData;
+    };
+
+    // 발행 중 Listeners 배열이 재할당되지 않도록 구독 추가/해제는 최상위 발행이 끝난 뒤 반영
+    void BeginEventDispatch() { ++EventDispatchDepth; }
+    void EndEventDispatch();
+    bool HasEventCoroutineWaiters() const;
+    void SignalEventCoroutines(const FGameEvent& Event, const sol::object& EventData);
+    static lua_State* GetEventLuaState();
+    static void ReportEventCallbackError(const FGameEvent& Event, sol::protected_function_result& Result);
+
+    // 이벤트 ID = 배열 인덱스
+    TArray<FGameEvent> DynamicEvents;
+    TMap<FString, FGameEventId> EventIdByName;
+    TMap<FDelegateHandle, FGameEventId> EventIdByHandle;
     FDelegateHandle NextDynamicHandle{ 1 };
 
+    int32 EventDispatchDepth{ 0 };
+    bool bHasRemovedListeners{ false };
+    TArray<FPendingGameEventListener> PendingListeners;
+
+    TArray<FQueuedGameEvent> QueuedEvents;
+    TArray<FQueuedGameEvent> FlushingEvents;  // FlushQueuedEvents에서 재사용
+
+    // Lua 상수 테이블 (이벤트 이름 -> ID)
+    sol::table EventIdTable;
+
     /** 지연 삭제 시스템 (Lua 콜백 중 삭제 방지) */
     TArray<AActor*> PendingDestroyActors;
 
     /** 직렬화 임시 변수 (OnSerialized에서 DefaultPawnActor 복원) */
     FString DefaultPawnActorNameToRestore;
 };
+
+template<typename TPayload>
+void AGameModeBase::FireEventTyped(FGameEventId EventId, const TPayload& Payload)
+{
+    if (EventId < 0 || EventId >= static_cast<FGameEventId>(DynamicEvents.size()))
+    {
+        return;
+    }
+
+    // WaitForEvent로 대기 중인 코루틴이 있을 때만 sol::object로 변환
+    if (HasEventCoroutineWaiters())
+    {
+        if (lua_State* L = GetEventLuaState())
+        {
+            SignalEventCoroutines(DynamicEvents[EventId], sol::make_object(L, Payload));
+        }
+    }
+
+    BeginEventDispatch();
+    const size_t Count = DynamicEvents[EventId].Listeners.size();
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const FGameEventListener& Listener = DynamicEvents[EventId].Listeners[i];
+        if (Listener.Handle == 0)
+        {
+            continue;
+        }
+
+        sol::protected_function_result Result = Listener.Callback(Payload);
+        if (!Result.valid())
+        {
+            ReportEventCallbackError(DynamicEvents[EventId], Result);
+        }
+    }
+    EndEventDispatch();
+}
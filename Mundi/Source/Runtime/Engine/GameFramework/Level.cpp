@@ -11,6 +11,8 @@
 #include "AmbientLightComponent.h"
 #include "World.h"
 #include "JsonSerializer.h"
+#include "SceneBinary.h"
+#include "PathUtils.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
 {
@@ -53,96 +55,47 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
 
-    struct FPerspectiveCameraData
-    {
-        FVector Location;
-        FVector Rotation;
-        float FOV;
-        float NearClip;
-        float FarClip;
-    };
-
     if (bInIsLoading)
     {
         // 카메라 정보
         JSON PerspectiveCameraData;
         if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
         {
-            // 카메라 정보
-            ACameraActor* CamActor = UUIManager::GetInstance().GetWorld()->GetCameraActor();
-            FPerspectiveCameraData CamData;
-            if (CamActor)
-            {
-                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
-                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
-                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
-
-                CamActor->SetActorLocation(CamData.Location);
-                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
-                if (auto* CamComp = CamActor->GetCameraComponent())
-                {
-                    CamComp->SetFOV(CamData.FOV);
-                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
-                }
-            }
+            LoadPerspectiveCamera(PerspectiveCameraData);
         }
 
         // Actors 정보
         JSON ActorListJson;
         if (FJsonSerializer::ReadObject(InOutHandle, "Actors", ActorListJson))
         {
-            // 1단계: 모든 액터를 먼저 생성하고 Serialize만 호출 (OnSerialized는 아직 호출 안됨)
-            TArray<AActor*> LoadedActors;
-
-            // ObjectRange()를 사용하여 Primitives 객체의 모든 키-값 쌍을 순회
+            // 모든 액터를 먼저 생성하고 Serialize만 호출 (OnSerialized는 아직 호출 안됨)
+            // ObjectRange()를 사용하여 Actors 객체의 모든 키-값 쌍을 순회
             for (auto& Pair : ActorListJson.ObjectRange())
             {
-                // Pair.first는 ID 문자열, Pair.second는 단일 프리미티브의 JSON 데이터입니다.
-                const FString& IdString = Pair.first;
+                // Pair.first는 ID 문자열, Pair.second는 단일 액터의 JSON 데이터입니다.
                 JSON& ActorDataJson = Pair.second;
 
                 FString TypeString;
                 FJsonSerializer::ReadString(ActorDataJson, "Type", TypeString);
 
-                //UClass* NewClass = FActorTypeMapper::TypeToActor(TypeString);
-                UClass* NewClass = UClass::FindClass(TypeString);
-                UWorld* World = UUIManager::GetInstance().GetWorld();
-
-                // 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
-                if (!NewClass || !NewClass->IsChildOf(AActor::StaticClass()))
-                {
-                    UE_LOG("SpawnActor failed: Invalid class provided.");
-                    continue;
-                }
-
-                // ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
-                AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(NewClass));
-                if (!NewActor)
-                {
-                    UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of");
-                    continue;
-                }
-
-                AddActor(NewActor);
-
-                if (NewActor)
-                {
-                    NewActor->Serialize(bInIsLoading, ActorDataJson);
-                    LoadedActors.Add(NewActor);
-                }
+                SpawnSerializedActor(UClass::FindClass(TypeString), ActorDataJson);
             }
 
-            // 2단계: OnSerialized는 World.cpp의 SetLevel()에서 호출됨
+            // OnSerialized는 World.cpp의 SetLevel()에서 호출됨
             // (이 시점에는 아직 World가 설정되지 않았으므로 여기서 호출하면 안 됨)
         }
     }
     else
     {
+        struct FPerspectiveCameraData
+        {
+            FVector Location;
+            FVector Rotation;
+            float FOV;
+            float NearClip;
+            float FarClip;
+        };
+
         // 기본 정보
         InOutHandle["Version"] = 1;
         InOutHandle["NextUUID"] = UObject::PeekNextUUID();
@@ -185,3 +138,327 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         InOutHandle["Actors"] = ActorListJson;
     }
 }
+
+bool ULevel::LoadFromCookedScene(FSceneBinaryReader& InReader)
+{
+    JSON LevelData;
+    if (!InReader.ReadLevelData(LevelData))
+    {
+        return false;
+    }
+    Super::Serialize(true, LevelData);
+
+    JSON PerspectiveCameraData;
+    if (FJsonSerializer::ReadObject(LevelData, "PerspectiveCamera", PerspectiveCameraData, nullptr, false))
+    {
+        LoadPerspectiveCamera(PerspectiveCameraData);
+    }
+
+    // 클래스 이름은 문자열 테이블 인덱스로 오므로 종류별로 한 번만 찾음
+    TArray<UClass*> ClassByString(InReader.GetStringCount(), nullptr);
+    TArray<bool> bClassResolved(InReader.GetStringCount(), false);
+
+    Actors.reserve(Actors.size() + InReader.GetActorCount());
+
+    // 액터 하나 분량의 JSON만 만들고 재사용
+    JSON ActorDataJson;
+    uint32 TypeIndex = 0;
+    for (uint32 i = 0; i < InReader.GetActorCount(); ++i)
+    {
+        if (!InReader.ReadNextActor(TypeIndex, ActorDataJson))
+        {
+            UE_LOG("[Level] Cooked scene is corrupt at actor %u", i);
+            return false;
+        }
+
+        if (!bClassResolved[TypeIndex])
+        {
+            ClassByString[TypeIndex] = UClass::FindClass(InReader.GetString(TypeIndex));
+            bClassResolved[TypeIndex] = true;
+        }
+
+        SpawnSerializedActor(ClassByString[TypeIndex], ActorDataJson);
+    }
+    return true;
+}
+
+void ULevel::LoadPerspectiveCamera(const JSON& InCameraJson)
+{
+    ACameraActor* CamActor = UUIManager::GetInstance().GetWorld()->GetCameraActor();
+    if (!CamActor)
+    {
+        return;
+    }
+
+    // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
+    // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
+    FVector Location;
+    FVector Rotation;
+    float FOV;
+    float NearClip;
+    float FarClip;
+    FJsonSerializer::ReadVector(InCameraJson, "Location", Location);
+    FJsonSerializer::ReadVector(InCameraJson, "Rotation", Rotation);
+    FJsonSerializer::ReadArrayFloat(InCameraJson, "FOV", FOV);
+    FJsonSerializer::ReadArrayFloat(InCameraJson, "NearClip", NearClip);
+    FJsonSerializer::ReadArrayFloat(InCameraJson, "FarClip", FarClip);
+
+    CamActor->SetActorLocation(Location);
+    CamActor->SetRotationFromEulerAngles(Rotation);
+    if (auto* CamComp = CamActor->GetCameraComponent())
+    {
+        CamComp->SetFOV(FOV);
+        CamComp->SetClipPlanes(NearClip, FarClip);
+    }
+}
+
+AActor* ULevel::SpawnSerializedActor(UClass* InClass, JSON& InActorJson)
+{
+    // 유효성 검사: Class가 유효하고 AActor를 상속했는지 확인
+    if (!InClass || !InClass->IsChildOf(AActor::StaticClass()))
+    {
+        UE_LOG("SpawnActor failed: Invalid class provided.");
+        return nullptr;
+    }
+
+    // ObjectFactory를 통해 UClass*로부터 객체 인스턴스 생성
+    AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(InClass));
+    if (!NewActor)
+    {
+        UE_LOG("SpawnActor failed: ObjectFactory could not create an instance of");
+        return nullptr;
+    }
+
+    AddActor(NewActor);
+    NewActor->Serialize(true, InActorJson);
+    return NewActor;
+}
+
+std::unique_ptr<ULevel> ULevelService::LoadLevelFromFile(const FString& InScenePath)
+{
+    std::unique_ptr<ULevel> NewLevel = CreateDefaultLevel();
+
+#ifdef USE_SCENE_CACHE
+    const FString CookedPath = SceneBinary::GetCookedScenePath(InScenePath);
+    SceneBinary::FSourceStamp SourceStamp;
+    const bool bHasStamp = SceneBinary::GetSourceStamp(InScenePath, SourceStamp);
+
+    // 1. 원본과 크기/수정 시간이 같은 쿠킹 캐시가 있으면 바이너리로 로드
+    if (bHasStamp)
+    {
+        FSceneBinaryReader Reader;
+        if (Reader.LoadFromFile(CookedPath) && Reader.GetSourceStamp() == SourceStamp)
+        {
+            if (NewLevel->LoadFromCookedScene(Reader))
+            {
+                return NewLevel;
+            }
+
+            // 중간에 실패했으면 만든 액터를 버리고 JSON으로 다시 로드
+            UE_LOG("[Level] Cooked scene load failed, falling back to JSON: %s", InScenePath.c_str());
+            for (AActor* Actor : NewLevel->GetActors())
+            {
+                ObjectFactory::DeleteObject(Actor);
+            }
+            NewLevel->Clear();
+        }
+    }
+#endif
+
+    // 2. JSON 로드
+    JSON LevelJsonData;
+    if (!FJsonSerializer::LoadJsonFromFile(LevelJsonData, InScenePath))
+    {
+        UE_LOG("[Level] Failed to load JSON from: %s", InScenePath.c_str());
+        return nullptr;
+    }
+
+#ifdef USE_SCENE_CACHE
+    // 다음 로드를 위해 파싱한 JSON을 그대로 쿠킹
+    if (bHasStamp && FSceneBinaryWriter::CookToFile(LevelJsonData, CookedPath, SourceStamp))
+    {
+        UE_LOG("[Level] Cooked scene: %s", CookedPath.c_str());
+    }
+#endif
+
+    NewLevel->Serialize(true, LevelJsonData);
+    return NewLevel;
+}
+
+bool ULevelService::SaveLevelToFile(ULevel* InLevel, const FString& InScenePath)
+{
+    if (!InLevel)
+    {
+        return false;
+    }
+
+    JSON LevelJson;
+    InLevel->Serialize(false, LevelJson);
+    if (!FJsonSerializer::SaveJsonToFile(LevelJson, InScenePath))
+    {
+        return false;
+    }
+
+#ifdef USE_SCENE_CACHE
+    SceneBinary::FSourceStamp SourceStamp;
+    if (SceneBinary::GetSourceStamp(InScenePath, SourceStamp))
+    {
+        FSceneBinaryWriter::CookToFile(LevelJson, SceneBinary::GetCookedScenePath(InScenePath), SourceStamp);
+    }
+#endif
+    return true;
+}
+
+void ULevelService::BenchmarkSceneLoad(int32 ActorCount)
+{
+    ActorCount = std::max(1, ActorCount);
+
+    using FClock = std::chrono::high_resolution_clock;
+    auto ElapsedMS = [](FClock::time_point Start)
+    {
+        return std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+    };
+
+    auto DeleteLevelActors = [](ULevel& Level)
+    {
+        for (AActor* Actor : Level.GetActors())
+        {
+            ObjectFactory::DeleteObject(Actor);
+        }
+        Level.Clear();
+    };
+
+    // 1. 템플릿 액터 하나를 직렬화해서 ActorCount개로 복제 (컴포넌트 Id는 액터마다 새로 부여)
+    JSON TemplateJson = JSON::Make(JSON::Class::Object);
+    {
+        AStaticMeshActor* Template = NewObject<AStaticMeshActor>();
+        TemplateJson["Type"] = Template->GetClass()->Name;
+        Template->Serialize(false, TemplateJson);
+        ObjectFactory::DeleteObject(Template);
+    }
+
+    JSON SceneJson = JSON::Make(JSON::Class::Object);
+    SceneJson["Version"] = 1;
+    JSON& ActorListJson = SceneJson["Actors"];
+    ActorListJson = JSON::Make(JSON::Class::Object);
+
+    uint32 NextId = 1000000;
+    for (int32 i = 0; i < ActorCount; ++i)
+    {
+        JSON ActorJson = TemplateJson;
+        ActorJson["Name"] = "BenchActor_" + std::to_string(i);
+
+        TMap<uint32, uint32> IdRemap;
+        for (JSON& ComponentJson : ActorJson["OwnedComponents"].ArrayRange())
+        {
+            uint32 OldId = 0;
+            if (FJsonSerializer::ReadUint32(ComponentJson, "Id", OldId, 0, false))
+            {
+                IdRemap.Add(OldId, NextId);
+                ComponentJson["Id"] = NextId++;
+            }
+        }
+        for (JSON& ComponentJson : ActorJson["OwnedComponents"].ArrayRange())
+        {
+            uint32 ParentId = 0;
+            if (FJsonSerializer::ReadUint32(ComponentJson, "ParentId", ParentId, 0, false) && ParentId != 0)
+            {
+                if (const uint32* NewParentId = IdRemap.Find(ParentId))
+                {
+                    ComponentJson["ParentId"] = *NewParentId;
+                }
+            }
+        }
+        // 루트 컴포넌트를 격자로 배치
+        uint32 RootId = 0;
+        if (FJsonSerializer::ReadUint32(ActorJson, "RootComponentId", RootId, 0, false))
+        {
+            if (const uint32* NewRootId = IdRemap.Find(RootId))
+            {
+                RootId = *NewRootId;
+                ActorJson["RootComponentId"] = RootId;
+            }
+            for (JSON& ComponentJson : ActorJson["OwnedComponents"].ArrayRange())
+            {
+                uint32 ComponentId = 0;
+                if (FJsonSerializer::ReadUint32(ComponentJson, "Id", ComponentId, 0, false) && ComponentId == RootId)
+                {
+                    const FVector Location(static_cast<float>(i % 256) * 2.0f, static_cast<float>(i / 256) * 2.0f, 0.0f);
+                    ComponentJson["RelativeLocation"] = FJsonSerializer::VectorToJson(Location);
+                }
+            }
+        }
+
+        ActorListJson[std::to_string(NextId++)] = std::move(ActorJson);
+    }
+
+    const FString ScenePath = GCacheDir + "/SceneLoadBench.Scene";
+    std::filesystem::create_directories(std::filesystem::path(UTF8ToWide(GCacheDir)));
+    if (!FJsonSerializer::SaveJsonToFile(SceneJson, ScenePath))
+    {
+        UE_LOG("[SceneBench] Failed to write %s", ScenePath.c_str());
+        return;
+    }
+    SceneJson = JSON();
+
+    SceneBinary::FSourceStamp SourceStamp;
+    SceneBinary::GetSourceStamp(ScenePath, SourceStamp);
+
+    // 2. JSON 로드 (텍스트 파싱 → 씬 전체 DOM → Serialize)
+    auto Start = FClock::now();
+    JSON LoadedJson;
+    FJsonSerializer::LoadJsonFromFile(LoadedJson, ScenePath);
+    const double JsonParseMS = ElapsedMS(Start);
+
+    std::unique_ptr<ULevel> JsonLevel = CreateDefaultLevel();
+    Start = FClock::now();
+    JsonLevel->Serialize(true, LoadedJson);
+    const double JsonSpawnMS = ElapsedMS(Start);
+    const uint32 JsonActorCount = static_cast<uint32>(JsonLevel->GetActors().size());
+    DeleteLevelActors(*JsonLevel);
+
+    // 3. 쿠킹
+    const FString CookedPath = SceneBinary::GetCookedScenePath(ScenePath);
+    Start = FClock::now();
+    FSceneBinaryWriter::CookToFile(LoadedJson, CookedPath, SourceStamp);
+    const double CookMS = ElapsedMS(Start);
+    LoadedJson = JSON();
+
+    // 4. 바이너리 디코딩만 (액터 생성 제외)
+    Start = FClock::now();
+    {
+        FSceneBinaryReader Reader;
+        Reader.LoadFromFile(CookedPath);
+        JSON ActorDataJson;
+        uint32 TypeIndex = 0;
+        while (Reader.ReadNextActor(TypeIndex, ActorDataJson))
+        {
+        }
+    }
+    const double BinaryDecodeMS = ElapsedMS(Start);
+
+    // 5. 바이너리 로드 (파일 읽기 + 디코딩 + Serialize)
+    std::unique_ptr<ULevel> BinaryLevel = CreateDefaultLevel();
+    Start = FClock::now();
+    {
+        FSceneBinaryReader Reader;
+        if (Reader.LoadFromFile(CookedPath))
+        {
+            BinaryLevel->LoadFromCookedScene(Reader);
+        }
+    }
+    const double BinaryLoadMS = ElapsedMS(Start);
+    const uint32 BinaryActorCount = static_cast<uint32>(BinaryLevel->GetActors().size());
+    DeleteLevelActors(*BinaryLevel);
+
+    std::error_code Error;
+    const uintmax_t JsonBytes = std::filesystem::file_size(std::filesystem::path(UTF8ToWide(ScenePath)), Error);
+    const uintmax_t BinaryBytes = std::filesystem::file_size(std::filesystem::path(UTF8ToWide(CookedPath)), Error);
+
+    UE_LOG("[SceneBench] %d actors, JSON %.1f MB, cooked %.1f MB (cook %.1f ms)",
+        ActorCount, static_cast<double>(JsonBytes) / (1024.0 * 1024.0), static_cast<double>(BinaryBytes) / (1024.0 * 1024.0), CookMS);
+    UE_LOG("[SceneBench] JSON:   parse %.1f ms + spawn %.1f ms = %.1f ms (%u actors)",
+        JsonParseMS, JsonSpawnMS, JsonParseMS + JsonSpawnMS, JsonActorCount);
+    UE_LOG("[SceneBench] Binary: decode %.1f ms, full load %.1f ms (%u actors)",
+        BinaryDecodeMS, BinaryLoadMS, BinaryActorCount);
+}
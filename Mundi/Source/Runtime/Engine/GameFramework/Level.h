@@ -4,6 +4,8 @@
 #include "Actor.h"
 #include <algorithm>
 
+class FSceneBinaryReader;
+
 class ULevel : public UObject
 {
 public:
@@ -23,7 +25,14 @@ public:
     void Clear() { Actors.Empty(); }
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    // 쿠킹된 바이너리 씬에서 로드 (Serialize(true, ...)와 같은 결과, 액터 하나씩 디코딩)
+    bool LoadFromCookedScene(FSceneBinaryReader& InReader);
+
 private:
+    void LoadPerspectiveCamera(const JSON& InCameraJson);
+    AActor* SpawnSerializedActor(UClass* InClass, JSON& InActorJson);
+
     TArray<AActor*> Actors;
 };
 
@@ -33,4 +42,13 @@ public:
     // Create a new empty level
     static std::unique_ptr<ULevel> CreateNewLevel();
     static std::unique_ptr<ULevel> CreateDefaultLevel();
+
+    // .Scene 파일 로드. 쿠킹 캐시가 최신이면 바이너리로, 아니면 JSON으로 로드한 뒤 캐시를 만듦
+    static std::unique_ptr<ULevel> LoadLevelFromFile(const FString& InScenePath);
+
+    // .Scene(JSON) 저장 후 쿠킹 캐시도 갱신
+    static bool SaveLevelToFile(ULevel* InLevel, const FString& InScenePath);
+
+    // 합성 씬(ActorCount개 액터)으로 JSON 로드와 바이너리 로드 시간 비교
+    static void BenchmarkSceneLoad(int32 ActorCount = 50000);
 };
@@ -13,6 +13,8 @@
 #include "ObjManager.h"
 #include "WorldPartitionManager.h"
 #include "CollisionManager.h"
+#include "ScriptTickManager.h"
+#include "CoroutineScheduler.h"
 #include "PrimitiveComponent.h"
 #include "Octree.h"
 #include "BVHierarchy.h"
@@ -41,7 +43,10 @@ UWorld::UWorld()
 	//PIE의 경우 Initalize 없이 빈 Level 생성만 해야함
 	Level = std::make_unique<ULevel>();
 	LightManager = std::make_unique<FLightManager>();
+	RenderScene = std::make_unique<FRenderScene>();
 	Collision = std::make_unique<UCollisionManager>();
+	ScriptTickManager = std::make_unique<FScriptTickManager>();
+	CoroutineScheduler = std::make_unique<FCoroutineScheduler>();
 }
 
 UWorld::~UWorld()
@@ -101,20 +106,24 @@ void UWorld::Initialize()
 void UWorld::InitializeGrid()
 {
 	GridActor = NewObject<AGridActor>();
+	// 컴포넌트 등록 시 에디터 액터로 분류되도록 SetWorld 전에 추가
+	EditorActors.push_back(GridActor);
 	GridActor->SetWorld(this);
 	GridActor->Initialize();
-
-	EditorActors.push_back(GridActor);
 }
 
 void UWorld::InitializeGizmo()
 {
 	GizmoActor = NewObject<AGizmoActor>();
+	EditorActors.push_back(GizmoActor);
 	GizmoActor->SetWorld(this);
 	GizmoActor->SetActorTransform(FTransform(FVector{ 0, 0, 0 }, FQuat::MakeFromEulerZYX(FVector{ 0, -90, 0 }),
 		FVector{ 1, 1, 1 }));
+}
 
-	EditorActors.push_back(GizmoActor);
+bool UWorld::IsEditorActor(const AActor* Actor) const
+{
+	return std::find(EditorActors.begin(), EditorActors.end(), Actor) != EditorActors.end();
 }
 
 // Slomo + Hit Stop 관련 함수
@@ -169,6 +178,8 @@ void UWorld::Tick(float RealDeltaSeconds)
 
 void UWorld::TickGameLogic(float GameDeltaSeconds)
 {
+	ScriptTickManager->TickGroup(EScriptTickGroup::PrePhysics, GameDeltaSeconds);
+
 	Partition->Update(GameDeltaSeconds, /*budget*/256);
 
 	if (Collision)
@@ -192,6 +203,11 @@ void UWorld::TickGameLogic(float GameDeltaSeconds)
 		}
 	}
 
+	ScriptTickManager->TickGroup(EScriptTickGroup::PostPhysics, GameDeltaSeconds);
+
+	// 만료/신호된 코루틴만 재개
+	CoroutineScheduler->Tick(GameDeltaSeconds);
+
 	for (AActor* EditorActor : EditorActors)
 	{
 		if (EditorActor && (!bPie || bPIEEjected))
@@ -209,6 +225,19 @@ void UWorld::TickGameLogic(float GameDeltaSeconds)
 			CameraManager->Tick(GameDeltaSeconds);
 		}
 	}
+
+	ScriptTickManager->TickGroup(EScriptTickGroup::PostCamera, GameDeltaSeconds);
+
+	// 프레임 동안 QueueEvent로 쌓인 GameMode 이벤트 일괄 발행
+	if (GameMode && bPie)
+	{
+		GameMode->FlushQueuedEvents();
+	}
+
+	if (bPie)
+	{
+		ScriptTickManager->PublishFrameStats();
+	}
 }
 
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
@@ -5,6 +5,7 @@
 #include "Level.h"
 #include "Gizmo/GizmoActor.h"
 #include "LightManager.h"
+#include "RenderScene.h"
 
 // Forward Declarations
 class UResourceManager;
@@ -24,6 +25,8 @@ struct FSceneCompData;
 class SViewportWindow;
 class UWorldPartitionManager;
 class UCollisionManager;
+class FScriptTickManager;
+class FCoroutineScheduler;
 class AStaticMeshActor;
 class BVHierachy;
 class UStaticMesh;
@@ -75,6 +78,7 @@ public:
     void SetLevel(std::unique_ptr<ULevel> InLevel);
     ULevel* GetLevel() const { return Level.get(); }
     FLightManager* GetLightManager() const { return LightManager.get(); }
+    FRenderScene* GetRenderScene() const { return RenderScene.get(); }
 
     ACameraActor* GetCameraActor() { return MainCameraActor; }
     void SetCameraActor(ACameraActor* InCamera)
@@ -117,10 +121,13 @@ public:
     /** === 필요한 엑터 게터 === */
     const TArray<AActor*>& GetActors() { static TArray<AActor*> Empty; return Level ? Level->GetActors() : Empty; }
     const TArray<AActor*>& GetEditorActors() { return EditorActors; }
+    bool IsEditorActor(const AActor* Actor) const;
     AGizmoActor* GetGizmoActor() { return GizmoActor; }
     AGridActor* GetGridActor() { return GridActor; }
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
     UCollisionManager* GetCollisionManager() { return Collision.get(); }
+    FScriptTickManager* GetScriptTickManager() { return ScriptTickManager.get(); }
+    FCoroutineScheduler* GetCoroutineScheduler() { return CoroutineScheduler.get(); }
 
     // Per-world render settings
     URenderSettings& GetRenderSettings() { return RenderSettings; }
@@ -153,6 +160,9 @@ private:
 
     /** === 라이트 매니저 ===*/
     std::unique_ptr<FLightManager> LightManager;
+
+    /** === 렌더 씬 (컴포넌트 프록시 레지스트리) ===*/
+    std::unique_ptr<FRenderScene> RenderScene;
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
 
@@ -166,6 +176,10 @@ private:
     std::unique_ptr<UWorldPartitionManager> Partition = nullptr;
     // per-world collision/overlap manager for shape components
     std::unique_ptr<UCollisionManager> Collision = nullptr;
+    // per-world Lua script tick scheduler (tick group별 일괄 틱)
+    std::unique_ptr<FScriptTickManager> ScriptTickManager;
+    // per-world Lua coroutine scheduler (대기 중인 코루틴은 타이머 휠/이벤트 목록에서 비용 없이 대기)
+    std::unique_ptr<FCoroutineScheduler> CoroutineScheduler;
 
     // Per-world selection manager
     std::unique_ptr<USelectionManager> SelectionMgr;
@@ -68,6 +68,9 @@ void FBVHierarchy::Clear()
     Nodes = TArray<FLBVHNode>();
     Bounds = FAABB();
     bPendingRebuild = false;
+
+    ChangedBounds.clear();
+    bAllBoundsChanged = true;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UStaticMeshComponent*>& Components)
@@ -76,7 +79,13 @@ void FBVHierarchy::BulkUpdate(const TArray<UStaticMeshComponent*>& Components)
     {
         if (SMC)
         {
-            StaticMeshComponentBounds.Add(SMC, SMC->GetWorldAABB());
+            if (const FAABB* OldBounds = StaticMeshComponentBounds.Find(SMC))
+            {
+                RecordChangedBounds(*OldBounds);
+            }
+            const FAABB NewBounds = SMC->GetWorldAABB();
+            RecordChangedBounds(NewBounds);
+            StaticMeshComponentBounds.Add(SMC, NewBounds);
         }
     }
 
@@ -93,7 +102,19 @@ void FBVHierarchy::Update(UStaticMeshComponent* InComponent)
         return;
     }
 
-    StaticMeshComponentBounds.Add(InComponent, InComponent->GetWorldAABB());
+    const FAABB NewBounds = InComponent->GetWorldAABB();
+    if (const FAABB* OldBounds = StaticMeshComponentBounds.Find(InComponent))
+    {
+        if (OldBounds->Min == NewBounds.Min && OldBounds->Max == NewBounds.Max)
+        {
+            // 위치가 그대로면 트리와 캐시 모두 바뀌지 않음
+            return;
+        }
+        RecordChangedBounds(*OldBounds);
+    }
+    RecordChangedBounds(NewBounds);
+
+    StaticMeshComponentBounds.Add(InComponent, NewBounds);
     bPendingRebuild = true;
 }
 
@@ -104,8 +125,9 @@ void FBVHierarchy::Remove(UStaticMeshComponent* InComponent)
         return;
     }
 
-    if (StaticMeshComponentBounds.Find(InComponent))
+    if (const FAABB* OldBounds = StaticMeshComponentBounds.Find(InComponent))
     {
+        RecordChangedBounds(*OldBounds);
         StaticMeshComponentBounds.Remove(InComponent);
         bPendingRebuild = true;
     }
@@ -484,6 +506,29 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
     }
 }
 
+void FBVHierarchy::RecordChangedBounds(const FAABB& InBounds)
+{
+    if (bAllBoundsChanged)
+    {
+        return;
+    }
+    if (ChangedBounds.Num() >= MaxChangedBounds)
+    {
+        ChangedBounds.clear();
+        bAllBoundsChanged = true;
+        return;
+    }
+    ChangedBounds.Add(InBounds);
+}
+
+void FBVHierarchy::ConsumeChangedBounds(TArray<FAABB>& OutBounds, bool& bOutAllChanged)
+{
+    OutBounds.clear();
+    std::swap(OutBounds, ChangedBounds);
+    bOutAllChanged = bAllBoundsChanged;
+    bAllBoundsChanged = false;
+}
+
 void FBVHierarchy::FlushRebuild()
 {
     if (bPendingRebuild)
@@ -566,3 +611,13 @@ TArray<UStaticMeshComponent*> FBVHierarchy::QueryIntersectedComponents(const FBo
         [](const FAABB& compBound, const FBoundingSphere& inBound) { return Collision::OverlapAABBSphere(compBound, inBound); }
     );
 }
+
+// FFrustum 오버로드
+TArray<UStaticMeshComponent*> FBVHierarchy::QueryIntersectedComponents(const FFrustum& InFrustum) const
+{
+    return QueryIntersectedComponentsGeneric(
+        InFrustum,
+        [](const FAABB& nodeBound, const FFrustum& inFrustum) { return IsAABBVisible(inFrustum, nodeBound); },
+        [](const FAABB& compBound, const FFrustum& inFrustum) { return IsAABBVisible(inFrustum, compBound); }
+    );
+}
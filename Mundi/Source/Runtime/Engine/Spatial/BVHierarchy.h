@@ -37,6 +37,16 @@ public:
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
+    // 절두체와 겹치는 컴포넌트 수집 (액터 컬링 플래그를 건드리지 않음, 라이트 섀도우 뷰 컬링용)
+    TArray<UStaticMeshComponent*> QueryIntersectedComponents(const FFrustum& InFrustum) const;
+
+    // 캐시된 바운드로 트리에 들어있는 컴포넌트인지 (리빌드 대기 중이면 트리와 다를 수 있음)
+    bool Contains(UStaticMeshComponent* InComponent) const { return StaticMeshComponentBounds.Find(InComponent) != nullptr; }
+    bool IsRebuildPending() const { return bPendingRebuild; }
+
+    // 마지막 소비 이후 바운드가 바뀐 영역(이전/새 바운드)을 넘기고 비움 (데칼 수신 메시 캐시 무효화용)
+    // bOutAllChanged가 true면 영역 목록 대신 전체가 바뀐 것으로 간주 (Clear, 기록 한도 초과)
+    void ConsumeChangedBounds(TArray<FAABB>& OutBounds, bool& bOutAllChanged);
 
     void DebugDraw(URenderer* Renderer) const;
 
@@ -62,6 +72,7 @@ private:
         bool IsLeaf() const { return Count > 0; }
     };
     void BuildLBVH();
+    void RecordChangedBounds(const FAABB& InBounds);
 
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
@@ -83,4 +94,9 @@ private:
     TArray<FLBVHNode> Nodes;
 
     bool bPendingRebuild = false;
+
+    // 소비자가 없을 때 무한히 쌓이지 않도록 한도를 넘으면 전체 변경으로 전환
+    static constexpr int32 MaxChangedBounds = 1024;
+    TArray<FAABB> ChangedBounds;
+    bool bAllBoundsChanged = false;
 };
@@ -34,6 +34,9 @@ public:
 	// 업데이트 큐 등록 API
 	void MarkDirty(AActor* Actor);
 	void MarkDirty(UStaticMeshComponent* Smc);
+	// 더티 큐에서 대기 중이라 BVH 바운드가 아직 갱신되지 않은 컴포넌트인지
+	bool IsPendingUpdate(UStaticMeshComponent* Smc) const { return ComponentDirtySet.Contains(Smc); }
+	const TSet<UStaticMeshComponent*>& GetPendingUpdates() const { return ComponentDirtySet; }
 
 	void Update(float DeltaTime, const uint32 BudgetCount = 256);
 
@@ -7,6 +7,9 @@ struct ModelBufferType // b0
 {
     FMatrix Model;
     FMatrix ModelInverseTranspose;  // For correct normal transformation with non-uniform scale
+    // 압축 정점 위치 복원: Pos = Offset + UNORM16 * Scale (COMPRESSED_VERTEX 변형에서만 사용)
+    FVector4 PositionDequantScale = FVector4(1.0f, 1.0f, 1.0f, 0.0f);
+    FVector4 PositionDequantOffset = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
 };
 
 struct ViewProjBufferType // b1 고유번호 고정
@@ -235,4 +238,19 @@ CONSTANT_BUFFER_INFO(FPointLightShadowBufferType, 12, true, true)  // b11, VS on
 CONSTANT_BUFFER_INFO(FVignetteBufferType, 0, false, true)  // b0, PS only
 CONSTANT_BUFFER_INFO(FGammaCorrectionBufferType, 0, false, true)  // b0, PS only
 CONSTANT_BUFFER_INFO(FLetterBoxBufferType, 0, false, true)  // b0, PS only
-CONSTANT_BUFFER_INFO(FFadeBufferType, 0, false, true)  // b0, PS only
\ No newline at end of file
+CONSTANT_BUFFER_INFO(FFadeBufferType, 0, false, true)  // b0, PS only
+
+// 상수 버퍼 종류 ID (렌더 커맨드가 D3D 버퍼 대신 기록)
+#define DECLARE_CONSTANT_BUFFER_ID(TYPE) TYPE,
+enum class EConstantBufferId : uint8
+{
+	CONSTANT_BUFFER_LIST(DECLARE_CONSTANT_BUFFER_ID)
+	Count
+};
+
+template<typename T>
+struct TConstantBufferId;
+
+#define DECLARE_CONSTANT_BUFFER_ID_TRAIT(TYPE) \
+template<> struct TConstantBufferId<TYPE> { static constexpr EConstantBufferId Value = EConstantBufferId::TYPE; };
+CONSTANT_BUFFER_LIST(DECLARE_CONSTANT_BUFFER_ID_TRAIT)
@@ -7,11 +7,13 @@ void D3D11RHI::Initialize(HWND hWindow)
 {
     // 이곳에서 Device, DeviceContext, viewport, swapchain를 초기화한다
     CreateDeviceAndSwapChain(hWindow);
+    InvalidateStateCache();
     CreateFrameBuffer();
     CreateIdBuffer();
     CreateRasterizerState();
     CreateBlendState();
     CONSTANT_BUFFER_LIST(CREATE_CONSTANT_BUFFER);
+    CreateConstantRing();
 
 	CreateDepthStencilState();
 	CreateSamplerState();
@@ -52,12 +54,14 @@ void D3D11RHI::Release()
 
         DeviceContext->ClearState();
         DeviceContext->Flush();
+        InvalidateStateCache();
     }
 
     ReleaseSamplerState();
 
     // 상수버퍼
     CONSTANT_BUFFER_LIST(RELEASE_CONSTANT_BUFFER);
+    ReleaseConstantRing();
 
     // 상태 객체
     if (DepthStencilState) { DepthStencilState->Release(); DepthStencilState = nullptr; }
@@ -100,6 +104,16 @@ void D3D11RHI::ClearDepthBuffer(float Depth, UINT Stencil)
     DeviceContext->ClearDepthStencilView(DepthStencilView, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, Depth, Stencil);
 }
 
+bool D3D11RHI::ClearRenderTargetRect(ID3D11RenderTargetView* InRTV, const FLOAT InColor[4], const D3D11_RECT& InRect)
+{
+    if (!DeviceContext1 || !InRTV)
+    {
+        return false;
+    }
+    DeviceContext1->ClearView(InRTV, InColor, &InRect, 1);
+    return true;
+}
+
 void D3D11RHI::CreateBlendState()
 {
     // Create once; reuse every frame
@@ -306,14 +320,33 @@ HRESULT D3D11RHI::CreateIndexBuffer(ID3D11Device* device, const FStaticMesh* mes
     if (!mesh || mesh->Indices.empty())
         return E_FAIL;
 
+    // LOD 인덱스는 LOD0 뒤에 이어 붙여 하나의 인덱스 버퍼로 만듦 (정점 버퍼는 모든 LOD가 공유)
+    const TArray<uint32>* indices = &mesh->Indices;
+    TArray<uint32> combinedIndices;
+    if (!mesh->LODs.empty())
+    {
+        size_t totalCount = mesh->Indices.size();
+        for (const FStaticMeshLOD& lod : mesh->LODs)
+        {
+            totalCount += lod.Indices.size();
+        }
+        combinedIndices.reserve(totalCount);
+        combinedIndices.insert(combinedIndices.end(), mesh->Indices.begin(), mesh->Indices.end());
+        for (const FStaticMeshLOD& lod : mesh->LODs)
+        {
+            combinedIndices.insert(combinedIndices.end(), lod.Indices.begin(), lod.Indices.end());
+        }
+        indices = &combinedIndices;
+    }
+
     D3D11_BUFFER_DESC ibd = {};
     ibd.Usage = D3D11_USAGE_DEFAULT;
-    ibd.ByteWidth = static_cast<UINT>(sizeof(uint32) * mesh->Indices.size());
+    ibd.ByteWidth = static_cast<UINT>(sizeof(uint32) * indices->size());
     ibd.BindFlags = D3D11_BIND_INDEX_BUFFER;
     ibd.CPUAccessFlags = 0;
 
     D3D11_SUBRESOURCE_DATA iinitData = {};
-    iinitData.pSysMem = mesh->Indices.data();
+    iinitData.pSysMem = indices->data();
 
     return device->CreateBuffer(&ibd, &iinitData, outBuffer);
 }
@@ -322,14 +355,123 @@ void D3D11RHI::ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool
 {
     if (bIsVS)
     {
-        DeviceContext->VSSetConstantBuffers(Slot, 1, &ConstantBuffer);
+        VSSetConstantBuffer(Slot, ConstantBuffer);
     }
     if (bIsPS)
     {
-        DeviceContext->PSSetConstantBuffers(Slot, 1, &ConstantBuffer);
+        PSSetConstantBuffer(Slot, ConstantBuffer);
+    }
+}
+
+bool D3D11RHI::ConstantRingSetUpdate(const void* InData, uint32 InSize, uint32 Slot, bool bIsVS, bool bIsPS)
+{
+    const uint32 AllocSize = (InSize + ConstantRingAlignment - 1) & ~(ConstantRingAlignment - 1);
+    if (AllocSize > ConstantRingSize)
+    {
+        return false;
+    }
+
+    // 프레임 첫 할당이거나 링 끝에 닿으면 DISCARD로 새 메모리를 받음 (GPU가 읽는 중인 영역은 덮어쓰지 않음)
+    D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (bConstantRingNeedsDiscard || ConstantRingOffset + AllocSize > ConstantRingSize)
+    {
+        if (!bConstantRingNeedsDiscard)
+        {
+            ++StateStats.RingWraps;
+        }
+        MapType = D3D11_MAP_WRITE_DISCARD;
+        ConstantRingOffset = 0;
+        bConstantRingNeedsDiscard = false;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE MSR;
+    if (FAILED(DeviceContext->Map(ConstantRingBuffer, 0, MapType, 0, &MSR)))
+    {
+        return false;
+    }
+    memcpy(static_cast<uint8*>(MSR.pData) + ConstantRingOffset, InData, InSize);
+    DeviceContext->Unmap(ConstantRingBuffer, 0);
+
+    const UINT FirstConstant = ConstantRingOffset / 16;
+    const UINT NumConstants = AllocSize / 16;
+    ConstantRingOffset += AllocSize;
+    ++StateStats.RingAllocations;
+    StateStats.RingBytes += AllocSize;
+
+    if (bIsVS)
+    {
+        SetConstantBufferRange(true, Slot, ConstantRingBuffer, FirstConstant, NumConstants);
+    }
+    if (bIsPS)
+    {
+        SetConstantBufferRange(false, Slot, ConstantRingBuffer, FirstConstant, NumConstants);
+    }
+    return true;
+}
+
+void D3D11RHI::SetConstantBufferRange(bool bIsVS, UINT Slot, ID3D11Buffer* InBuffer, UINT FirstConstant, UINT NumConstants)
+{
+    // API 슬롯 범위 밖은 D3D도 무시하는 호출
+    if (Slot >= D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT)
+    {
+        return;
+    }
+
+    FConstantBufferBinding& Binding = bIsVS ? StateCache.VSConstantBuffers[Slot] : StateCache.PSConstantBuffers[Slot];
+    if (Binding.Buffer == InBuffer && Binding.FirstConstant == FirstConstant && Binding.NumConstants == NumConstants)
+    {
+        RecordStateCall(ERHIStateCall::ConstantBuffer, false);
+        return;
+    }
+
+    if (NumConstants > 0 && DeviceContext1)
+    {
+        if (bIsVS)
+        {
+            DeviceContext1->VSSetConstantBuffers1(Slot, 1, &InBuffer, &FirstConstant, &NumConstants);
+        }
+        else
+        {
+            DeviceContext1->PSSetConstantBuffers1(Slot, 1, &InBuffer, &FirstConstant, &NumConstants);
+        }
+    }
+    else if (bIsVS)
+    {
+        DeviceContext->VSSetConstantBuffers(Slot, 1, &InBuffer);
+    }
+    else
+    {
+        DeviceContext->PSSetConstantBuffers(Slot, 1, &InBuffer);
     }
+
+    Binding = { InBuffer, FirstConstant, NumConstants };
+    RecordStateCall(ERHIStateCall::ConstantBuffer, true);
 }
 
+void D3D11RHI::VSSetConstantBuffer(UINT Slot, ID3D11Buffer* InBuffer)
+{
+    SetConstantBufferRange(true, Slot, InBuffer, 0, 0);
+}
+
+void D3D11RHI::PSSetConstantBuffer(UINT Slot, ID3D11Buffer* InBuffer)
+{
+    SetConstantBufferRange(false, Slot, InBuffer, 0, 0);
+}
+
+#define CASE_SET_UPDATE_CONSTANT_BUFFER_BY_ID(TYPE) \
+	case EConstantBufferId::TYPE: \
+		ConstantBufferSetUpdate(TYPE##Buffer, *static_cast<const TYPE*>(InData), TYPE##Slot, TYPE##IsVS, TYPE##IsPS); \
+		break;
+
+void D3D11RHI::SetAndUpdateConstantBuffer(EConstantBufferId InBufferId, const void* InData)
+{
+	switch (InBufferId)
+	{
+	CONSTANT_BUFFER_LIST(CASE_SET_UPDATE_CONSTANT_BUFFER_BY_ID)
+	default:
+		break;
+	}
+}
 
 void D3D11RHI::IASetPrimitiveTopology()
 {
@@ -341,27 +483,27 @@ void D3D11RHI::RSSetState(ERasterizerMode ViewModeIndex)
 	switch (ViewModeIndex)
 	{
 	case ERasterizerMode::Solid:
-		DeviceContext->RSSetState(DefaultRasterizerState);
+		SetRasterizerState(DefaultRasterizerState);
         break;
 
 	case ERasterizerMode::Wireframe:
-		DeviceContext->RSSetState(WireFrameRasterizerState);
+		SetRasterizerState(WireFrameRasterizerState);
         break;
 
 	case ERasterizerMode::Solid_NoCull:
-		DeviceContext->RSSetState(NoCullRasterizerState);
+		SetRasterizerState(NoCullRasterizerState);
         break;
 
 	case ERasterizerMode::Decal:
-		DeviceContext->RSSetState(DecalRasterizerState);
+		SetRasterizerState(DecalRasterizerState);
         break;
 
 	case ERasterizerMode::Shadows:
-		DeviceContext->RSSetState(ShadowRasterizerState);
+		SetRasterizerState(ShadowRasterizerState);
         break;
 
 	default:
-		DeviceContext->RSSetState(DefaultRasterizerState);
+		SetRasterizerState(DefaultRasterizerState);
         break;
 	}
 }
@@ -459,11 +601,11 @@ void D3D11RHI::OMSetBlendState(bool bIsBlendMode)
     if (bIsBlendMode == true)
     {
         float blendFactor[4] = { 0, 0, 0, 0 };
-        DeviceContext->OMSetBlendState(BlendStateTransparent, blendFactor, 0xffffffff);
+        SetBlendState(BlendStateTransparent, blendFactor, 0xffffffff);
     }
     else
     {
-        DeviceContext->OMSetBlendState(BlendStateOpaque, nullptr, 0xffffffff);
+        SetBlendState(BlendStateOpaque, nullptr, 0xffffffff);
     }
 }
 
@@ -474,13 +616,141 @@ void D3D11RHI::DrawFullScreenQuad()
     //    Input Assembler (IA) 단계가 사실상 생략됩니다.
     DeviceContext->IASetVertexBuffers(0, 0, nullptr, nullptr, nullptr);
     DeviceContext->IASetIndexBuffer(nullptr, DXGI_FORMAT_UNKNOWN, 0);
-    DeviceContext->IASetInputLayout(nullptr); // Input Layout도 필요 없습니다.
+    IASetInputLayout(nullptr); // Input Layout도 필요 없습니다.
     DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
     // 2. 정점 셰이더를 6번 실행하여 큰 삼각형 2개를 그리도록 명령합니다.
     DeviceContext->Draw(6, 0);
 }
 
+void D3D11RHI::IASetInputLayout(ID3D11InputLayout* InInputLayout)
+{
+    if (StateCache.InputLayout == InInputLayout)
+    {
+        RecordStateCall(ERHIStateCall::Shader, false);
+        return;
+    }
+    DeviceContext->IASetInputLayout(InInputLayout);
+    StateCache.InputLayout = InInputLayout;
+    RecordStateCall(ERHIStateCall::Shader, true);
+}
+
+void D3D11RHI::VSSetShader(ID3D11VertexShader* InVertexShader)
+{
+    if (StateCache.VertexShader == InVertexShader)
+    {
+        RecordStateCall(ERHIStateCall::Shader, false);
+        return;
+    }
+    DeviceContext->VSSetShader(InVertexShader, nullptr, 0);
+    StateCache.VertexShader = InVertexShader;
+    RecordStateCall(ERHIStateCall::Shader, true);
+}
+
+void D3D11RHI::PSSetShader(ID3D11PixelShader* InPixelShader)
+{
+    if (StateCache.PixelShader == InPixelShader)
+    {
+        RecordStateCall(ERHIStateCall::Shader, false);
+        return;
+    }
+    DeviceContext->PSSetShader(InPixelShader, nullptr, 0);
+    StateCache.PixelShader = InPixelShader;
+    RecordStateCall(ERHIStateCall::Shader, true);
+}
+
+void D3D11RHI::PSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* InSamplers)
+{
+    if (StartSlot + NumSamplers > D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT)
+    {
+        DeviceContext->PSSetSamplers(StartSlot, NumSamplers, InSamplers);
+        return;
+    }
+
+    // 바뀐 슬롯 구간만 제출
+    UINT First = NumSamplers;
+    UINT Last = 0;
+    for (UINT i = 0; i < NumSamplers; ++i)
+    {
+        if (StateCache.PSSamplers[StartSlot + i] != InSamplers[i])
+        {
+            First = std::min(First, i);
+            Last = i;
+        }
+    }
+    if (First == NumSamplers)
+    {
+        RecordStateCall(ERHIStateCall::Sampler, false);
+        return;
+    }
+
+    DeviceContext->PSSetSamplers(StartSlot + First, Last - First + 1, InSamplers + First);
+    for (UINT i = First; i <= Last; ++i)
+    {
+        StateCache.PSSamplers[StartSlot + i] = InSamplers[i];
+    }
+    RecordStateCall(ERHIStateCall::Sampler, true);
+}
+
+void D3D11RHI::SetRasterizerState(ID3D11RasterizerState* InState)
+{
+    if (StateCache.RasterizerState == InState)
+    {
+        RecordStateCall(ERHIStateCall::Rasterizer, false);
+        return;
+    }
+    DeviceContext->RSSetState(InState);
+    StateCache.RasterizerState = InState;
+    RecordStateCall(ERHIStateCall::Rasterizer, true);
+}
+
+void D3D11RHI::SetDepthStencilState(ID3D11DepthStencilState* InState, UINT InStencilRef)
+{
+    if (StateCache.DepthStencilState == InState && StateCache.StencilRef == InStencilRef)
+    {
+        RecordStateCall(ERHIStateCall::OutputMerger, false);
+        return;
+    }
+    DeviceContext->OMSetDepthStencilState(InState, InStencilRef);
+    StateCache.DepthStencilState = InState;
+    StateCache.StencilRef = InStencilRef;
+    RecordStateCall(ERHIStateCall::OutputMerger, true);
+}
+
+void D3D11RHI::SetBlendState(ID3D11BlendState* InState, const FLOAT InBlendFactor[4], UINT InSampleMask)
+{
+    // nullptr 블렌드 팩터는 D3D 기본값 {1, 1, 1, 1}과 같음
+    static const FLOAT DefaultBlendFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    const FLOAT* BlendFactor = InBlendFactor ? InBlendFactor : DefaultBlendFactor;
+
+    if (StateCache.BlendState == InState
+        && StateCache.SampleMask == InSampleMask
+        && memcmp(StateCache.BlendFactor, BlendFactor, sizeof(StateCache.BlendFactor)) == 0)
+    {
+        RecordStateCall(ERHIStateCall::OutputMerger, false);
+        return;
+    }
+    DeviceContext->OMSetBlendState(InState, BlendFactor, InSampleMask);
+    StateCache.BlendState = InState;
+    memcpy(StateCache.BlendFactor, BlendFactor, sizeof(StateCache.BlendFactor));
+    StateCache.SampleMask = InSampleMask;
+    RecordStateCall(ERHIStateCall::OutputMerger, true);
+}
+
+void D3D11RHI::InvalidateStateCache()
+{
+    // 모든 바이트를 0xFF로 채워 실제로 바인딩될 수 있는 어떤 값과도 같지 않게 함
+    memset(&StateCache, 0xFF, sizeof(StateCache));
+}
+
+void D3D11RHI::BeginFrameState()
+{
+    // ImGui/D2D 등 캐시를 거치지 않는 코드가 프레임 사이에 상태를 바꿀 수 있으므로 매 프레임 무효화
+    InvalidateStateCache();
+    StateStats = FRHIStateStats();
+    bConstantRingNeedsDiscard = true;
+}
+
 void D3D11RHI::Present()
 {
     // Draw any Direct2D overlays before present
@@ -701,6 +971,9 @@ void D3D11RHI::UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeS
 {
     if (!UVScrollCB) return;
 
+    UVScrollSpeed = Speed;
+    UVScrollTime = TimeSec;
+
     struct { float x; float y; float t; float pad; } data { Speed.X, Speed.Y, TimeSec, 0.0f };
 
     D3D11_MAPPED_SUBRESOURCE mapped;
@@ -708,7 +981,7 @@ void D3D11RHI::UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeS
     {
         memcpy(mapped.pData, &data, sizeof(data));
         DeviceContext->Unmap(UVScrollCB, 0);
-        DeviceContext->PSSetConstantBuffers(5, 1, &UVScrollCB);
+        PSSetConstantBuffer(5, UVScrollCB);
     }
 }
 
@@ -900,21 +1173,74 @@ void D3D11RHI::ReleaseDeviceAndSwapChain()
     }
 }
 
+void D3D11RHI::CreateConstantRing()
+{
+    bUseConstantRing = false;
+
+    // D3D11.1 런타임 + 상수 버퍼 오프셋 바인딩 + 동적 상수 버퍼 NO_OVERWRITE 맵을 모두 지원해야 함
+    if (FAILED(DeviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&DeviceContext1))))
+    {
+        DeviceContext1 = nullptr;
+        UE_LOG("D3D11RHI: ID3D11DeviceContext1 unavailable, using per-type constant buffers");
+        return;
+    }
+
+    D3D11_FEATURE_DATA_D3D11_OPTIONS Options{};
+    if (FAILED(Device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &Options, sizeof(Options)))
+        || !Options.ConstantBufferOffsetting
+        || !Options.MapNoOverwriteOnDynamicConstantBuffer)
+    {
+        UE_LOG("D3D11RHI: Constant buffer offsetting unsupported, using per-type constant buffers");
+        return;
+    }
+
+    D3D11_BUFFER_DESC BufferDesc{};
+    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    BufferDesc.ByteWidth = ConstantRingSize;
+    BufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (FAILED(Device->CreateBuffer(&BufferDesc, nullptr, &ConstantRingBuffer)))
+    {
+        ConstantRingBuffer = nullptr;
+        UE_LOG("D3D11RHI: Failed to create constant ring buffer");
+        return;
+    }
+
+    ConstantRingOffset = 0;
+    bConstantRingNeedsDiscard = true;
+    bUseConstantRing = true;
+}
+
+void D3D11RHI::ReleaseConstantRing()
+{
+    bUseConstantRing = false;
+    if (ConstantRingBuffer)
+    {
+        ConstantRingBuffer->Release();
+        ConstantRingBuffer = nullptr;
+    }
+    if (DeviceContext1)
+    {
+        DeviceContext1->Release();
+        DeviceContext1 = nullptr;
+    }
+}
+
 void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
 {
     switch (Func)
     {
     case EComparisonFunc::Always:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateAlwaysNoWrite, 0);
+        SetDepthStencilState(DepthStencilStateAlwaysNoWrite, 0);
         break;
     case EComparisonFunc::LessEqual:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateLessEqualWrite, 0);
+        SetDepthStencilState(DepthStencilStateLessEqualWrite, 0);
         break;
     case EComparisonFunc::GreaterEqual:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateGreaterEqualWrite, 0);
+        SetDepthStencilState(DepthStencilStateGreaterEqualWrite, 0);
         break;
     case EComparisonFunc::LessEqualReadOnly:
-        DeviceContext->OMSetDepthStencilState(DepthStencilStateLessEqualReadOnly, 0);
+        SetDepthStencilState(DepthStencilStateLessEqualReadOnly, 0);
         break;
     }
 }
@@ -922,13 +1248,13 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
 void D3D11RHI::OMSetDepthStencilState_OverlayWriteStencil()
 {
     // Stencil ref = 1 (overlay marks)
-    DeviceContext->OMSetDepthStencilState(DepthStencilStateOverlayWriteStencil, 1);
+    SetDepthStencilState(DepthStencilStateOverlayWriteStencil, 1);
 }
 
 void D3D11RHI::OMSetDepthStencilState_StencilRejectOverlay()
 {
     // Stencil ref = 0 (draw only where overlay not marked)
-    DeviceContext->OMSetDepthStencilState(DepthStencilStateStencilRejectOverlay, 0);
+    SetDepthStencilState(DepthStencilStateStencilRejectOverlay, 0);
 }
 
 void D3D11RHI::CreateShader(ID3D11InputLayout** SimpleInputLayout, ID3D11VertexShader** SimpleVertexShader, ID3D11PixelShader** SimplePixelShader)
@@ -1084,12 +1410,12 @@ void D3D11RHI::SetViewport(UINT width, UINT height)
 
 void D3D11RHI::PSSetDefaultSampler(UINT StartSlot)
 {
-	DeviceContext->PSSetSamplers(StartSlot, 1, &DefaultSamplerState);
+	PSSetSamplers(StartSlot, 1, &DefaultSamplerState);
 }
 
 void D3D11RHI::PSSetClampSampler(UINT StartSlot)
 {
-    DeviceContext->PSSetSamplers(StartSlot, 1, &LinearClampSamplerState);
+    PSSetSamplers(StartSlot, 1, &LinearClampSamplerState);
 }
 
 ID3D11SamplerState* D3D11RHI::GetSamplerState(RHI_Sampler_Index SamplerIndex) const
@@ -1122,17 +1448,17 @@ ID3D11SamplerState* D3D11RHI::GetSamplerState(RHI_Sampler_Index SamplerIndex) co
 
 void D3D11RHI::PrepareShader(UShader* InShader)
 {
-    GetDeviceContext()->VSSetShader(InShader->GetVertexShader(), nullptr, 0);
-    GetDeviceContext()->PSSetShader(InShader->GetPixelShader(), nullptr, 0);
-    GetDeviceContext()->IASetInputLayout(InShader->GetInputLayout());
+    VSSetShader(InShader->GetVertexShader());
+    PSSetShader(InShader->GetPixelShader());
+    IASetInputLayout(InShader->GetInputLayout());
 }
 
 void D3D11RHI::PrepareShader(UShader* InVertexShader, UShader* InPixelShader)
 {
-    GetDeviceContext()->IASetInputLayout(InVertexShader->GetInputLayout());
-    GetDeviceContext()->VSSetShader(InVertexShader->GetVertexShader(), nullptr, 0);
+    IASetInputLayout(InVertexShader->GetInputLayout());
+    VSSetShader(InVertexShader->GetVertexShader());
 
-    GetDeviceContext()->PSSetShader(InPixelShader->GetPixelShader(), nullptr, 0);
+    PSSetShader(InPixelShader->GetPixelShader());
 }
 
 // ──────────────────────────────────────────────────────
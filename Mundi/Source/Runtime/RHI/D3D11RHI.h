@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <d3d11_1.h>
 #include "RHIDevice.h"
 #include "ResourceManager.h"
 #include "VertexData.h"
@@ -42,6 +43,43 @@ enum class EComparisonFunc
 	// 필요시 추가 후 OMSetDepthStencilState 함수 수정
 };
 
+// 상태 캐시가 걸러내는 바인딩 종류
+enum class ERHIStateCall : uint8
+{
+	Shader,			// IASetInputLayout, VSSetShader, PSSetShader
+	ConstantBuffer,	// VS/PSSetConstantBuffers(1)
+	Sampler,		// PSSetSamplers
+	Rasterizer,		// RSSetState
+	OutputMerger,	// OMSetDepthStencilState, OMSetBlendState
+	Count
+};
+
+// 프레임 단위 RHI 상태 통계 (URenderer::BeginFrame에서 초기화)
+struct FRHIStateStats
+{
+	uint32 Submitted[static_cast<uint32>(ERHIStateCall::Count)] = {};
+	uint32 Skipped[static_cast<uint32>(ERHIStateCall::Count)] = {};
+
+	// 상수 버퍼 링
+	uint32 RingAllocations = 0;
+	uint32 RingBytes = 0;
+	uint32 RingWraps = 0;
+	uint32 DiscardUpdates = 0;	// 링을 쓰지 못해 타입별 버퍼를 DISCARD로 갱신한 횟수
+
+	uint32 GetTotalSubmitted() const
+	{
+		uint32 Total = 0;
+		for (uint32 Count : Submitted) { Total += Count; }
+		return Total;
+	}
+	uint32 GetTotalSkipped() const
+	{
+		uint32 Total = 0;
+		for (uint32 Count : Skipped) { Total += Count; }
+		return Total;
+	}
+};
+
 class D3D11RHI
 {
 public:
@@ -62,6 +100,9 @@ public:
 	// clear
 	void ClearAllBuffer();
 	void ClearDepthBuffer(float Depth, UINT Stencil);
+	// RTV의 일부 영역만 클리어 (D3D11.1 ClearView). 지원하지 않으면 false
+	bool ClearRenderTargetRect(ID3D11RenderTargetView* InRTV, const FLOAT InColor[4], const D3D11_RECT& InRect);
+	bool SupportsClearRenderTargetRect() const { return DeviceContext1 != nullptr; }
 	void CreateBlendState();
 
 	template<typename TVertex>
@@ -76,6 +117,9 @@ public:
 	template<typename TVertex>
 	static HRESULT CreateVertexBuffer(ID3D11Device* device, const std::vector<FNormalVertex>& srcVertices, ID3D11Buffer** outBuffer);
 
+	// 이미 GPU 포맷으로 압축된 스태틱 메시 정점 (변환 없이 그대로 업로드)
+	static HRESULT CreateVertexBuffer(ID3D11Device* device, const std::vector<FCompressedVertex>& compressedVertices, ID3D11Buffer** outBuffer);
+
 	static HRESULT CreateIndexBuffer(ID3D11Device* device, const FMeshData* meshData, ID3D11Buffer** outBuffer);
 
 	static HRESULT CreateIndexBuffer(ID3D11Device* device, const FStaticMesh* mesh, ID3D11Buffer** outBuffer);
@@ -96,12 +140,22 @@ public:
 	template <typename T>
 	void ConstantBufferSetUpdate(ID3D11Buffer* ConstantBuffer, T& Data, const uint32 Slot, const bool bIsVS, const bool bIsPS)
 	{
+		// 링을 쓸 수 있으면 프레임 링에 이어 쓰고 오프셋으로 바인딩 (타입별 버퍼 DISCARD 없음)
+		if (bUseConstantRing && ConstantRingSetUpdate(&Data, sizeof(T), Slot, bIsVS, bIsPS))
+		{
+			return;
+		}
 		ConstantBufferUpdate(ConstantBuffer, Data);
 		ConstantBufferSet(ConstantBuffer, Slot, bIsVS, bIsPS);
-		
+		++StateStats.DiscardUpdates;
 	}
 	void ConstantBufferSet(ID3D11Buffer* ConstantBuffer, uint32 Slot, bool bIsVS, bool bIsPS);
+	// 렌더 커맨드 실행용: 버퍼 종류 ID로 갱신 + 바인딩 (InData는 해당 타입 크기만큼 유효해야 함)
+	void SetAndUpdateConstantBuffer(EConstantBufferId InBufferId, const void* InData);
     void UpdateUVScrollConstantBuffers(const FVector2D& Speed, float TimeSec);
+    // 마지막으로 기록한 UV 스크롤 값 (b5는 렌더 씬 밖에서 갱신되므로 뷰포트 캐시 서명에 포함)
+    const FVector2D& GetUVScrollSpeed() const { return UVScrollSpeed; }
+    float GetUVScrollTime() const { return UVScrollTime; }
 	
 	void IASetPrimitiveTopology();
 	void RSSetState(ERasterizerMode ViewModeIndex);
@@ -114,6 +168,21 @@ public:
 	void DrawFullScreenQuad();
 	void Present();
 
+	// 상태 캐시를 거치는 바인딩: 마지막으로 바인딩한 상태와 같으면 컨텍스트 호출을 생략
+	// (컨텍스트를 직접 건드린 코드 뒤에는 InvalidateStateCache 호출 필요)
+	void IASetInputLayout(ID3D11InputLayout* InInputLayout);
+	void VSSetShader(ID3D11VertexShader* InVertexShader);
+	void PSSetShader(ID3D11PixelShader* InPixelShader);
+	void PSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* InSamplers);
+	void VSSetConstantBuffer(UINT Slot, ID3D11Buffer* InBuffer);
+	void PSSetConstantBuffer(UINT Slot, ID3D11Buffer* InBuffer);
+
+	void InvalidateStateCache();
+	// 프레임 시작: 캐시 무효화 + 통계 초기화 + 링 DISCARD 예약
+	void BeginFrameState();
+	const FRHIStateStats& GetStateStats() const { return StateStats; }
+	bool IsConstantRingEnabled() const { return bUseConstantRing; }
+
 	// Overlay precedence helpers
 	void OMSetDepthStencilState_OverlayWriteStencil();
 	void OMSetDepthStencilState_StencilRejectOverlay();
@@ -185,6 +254,21 @@ private:
 	void CreateConstantBuffer(ID3D11Buffer** ConstantBuffer, uint32 Size);
 	void CreateDepthStencilState();
 	void CreateSamplerState();
+	void CreateConstantRing();
+
+	// 캐시를 거치는 내부 상태 설정 (enum 기반 함수에서 사용)
+	void SetRasterizerState(ID3D11RasterizerState* InState);
+	void SetDepthStencilState(ID3D11DepthStencilState* InState, UINT InStencilRef);
+	void SetBlendState(ID3D11BlendState* InState, const FLOAT InBlendFactor[4], UINT InSampleMask);
+	// NumConstants가 0이면 버퍼 전체 바인딩, 아니면 D3D11.1 오프셋 바인딩
+	void SetConstantBufferRange(bool bIsVS, UINT Slot, ID3D11Buffer* InBuffer, UINT FirstConstant, UINT NumConstants);
+	bool ConstantRingSetUpdate(const void* InData, uint32 InSize, uint32 Slot, bool bIsVS, bool bIsPS);
+
+	void RecordStateCall(ERHIStateCall InCall, bool bSubmitted)
+	{
+		uint32& Counter = bSubmitted ? StateStats.Submitted[static_cast<uint32>(InCall)] : StateStats.Skipped[static_cast<uint32>(InCall)];
+		++Counter;
+	}
 
 	// release
 	void ReleaseSamplerState();
@@ -193,6 +277,7 @@ private:
 	void ReleaseFrameBuffer(); // fb, rtv
 	void ReleaseIdBuffer();
 	void ReleaseDeviceAndSwapChain();
+	void ReleaseConstantRing();
 
 	// FSwapGuard 클래스가 D3D11RHI의 private 멤버에 접근할 수 있도록 허용
 	friend class FSwapGuard;
@@ -251,6 +336,8 @@ private:
     // 버퍼 핸들
 	CONSTANT_BUFFER_LIST(DECLARE_CONSTANT_BUFFER)
 	ID3D11Buffer* UVScrollCB{};
+	FVector2D UVScrollSpeed{};
+	float UVScrollTime = 0.0f;
 
 	ID3D11SamplerState* DefaultSamplerState = nullptr;
 	ID3D11SamplerState* LinearClampSamplerState = nullptr;
@@ -260,6 +347,40 @@ private:
 
 	UShader* PreShader = nullptr; // Shaders, Inputlayout
 
+	// 마지막으로 컨텍스트에 바인딩한 상태 (InvalidateStateCache에서 0xFF로 채워 어떤 값과도 다르게 만듦)
+	struct FConstantBufferBinding
+	{
+		ID3D11Buffer* Buffer;
+		UINT FirstConstant;
+		UINT NumConstants;
+	};
+	struct FStateCache
+	{
+		ID3D11InputLayout* InputLayout;
+		ID3D11VertexShader* VertexShader;
+		ID3D11PixelShader* PixelShader;
+		ID3D11RasterizerState* RasterizerState;
+		ID3D11DepthStencilState* DepthStencilState;
+		UINT StencilRef;
+		ID3D11BlendState* BlendState;
+		FLOAT BlendFactor[4];
+		UINT SampleMask;
+		ID3D11SamplerState* PSSamplers[D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT];
+		FConstantBufferBinding VSConstantBuffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+		FConstantBufferBinding PSConstantBuffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+	};
+	FStateCache StateCache;
+	FRHIStateStats StateStats;
+
+	// 프레임 상수 버퍼 링 (D3D11.1 오프셋 바인딩 + NO_OVERWRITE 맵 지원 시에만 사용)
+	static constexpr uint32 ConstantRingSize = 4 * 1024 * 1024;
+	static constexpr uint32 ConstantRingAlignment = 256; // 오프셋/크기는 상수 16개(256바이트) 단위
+	ID3D11DeviceContext1* DeviceContext1 = nullptr;
+	ID3D11Buffer* ConstantRingBuffer = nullptr;
+	uint32 ConstantRingOffset = 0;
+	bool bConstantRingNeedsDiscard = true;
+	bool bUseConstantRing = false;
+
 	bool bReleased = false; // Prevent double Release() calls
 };
 
@@ -368,3 +489,16 @@ inline HRESULT D3D11RHI::CreateVertexBuffer<FBillboardVertexInfo_GPU>(ID3D11Devi
 {
 	return CreateVertexBufferImpl<FBillboardVertexInfo_GPU>(device, srcVertices, outBuffer, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
 }
+
+inline HRESULT D3D11RHI::CreateVertexBuffer(ID3D11Device* device, const std::vector<FCompressedVertex>& compressedVertices, ID3D11Buffer** outBuffer)
+{
+	D3D11_BUFFER_DESC vbd = {};
+	vbd.Usage = D3D11_USAGE_IMMUTABLE;
+	vbd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	vbd.ByteWidth = static_cast<UINT>(sizeof(FCompressedVertex) * compressedVertices.size());
+
+	D3D11_SUBRESOURCE_DATA vinitData = {};
+	vinitData.pSysMem = compressedVertices.data();
+
+	return device->CreateBuffer(&vbd, &vinitData, outBuffer);
+}
@@ -0,0 +1,128 @@
+﻿#include "pch.h"
+#include "D3D11RenderBackend.h"
+
+void FD3D11RenderBackend::BeginPass()
+{
+	bPipelineValid = false;
+	bGeometryValid = false;
+	bPixelResourcesValid = false;
+	CurrentPipeline = {};
+	CurrentGeometry = {};
+	CurrentPixelResources = {};
+}
+
+void FD3D11RenderBackend::Execute(const FRenderCommandBuffer& InBuffer)
+{
+	if (!RHIDevice)
+	{
+		return;
+	}
+
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	const uint8* ConstantData = InBuffer.GetConstantData();
+
+	for (const FRenderCommand& Command : InBuffer.GetCommands())
+	{
+		++Stats.CommandCounts[static_cast<uint32>(Command.Type)];
+
+		switch (Command.Type)
+		{
+		case ERenderCommandType::SetPipeline:
+			ExecutePipeline(Command.Pipeline);
+			break;
+		case ERenderCommandType::SetGeometry:
+			ExecuteGeometry(Command.Geometry);
+			break;
+		case ERenderCommandType::SetPixelResources:
+			ExecutePixelResources(Command.PixelResources);
+			break;
+		case ERenderCommandType::UpdateConstants:
+			// 데이터가 매번 달라지므로 걸러내지 않음
+			RHIDevice->SetAndUpdateConstantBuffer(Command.Constants.BufferId, ConstantData + Command.Constants.DataOffset);
+			Stats.ConstantBytes += Command.Constants.DataSize;
+			++Stats.SubmittedCommands;
+			break;
+		case ERenderCommandType::DrawIndexed:
+			// 인스턴스 1개 + StartInstance로 오브젝트 데이터 인덱스 전달
+			DeviceContext->DrawIndexedInstanced(Command.Draw.IndexCount, 1, Command.Draw.StartIndex, Command.Draw.BaseVertex, Command.Draw.StartInstance);
+			++Stats.Draws;
+			Stats.Indices += Command.Draw.IndexCount;
+			++Stats.SubmittedCommands;
+			break;
+		default:
+			++Stats.ValidationErrors;
+			break;
+		}
+	}
+}
+
+void FD3D11RenderBackend::ExecutePipeline(const FRenderCmdPipeline& InPipeline)
+{
+	if (bPipelineValid
+		&& InPipeline.InputLayout == CurrentPipeline.InputLayout
+		&& InPipeline.VertexShader == CurrentPipeline.VertexShader
+		&& InPipeline.PixelShader == CurrentPipeline.PixelShader)
+	{
+		++Stats.FilteredCommands;
+		return;
+	}
+
+	// RHI 상태 캐시를 거쳐 패스 밖에서 이미 바인딩된 셰이더도 걸러냄
+	RHIDevice->IASetInputLayout(InPipeline.InputLayout);
+	RHIDevice->VSSetShader(InPipeline.VertexShader);
+	RHIDevice->PSSetShader(InPipeline.PixelShader);
+	CurrentPipeline = InPipeline;
+	bPipelineValid = true;
+	++Stats.SubmittedCommands;
+}
+
+void FD3D11RenderBackend::ExecuteGeometry(const FRenderCmdGeometry& InGeometry)
+{
+	if (bGeometryValid
+		&& InGeometry.VertexBuffer == CurrentGeometry.VertexBuffer
+		&& InGeometry.IndexBuffer == CurrentGeometry.IndexBuffer
+		&& InGeometry.VertexStride == CurrentGeometry.VertexStride
+		&& InGeometry.PrimitiveTopology == CurrentGeometry.PrimitiveTopology)
+	{
+		++Stats.FilteredCommands;
+		return;
+	}
+
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	UINT Stride = InGeometry.VertexStride;
+	UINT Offset = 0;
+	ID3D11Buffer* VertexBuffer = InGeometry.VertexBuffer;
+	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
+	DeviceContext->IASetIndexBuffer(InGeometry.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	DeviceContext->IASetPrimitiveTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(InGeometry.PrimitiveTopology));
+	CurrentGeometry = InGeometry;
+	bGeometryValid = true;
+	++Stats.SubmittedCommands;
+}
+
+void FD3D11RenderBackend::ExecutePixelResources(const FRenderCmdPixelResources& InResources)
+{
+	// 개수가 다르면 슬롯 범위가 달라지므로 그대로 제출
+	if (bPixelResourcesValid
+		&& InResources.NumSRVs == CurrentPixelResources.NumSRVs
+		&& InResources.NumSamplers == CurrentPixelResources.NumSamplers
+		&& memcmp(InResources.SRVs, CurrentPixelResources.SRVs, sizeof(InResources.SRVs[0]) * InResources.NumSRVs) == 0
+		&& memcmp(InResources.Samplers, CurrentPixelResources.Samplers, sizeof(InResources.Samplers[0]) * InResources.NumSamplers) == 0)
+	{
+		++Stats.FilteredCommands;
+		return;
+	}
+
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	if (InResources.NumSRVs > 0)
+	{
+		DeviceContext->PSSetShaderResources(0, InResources.NumSRVs, InResources.SRVs);
+	}
+	if (InResources.NumSamplers > 0)
+	{
+		RHIDevice->PSSetSamplers(0, InResources.NumSamplers, InResources.Samplers);
+	}
+	CurrentPixelResources = InResources;
+	bPixelResourcesValid = true;
+	++Stats.SubmittedCommands;
+}
@@ -0,0 +1,30 @@
+﻿#pragma once
+#include "RenderCommandBuffer.h"
+
+class D3D11RHI;
+
+// 렌더 커맨드를 D3D11 디바이스 컨텍스트 호출로 변환. 마지막으로 바인딩한 상태와 같은 커맨드는 건너뜀
+class FD3D11RenderBackend : public FRenderCommandBackend
+{
+public:
+	explicit FD3D11RenderBackend(D3D11RHI* InRHIDevice) : RHIDevice(InRHIDevice) {}
+
+	const char* GetName() const override { return "D3D11"; }
+	void BeginPass() override;
+	void Execute(const FRenderCommandBuffer& InBuffer) override;
+
+private:
+	void ExecutePipeline(const FRenderCmdPipeline& InPipeline);
+	void ExecuteGeometry(const FRenderCmdGeometry& InGeometry);
+	void ExecutePixelResources(const FRenderCmdPixelResources& InResources);
+
+	D3D11RHI* RHIDevice = nullptr;
+
+	// 이번 패스에서 마지막으로 바인딩한 상태 (BeginPass에서 무효화)
+	bool bPipelineValid = false;
+	bool bGeometryValid = false;
+	bool bPixelResourcesValid = false;
+	FRenderCmdPipeline CurrentPipeline{};
+	FRenderCmdGeometry CurrentGeometry{};
+	FRenderCmdPixelResources CurrentPixelResources{};
+};
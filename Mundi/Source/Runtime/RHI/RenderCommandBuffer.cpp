@@ -0,0 +1,133 @@
+﻿#include "pch.h"
+#include "RenderCommandBuffer.h"
+
+void FRenderCommandBuffer::Reset()
+{
+	Commands.clear();
+	ConstantData.clear();
+	NumDraws = 0;
+}
+
+void FRenderCommandBuffer::SetPipeline(ID3D11InputLayout* InInputLayout, ID3D11VertexShader* InVertexShader, ID3D11PixelShader* InPixelShader)
+{
+	FRenderCommand& Command = Commands.emplace_back();
+	Command.Type = ERenderCommandType::SetPipeline;
+	Command.Pipeline = { InInputLayout, InVertexShader, InPixelShader };
+}
+
+void FRenderCommandBuffer::SetGeometry(ID3D11Buffer* InVertexBuffer, ID3D11Buffer* InIndexBuffer, uint32 InVertexStride, uint32 InPrimitiveTopology)
+{
+	FRenderCommand& Command = Commands.emplace_back();
+	Command.Type = ERenderCommandType::SetGeometry;
+	Command.Geometry = { InVertexBuffer, InIndexBuffer, InVertexStride, InPrimitiveTopology };
+}
+
+void FRenderCommandBuffer::SetPixelResources(ID3D11ShaderResourceView* const* InSRVs, uint32 InNumSRVs, ID3D11SamplerState* const* InSamplers, uint32 InNumSamplers)
+{
+	FRenderCommand& Command = Commands.emplace_back();
+	Command.Type = ERenderCommandType::SetPixelResources;
+
+	FRenderCmdPixelResources& Resources = Command.PixelResources;
+	Resources = {};
+	Resources.NumSRVs = static_cast<uint8>(std::min(InNumSRVs, RenderCommandMaxPixelSRVs));
+	Resources.NumSamplers = static_cast<uint8>(std::min(InNumSamplers, RenderCommandMaxPixelSamplers));
+	for (uint32 i = 0; i < Resources.NumSRVs; ++i)
+	{
+		Resources.SRVs[i] = InSRVs ? InSRVs[i] : nullptr;
+	}
+	for (uint32 i = 0; i < Resources.NumSamplers; ++i)
+	{
+		Resources.Samplers[i] = InSamplers ? InSamplers[i] : nullptr;
+	}
+}
+
+void FRenderCommandBuffer::DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex, uint32 InStartInstance)
+{
+	FRenderCommand& Command = Commands.emplace_back();
+	Command.Type = ERenderCommandType::DrawIndexed;
+	Command.Draw = { InIndexCount, InStartIndex, InBaseVertex, InStartInstance };
+	++NumDraws;
+}
+
+void FRenderCommandBuffer::AddConstants(EConstantBufferId InBufferId, const void* InData, uint32 InSize)
+{
+	// 상수 버퍼 크기는 16바이트 배수이므로 오프셋도 16바이트 단위로 유지됨
+	const uint32 Offset = static_cast<uint32>(ConstantData.size());
+	ConstantData.resize(Offset + InSize);
+	memcpy(ConstantData.data() + Offset, InData, InSize);
+
+	FRenderCommand& Command = Commands.emplace_back();
+	Command.Type = ERenderCommandType::UpdateConstants;
+	Command.Constants = { InBufferId, Offset, InSize };
+}
+
+void FNullRenderBackend::BeginPass()
+{
+	bPipelineBound = false;
+	bGeometryBound = false;
+}
+
+void FNullRenderBackend::Execute(const FRenderCommandBuffer& InBuffer)
+{
+	const uint32 ConstantDataSize = InBuffer.GetConstantDataSize();
+
+	for (const FRenderCommand& Command : InBuffer.GetCommands())
+	{
+		const uint32 TypeIndex = static_cast<uint32>(Command.Type);
+		if (TypeIndex >= static_cast<uint32>(ERenderCommandType::Count))
+		{
+			++Stats.ValidationErrors;
+			continue;
+		}
+		++Stats.CommandCounts[TypeIndex];
+
+		switch (Command.Type)
+		{
+		case ERenderCommandType::SetPipeline:
+			bPipelineBound = Command.Pipeline.VertexShader && Command.Pipeline.PixelShader;
+			if (!bPipelineBound)
+			{
+				++Stats.ValidationErrors;
+			}
+			break;
+		case ERenderCommandType::SetGeometry:
+			bGeometryBound = Command.Geometry.VertexBuffer && Command.Geometry.IndexBuffer && Command.Geometry.VertexStride > 0;
+			if (!bGeometryBound)
+			{
+				++Stats.ValidationErrors;
+			}
+			break;
+		case ERenderCommandType::SetPixelResources:
+			if (Command.PixelResources.NumSRVs > RenderCommandMaxPixelSRVs || Command.PixelResources.NumSamplers > RenderCommandMaxPixelSamplers)
+			{
+				++Stats.ValidationErrors;
+			}
+			break;
+		case ERenderCommandType::UpdateConstants:
+		{
+			const FRenderCmdConstants& Constants = Command.Constants;
+			if (Constants.BufferId >= EConstantBufferId::Count
+				|| Constants.DataSize == 0
+				|| Constants.DataOffset > ConstantDataSize
+				|| Constants.DataSize > ConstantDataSize - Constants.DataOffset)
+			{
+				++Stats.ValidationErrors;
+				break;
+			}
+			Stats.ConstantBytes += Constants.DataSize;
+			break;
+		}
+		case ERenderCommandType::DrawIndexed:
+			if (!bPipelineBound || !bGeometryBound || Command.Draw.IndexCount == 0)
+			{
+				++Stats.ValidationErrors;
+				break;
+			}
+			++Stats.Draws;
+			Stats.Indices += Command.Draw.IndexCount;
+			break;
+		default:
+			break;
+		}
+	}
+}
@@ -0,0 +1,173 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "ConstantBufferType.h"
+
+struct ID3D11InputLayout;
+struct ID3D11VertexShader;
+struct ID3D11PixelShader;
+struct ID3D11Buffer;
+struct ID3D11ShaderResourceView;
+struct ID3D11SamplerState;
+
+/**
+ * 백엔드 독립 렌더 커맨드 스트림
+ * - 패스는 디바이스 컨텍스트 대신 FRenderCommandBuffer에 POD 커맨드를 기록 (스레드별 버퍼로 병렬 기록 가능)
+ * - FRenderCommandBackend가 버퍼를 순서대로 실행: D3D11 백엔드는 중복 상태를 걸러 제출,
+ *   Null 백엔드는 커맨드 수 집계와 검증만 수행 (GPU 없이 CPU 렌더 경로 측정용)
+ * D3D 리소스 포인터는 백엔드만 해석하는 불투명 핸들로 취급
+ */
+enum class ERenderCommandType : uint8
+{
+	SetPipeline,		// 입력 레이아웃 + VS + PS
+	SetGeometry,		// 정점/인덱스 버퍼 + 스트라이드 + 토폴로지
+	SetPixelResources,	// PS SRV + 샘플러
+	UpdateConstants,	// 상수 버퍼 갱신 + 바인딩 (데이터는 버퍼의 상수 영역에 보관)
+	DrawIndexed,
+	Count
+};
+
+constexpr uint32 RenderCommandMaxPixelSRVs = 2;
+constexpr uint32 RenderCommandMaxPixelSamplers = 4;
+
+struct FRenderCmdPipeline
+{
+	ID3D11InputLayout* InputLayout;
+	ID3D11VertexShader* VertexShader;
+	ID3D11PixelShader* PixelShader;
+};
+
+struct FRenderCmdGeometry
+{
+	ID3D11Buffer* VertexBuffer;
+	ID3D11Buffer* IndexBuffer;
+	uint32 VertexStride;
+	uint32 PrimitiveTopology;	// D3D11_PRIMITIVE_TOPOLOGY
+};
+
+struct FRenderCmdPixelResources
+{
+	ID3D11ShaderResourceView* SRVs[RenderCommandMaxPixelSRVs];
+	ID3D11SamplerState* Samplers[RenderCommandMaxPixelSamplers];
+	uint8 NumSRVs;		// t0부터 바인딩할 개수
+	uint8 NumSamplers;	// s0부터 바인딩할 개수
+};
+
+struct FRenderCmdConstants
+{
+	EConstantBufferId BufferId;
+	uint32 DataOffset;	// FRenderCommandBuffer 상수 영역 내 오프셋
+	uint32 DataSize;
+};
+
+struct FRenderCmdDraw
+{
+	uint32 IndexCount;
+	uint32 StartIndex;
+	int32 BaseVertex;
+	uint32 StartInstance;	// 오브젝트 데이터 인덱스 (인스턴스 스트림을 거쳐 셰이더의 OBJECTINDEX로 전달)
+};
+
+struct FRenderCommand
+{
+	ERenderCommandType Type;
+	union
+	{
+		FRenderCmdPipeline Pipeline;
+		FRenderCmdGeometry Geometry;
+		FRenderCmdPixelResources PixelResources;
+		FRenderCmdConstants Constants;
+		FRenderCmdDraw Draw;
+	};
+};
+static_assert(std::is_trivially_copyable_v<FRenderCommand>, "FRenderCommand must stay POD");
+
+class FRenderCommandBuffer
+{
+public:
+	// 용량은 유지한 채 비움 (프레임마다 재사용)
+	void Reset();
+
+	void SetPipeline(ID3D11InputLayout* InInputLayout, ID3D11VertexShader* InVertexShader, ID3D11PixelShader* InPixelShader);
+	void SetGeometry(ID3D11Buffer* InVertexBuffer, ID3D11Buffer* InIndexBuffer, uint32 InVertexStride, uint32 InPrimitiveTopology);
+	void SetPixelResources(ID3D11ShaderResourceView* const* InSRVs, uint32 InNumSRVs, ID3D11SamplerState* const* InSamplers, uint32 InNumSamplers);
+	void DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex, uint32 InStartInstance = 0);
+
+	template<typename T>
+	void UpdateConstants(const T& InData)
+	{
+		AddConstants(TConstantBufferId<T>::Value, &InData, sizeof(T));
+	}
+
+	const TArray<FRenderCommand>& GetCommands() const { return Commands; }
+	const uint8* GetConstantData() const { return ConstantData.data(); }
+	uint32 GetConstantDataSize() const { return static_cast<uint32>(ConstantData.size()); }
+	uint32 GetNumDraws() const { return NumDraws; }
+	bool IsEmpty() const { return Commands.empty(); }
+
+private:
+	void AddConstants(EConstantBufferId InBufferId, const void* InData, uint32 InSize);
+
+	TArray<FRenderCommand> Commands;
+	TArray<uint8> ConstantData;	// 상수 데이터 (16바이트 단위로 패킹)
+	uint32 NumDraws = 0;
+};
+
+// 백엔드 실행 통계 (ResetStats 이후 누적)
+struct FRenderCommandStats
+{
+	uint32 CommandCounts[static_cast<uint32>(ERenderCommandType::Count)] = {};
+	uint32 SubmittedCommands = 0;	// 실제로 디바이스에 전달된 커맨드
+	uint32 FilteredCommands = 0;	// 이미 바인딩된 상태라 건너뛴 커맨드
+	uint32 ValidationErrors = 0;
+	uint32 Draws = 0;
+	uint64 Indices = 0;
+	uint64 ConstantBytes = 0;
+
+	void Reset()
+	{
+		*this = FRenderCommandStats();
+	}
+
+	uint32 GetTotalCommands() const
+	{
+		uint32 Total = 0;
+		for (uint32 Count : CommandCounts)
+		{
+			Total += Count;
+		}
+		return Total;
+	}
+};
+
+class FRenderCommandBackend
+{
+public:
+	virtual ~FRenderCommandBackend() = default;
+
+	virtual const char* GetName() const = 0;
+
+	// 패스 시작 시 호출. 커맨드 밖에서 컨텍스트를 직접 건드렸을 수 있으므로 추적 상태를 무효화
+	virtual void BeginPass() = 0;
+
+	// 버퍼의 커맨드를 기록 순서대로 실행 (렌더 스레드에서만 호출)
+	virtual void Execute(const FRenderCommandBuffer& InBuffer) = 0;
+
+	const FRenderCommandStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats.Reset(); }
+
+protected:
+	FRenderCommandStats Stats;
+};
+
+// 디바이스 없이 커맨드 수 집계와 검증만 하는 백엔드
+class FNullRenderBackend : public FRenderCommandBackend
+{
+public:
+	const char* GetName() const override { return "Null"; }
+	void BeginPass() override;
+	void Execute(const FRenderCommandBuffer& InBuffer) override;
+
+private:
+	bool bPipelineBound = false;
+	bool bGeometryBound = false;
+};
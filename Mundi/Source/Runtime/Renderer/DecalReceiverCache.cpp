@@ -0,0 +1,76 @@
+﻿#include "pch.h"
+#include "DecalReceiverCache.h"
+#include "BVHierarchy.h"
+#include "CollisionQueries.h"
+#include "DecalComponent.h"
+
+namespace
+{
+	bool IsSameOBB(const FOBB& A, const FOBB& B)
+	{
+		return A.Center == B.Center && A.HalfExtent == B.HalfExtent
+			&& A.Axes[0] == B.Axes[0] && A.Axes[1] == B.Axes[1] && A.Axes[2] == B.Axes[2];
+	}
+}
+
+void FDecalReceiverCache::SyncWithBVH(FBVHierarchy& BVH)
+{
+	CacheHits = 0;
+	CacheMisses = 0;
+
+	bBypassCache = BVH.IsRebuildPending();
+	if (bBypassCache)
+	{
+		// 바뀐 바운드는 리빌드 후 다음 프레임에 소비
+		return;
+	}
+
+	bool bAllChanged = false;
+	BVH.ConsumeChangedBounds(ChangedBounds, bAllChanged);
+	if (!bAllChanged && ChangedBounds.empty())
+	{
+		return;
+	}
+
+	for (auto& Pair : Entries)
+	{
+		FEntry& Entry = Pair.second;
+		if (!Entry.bValid)
+		{
+			continue;
+		}
+		if (bAllChanged)
+		{
+			Entry.bValid = false;
+			continue;
+		}
+
+		for (const FAABB& Bounds : ChangedBounds)
+		{
+			if (Bounds.Intersects(Entry.DecalBounds) && Collision::OverlapAABBOBB(Bounds, Entry.DecalOBB))
+			{
+				Entry.bValid = false;
+				break;
+			}
+		}
+	}
+}
+
+const TArray<UStaticMeshComponent*>& FDecalReceiverCache::GetReceivers(UDecalComponent* Decal, const FBVHierarchy& BVH)
+{
+	FEntry& Entry = Entries[Decal];
+	const FOBB DecalOBB = Decal->GetWorldOBB();
+
+	if (!bBypassCache && Entry.bValid && IsSameOBB(Entry.DecalOBB, DecalOBB))
+	{
+		++CacheHits;
+		return Entry.Receivers;
+	}
+
+	++CacheMisses;
+	Entry.DecalOBB = DecalOBB;
+	Entry.DecalBounds = Decal->GetWorldAABB();
+	Entry.Receivers = BVH.QueryIntersectedComponents(DecalOBB);
+	Entry.bValid = !bBypassCache;
+	return Entry.Receivers;
+}
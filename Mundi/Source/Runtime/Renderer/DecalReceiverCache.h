@@ -0,0 +1,47 @@
+﻿#pragma once
+#include "OBB.h"
+
+class FBVHierarchy;
+class UDecalComponent;
+class UStaticMeshComponent;
+
+/**
+ * 데칼별 수신 메시 목록 캐시 (월드의 FRenderScene이 소유)
+ * - 데칼 OBB로 BVH를 질의한 결과를 데칼마다 보관하고, 데칼 OBB가 그대로면 다음 프레임에도 재사용
+ * - 수신 메시가 움직이면 BVH가 기록한 이전/새 바운드와 겹치는 데칼만 무효화
+ * 소유 액터 가시성, 편집 가능 여부처럼 자주 바뀌는 조건은 캐시에 담지 않고 사용하는 쪽에서 매 프레임 검사
+ */
+class FDecalReceiverCache
+{
+public:
+	// 마지막 동기화 이후 바뀐 BVH 바운드를 가져와 겹치는 항목을 무효화 (프레임마다 데칼 패스 시작 시 호출)
+	void SyncWithBVH(FBVHierarchy& BVH);
+
+	// 데칼의 수신 메시 목록 (캐시가 유효하지 않으면 BVH를 다시 질의)
+	const TArray<UStaticMeshComponent*>& GetReceivers(UDecalComponent* Decal, const FBVHierarchy& BVH);
+
+	void Remove(UDecalComponent* Decal) { Entries.Remove(Decal); }
+	void Clear() { Entries.clear(); }
+
+	// 프레임 통계 (SyncWithBVH에서 초기화)
+	uint32 GetCacheHits() const { return CacheHits; }
+	uint32 GetCacheMisses() const { return CacheMisses; }
+
+private:
+	struct FEntry
+	{
+		FOBB DecalOBB;
+		FAABB DecalBounds;	// 바뀐 바운드와 빠르게 비교하기 위한 OBB의 AABB
+		TArray<UStaticMeshComponent*> Receivers;
+		bool bValid = false;
+	};
+
+	TMap<UDecalComponent*, FEntry> Entries;
+	TArray<FAABB> ChangedBounds;
+
+	// BVH 리빌드 대기 중이면 트리가 최신이 아니므로 이번 프레임 질의 결과를 캐시하지 않음
+	bool bBypassCache = false;
+
+	uint32 CacheHits = 0;
+	uint32 CacheMisses = 0;
+};
@@ -2,6 +2,18 @@
 
 #include <cstdint>
 
+/**
+ * @brief 데칼 렌더 경로 하나의 프레임 비용입니다.
+ */
+struct FDecalPathStats
+{
+	uint32_t Draws = 0;					// 메시 경로: 데칼-메시 드로우 수, 클러스터드 경로: 전체 화면 패스 수
+	uint32_t TileDecalPairs = 0;		// 클러스터드 경로: 데칼이 걸친 타일 수의 합
+	uint32_t ReceiverCacheHits = 0;		// 메시 경로: 수신 메시 목록을 캐시에서 가져온 데칼 수
+	uint32_t ReceiverCacheMisses = 0;	// 메시 경로: BVH를 다시 질의한 데칼 수
+	double CpuTimeMS = 0.0;
+};
+
 /**
  * @class FDecalStatManager
  * @brief 데칼 렌더링과 관련된 통계 데이터를 수집하고 제공하는 싱글톤 클래스입니다.
@@ -27,6 +39,17 @@ public:
 		VisibleDecalCount = 0;
 		AffectedMeshCount = 0;
 		DecalPassTimeMS = 0.0;
+
+		// 경로를 바꾼 뒤에도 비교할 수 있도록 측정된 경로의 값은 보관
+		for (int32_t i = 0; i < NumPaths; ++i)
+		{
+			if (bPathMeasured[i])
+			{
+				LastPathStats[i] = PathStats[i];
+			}
+			PathStats[i] = FDecalPathStats();
+			bPathMeasured[i] = false;
+		}
 	}
 
 	// --- Getters ---
@@ -69,6 +92,18 @@ public:
 		return DecalPassTimeMS / static_cast<double>(AffectedMeshCount);
 	}
 
+	/**
+	 * @brief 경로별 비용을 반환합니다. 이번 프레임에 쓰이지 않은 경로는 마지막으로 측정한 값입니다.
+	 */
+	const FDecalPathStats& GetPathStats(EDecalRenderPath InPath) const
+	{
+		const int32_t Index = static_cast<int32_t>(InPath);
+		return bPathMeasured[Index] ? PathStats[Index] : LastPathStats[Index];
+	}
+
+	/** @return 이번 프레임에 해당 경로로 데칼을 그렸는지 */
+	bool IsPathMeasuredThisFrame(EDecalRenderPath InPath) const { return bPathMeasured[static_cast<int32_t>(InPath)]; }
+
 	// --- Setters / Incrementers ---
 
 	// NOTE: 추후 데칼 생성/소멸 시 호출하여 실제 컴포넌트 수만큼만 표시
@@ -85,6 +120,14 @@ public:
 	/** @brief 데칼 패스의 전체 소요 시간을 직접 기록할 수 있도록 변수의 참조를 반환합니다. */
 	double& GetDecalPassTimeSlot() { return DecalPassTimeMS; }
 
+	/** @brief 해당 경로의 이번 프레임 비용을 기록할 수 있도록 참조를 반환합니다. */
+	FDecalPathStats& GetPathStatsSlot(EDecalRenderPath InPath)
+	{
+		const int32_t Index = static_cast<int32_t>(InPath);
+		bPathMeasured[Index] = true;
+		return PathStats[Index];
+	}
+
 private:
 	FDecalStatManager() = default;
 	~FDecalStatManager() = default;
@@ -101,4 +144,10 @@ private:
 	uint32_t VisibleDecalCount = 0;
 	uint32_t AffectedMeshCount = 0;
 	double DecalPassTimeMS = 0.0;
+
+	// 경로별 비용 (EDecalRenderPath 순서)
+	static constexpr int32_t NumPaths = 2;
+	FDecalPathStats PathStats[NumPaths];
+	FDecalPathStats LastPathStats[NumPaths];
+	bool bPathMeasured[NumPaths] = {};
 };
\ No newline at end of file
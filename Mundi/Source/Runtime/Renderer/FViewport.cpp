@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "FViewport.h"
 #include "FViewportClient.h"
+#include "D3D11RHI.h"
 
 FViewport::FViewport()
 {
@@ -28,6 +29,8 @@ bool FViewport::Initialize(float InStartX, float InStartY, float InSizeX, float
 
 void FViewport::Cleanup()
 {
+	ReleaseCachedFrameTextures();
+
 	if (D3DDeviceContext)
 	{
 		D3DDeviceContext->Release();
@@ -82,4 +85,137 @@ void FViewport::Resize(uint32 NewStartX, uint32 NewStartY, uint32 NewSizeX, uint
 	StartY = NewStartY;
 	SizeX = NewSizeX;
 	SizeY = NewSizeY;
-}
\ No newline at end of file
+}
+
+bool FViewport::PresentCachedFrame(D3D11RHI* RHI, uint64 InViewSignature)
+{
+	if (!bCachedFrameValid || CachedViewSignature != InViewSignature)
+	{
+		return false;
+	}
+
+	ID3D11Resource* BackBufferResource = nullptr;
+	if (ID3D11RenderTargetView* BackBufferRTV = RHI->GetBackBufferRTV())
+	{
+		BackBufferRTV->GetResource(&BackBufferResource);
+	}
+	ID3D11Texture2D* BackBuffer = static_cast<ID3D11Texture2D*>(BackBufferResource);
+
+	D3D11_BOX DestBox{};
+	const bool bCopied = BackBuffer && RHI->GetIdBuffer() && GetBackBufferCopyBox(BackBuffer, DestBox);
+	if (bCopied)
+	{
+		// 캐시 텍스처의 (0,0)부터 뷰포트 영역 크기만큼을 백버퍼/ID 버퍼의 뷰포트 위치로 복사 (FLIP 스왑체인은 프레임마다 내용이 버려짐)
+		const D3D11_BOX SourceBox = { 0, 0, 0, DestBox.right - DestBox.left, DestBox.bottom - DestBox.top, 1 };
+		D3DDeviceContext->CopySubresourceRegion(BackBuffer, 0, DestBox.left, DestBox.top, 0, CachedColorTexture, 0, &SourceBox);
+		D3DDeviceContext->CopySubresourceRegion(RHI->GetIdBuffer(), 0, DestBox.left, DestBox.top, 0, CachedIdTexture, 0, &SourceBox);
+	}
+
+	if (BackBufferResource)
+	{
+		BackBufferResource->Release();
+	}
+	return bCopied;
+}
+
+void FViewport::StoreCachedFrame(D3D11RHI* RHI, uint64 InViewSignature)
+{
+	bCachedFrameValid = false;
+
+	ID3D11Resource* BackBufferResource = nullptr;
+	if (ID3D11RenderTargetView* BackBufferRTV = RHI->GetBackBufferRTV())
+	{
+		BackBufferRTV->GetResource(&BackBufferResource);
+	}
+	ID3D11Texture2D* BackBuffer = static_cast<ID3D11Texture2D*>(BackBufferResource);
+
+	D3D11_BOX SourceBox{};
+	if (BackBuffer && RHI->GetIdBuffer() && EnsureCachedFrameTextures(BackBuffer, RHI->GetIdBuffer()) && GetBackBufferCopyBox(BackBuffer, SourceBox))
+	{
+		D3DDeviceContext->CopySubresourceRegion(CachedColorTexture, 0, 0, 0, 0, BackBuffer, 0, &SourceBox);
+		D3DDeviceContext->CopySubresourceRegion(CachedIdTexture, 0, 0, 0, 0, RHI->GetIdBuffer(), 0, &SourceBox);
+
+		CachedViewSignature = InViewSignature;
+		bCachedFrameValid = true;
+	}
+
+	if (BackBufferResource)
+	{
+		BackBufferResource->Release();
+	}
+}
+
+bool FViewport::GetBackBufferCopyBox(ID3D11Texture2D* BackBuffer, D3D11_BOX& OutBox) const
+{
+	D3D11_TEXTURE2D_DESC Desc{};
+	BackBuffer->GetDesc(&Desc);
+	if (StartX >= Desc.Width || StartY >= Desc.Height || SizeX == 0 || SizeY == 0)
+	{
+		return false;
+	}
+
+	OutBox.left = StartX;
+	OutBox.top = StartY;
+	OutBox.front = 0;
+	OutBox.right = std::min(StartX + SizeX, Desc.Width);
+	OutBox.bottom = std::min(StartY + SizeY, Desc.Height);
+	OutBox.back = 1;
+	return true;
+}
+
+bool FViewport::EnsureCachedFrameTextures(ID3D11Texture2D* BackBuffer, ID3D11Texture2D* IdBuffer)
+{
+	if (CachedColorTexture && CachedIdTexture && CachedTextureSizeX == SizeX && CachedTextureSizeY == SizeY)
+	{
+		return true;
+	}
+
+	ReleaseCachedFrameTextures();
+	if (!D3DDevice || SizeX == 0 || SizeY == 0)
+	{
+		return false;
+	}
+
+	// 원본과 같은 포맷(복사 호환)의 뷰포트 크기 텍스처
+	auto CreateCacheTexture = [this](ID3D11Texture2D* Source, ID3D11Texture2D** OutTexture)
+	{
+		D3D11_TEXTURE2D_DESC Desc{};
+		Source->GetDesc(&Desc);
+		Desc.Width = SizeX;
+		Desc.Height = SizeY;
+		Desc.MipLevels = 1;
+		Desc.ArraySize = 1;
+		Desc.Usage = D3D11_USAGE_DEFAULT;
+		Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+		Desc.CPUAccessFlags = 0;
+		Desc.MiscFlags = 0;
+		return SUCCEEDED(D3DDevice->CreateTexture2D(&Desc, nullptr, OutTexture));
+	};
+
+	if (!CreateCacheTexture(BackBuffer, &CachedColorTexture) || !CreateCacheTexture(IdBuffer, &CachedIdTexture))
+	{
+		ReleaseCachedFrameTextures();
+		return false;
+	}
+
+	CachedTextureSizeX = SizeX;
+	CachedTextureSizeY = SizeY;
+	return true;
+}
+
+void FViewport::ReleaseCachedFrameTextures()
+{
+	if (CachedColorTexture)
+	{
+		CachedColorTexture->Release();
+		CachedColorTexture = nullptr;
+	}
+	if (CachedIdTexture)
+	{
+		CachedIdTexture->Release();
+		CachedIdTexture = nullptr;
+	}
+	CachedTextureSizeX = 0;
+	CachedTextureSizeY = 0;
+	bCachedFrameValid = false;
+}
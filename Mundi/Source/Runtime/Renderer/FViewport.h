@@ -4,6 +4,7 @@
 #include <d3d11.h>
 
 class FViewportClient;
+class D3D11RHI;
 
 /**
  * @brief 뷰포트 클래스 - UE의 FViewport를 모방
@@ -41,6 +42,15 @@ public:
     
     FVector2D GetViewportMousePosition() { return ViewportMousePosition; }
 
+    // 정적 뷰포트 재사용: 마지막 렌더 결과(색/ID 영역)를 보관했다가 뷰 서명이 같으면 렌더 대신 복사
+    // 호버 중인 뷰포트처럼 입력에 반응해야 하는 경우 SViewportWindow가 매 프레임 재사용을 막음
+    void SetFrameCachePresentAllowed(bool bAllowed) { bFrameCachePresentAllowed = bAllowed; }
+    bool IsFrameCachePresentAllowed() const { return bFrameCachePresentAllowed; }
+
+    bool PresentCachedFrame(D3D11RHI* RHI, uint64 InViewSignature);
+    void StoreCachedFrame(D3D11RHI* RHI, uint64 InViewSignature);
+    void InvalidateCachedFrame() { bCachedFrameValid = false; }
+
 
 private:
     // 뷰포트 속성
@@ -56,5 +66,18 @@ private:
     FViewportClient* ViewportClient = nullptr;
 
     FVector2D ViewportMousePosition{};
+
+    // 백버퍼/ID 버퍼 영역 복사 (뷰포트가 백버퍼 밖으로 나간 부분은 잘라냄)
+    bool GetBackBufferCopyBox(ID3D11Texture2D* BackBuffer, D3D11_BOX& OutBox) const;
+    bool EnsureCachedFrameTextures(ID3D11Texture2D* BackBuffer, ID3D11Texture2D* IdBuffer);
+    void ReleaseCachedFrameTextures();
+
+    ID3D11Texture2D* CachedColorTexture = nullptr;
+    ID3D11Texture2D* CachedIdTexture = nullptr;
+    uint32 CachedTextureSizeX = 0;
+    uint32 CachedTextureSizeY = 0;
+    uint64 CachedViewSignature = 0;
+    bool bCachedFrameValid = false;
+    bool bFrameCachePresentAllowed = false;
 };
 
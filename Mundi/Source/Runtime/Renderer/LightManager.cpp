@@ -5,9 +5,66 @@
 #include "SpotLightComponent.h"
 #include "PointLightComponent.h"
 #include "D3D11RHI.h"
+#include "SceneView.h"
+#include "RenderManager.h"
 
 #define NUM_POINT_LIGHT_MAX 256
 #define NUM_SPOT_LIGHT_MAX 256
+
+namespace
+{
+	// 라이트 영향 구의 화면 높이 대비 지름 비율 (0~1, 카메라가 영향 범위 안이면 1)
+	float ComputeLightScreenFraction(const FShadowRenderRequest& Request, const FSceneView* View)
+	{
+		if (!View || Request.Radius <= 0.0f)
+		{
+			return 1.0f;
+		}
+
+		// 투영 행렬 [1][1] = 원근: 1 / tan(FOV/2), 직교: 2 / 높이
+		const float ProjectionScaleY = View->ProjectionMatrix.M[1][1];
+		if (View->ProjectionMode == ECameraProjectionMode::Perspective)
+		{
+			const float Distance = (Request.WorldLocation - View->ViewLocation).Size();
+			if (Distance <= Request.Radius)
+			{
+				return 1.0f;
+			}
+			return FMath::Clamp(Request.Radius * ProjectionScaleY / Distance, 0.0f, 1.0f);
+		}
+		return FMath::Clamp(Request.Radius * ProjectionScaleY, 0.0f, 1.0f);
+	}
+
+	// 요청 해상도를 화면 크기 비율만큼 줄인 2의 거듭제곱 크기 (MinSize ~ MaxSize)
+	uint32 ComputeShadowLODSize(const FShadowRenderRequest& Request, const FSceneView* View, uint32 MaxSize, uint32 MinSize, float& OutScreenFraction)
+	{
+		const uint32 RequestedSize = FMath::Clamp(FShadowAtlasQuadTree::RoundUpToPowerOfTwo(Request.Size), MinSize, MaxSize);
+		OutScreenFraction = ComputeLightScreenFraction(Request, View);
+
+		const uint32 LODSize = FShadowAtlasQuadTree::RoundUpToPowerOfTwo(static_cast<uint32>(RequestedSize * OutScreenFraction));
+		return FMath::Clamp(LODSize, MinSize, RequestedSize);
+	}
+
+	// 같은 프레임의 여러 뷰 요청은 최대값으로 합치고, 새 프레임이면 직전 요구량을 보관
+	void RequestAtlasSize(FShadowAtlasAllocation& Allocation, uint64 FrameNumber, uint32 DesiredSize, float Priority)
+	{
+		if (Allocation.LastRequestedFrame != FrameNumber)
+		{
+			Allocation.PrevDesiredSize = (Allocation.LastRequestedFrame + 1 == FrameNumber) ? Allocation.DesiredSize : 0;
+			Allocation.DesiredSize = 0;
+			Allocation.Priority = 0.0f;
+			Allocation.LastRequestedFrame = FrameNumber;
+		}
+		Allocation.DesiredSize = FMath::Max(Allocation.DesiredSize, DesiredSize);
+		Allocation.Priority = FMath::Max(Allocation.Priority, Priority);
+	}
+
+	uint64 GetRenderFrameNumber()
+	{
+		URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
+		return Renderer ? Renderer->GetFrameNumber() : 0;
+	}
+}
 FLightManager::~FLightManager()
 {
 	Release();
@@ -174,6 +231,11 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice)
 		}
 	}
 
+	// --- 4. 아틀라스 영역 할당기 ---
+	if (!Atlas2DAllocator.IsInitialized())
+	{
+		InitializeAtlasAllocators(RHIDevice);
+	}
 }
 
 void FLightManager::Release()
@@ -222,15 +284,15 @@ void FLightManager::Release()
 	if (ShadowAtlasTextureCube) { ShadowAtlasTextureCube->Release(); ShadowAtlasTextureCube = nullptr; }
 	if (ShadowDepthDSVCube) { ShadowDepthDSVCube->Release(); ShadowDepthDSVCube = nullptr; }
 	if (ShadowDepthTextureCube) { ShadowDepthTextureCube->Release(); ShadowDepthTextureCube = nullptr; }
+
+	InvalidateShadowCache();
+	ReleaseAtlasAllocations();
 }
 
 void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 {
-	// 1. 아무것도 변경되지 않았으면 모든 작업을 건너뜀
-	if (!bHaveToUpdate && !bPointLightDirty && !bSpotLightDirty && !bShadowDataDirty)
-	{
-		return;
-	}
+	// 1. 구조화 버퍼는 변경이 있을 때만 다시 만들지만, 상수 버퍼와 SRV 바인딩은 뷰마다 수행
+	//    (다른 뷰의 섀도우 패스가 t8/t9를 해제하고, 디렉셔널 캐스케이드는 뷰마다 다름)
 
 	// 2. 초기화 확인
 	if (!PointLightBuffer || !SpotLightBuffer)
@@ -277,7 +339,9 @@ void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
 				// 섀도우 데이터 (큐브맵 인덱스) 병합
 				if (Light->IsCastShadows() && ShadowDataCacheCube.Contains(Light))
 				{
-					Info.ShadowArrayIndex = ShadowDataCacheCube[Light];
+					const FShadowCubeSlot& Slot = ShadowDataCacheCube[Light];
+					Info.ShadowArrayIndex = Slot.SliceIndex;
+					Info.ShadowTile = Slot.ShadowTile;
 					Info.bCastShadows = (Info.ShadowArrayIndex != -1);
 				}
 				PointLightInfoList.Add(Info);
@@ -361,20 +425,59 @@ void FLightManager::SetShadowMapData(ULightComponent* Light, int32 SubViewIndex,
 		Cascades.SetNum(SubViewIndex + 1);
 	}
 
+	if (!ShouldApplyShadowData(memcmp(&Cascades[SubViewIndex], &Data, sizeof(FShadowMapData)) == 0))
+	{
+		return;
+	}
+
 	// 데이터 저장
 	Cascades[SubViewIndex] = Data;
 
-	bShadowDataDirty = true;
+	// 디렉셔널 캐스케이드는 상수 버퍼에만 들어가므로 뷰마다 바뀌어도 구조화 버퍼는 다시 만들지 않음
+	if (!Cast<UDirectionalLightComponent>(Light))
+	{
+		bShadowDataDirty = true;
+	}
 	bHaveToUpdate = true;
 }
 
+bool FLightManager::ShouldApplyShadowData(bool bSameAsCached)
+{
+	// 프레임의 첫 기록은 이전처럼 라이트 버퍼 전체를 갱신하고 (알림 없이 바뀐 라이트 값 반영),
+	// 같은 프레임의 다른 뷰(쿼드 뷰)가 같은 값을 다시 기록하면 버퍼를 다시 만들지 않음
+	const uint64 FrameNumber = GetRenderFrameNumber();
+	if (ShadowDataFrameNumber != FrameNumber)
+	{
+		ShadowDataFrameNumber = FrameNumber;
+		bShadowDataDirty = true;
+		bHaveToUpdate = true;
+		return true;
+	}
+	return !bSameAsCached;
+}
+
 void FLightManager::SetShadowCubeMapData(ULightComponent* Light, int32 SliceIndex)
 {
 	if (!Light) return;
-	if (SliceIndex < 0 || CubeArrayCount <= SliceIndex) return;
 
-	// TMap에 슬라이스 인덱스 저장
-	ShadowDataCacheCube[Light] = SliceIndex;
+	// 할당 실패(-1)도 기록해야 다른 라이트가 이어받은 이전 슬라이스를 샘플링하지 않음
+	FShadowCubeSlot Slot;
+	if (0 <= SliceIndex && SliceIndex < static_cast<int32>(CubeArrayCount))
+	{
+		Slot.SliceIndex = SliceIndex;
+		if (const FShadowAtlasAllocation* Allocation = AtlasAllocationsCube.Find(Light))
+		{
+			Slot.ShadowTile = GetCubeShadowTile(*Allocation);
+		}
+	}
+	const FShadowCubeSlot* CachedSlot = ShadowDataCacheCube.Find(Light);
+	const bool bSameAsCached = CachedSlot && CachedSlot->SliceIndex == Slot.SliceIndex && CachedSlot->ShadowTile == Slot.ShadowTile;
+	if (!ShouldApplyShadowData(bSameAsCached))
+	{
+		return;
+	}
+
+	ShadowDataCacheCube[Light] = Slot;
 
 	bShadowDataDirty = true;
 	bHaveToUpdate = true;
@@ -402,6 +505,8 @@ ID3D11ShaderResourceView* FLightManager::GetShadowCubeFaceSRV(UINT SliceIndex, U
 
 void FLightManager::ClearAllRenderTargetView(D3D11RHI* RHIDevice)
 {
+	InvalidateShadowCache();
+
 	float ClearColor[4] = { 1.0f, 1.0f, 0.0f, 0.0f }; // R=depth, G=depth^2 초기값
 	
 	ID3D11RenderTargetView* AtlasRTV2D = GetShadowAtlasRTV2D();
@@ -460,9 +565,9 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 		return false;
 	}
 
-	// 2. 해당 라이트에 대한 캐시 데이터(int32) 찾기
-	const int32* FoundIndex = ShadowDataCacheCube.Find(Light);
-	if (!FoundIndex)
+	// 2. 해당 라이트에 대한 캐시 데이터 찾기
+	const FShadowCubeSlot* FoundSlot = ShadowDataCacheCube.Find(Light);
+	if (!FoundSlot)
 	{
 		// 이 라이트에 대한 캐시 데이터가 없음
 		OutSliceIndex = -1;
@@ -470,115 +575,470 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 	}
 
 	// 3. 데이터 복사 및 성공 반환
-	OutSliceIndex = *FoundIndex;
+	OutSliceIndex = FoundSlot->SliceIndex;
 	return true;
 }
 
 // 단순한 아틀라스 로직
-void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D)
+bool FShadowCacheEntry::Matches(const FShadowRenderRequest& Request, uint64 InCasterHash) const
+{
+	return LightOwner == Request.LightOwner
+		&& SubViewIndex == Request.SubViewIndex
+		&& SliceIndex == Request.AssignedSliceIndex
+		&& Size == Request.Size
+		&& AtlasOffset == Request.AtlasViewportOffset
+		&& CasterHash == InCasterHash
+		&& Radius == Request.Radius
+		&& WorldLocation == Request.WorldLocation
+		&& ViewMatrix == Request.ViewMatrix
+		&& ProjectionMatrix == Request.ProjectionMatrix;
+}
+
+bool FShadowCacheEntry::Overlaps(const FShadowRenderRequest& Request) const
+{
+	// 2D 아틀라스와 큐브 아틀라스는 서로 겹치지 않음, 큐브는 같은 슬라이스의 같은 면 안에서 타일 영역 비교
+	if (SliceIndex != Request.AssignedSliceIndex)
+	{
+		return false;
+	}
+	if (SliceIndex >= 0 && SubViewIndex != Request.SubViewIndex)
+	{
+		return false;
+	}
+
+	const float RequestSize = static_cast<float>(Request.Size);
+	const float EntrySize = static_cast<float>(Size);
+	return AtlasOffset.X < Request.AtlasViewportOffset.X + RequestSize && Request.AtlasViewportOffset.X < AtlasOffset.X + EntrySize
+		&& AtlasOffset.Y < Request.AtlasViewportOffset.Y + RequestSize && Request.AtlasViewportOffset.Y < AtlasOffset.Y + EntrySize;
+}
+
+void FLightManager::SetShadowCacheEnabled(bool bEnabled)
 {
-	// 요청 정렬 (가장 큰 것부터)
-	InOutRequests2D.Sort(std::greater<FShadowRenderRequest>());
+	bShadowCacheEnabled = bEnabled;
+	InvalidateShadowCache();
+}
 
-	// 동적 패킹(Shelf Algorithm)
-	uint32 CurrentAtlasX = 0;
-	uint32 CurrentAtlasY = 0;
-	uint32 CurrentShelfMaxHeight = 0;
+bool FLightManager::IsShadowViewCached(const FShadowRenderRequest& Request, uint64 CasterHash) const
+{
+	if (!bShadowCacheEnabled || Request.Size == 0)
+	{
+		return false;
+	}
 
-	for (FShadowRenderRequest& Request : InOutRequests2D)
+	for (const FShadowCacheEntry& Entry : ShadowViewCache)
 	{
-		if (CurrentAtlasX + Request.Size > ShadowAtlasSize2D)
+		if (Entry.Matches(Request, CasterHash))
 		{
-			CurrentAtlasY += CurrentShelfMaxHeight;
-			CurrentAtlasX = 0;
-			CurrentShelfMaxHeight = 0;
+			return true;
 		}
-		if (CurrentAtlasY + Request.Size > ShadowAtlasSize2D)
+	}
+	return false;
+}
+
+void FLightManager::StoreShadowView(const FShadowRenderRequest& Request, uint64 CasterHash)
+{
+	// 새로 그린 영역과 겹치는 기록은 내용이 덮어써졌으므로 제거
+	for (int32 i = ShadowViewCache.Num() - 1; i >= 0; --i)
+	{
+		if (ShadowViewCache[i].Overlaps(Request))
 		{
-			Request.Size = 0; // 꽉 참 (렌더링 실패)
-			UE_LOG("그림자 맵 아틀라스가 가득차서 더 이상 그림자를 추가할 수 없습니다.");
-			continue;
+			ShadowViewCache.erase(ShadowViewCache.begin() + i);
 		}
+	}
 
-		Request.AtlasViewportOffset = FVector2D((float)CurrentAtlasX, (float)CurrentAtlasY);
+	if (!bShadowCacheEnabled || Request.Size == 0)
+	{
+		return;
+	}
 
-		// Pass 2 데이터 (UV) 저장
-		Request.AtlasScaleOffset = FVector4(
-			Request.Size / (float)ShadowAtlasSize2D,    // ScaleX
-			Request.Size / (float)ShadowAtlasSize2D,    // ScaleY
-			CurrentAtlasX / (float)ShadowAtlasSize2D,   // OffsetX
-			CurrentAtlasY / (float)ShadowAtlasSize2D    // OffsetY
-		);
+	FShadowCacheEntry Entry;
+	Entry.LightOwner = Request.LightOwner;
+	Entry.SubViewIndex = Request.SubViewIndex;
+	Entry.SliceIndex = Request.AssignedSliceIndex;
+	Entry.AtlasOffset = Request.AtlasViewportOffset;
+	Entry.Size = Request.Size;
+	Entry.ViewMatrix = Request.ViewMatrix;
+	Entry.ProjectionMatrix = Request.ProjectionMatrix;
+	Entry.WorldLocation = Request.WorldLocation;
+	Entry.Radius = Request.Radius;
+	Entry.CasterHash = CasterHash;
+	ShadowViewCache.Add(Entry);
+}
 
-		CurrentAtlasX += Request.Size;
-		CurrentShelfMaxHeight = FMath::Max(CurrentShelfMaxHeight, Request.Size);
+void FLightManager::RemoveShadowViewCache(ULightComponent* Light)
+{
+	for (int32 i = ShadowViewCache.Num() - 1; i >= 0; --i)
+	{
+		if (ShadowViewCache[i].LightOwner == Light)
+		{
+			ShadowViewCache.erase(ShadowViewCache.begin() + i);
+		}
 	}
 }
 
-void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
+void FLightManager::InitializeAtlasAllocators(D3D11RHI* RHIDevice)
 {
-	// 슬라이스 개수가 유효하지 않으면 모든 요청 실패 처리
-	if (CubeArrayCount == 0)
+	Atlas2DAllocator.Initialize(ShadowAtlasSize2D, MinShadowTileSize2D);
+
+	// 큐브 면의 일부 타일만 지우려면 ClearView가 필요하므로 미지원 시 면 단위로만 할당
+	CubeTileLevels = RHIDevice->SupportsClearRenderTargetRect() ? 2 : 0;
+	CubeSliceAllocators.clear();
+	CubeSliceAllocators.SetNum(CubeArrayCount);
+	for (FShadowAtlasQuadTree& SliceAllocator : CubeSliceAllocators)
 	{
-		for (FShadowRenderRequest& Request : InOutRequestsCube)
+		SliceAllocator.Initialize(AtlasSizeCube, AtlasSizeCube >> CubeTileLevels);
+	}
+
+	AtlasAllocations2D.clear();
+	AtlasAllocationsCube.clear();
+}
+
+void FLightManager::ReleaseAtlasAllocations()
+{
+	Atlas2DAllocator.Reset();
+	for (FShadowAtlasQuadTree& SliceAllocator : CubeSliceAllocators)
+	{
+		SliceAllocator.Reset();
+	}
+	AtlasAllocations2D.clear();
+	AtlasAllocationsCube.clear();
+}
+
+void FLightManager::EvictStaleAtlasAllocations(uint64 FrameNumber)
+{
+	// 직전 프레임에도 요청되지 않은 라이트(꺼짐, 섀도우 비활성, 캐스케이드 수 감소 등)의 영역 반납
+	for (auto It = AtlasAllocations2D.begin(); It != AtlasAllocations2D.end();)
+	{
+		bool bAnyRequested = false;
+		for (FShadowAtlasAllocation& Allocation : It->second)
 		{
-			Request.Size = 0; // 할당 불가
-			Request.AssignedSliceIndex = -1; // 할당 인덱스를 -1로 설정
+			if (Allocation.LastRequestedFrame + 1 < FrameNumber)
+			{
+				FreeAtlasAllocation(Allocation);
+			}
+			else
+			{
+				bAnyRequested = true;
+			}
 		}
-		return;
+		It = bAnyRequested ? std::next(It) : AtlasAllocations2D.erase(It);
+	}
+
+	for (auto It = AtlasAllocationsCube.begin(); It != AtlasAllocationsCube.end();)
+	{
+		if (It->second.LastRequestedFrame + 1 < FrameNumber)
+		{
+			FreeAtlasAllocation(It->second);
+			It = AtlasAllocationsCube.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+}
+
+void FLightManager::RemoveAtlasAllocations(ULightComponent* Light)
+{
+	if (TArray<FShadowAtlasAllocation>* Allocations = AtlasAllocations2D.Find(Light))
+	{
+		for (FShadowAtlasAllocation& Allocation : *Allocations)
+		{
+			FreeAtlasAllocation(Allocation);
+		}
+		AtlasAllocations2D.Remove(Light);
 	}
+	if (FShadowAtlasAllocation* Allocation = AtlasAllocationsCube.Find(Light))
+	{
+		FreeAtlasAllocation(*Allocation);
+		AtlasAllocationsCube.Remove(Light);
+	}
+}
 
-	int AllocatorCube_CurrentSliceIndex = 0;
+void FLightManager::FreeAtlasAllocation(FShadowAtlasAllocation& Allocation)
+{
+	if (Allocation.SliceIndex >= 0)
+	{
+		if (Allocation.SliceIndex < CubeSliceAllocators.Num())
+		{
+			CubeSliceAllocators[Allocation.SliceIndex].Free(Allocation.Region);
+		}
+	}
+	else
+	{
+		Atlas2DAllocator.Free(Allocation.Region);
+	}
+	Allocation.Region = FShadowAtlasQuadTree::FRegion();
+	Allocation.SliceIndex = -1;
+}
 
-	ULightComponent* CurrentLightOwner = nullptr; // 현재 처리 중인 라이트 추적용
-	bool bCurrentLightFailed = false; // 현재 라이트가 슬라이스 할당에 실패했는지 여부
-	// 로컬 변수 대신 FLightManager의 멤버 변수 AllocatorCube_CurrentSliceIndex 사용
+bool FLightManager::TryAllocateAtlasRegion(FShadowAtlasAllocation& Allocation, uint32 Size, bool bCube)
+{
+	if (!bCube)
+	{
+		Allocation.SliceIndex = -1;
+		return Atlas2DAllocator.Allocate(Size, Allocation.Region);
+	}
 
-	// 요청 리스트 순회 (각 라이트당 6개의 요청이 들어옴)
-	for (FShadowRenderRequest& Request : InOutRequestsCube)
+	// 앞 슬라이스부터 채워 뒤쪽에 통째로 빈 슬라이스(면 전체 해상도용)를 남김
+	for (int32 SliceIndex = 0; SliceIndex < CubeSliceAllocators.Num(); ++SliceIndex)
 	{
-		// 유효하지 않은 요청은 건너뜀 (예: Size가 0인 경우)
-		if (Request.Size == 0)
+		if (CubeSliceAllocators[SliceIndex].Allocate(Size, Allocation.Region))
 		{
-			Request.AssignedSliceIndex = -1; // 실패 상태 명시
-			continue;
+			Allocation.SliceIndex = SliceIndex;
+			return true;
 		}
+	}
+	Allocation.SliceIndex = -1;
+	return false;
+}
+
+uint32 FLightManager::GetCubeShadowTile(const FShadowAtlasAllocation& Allocation) const
+{
+	const FShadowAtlasQuadTree::FRegion& Region = Allocation.Region;
+	if (!Region.IsValid() || Region.Size >= AtlasSizeCube)
+	{
+		return 0;
+	}
+
+	uint32 Level = 0;
+	while ((Region.Size << Level) < AtlasSizeCube)
+	{
+		++Level;
+	}
+	const uint32 TilesPerAxis = 1u << Level;
+	const uint32 TileIndex = (Region.Y / Region.Size) * TilesPerAxis + (Region.X / Region.Size);
+	return (Level << 16) | TileIndex;
+}
 
-		// 라이트가 변경되었는지 확인
-		if (Request.LightOwner != CurrentLightOwner)
+void FLightManager::AllocateAtlasWorkItems(TArray<FShadowAtlasAllocation*>& WorkItems, bool bCube)
+{
+	// 우선순위가 높은 것부터 (같으면 큰 요청부터)
+	WorkItems.Sort([](const FShadowAtlasAllocation* A, const FShadowAtlasAllocation* B)
+	{
+		return A->Priority != B->Priority ? A->Priority > B->Priority : A->DesiredSize > B->DesiredSize;
+	});
+
+	const uint32 MinSize = bCube ? (AtlasSizeCube >> CubeTileLevels) : Atlas2DAllocator.GetMinTileSize();
+	for (int32 i = 0; i < WorkItems.Num(); ++i)
+	{
+		FShadowAtlasAllocation& Allocation = *WorkItems[i];
+		const uint32 TargetSize = Allocation.bFixedSize ? Allocation.DesiredSize : FMath::Max(Allocation.DesiredSize, Allocation.PrevDesiredSize);
+
+		if (Allocation.IsAllocated() && Allocation.bFixedSize)
 		{
-			// 첫 라이트가 아니면서 이전 라이트가 성공적으로 할당되었을 경우, 다음 슬라이스로 이동
-			if (CurrentLightOwner != nullptr && !bCurrentLightFailed)
+			if (Allocation.Region.Size == TargetSize)
 			{
-				AllocatorCube_CurrentSliceIndex++; // 다음 슬라이스 인덱스로 증가 (멤버 변수 사용)
+				continue;
+			}
+			FreeAtlasAllocation(Allocation);
+		}
+		else if (Allocation.IsAllocated())
+		{
+			// 한 단계 작은 요구까지는 그대로 유지 (카메라 이동마다 재할당/재렌더하지 않도록)
+			if (TargetSize <= Allocation.Region.Size && Allocation.Region.Size <= TargetSize * 2)
+			{
+				continue;
 			}
 
-			CurrentLightOwner = Request.LightOwner; // 현재 라이트 갱신
+			if (Allocation.Region.Size < TargetSize)
+			{
+				// 확대: 새 영역을 먼저 잡고 성공했을 때만 옮김 (실패하면 기존 해상도 유지)
+				FShadowAtlasAllocation Grown = Allocation;
+				if (TryAllocateAtlasRegion(Grown, TargetSize, bCube))
+				{
+					FreeAtlasAllocation(Allocation);
+					Allocation.Region = Grown.Region;
+					Allocation.SliceIndex = Grown.SliceIndex;
+				}
+				continue;
+			}
+
+			// 축소: 반납 후 새 크기로 다시 할당
+			FreeAtlasAllocation(Allocation);
+		}
 
-			// 새 라이트가 슬라이스 개수 제한을 초과하는지 확인
-			if (AllocatorCube_CurrentSliceIndex >= CubeArrayCount)
+		// 예산이 모자라면 해상도를 절반씩 낮추고, 최소 크기도 안 되면 우선순위가 가장 낮은 영역부터 축출
+		// 축출된 항목은 뒤에서 다시 처리되므로 낮은 해상도로라도 재배치됨 (점진적 재패킹)
+		int32 VictimIndex = WorkItems.Num() - 1;
+		while (true)
+		{
+			bool bAllocated = false;
+			const uint32 SmallestSize = Allocation.bFixedSize ? TargetSize : MinSize;
+			for (uint32 Size = TargetSize; Size >= SmallestSize && !bAllocated; Size /= 2)
 			{
-				bCurrentLightFailed = true; // 이 라이트는 할당 불가
+				bAllocated = TryAllocateAtlasRegion(Allocation, Size, bCube);
 			}
-			else
+			if (bAllocated)
+			{
+				break;
+			}
+
+			while (VictimIndex > i && !WorkItems[VictimIndex]->IsAllocated())
+			{
+				--VictimIndex;
+			}
+			if (VictimIndex <= i)
 			{
-				bCurrentLightFailed = false; // 이 라이트는 할당 가능
+				break;
 			}
+			FreeAtlasAllocation(*WorkItems[VictimIndex]);
+		}
+	}
+}
+
+uint32 FLightManager::GetDirectionalShadowTileSize(uint32 RequestedSize) const
+{
+	// 8개 캐스케이드까지 항상 들어가도록 아틀라스의 1/4 변(= 1/16 면적)로 제한
+	const uint32 MaxTileSize = FMath::Max(ShadowAtlasSize2D / 4, MinShadowTileSize2D);
+	return FMath::Clamp(FShadowAtlasQuadTree::RoundUpToPowerOfTwo(RequestedSize), MinShadowTileSize2D, MaxTileSize);
+}
+
+void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D, const FSceneView* View)
+{
+	const uint64 FrameNumber = GetRenderFrameNumber();
+	EvictStaleAtlasAllocations(FrameNumber);
+
+	if (!Atlas2DAllocator.IsInitialized())
+	{
+		for (FShadowRenderRequest& Request : InOutRequests2D)
+		{
+			Request.Size = 0;
 		}
+		return;
+	}
 
-		// 현재 라이트가 할당 실패 상태인지 확인
-		if (bCurrentLightFailed)
+	// 서브뷰 배열을 먼저 늘려 두어야 아래에서 잡은 포인터가 유지됨
+	for (const FShadowRenderRequest& Request : InOutRequests2D)
+	{
+		TArray<FShadowAtlasAllocation>& Allocations = AtlasAllocations2D[Request.LightOwner];
+		if (Allocations.Num() <= Request.SubViewIndex)
 		{
-			Request.Size = 0; // 할당 실패 처리
-			Request.AssignedSliceIndex = -1; // 할당 인덱스를 -1로 설정
+			Allocations.SetNum(Request.SubViewIndex + 1);
+		}
+	}
+
+	TArray<FShadowAtlasAllocation*> RequestAllocations;
+	TArray<FShadowAtlasAllocation*> WorkItems;
+	RequestAllocations.SetNum(InOutRequests2D.Num(), nullptr);
+	for (int32 i = 0; i < InOutRequests2D.Num(); ++i)
+	{
+		const FShadowRenderRequest& Request = InOutRequests2D[i];
+		if (Request.Size == 0)
+		{
+			continue;
+		}
+
+		FShadowAtlasAllocation& Allocation = AtlasAllocations2D[Request.LightOwner][Request.SubViewIndex];
+		float Priority = 0.0f;
+		uint32 DesiredSize = 0;
+		if (Request.Radius < 0.0f)
+		{
+			// Directional (CSM) 은 화면 전체를 덮으므로 요청 해상도 그대로, 가까운 캐스케이드부터
+			// 피팅이 이 크기로 텍셀 스냅을 했으므로 해상도를 낮추지 않음 (안 들어가면 낮은 우선순위 영역을 축출)
+			DesiredSize = GetDirectionalShadowTileSize(Request.Size);
+			Priority = 2.0f + 1.0f / (1.0f + Request.SubViewIndex);
+			Allocation.bFixedSize = true;
 		}
 		else
 		{
-			// --- [핵심 수정] ---
-			// 성공: 현재 슬라이스 인덱스를 'AssignedSliceIndex' 멤버에 기록
-			Request.AssignedSliceIndex = AllocatorCube_CurrentSliceIndex;
-			// OriginalSubViewIndex는 건드리지 않음
+			DesiredSize = ComputeShadowLODSize(Request, View, ShadowAtlasSize2D, MinShadowTileSize2D, Priority);
 		}
+
+		RequestAtlasSize(Allocation, FrameNumber, DesiredSize, Priority);
+		RequestAllocations[i] = &Allocation;
+		WorkItems.Add(&Allocation);
+	}
+
+	AllocateAtlasWorkItems(WorkItems, false);
+
+	int32 FailedCount = 0;
+	const float AtlasSize = static_cast<float>(ShadowAtlasSize2D);
+	for (int32 i = 0; i < InOutRequests2D.Num(); ++i)
+	{
+		FShadowRenderRequest& Request = InOutRequests2D[i];
+		const FShadowAtlasAllocation* Allocation = RequestAllocations[i];
+		if (!Allocation || !Allocation->IsAllocated())
+		{
+			FailedCount += (Request.Size > 0) ? 1 : 0;
+			Request.Size = 0; // 꽉 참 (렌더링 실패)
+			continue;
+		}
+
+		const FShadowAtlasQuadTree::FRegion& Region = Allocation->Region;
+		Request.Size = Region.Size;
+		Request.AtlasViewportOffset = FVector2D(static_cast<float>(Region.X), static_cast<float>(Region.Y));
+
+		// Pass 2 데이터 (UV) 저장
+		Request.AtlasScaleOffset = FVector4(
+			Region.Size / AtlasSize,    // ScaleX
+			Region.Size / AtlasSize,    // ScaleY
+			Region.X / AtlasSize,       // OffsetX
+			Region.Y / AtlasSize        // OffsetY
+		);
+	}
+
+	if (FailedCount > 0)
+	{
+		UE_LOG("그림자 맵 아틀라스가 가득차서 그림자 %d개를 추가할 수 없습니다.", FailedCount);
+	}
+}
+
+void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube, const FSceneView* View)
+{
+	const uint64 FrameNumber = GetRenderFrameNumber();
+	EvictStaleAtlasAllocations(FrameNumber);
+
+	// 라이트당 6개의 면 요청이 들어오지만 할당은 라이트 단위 (6면이 같은 슬라이스의 같은 타일 위치 사용)
+	// TMap 값은 삽입 후에도 주소가 유지되므로 포인터로 보관
+	TArray<FShadowAtlasAllocation*> RequestAllocations;
+	TArray<FShadowAtlasAllocation*> WorkItems;
+	RequestAllocations.SetNum(InOutRequestsCube.Num(), nullptr);
+	if (!CubeSliceAllocators.IsEmpty())
+	{
+		const uint32 MinTileSize = AtlasSizeCube >> CubeTileLevels;
+		for (int32 i = 0; i < InOutRequestsCube.Num(); ++i)
+		{
+			const FShadowRenderRequest& Request = InOutRequestsCube[i];
+			if (Request.Size == 0)
+			{
+				continue;
+			}
+
+			FShadowAtlasAllocation& Allocation = AtlasAllocationsCube[Request.LightOwner];
+			RequestAllocations[i] = &Allocation;
+			if (WorkItems.Contains(&Allocation))
+			{
+				continue;
+			}
+
+			float Priority = 0.0f;
+			const uint32 DesiredSize = ComputeShadowLODSize(Request, View, AtlasSizeCube, MinTileSize, Priority);
+			RequestAtlasSize(Allocation, FrameNumber, DesiredSize, Priority);
+			WorkItems.Add(&Allocation);
+		}
+	}
+
+	AllocateAtlasWorkItems(WorkItems, true);
+
+	const float AtlasSize = static_cast<float>(AtlasSizeCube);
+	for (int32 i = 0; i < InOutRequestsCube.Num(); ++i)
+	{
+		FShadowRenderRequest& Request = InOutRequestsCube[i];
+		const FShadowAtlasAllocation* Allocation = RequestAllocations[i];
+		if (!Allocation || !Allocation->IsAllocated())
+		{
+			Request.Size = 0; // 할당 실패 처리
+			Request.AssignedSliceIndex = -1; // 할당 인덱스를 -1로 설정
+			continue;
+		}
+
+		// 면 안의 타일 위치 (면 전체면 오프셋 0, 크기 AtlasSizeCube)
+		const FShadowAtlasQuadTree::FRegion& Region = Allocation->Region;
+		Request.AssignedSliceIndex = Allocation->SliceIndex;
+		Request.Size = Region.Size;
+		Request.AtlasViewportOffset = FVector2D(static_cast<float>(Region.X), static_cast<float>(Region.Y));
+		Request.AtlasScaleOffset = FVector4(Region.Size / AtlasSize, Region.Size / AtlasSize, Region.X / AtlasSize, Region.Y / AtlasSize);
 	}
 }
 
@@ -600,6 +1060,8 @@ void FLightManager::ClearAllLightList()
 
 	ShadowDataCache2D.clear();
 	ShadowDataCacheCube.clear();
+	InvalidateShadowCache();
+	ReleaseAtlasAllocations();
 }
 
 template<typename T>
@@ -684,6 +1146,8 @@ void FLightManager::DeRegisterLight<UDirectionalLightComponent>(UDirectionalLigh
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	RemoveShadowViewCache(LightComponent);
+	RemoveAtlasAllocations(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent* LightComponent)
@@ -700,6 +1164,8 @@ void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent*
 	bHaveToUpdate = true;
 
 	ShadowDataCacheCube.Remove(LightComponent);
+	RemoveShadowViewCache(LightComponent);
+	RemoveAtlasAllocations(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* LightComponent)
@@ -715,6 +1181,8 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	RemoveShadowViewCache(LightComponent);
+	RemoveAtlasAllocations(LightComponent);
 }
 
 
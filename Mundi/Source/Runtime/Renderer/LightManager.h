@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "ShadowAtlasAllocator.h"
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -7,6 +8,7 @@ class UPointLightComponent;
 class USpotLightComponent;
 class ULightComponent;
 class D3D11RHI;
+class FSceneView;
 
 enum class ELightType
 {
@@ -57,6 +59,47 @@ struct FShadowRenderRequest
     }
 };
 
+// 이전 프레임에 그린 섀도우 뷰 기록 (아틀라스 영역 재사용 판정용)
+struct FShadowCacheEntry
+{
+    ULightComponent* LightOwner = nullptr;
+    int32 SubViewIndex = 0;
+    int32 SliceIndex = -1; // 큐브 슬라이스 (2D 아틀라스는 -1)
+    FVector2D AtlasOffset;
+    uint32 Size = 0;
+    FMatrix ViewMatrix;
+    FMatrix ProjectionMatrix;
+    FVector WorldLocation;
+    float Radius = 0.0f;
+    uint64 CasterHash = 0; // 뷰에 들어온 캐스터들의 메시/트랜스폼 해시
+
+    // 라이트 뷰, 아틀라스 위치, 캐스터가 모두 같으면 이전 내용이 그대로 유효
+    bool Matches(const FShadowRenderRequest& Request, uint64 InCasterHash) const;
+    // 같은 아틀라스 영역(2D) 또는 같은 큐브 면의 같은 타일 영역을 덮어쓰는지
+    bool Overlaps(const FShadowRenderRequest& Request) const;
+};
+
+// 프레임 사이 유지되는 라이트별 아틀라스 영역 (2D는 서브뷰마다, 큐브는 라이트마다 하나)
+struct FShadowAtlasAllocation
+{
+    FShadowAtlasQuadTree::FRegion Region;
+    int32 SliceIndex = -1;          // 큐브 아틀라스 슬라이스 (2D는 -1)
+    uint64 LastRequestedFrame = 0;
+    uint32 DesiredSize = 0;         // 이번 프레임 뷰들이 요구한 최대 해상도
+    uint32 PrevDesiredSize = 0;     // 직전 프레임 요구 해상도 (뷰포트마다 크기가 달라도 매 뷰 재할당하지 않도록)
+    float Priority = 0.0f;          // 아틀라스가 모자랄 때 높은 쪽부터 할당, 낮은 쪽부터 축출
+    bool bFixedSize = false;        // 해상도를 낮추지 않음 (CSM: 캐스케이드 피팅이 이 크기의 텍셀 격자에 스냅함)
+
+    bool IsAllocated() const { return Region.IsValid(); }
+};
+
+// 큐브 아틀라스 배치 결과 (셰이더로 전달)
+struct FShadowCubeSlot
+{
+    int32 SliceIndex = -1;
+    uint32 ShadowTile = 0;          // 상위 16비트: 면 분할 레벨, 하위 16비트: 타일 번호 (0=면 전체)
+};
+
 // -----------------------------------------------------------------------------
 // 2. Pass 2 (GPU) 셰이더용 구조체
 // -----------------------------------------------------------------------------
@@ -101,7 +144,7 @@ struct FPointLightInfo
     float ShadowBias;        // 4 bytes
     float ShadowSlopeBias;   // 4 bytes
     float ShadowSharpen;     // 4 bytes
-    float Padding;           // 4 bytes
+    uint32 ShadowTile;       // 4 bytes (큐브 면 안의 저해상도 타일, 0=면 전체)
     // Total: 64 bytes
 };
 
@@ -158,8 +201,20 @@ public:
 
 	void ClearAllRenderTargetView(D3D11RHI* RHIDevice);
 
-    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
-    void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
+	// --- 정적 섀도우 캐시 (라이트와 캐스터가 그대로면 아틀라스 영역 재사용) ---
+	bool IsShadowCacheEnabled() const { return bShadowCacheEnabled; }
+	void SetShadowCacheEnabled(bool bEnabled);
+	bool IsShadowViewCached(const FShadowRenderRequest& Request, uint64 CasterHash) const;
+	void StoreShadowView(const FShadowRenderRequest& Request, uint64 CasterHash);
+	void InvalidateShadowCache() { ShadowViewCache.clear(); }
+
+    // CSM 캐스케이드 타일 크기 (2의 거듭제곱, 예산이 모자라도 줄이지 않음). 캐스케이드 피팅과 아틀라스 할당이 같은 값을 씀
+    uint32 GetDirectionalShadowTileSize(uint32 RequestedSize) const;
+
+    // 라이트별 영역을 프레임 사이 유지하며 할당 (View: 화면 크기 기반 해상도 선택, nullptr이면 요청 크기 그대로)
+    void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D, const FSceneView* View);
+    // 슬라이스가 모자라면 한 슬라이스를 저해상도 타일로 나눠 여러 라이트가 공유
+    void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube, const FSceneView* View);
 
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
@@ -184,6 +239,10 @@ private:
     bool bSpotLightDirty = true;
     bool bShadowDataDirty = true;
 
+    // 섀도우 데이터가 마지막으로 기록된 프레임 (같은 프레임의 다른 뷰가 같은 값을 다시 기록하면 무시)
+    uint64 ShadowDataFrameNumber = 0;
+    bool ShouldApplyShadowData(bool bSameAsCached);
+
 	// --- 섀도우 리소스 ---
 	// Atlas 1: 2D 아틀라스 (Spot/Dir용) - RTV만 사용
 	ID3D11Texture2D* ShadowAtlasTexture2D = nullptr;
@@ -207,8 +266,30 @@ private:
     // --- 섀도우 데이터 캐시 (CPU) ---
     // Key: 라이트, Value: 2D 섀도우 데이터 배열 (CSM의 경우 여러 개)
     TMap<ULightComponent*, TArray<FShadowMapData>> ShadowDataCache2D;
-    // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스
-    TMap<ULightComponent*, int32> ShadowDataCacheCube;
+    // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스와 타일
+    TMap<ULightComponent*, FShadowCubeSlot> ShadowDataCacheCube;
+
+    // 아틀라스에 남아 있는 섀도우 뷰 (렌더 요청 단위)
+    TArray<FShadowCacheEntry> ShadowViewCache;
+    bool bShadowCacheEnabled = true;
+    void RemoveShadowViewCache(ULightComponent* Light);
+
+    // --- 아틀라스 영역 할당 (프레임 사이 유지) ---
+    FShadowAtlasQuadTree Atlas2DAllocator;
+    TArray<FShadowAtlasQuadTree> CubeSliceAllocators; // 슬라이스마다 한 면의 타일 배치 (6면 공통)
+    TMap<ULightComponent*, TArray<FShadowAtlasAllocation>> AtlasAllocations2D; // 서브뷰 인덱스 순
+    TMap<ULightComponent*, FShadowAtlasAllocation> AtlasAllocationsCube;
+    uint32 MinShadowTileSize2D = 128;
+    uint32 CubeTileLevels = 2; // 큐브 면을 최대 4x4 타일까지 분할 (ClearView 미지원 시 0)
+
+    void InitializeAtlasAllocators(D3D11RHI* RHIDevice);
+    void ReleaseAtlasAllocations();
+    void AllocateAtlasWorkItems(TArray<FShadowAtlasAllocation*>& WorkItems, bool bCube);
+    void EvictStaleAtlasAllocations(uint64 FrameNumber);
+    void RemoveAtlasAllocations(ULightComponent* Light);
+    void FreeAtlasAllocation(FShadowAtlasAllocation& Allocation);
+    bool TryAllocateAtlasRegion(FShadowAtlasAllocation& Allocation, uint32 Size, bool bCube);
+    uint32 GetCubeShadowTile(const FShadowAtlasAllocation& Allocation) const;
 
 
     //structured buffer
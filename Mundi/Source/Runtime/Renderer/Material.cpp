@@ -54,6 +54,10 @@ void UMaterial::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 void UMaterial::SetShader(UShader* InShaderResource)
 {
+	if (Shader != InShaderResource)
+	{
+		UShader::InvalidateVariantSelections();
+	}
 	Shader = InShaderResource;
 }
 
@@ -74,6 +78,10 @@ void UMaterial::SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro)
 		UResourceManager::GetInstance().Load<UShader>(Shader->GetFilePath(), InShaderMacro);
 	}
 
+	if (ShaderMacro != InShaderMacro)
+	{
+		UShader::InvalidateVariantSelections();
+	}
 	ShaderMacro = InShaderMacro;
 }
 
@@ -133,6 +141,7 @@ void UMaterial::SetMaterialInfo(const FMaterialInfo& InMaterialInfo)
 {
 	MaterialInfo = InMaterialInfo;
 	ResolveTextures();
+	MarkContentChanged();
 }
 
 
@@ -293,6 +302,7 @@ void UMaterialInstanceDynamic::CopyParametersFrom(const UMaterialInstanceDynamic
 	this->OverriddenVectorParameters = Other->OverriddenVectorParameters;
 
 	this->bIsCachedMaterialInfoDirty = true;
+	MarkContentChanged();
 }
 
 UMaterialInstanceDynamic::UMaterialInstanceDynamic(UMaterialInterface* InParentMaterial)
@@ -461,34 +471,40 @@ void UMaterialInstanceDynamic::SetTextureParameterValue(EMaterialTextureSlot Slo
 {
 	OverriddenTextures.Add(Slot, Value);
 	bIsCachedMaterialInfoDirty = true;
+	MarkContentChanged();
 }
 
 void UMaterialInstanceDynamic::SetVectorParameterValue(const FString& ParameterName, const FLinearColor& Value)
 {
 	OverriddenVectorParameters.Add(ParameterName, Value);
 	bIsCachedMaterialInfoDirty = true;
+	MarkContentChanged();
 }
 
 void UMaterialInstanceDynamic::SetScalarParameterValue(const FString& ParameterName, float Value)
 {
 	OverriddenScalarParameters.Add(ParameterName, Value);
 	bIsCachedMaterialInfoDirty = true;
+	MarkContentChanged();
 }
 
 void UMaterialInstanceDynamic::SetOverriddenTextureParameters(const TMap<EMaterialTextureSlot, UTexture*>& InTextures)
 {
 	OverriddenTextures = InTextures;
 	bIsCachedMaterialInfoDirty = true;
+	MarkContentChanged();
 }
 
 void UMaterialInstanceDynamic::SetOverriddenScalarParameters(const TMap<FString, float>& InScalars)
 {
 	OverriddenScalarParameters = InScalars;
 	bIsCachedMaterialInfoDirty = true; // 스칼라 값이 변경되었으므로 캐시를 갱신해야 함
+	MarkContentChanged();
 }
 
 void UMaterialInstanceDynamic::SetOverriddenVectorParameters(const TMap<FString, FLinearColor>& InVectors)
 {
 	OverriddenVectorParameters = InVectors;
 	bIsCachedMaterialInfoDirty = true; // 벡터 값이 변경되었으므로 캐시를 갱신해야 함
+	MarkContentChanged();
 }
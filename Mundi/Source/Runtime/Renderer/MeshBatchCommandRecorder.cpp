@@ -0,0 +1,271 @@
+﻿#include "pch.h"
+#include "MeshBatchCommandRecorder.h"
+#include "MeshBatchElement.h"
+#include "Material.h"
+#include "Texture.h"
+#include "ParallelFor.h"
+
+namespace
+{
+	bool IsDrawableBatch(const FMeshBatchElement& Batch)
+	{
+		// 셰이더나 버퍼, 스트라이드 정보가 없으면 그릴 수 없음
+		return Batch.VertexShader && Batch.PixelShader && Batch.VertexBuffer && Batch.IndexBuffer && Batch.VertexStride != 0;
+	}
+
+	// 패스 시작 시 PS 리소스 초기화 (첫 번째 버퍼에만 기록)
+	void RecordPrologue(FRenderCommandBuffer& OutBuffer)
+	{
+		ID3D11ShaderResourceView* NullSRVs[2] = { nullptr, nullptr };
+		ID3D11SamplerState* NullSamplers[2] = { nullptr, nullptr };
+		OutBuffer.SetPixelResources(NullSRVs, 2, NullSamplers, 2);
+		OutBuffer.UpdateConstants(FPixelConstBufferType{});
+	}
+
+	void RecordPixelState(const FMeshBatchElement& Batch, const FMeshBatchRecordContext& Context, FRenderCommandBuffer& OutBuffer)
+	{
+		ID3D11ShaderResourceView* DiffuseTextureSRV = nullptr; // t0
+		ID3D11ShaderResourceView* NormalTextureSRV = nullptr;  // t1
+		FPixelConstBufferType PixelConst{};
+
+		if (Batch.Material)
+		{
+			PixelConst.Material = Batch.Material->GetMaterialInfo();
+			PixelConst.bHasMaterial = true;
+		}
+		else
+		{
+			FMaterialInfo DefaultMaterialInfo;
+			PixelConst.Material = DefaultMaterialInfo;
+			PixelConst.bHasMaterial = false;
+			PixelConst.bHasDiffuseTexture = false;
+			PixelConst.bHasNormalTexture = false;
+		}
+
+		// 1순위: 인스턴스 텍스처 (빌보드)
+		if (Batch.InstanceShaderResourceView)
+		{
+			DiffuseTextureSRV = Batch.InstanceShaderResourceView;
+			PixelConst.bHasDiffuseTexture = true;
+			PixelConst.bHasNormalTexture = false;
+		}
+		// 2순위: 머티리얼 텍스처 (스태틱 메시)
+		else if (Batch.Material)
+		{
+			const FMaterialInfo& MaterialInfo = Batch.Material->GetMaterialInfo();
+			if (!MaterialInfo.DiffuseTextureFileName.empty())
+			{
+				if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Diffuse))
+				{
+					DiffuseTextureSRV = TextureData->GetShaderResourceView();
+					PixelConst.bHasDiffuseTexture = (DiffuseTextureSRV != nullptr);
+				}
+			}
+			if (!MaterialInfo.NormalTextureFileName.empty())
+			{
+				if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Normal))
+				{
+					NormalTextureSRV = TextureData->GetShaderResourceView();
+					PixelConst.bHasNormalTexture = (NormalTextureSRV != nullptr);
+				}
+			}
+		}
+
+		ID3D11ShaderResourceView* SRVs[2] = { DiffuseTextureSRV, NormalTextureSRV };
+		ID3D11SamplerState* Samplers[4] = { Context.DefaultSampler, Context.DefaultSampler, Context.ShadowSampler, Context.VSMSampler };
+		OutBuffer.SetPixelResources(SRVs, 2, Samplers, 4);
+		OutBuffer.UpdateConstants(PixelConst);
+	}
+
+	// [Begin, End) 구간 기록. Prev는 직전에 기록된 유효 배치 (없으면 모든 상태가 비어 있는 것으로 간주)
+	void RecordBatchRange(const FMeshBatchElement* Batches, uint32 Begin, uint32 End, const FMeshBatchElement* Prev,
+		const FMeshBatchRecordContext& Context, FRenderCommandBuffer& OutBuffer)
+	{
+		for (uint32 Index = Begin; Index < End; ++Index)
+		{
+			const FMeshBatchElement& Batch = Batches[Index];
+			if (!IsDrawableBatch(Batch))
+			{
+				continue;
+			}
+
+			// 1. 셰이더 상태 변경
+			if (!Prev || Batch.VertexShader != Prev->VertexShader || Batch.PixelShader != Prev->PixelShader)
+			{
+				OutBuffer.SetPipeline(Batch.InputLayout, Batch.VertexShader, Batch.PixelShader);
+			}
+
+			// 2. 픽셀 상태 ('Material' 또는 'Instance SRV' 둘 중 하나라도 바뀌면 모두 다시 바인딩)
+			const UMaterialInterface* PrevMaterial = Prev ? Prev->Material : nullptr;
+			const ID3D11ShaderResourceView* PrevInstanceSRV = Prev ? Prev->InstanceShaderResourceView : nullptr;
+			if (Batch.Material != PrevMaterial || Batch.InstanceShaderResourceView != PrevInstanceSRV)
+			{
+				RecordPixelState(Batch, Context, OutBuffer);
+			}
+
+			// 3. IA 상태 변경
+			if (!Prev ||
+				Batch.VertexBuffer != Prev->VertexBuffer ||
+				Batch.IndexBuffer != Prev->IndexBuffer ||
+				Batch.VertexStride != Prev->VertexStride ||
+				Batch.PrimitiveTopology != Prev->PrimitiveTopology)
+			{
+				OutBuffer.SetGeometry(Batch.VertexBuffer, Batch.IndexBuffer, Batch.VertexStride, static_cast<uint32>(Batch.PrimitiveTopology));
+			}
+
+			// 4. 드로우 (오브젝트별 데이터는 FObjectDataBuffer에 배치 인덱스 순서로 올라가 있음)
+			OutBuffer.DrawIndexed(Batch.IndexCount, Batch.StartIndex, static_cast<int32>(Batch.BaseVertexIndex), Index);
+
+			Prev = &Batch;
+		}
+	}
+}
+
+uint32 FMeshBatchCommandRecorder::Record(const TArray<FMeshBatchElement>& InBatches, const FMeshBatchRecordContext& InContext,
+	TArray<FRenderCommandBuffer>& InOutBuffers, FTaskPool* InTaskPool, uint32 InMaxThreads)
+{
+	const uint32 NumBatches = static_cast<uint32>(InBatches.size());
+	if (NumBatches == 0)
+	{
+		return 0;
+	}
+
+	const uint32 NumBuffers = GetParallelThreadCount(InTaskPool, NumBatches, MinBatchesPerThread, InMaxThreads);
+	if (static_cast<uint32>(InOutBuffers.size()) < NumBuffers)
+	{
+		InOutBuffers.resize(NumBuffers);
+	}
+
+	if (NumBuffers > 1)
+	{
+		// UMaterialInstanceDynamic::GetMaterialInfo는 첫 호출 때 캐시를 갱신하므로 병렬 기록 전에 메인 스레드에서 미리 갱신
+		const UMaterialInterface* LastMaterial = nullptr;
+		for (const FMeshBatchElement& Batch : InBatches)
+		{
+			if (Batch.Material && Batch.Material != LastMaterial)
+			{
+				Batch.Material->GetMaterialInfo();
+				LastMaterial = Batch.Material;
+			}
+		}
+	}
+
+	const FMeshBatchElement* Batches = InBatches.data();
+	const uint32 PerBuffer = (NumBatches + NumBuffers - 1) / NumBuffers;
+
+	ParallelFor(InTaskPool, NumBuffers, [&](uint32 BufferIndex)
+	{
+		FRenderCommandBuffer& Buffer = InOutBuffers[BufferIndex];
+		Buffer.Reset();
+
+		const uint32 Begin = std::min(NumBatches, BufferIndex * PerBuffer);
+		const uint32 End = std::min(NumBatches, Begin + PerBuffer);
+
+		// 구간 첫 배치의 비교 기준은 앞 구간의 마지막 유효 배치 (단일 스레드로 기록했을 때와 같은 커맨드가 나오도록)
+		const FMeshBatchElement* Prev = nullptr;
+		for (uint32 Index = Begin; Index > 0; --Index)
+		{
+			if (IsDrawableBatch(Batches[Index - 1]))
+			{
+				Prev = &Batches[Index - 1];
+				break;
+			}
+		}
+
+		if (BufferIndex == 0)
+		{
+			RecordPrologue(Buffer);
+		}
+		RecordBatchRange(Batches, Begin, End, Prev, InContext, Buffer);
+	});
+
+	return NumBuffers;
+}
+
+void FMeshBatchCommandRecorder::RunBenchmark(uint32 InNumBatches, FTaskPool* InTaskPool)
+{
+	using FClock = std::chrono::high_resolution_clock;
+	auto ElapsedMS = [](FClock::time_point Start)
+	{
+		return std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+	};
+
+	// Null 백엔드만 해석하는 가짜 핸들
+	auto FakeHandle = [](uintptr_t Base, uint32 Index)
+	{
+		return reinterpret_cast<void*>(Base + static_cast<uintptr_t>(Index + 1) * 16);
+	};
+
+	const uint32 NumBatches = std::max(1u, InNumBatches);
+	constexpr uint32 NumShaders = 8;
+	constexpr uint32 NumMeshes = 256;
+	constexpr uint32 NumInstanceTextures = 64;
+
+	// 합성 배치: 셰이더 8종 x 메시 256종, 픽셀 상태 변화는 인스턴스 SRV 64종으로 생성 (머티리얼 없음)
+	TArray<FMeshBatchElement> Batches;
+	Batches.resize(NumBatches);
+	for (uint32 i = 0; i < NumBatches; ++i)
+	{
+		FMeshBatchElement& Batch = Batches[i];
+		const uint32 Shader = i % NumShaders;
+		const uint32 Mesh = (i * 7919u) % NumMeshes;
+		Batch.VertexShader = static_cast<ID3D11VertexShader*>(FakeHandle(0x100000, Shader));
+		Batch.PixelShader = static_cast<ID3D11PixelShader*>(FakeHandle(0x200000, Shader));
+		Batch.InputLayout = static_cast<ID3D11InputLayout*>(FakeHandle(0x300000, Shader));
+		Batch.VertexBuffer = static_cast<ID3D11Buffer*>(FakeHandle(0x400000, Mesh));
+		Batch.IndexBuffer = static_cast<ID3D11Buffer*>(FakeHandle(0x500000, Mesh));
+		Batch.InstanceShaderResourceView = static_cast<ID3D11ShaderResourceView*>(FakeHandle(0x600000, (i / 3) % NumInstanceTextures));
+		Batch.VertexStride = 32;
+		Batch.IndexCount = 36 + Mesh * 3;
+		Batch.WorldMatrix = FMatrix::MakeTranslation(FVector(static_cast<float>(i % 100), static_cast<float>((i / 100) % 100), static_cast<float>(i / 10000)));
+		Batch.ObjectID = i;
+	}
+	std::sort(Batches.begin(), Batches.end());
+
+	FMeshBatchRecordContext Context;
+	Context.DefaultSampler = static_cast<ID3D11SamplerState*>(FakeHandle(0x700000, 0));
+	Context.ShadowSampler = static_cast<ID3D11SamplerState*>(FakeHandle(0x700000, 1));
+	Context.VSMSampler = static_cast<ID3D11SamplerState*>(FakeHandle(0x700000, 2));
+
+	TArray<FRenderCommandBuffer> Buffers;
+
+	// 버퍼 용량 확보 (측정에서 최초 할당 제외)
+	Record(Batches, Context, Buffers, InTaskPool, 0);
+	Record(Batches, Context, Buffers, InTaskPool, 1);
+
+	FClock::time_point Start = FClock::now();
+	Record(Batches, Context, Buffers, InTaskPool, 1);
+	const double SerialMS = ElapsedMS(Start);
+
+	Start = FClock::now();
+	const uint32 NumBuffers = Record(Batches, Context, Buffers, InTaskPool, 0);
+	const double ParallelMS = ElapsedMS(Start);
+
+	FNullRenderBackend Backend;
+	Start = FClock::now();
+	Backend.BeginPass();
+	for (uint32 i = 0; i < NumBuffers; ++i)
+	{
+		Backend.Execute(Buffers[i]);
+	}
+	const double ExecuteMS = ElapsedMS(Start);
+
+	const FRenderCommandStats& Stats = Backend.GetStats();
+	uint64 ConstantBytes = 0;
+	for (uint32 i = 0; i < NumBuffers; ++i)
+	{
+		ConstantBytes += Buffers[i].GetConstantDataSize();
+	}
+
+	UE_LOG("[RenderBench] %u batches: record 1 thread %.3f ms, %u threads %.3f ms (x%.2f), null execute %.3f ms",
+		NumBatches, SerialMS, NumBuffers, ParallelMS, ParallelMS > 0.0 ? SerialMS / ParallelMS : 0.0, ExecuteMS);
+	UE_LOG("[RenderBench] commands %u (pipeline %u, geometry %u, pixel %u, constants %u, draw %u), constant data %.1f KB, validation errors %u",
+		Stats.GetTotalCommands(),
+		Stats.CommandCounts[static_cast<uint32>(ERenderCommandType::SetPipeline)],
+		Stats.CommandCounts[static_cast<uint32>(ERenderCommandType::SetGeometry)],
+		Stats.CommandCounts[static_cast<uint32>(ERenderCommandType::SetPixelResources)],
+		Stats.CommandCounts[static_cast<uint32>(ERenderCommandType::UpdateConstants)],
+		Stats.Draws,
+		static_cast<double>(ConstantBytes) / 1024.0,
+		Stats.ValidationErrors);
+}
@@ -0,0 +1,34 @@
+﻿#pragma once
+#include "RenderCommandBuffer.h"
+
+struct FMeshBatchElement;
+class FTaskPool;
+struct ID3D11SamplerState;
+
+// 메시 배치 기록에 필요한 패스 공통 리소스
+struct FMeshBatchRecordContext
+{
+	ID3D11SamplerState* DefaultSampler = nullptr;
+	ID3D11SamplerState* ShadowSampler = nullptr;
+	ID3D11SamplerState* VSMSampler = nullptr;
+};
+
+/**
+ * 정렬된 FMeshBatchElement 목록을 렌더 커맨드로 기록
+ * 배치가 많으면 연속 구간으로 나눠 스레드마다 별도 버퍼에 기록하고, 버퍼 인덱스 순서로 실행하면 단일 스레드 기록과 같은 결과
+ * 오브젝트별 데이터(월드 행렬, 색상, ID)는 상수 버퍼 대신 FObjectDataBuffer로 올리고, 드로우는 배치 인덱스를 StartInstance로 넘김
+ */
+class FMeshBatchCommandRecorder
+{
+public:
+	// 스레드 하나가 맡는 최소 배치 수 (워커에 나눠 주고 기다리는 비용보다 기록 비용이 커지는 지점)
+	static constexpr uint32 MinBatchesPerThread = 1024;
+
+	// 기록에 사용한 버퍼 수를 반환 (InOutBuffers는 필요한 만큼 늘어나며 재사용됨)
+	// 버퍼별 기록은 InTaskPool의 워커가 나눠 맡고, InMaxThreads가 0이면 풀의 스레드 수까지 사용 (풀이 없으면 단일 스레드)
+	static uint32 Record(const TArray<FMeshBatchElement>& InBatches, const FMeshBatchRecordContext& InContext,
+		TArray<FRenderCommandBuffer>& InOutBuffers, FTaskPool* InTaskPool, uint32 InMaxThreads = 0);
+
+	// 합성 배치로 기록(단일/병렬)과 Null 백엔드 실행 시간을 측정 (GPU 불필요)
+	static void RunBenchmark(uint32 InNumBatches, FTaskPool* InTaskPool);
+};
@@ -4,6 +4,7 @@
 // 전방 선언
 class UShader;
 class UMaterial;
+struct FMeshletCullData;
 
 /**
  * @struct FMeshBatchElement
@@ -62,6 +63,15 @@ struct FMeshBatchElement
 	// (기본값으로 흰색(1,1,1,1)을 설정하는 것이 일반적입니다.)
 	FLinearColor InstanceColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
 
+	// 설정되어 있으면 메인 패스에서 메쉴릿 단위 CPU 컬링 후 인덱스 범위가 동적 인덱스 버퍼로 교체될 수 있습니다.
+	const FMeshletCullData* MeshletCullData = nullptr;
+
+	// 정점 버퍼가 압축 포맷(FCompressedVertex)이면 셰이더를 COMPRESSED_VERTEX 변형으로 바꿔야 합니다.
+	// 셰이더를 강제하는 패스는 UShader::GetBatchShaderVariant로 변형을 고릅니다.
+	bool bCompressedVertex = false;
+	FVector4 PositionDequantScale = FVector4(1.0f, 1.0f, 1.0f, 0.0f);
+	FVector4 PositionDequantOffset = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
 
@@ -0,0 +1,657 @@
+﻿#include "pch.h"
+#include "MeshletCuller.h"
+#include "D3D11RHI.h"
+#include "SceneView.h"
+#include "MeshBatchElement.h"
+#include "MeshletStats.h"
+#include "StaticMesh.h"
+#include "ResourceManager.h"
+#include <immintrin.h>
+#include <intrin.h>
+
+namespace
+{
+	constexpr uint32 SimdWidth = 8;
+
+	FCullMeshletsKernel SelectCullKernel()
+	{
+		const bool bAVX = IsMeshletAVXSupported();
+		UE_LOG("FMeshletCuller: %s 컬링 커널 사용", bAVX ? "AVX" : "스칼라");
+		return bAVX ? &CullMeshlets_AVX : &CullMeshlets_Scalar;
+	}
+}
+
+// ─────────────────────────────
+// FMeshletCullData
+// ─────────────────────────────
+
+void FMeshletCullData::Build(const TArray<FMeshlet>& Meshlets, const TArray<uint32>* InSourceIndices)
+{
+	Reset();
+
+	MeshletCount = static_cast<uint32>(Meshlets.size());
+	SourceIndices = InSourceIndices;
+	if (MeshletCount == 0)
+	{
+		return;
+	}
+
+	// 패딩 영역은 반지름을 음수로 둬서 절두체 테스트에서 항상 실패하게 함
+	const uint32 PaddedCount = MeshletCount + SimdWidth;
+	CenterX.assign(PaddedCount, 0.0f);
+	CenterY.assign(PaddedCount, 0.0f);
+	CenterZ.assign(PaddedCount, 0.0f);
+	Radius.assign(PaddedCount, -1.0f);
+	ConeAxisX.assign(PaddedCount, 0.0f);
+	ConeAxisY.assign(PaddedCount, 0.0f);
+	ConeAxisZ.assign(PaddedCount, 0.0f);
+	ConeCutoff.assign(PaddedCount, 1.0f);
+	StartIndex.resize(MeshletCount);
+	IndexCount.resize(MeshletCount);
+
+	for (uint32 i = 0; i < MeshletCount; ++i)
+	{
+		const FMeshlet& Meshlet = Meshlets[i];
+		CenterX[i] = Meshlet.Center.X;
+		CenterY[i] = Meshlet.Center.Y;
+		CenterZ[i] = Meshlet.Center.Z;
+		Radius[i] = Meshlet.Radius;
+		ConeAxisX[i] = Meshlet.ConeAxis.X;
+		ConeAxisY[i] = Meshlet.ConeAxis.Y;
+		ConeAxisZ[i] = Meshlet.ConeAxis.Z;
+		ConeCutoff[i] = Meshlet.ConeCutoff;
+		StartIndex[i] = Meshlet.StartIndex;
+		IndexCount[i] = Meshlet.IndexCount;
+	}
+}
+
+void FMeshletCullData::Reset()
+{
+	CenterX.clear(); CenterY.clear(); CenterZ.clear(); Radius.clear();
+	ConeAxisX.clear(); ConeAxisY.clear(); ConeAxisZ.clear(); ConeCutoff.clear();
+	StartIndex.clear();
+	IndexCount.clear();
+	MeshletCount = 0;
+	SourceIndices = nullptr;
+}
+
+void FMeshletCullData::FindMeshletRange(uint32 InStartIndex, uint32 InIndexCount, uint32& OutFirst, uint32& OutCount) const
+{
+	OutFirst = 0;
+	OutCount = 0;
+
+	auto It = std::lower_bound(StartIndex.begin(), StartIndex.end(), InStartIndex);
+	if (It == StartIndex.end() || *It != InStartIndex)
+	{
+		return;
+	}
+
+	const uint32 First = static_cast<uint32>(It - StartIndex.begin());
+	const uint32 EndIndex = InStartIndex + InIndexCount;
+	uint32 Covered = 0;
+	uint32 Last = First;
+	while (Last < MeshletCount && StartIndex[Last] < EndIndex)
+	{
+		Covered += IndexCount[Last];
+		++Last;
+	}
+
+	if (Covered == InIndexCount)
+	{
+		OutFirst = First;
+		OutCount = Last - First;
+	}
+}
+
+// ─────────────────────────────
+// FMeshletCullParams
+// ─────────────────────────────
+
+FMeshletCullParams FMeshletCullParams::Make(const FMatrix& WorldMatrix, const FSceneView& View)
+{
+	return Make(WorldMatrix, View.ViewFrustum, View.ViewLocation, View.ProjectionMode == ECameraProjectionMode::Orthographic);
+}
+
+FMeshletCullParams FMeshletCullParams::Make(const FMatrix& WorldMatrix, const FFrustum& Frustum, const FVector& ViewLocation, bool bInOrthographic)
+{
+	FMeshletCullParams Params;
+
+	// 월드 평면 (N·X - D >= 0)에 X = Xl * M 을 대입하면 로컬 평면은 Nl = M(3x3) * N, Dl = D - T·N
+	const FMatrix& M = WorldMatrix;
+	const FPlane* WorldPlanes[6] = { &Frustum.TopFace, &Frustum.BottomFace, &Frustum.RightFace, &Frustum.LeftFace, &Frustum.NearFace, &Frustum.FarFace };
+	for (uint32 p = 0; p < 6; ++p)
+	{
+		const FVector4& N = WorldPlanes[p]->Normal;
+		FVector LocalNormal(
+			M.M[0][0] * N.X + M.M[0][1] * N.Y + M.M[0][2] * N.Z,
+			M.M[1][0] * N.X + M.M[1][1] * N.Y + M.M[1][2] * N.Z,
+			M.M[2][0] * N.X + M.M[2][1] * N.Y + M.M[2][2] * N.Z);
+		float LocalDistance = WorldPlanes[p]->Distance - (M.M[3][0] * N.X + M.M[3][1] * N.Y + M.M[3][2] * N.Z);
+
+		// 로컬 반지름과 비교할 수 있도록 정규화 (비균등 스케일에서도 보수적으로 정확)
+		const float Length = LocalNormal.Size();
+		if (Length > KINDA_SMALL_NUMBER)
+		{
+			LocalNormal = LocalNormal * (1.0f / Length);
+			LocalDistance /= Length;
+		}
+		Params.Planes[p].Normal = FVector4(LocalNormal.X, LocalNormal.Y, LocalNormal.Z, 0.0f);
+		Params.Planes[p].Distance = LocalDistance;
+	}
+
+	const FMatrix Inverse = M.InverseAffine();
+	const FVector& Camera = ViewLocation;
+	Params.CameraPosition = FVector(
+		Camera.X * Inverse.M[0][0] + Camera.Y * Inverse.M[1][0] + Camera.Z * Inverse.M[2][0] + Inverse.M[3][0],
+		Camera.X * Inverse.M[0][1] + Camera.Y * Inverse.M[1][1] + Camera.Z * Inverse.M[2][1] + Inverse.M[3][1],
+		Camera.X * Inverse.M[0][2] + Camera.Y * Inverse.M[1][2] + Camera.Z * Inverse.M[2][2] + Inverse.M[3][2]);
+
+	// Near 평면 법선 = 카메라 전방
+	const FVector4& Forward = Frustum.NearFace.Normal;
+	Params.ViewDirection = FVector(
+		Forward.X * Inverse.M[0][0] + Forward.Y * Inverse.M[1][0] + Forward.Z * Inverse.M[2][0],
+		Forward.X * Inverse.M[0][1] + Forward.Y * Inverse.M[1][1] + Forward.Z * Inverse.M[2][1],
+		Forward.X * Inverse.M[0][2] + Forward.Y * Inverse.M[1][2] + Forward.Z * Inverse.M[2][2]).GetNormalized();
+
+	Params.bOrthographic = bInOrthographic;
+
+	const float Determinant =
+		M.M[0][0] * (M.M[1][1] * M.M[2][2] - M.M[1][2] * M.M[2][1]) -
+		M.M[0][1] * (M.M[1][0] * M.M[2][2] - M.M[1][2] * M.M[2][0]) +
+		M.M[0][2] * (M.M[1][0] * M.M[2][1] - M.M[1][1] * M.M[2][0]);
+	Params.bConeCulling = Determinant > 0.0f;
+
+	return Params;
+}
+
+// ─────────────────────────────
+// 컬링 커널
+// ─────────────────────────────
+
+bool IsMeshletAVXSupported()
+{
+	static const bool bSupported = []()
+	{
+		int CpuInfo[4] = {};
+		__cpuid(CpuInfo, 1);
+		const bool bOSXSave = (CpuInfo[2] & (1 << 27)) != 0;	// XGETBV 사용 가능
+		const bool bAVX = (CpuInfo[2] & (1 << 28)) != 0;
+		if (!bOSXSave || !bAVX)
+		{
+			return false;
+		}
+		// OS가 문맥 전환 시 XMM/YMM 상태를 저장해야 AVX 레지스터를 쓸 수 있음
+		const unsigned long long XCR0 = _xgetbv(0);
+		return (XCR0 & 0x6) == 0x6;
+	}();
+	return bSupported;
+}
+
+uint32 CullMeshlets(const FMeshletCullData& Data, uint32 First, uint32 Count, const FMeshletCullParams& Params, uint32* OutVisibleMeshlets)
+{
+	static const FCullMeshletsKernel Kernel = SelectCullKernel();
+	return Kernel(Data, First, Count, Params, OutVisibleMeshlets);
+}
+
+uint32 CullMeshlets_Scalar(const FMeshletCullData& Data, uint32 First, uint32 Count, const FMeshletCullParams& Params, uint32* OutVisibleMeshlets)
+{
+	if (Count == 0 || First + Count > Data.MeshletCount)
+	{
+		return 0;
+	}
+
+	// AVX 커널과 같은 연산 순서 (두 커널의 결과가 비트 단위로 같도록)
+	uint32 NumVisible = 0;
+	for (uint32 Index = First; Index < First + Count; ++Index)
+	{
+		const float CX = Data.CenterX[Index];
+		const float CY = Data.CenterY[Index];
+		const float CZ = Data.CenterZ[Index];
+		const float R = Data.Radius[Index];
+
+		// 1. 절두체: 모든 평면에 대해 Distance + Radius >= 0
+		bool bVisible = true;
+		for (uint32 p = 0; p < 6 && bVisible; ++p)
+		{
+			const FPlane& Plane = Params.Planes[p];
+			const float Dist = Plane.Normal.X * CX + Plane.Normal.Y * CY + Plane.Normal.Z * CZ - Plane.Distance;
+			bVisible = Dist + R >= 0.0f;
+		}
+
+		// 2. 노멀 콘: 카메라→메쉴릿 방향이 콘 축과 충분히 같은 쪽이면 모든 삼각형이 뒷면
+		if (bVisible && Params.bConeCulling)
+		{
+			const float AX = Data.ConeAxisX[Index];
+			const float AY = Data.ConeAxisY[Index];
+			const float AZ = Data.ConeAxisZ[Index];
+			const float Cutoff = Data.ConeCutoff[Index];
+
+			if (Params.bOrthographic)
+			{
+				const float Dot = Params.ViewDirection.X * AX + Params.ViewDirection.Y * AY + Params.ViewDirection.Z * AZ;
+				bVisible = !(Dot > Cutoff);
+			}
+			else
+			{
+				const float DX = CX - Params.CameraPosition.X;
+				const float DY = CY - Params.CameraPosition.Y;
+				const float DZ = CZ - Params.CameraPosition.Z;
+				const float LengthSq = DX * DX + DY * DY + DZ * DZ;
+				const float Dot = DX * AX + DY * AY + DZ * AZ;
+				bVisible = !(Dot > Cutoff * std::sqrt(LengthSq) + R);
+			}
+		}
+
+		if (bVisible)
+		{
+			OutVisibleMeshlets[NumVisible++] = Index;
+		}
+	}
+	return NumVisible;
+}
+
+uint32 CullMeshlets_AVX(const FMeshletCullData& Data, uint32 First, uint32 Count, const FMeshletCullParams& Params, uint32* OutVisibleMeshlets)
+{
+	if (Count == 0 || First + Count > Data.MeshletCount)
+	{
+		return 0;
+	}
+
+	__m256 PlaneNX[6], PlaneNY[6], PlaneNZ[6], PlaneD[6];
+	for (uint32 p = 0; p < 6; ++p)
+	{
+		PlaneNX[p] = _mm256_set1_ps(Params.Planes[p].Normal.X);
+		PlaneNY[p] = _mm256_set1_ps(Params.Planes[p].Normal.Y);
+		PlaneNZ[p] = _mm256_set1_ps(Params.Planes[p].Normal.Z);
+		PlaneD[p] = _mm256_set1_ps(Params.Planes[p].Distance);
+	}
+
+	const __m256 CamX = _mm256_set1_ps(Params.CameraPosition.X);
+	const __m256 CamY = _mm256_set1_ps(Params.CameraPosition.Y);
+	const __m256 CamZ = _mm256_set1_ps(Params.CameraPosition.Z);
+	const __m256 DirX = _mm256_set1_ps(Params.ViewDirection.X);
+	const __m256 DirY = _mm256_set1_ps(Params.ViewDirection.Y);
+	const __m256 DirZ = _mm256_set1_ps(Params.ViewDirection.Z);
+	const __m256 Zero = _mm256_setzero_ps();
+
+	uint32 NumVisible = 0;
+	for (uint32 Base = 0; Base < Count; Base += SimdWidth)
+	{
+		const uint32 Index = First + Base;
+		const __m256 CX = _mm256_loadu_ps(&Data.CenterX[Index]);
+		const __m256 CY = _mm256_loadu_ps(&Data.CenterY[Index]);
+		const __m256 CZ = _mm256_loadu_ps(&Data.CenterZ[Index]);
+		const __m256 R = _mm256_loadu_ps(&Data.Radius[Index]);
+
+		// 1. 절두체: 모든 평면에 대해 Distance + Radius >= 0
+		__m256 Visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for (uint32 p = 0; p < 6; ++p)
+		{
+			__m256 Dist = _mm256_mul_ps(PlaneNX[p], CX);
+			Dist = _mm256_add_ps(Dist, _mm256_mul_ps(PlaneNY[p], CY));
+			Dist = _mm256_add_ps(Dist, _mm256_mul_ps(PlaneNZ[p], CZ));
+			Dist = _mm256_sub_ps(Dist, PlaneD[p]);
+			Visible = _mm256_and_ps(Visible, _mm256_cmp_ps(_mm256_add_ps(Dist, R), Zero, _CMP_GE_OQ));
+		}
+
+		// 2. 노멀 콘: 카메라→메쉴릿 방향이 콘 축과 충분히 같은 쪽이면 모든 삼각형이 뒷면
+		if (Params.bConeCulling)
+		{
+			const __m256 AX = _mm256_loadu_ps(&Data.ConeAxisX[Index]);
+			const __m256 AY = _mm256_loadu_ps(&Data.ConeAxisY[Index]);
+			const __m256 AZ = _mm256_loadu_ps(&Data.ConeAxisZ[Index]);
+			const __m256 Cutoff = _mm256_loadu_ps(&Data.ConeCutoff[Index]);
+
+			__m256 BackFacing;
+			if (Params.bOrthographic)
+			{
+				__m256 Dot = _mm256_mul_ps(DirX, AX);
+				Dot = _mm256_add_ps(Dot, _mm256_mul_ps(DirY, AY));
+				Dot = _mm256_add_ps(Dot, _mm256_mul_ps(DirZ, AZ));
+				BackFacing = _mm256_cmp_ps(Dot, Cutoff, _CMP_GT_OQ);
+			}
+			else
+			{
+				const __m256 DX = _mm256_sub_ps(CX, CamX);
+				const __m256 DY = _mm256_sub_ps(CY, CamY);
+				const __m256 DZ = _mm256_sub_ps(CZ, CamZ);
+				__m256 LengthSq = _mm256_mul_ps(DX, DX);
+				LengthSq = _mm256_add_ps(LengthSq, _mm256_mul_ps(DY, DY));
+				LengthSq = _mm256_add_ps(LengthSq, _mm256_mul_ps(DZ, DZ));
+				__m256 Dot = _mm256_mul_ps(DX, AX);
+				Dot = _mm256_add_ps(Dot, _mm256_mul_ps(DY, AY));
+				Dot = _mm256_add_ps(Dot, _mm256_mul_ps(DZ, AZ));
+
+				// dot(C - Cam, Axis) > Cutoff * |C - Cam| + Radius
+				const __m256 Threshold = _mm256_add_ps(_mm256_mul_ps(Cutoff, _mm256_sqrt_ps(LengthSq)), R);
+				BackFacing = _mm256_cmp_ps(Dot, Threshold, _CMP_GT_OQ);
+			}
+			Visible = _mm256_andnot_ps(BackFacing, Visible);
+		}
+
+		// 3. 범위 밖 레인 제거 후 보이는 메쉴릿 번호 기록
+		const uint32 Lanes = std::min(SimdWidth, Count - Base);
+		const uint32 Mask = static_cast<uint32>(_mm256_movemask_ps(Visible)) & ((1u << Lanes) - 1u);
+		for (uint32 Lane = 0; Lane < Lanes; ++Lane)
+		{
+			if (Mask & (1u << Lane))
+			{
+				OutVisibleMeshlets[NumVisible++] = Index + Lane;
+			}
+		}
+	}
+	return NumVisible;
+}
+
+// ─────────────────────────────
+// FMeshletCuller
+// ─────────────────────────────
+
+FMeshletCuller::~FMeshletCuller()
+{
+	Release();
+}
+
+void FMeshletCuller::Initialize(D3D11RHI* InRHI)
+{
+	RHI = InRHI;
+}
+
+void FMeshletCuller::Release()
+{
+	if (DynamicIndexBuffer)
+	{
+		DynamicIndexBuffer->Release();
+		DynamicIndexBuffer = nullptr;
+	}
+	Capacity = 0;
+}
+
+bool FMeshletCuller::EnsureCapacity(uint32 InIndexCount)
+{
+	if (DynamicIndexBuffer && InIndexCount <= Capacity)
+	{
+		return true;
+	}
+
+	Release();
+
+	// 매 프레임 재생성하지 않도록 여유를 두고 키움
+	const uint32 NewCapacity = std::max<uint32>(InIndexCount + InIndexCount / 2, 64 * 1024);
+
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.Usage = D3D11_USAGE_DYNAMIC;
+	Desc.ByteWidth = static_cast<UINT>(sizeof(uint32) * NewCapacity);
+	Desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	HRESULT hr = RHI->GetDevice()->CreateBuffer(&Desc, nullptr, &DynamicIndexBuffer);
+	if (FAILED(hr))
+	{
+		UE_LOG("FMeshletCuller: 동적 인덱스 버퍼 생성 실패 (%u indices)", NewCapacity);
+		DynamicIndexBuffer = nullptr;
+		return false;
+	}
+
+	Capacity = NewCapacity;
+	return true;
+}
+
+void FMeshletCuller::CullAndCompact(TArray<FMeshBatchElement>& InOutBatches, const FSceneView& View)
+{
+	if (!RHI)
+	{
+		return;
+	}
+
+	auto CpuTimeStart = std::chrono::high_resolution_clock::now();
+
+	FMeshletStats& Stats = FMeshletStatManager::GetInstance().GetStatsSlot();
+	VisibleMeshlets.clear();
+	PendingBatches.clear();
+
+	// --- 1. 배치별 컬링 ---
+	uint32 TotalIndexCount = 0;
+	bool bHasCulledBatch = false;
+	for (uint32 BatchIndex = 0; BatchIndex < static_cast<uint32>(InOutBatches.size()); ++BatchIndex)
+	{
+		FMeshBatchElement& Batch = InOutBatches[BatchIndex];
+		const FMeshletCullData* Data = Batch.MeshletCullData;
+		if (!Data || Data->IsEmpty() || !Data->SourceIndices)
+		{
+			continue;
+		}
+
+		uint32 First = 0;
+		uint32 Count = 0;
+		Data->FindMeshletRange(Batch.StartIndex, Batch.IndexCount, First, Count);
+		if (Count <= 1)
+		{
+			continue;
+		}
+
+		const FMeshletCullParams Params = FMeshletCullParams::Make(Batch.WorldMatrix, View);
+
+		const uint32 VisibleBegin = static_cast<uint32>(VisibleMeshlets.size());
+		VisibleMeshlets.resize(VisibleBegin + Count);
+		const uint32 VisibleCount = CullMeshlets(*Data, First, Count, Params, &VisibleMeshlets[VisibleBegin]);
+		VisibleMeshlets.resize(VisibleBegin + VisibleCount);
+
+		uint32 VisibleIndexCount = 0;
+		for (uint32 i = VisibleBegin; i < VisibleBegin + VisibleCount; ++i)
+		{
+			VisibleIndexCount += Data->IndexCount[VisibleMeshlets[i]];
+		}
+
+		Stats.TestedMeshlets += Count;
+		Stats.VisibleMeshlets += VisibleCount;
+		Stats.TestedTriangles += Batch.IndexCount / 3;
+		Stats.VisibleTriangles += VisibleIndexCount / 3;
+
+		if (VisibleCount == Count)
+		{
+			// 전부 보이면 정적 인덱스 버퍼 그대로 사용
+			VisibleMeshlets.resize(VisibleBegin);
+		}
+		else if (VisibleCount == 0)
+		{
+			Batch.IndexCount = 0;
+			bHasCulledBatch = true;
+			++Stats.CulledBatches;
+		}
+		else
+		{
+			PendingBatches.push_back({ BatchIndex, VisibleBegin, VisibleCount, VisibleIndexCount, Data });
+			TotalIndexCount += VisibleIndexCount;
+		}
+	}
+
+	// --- 2. 보이는 메쉴릿 인덱스를 동적 인덱스 버퍼로 압축 ---
+	if (TotalIndexCount > 0 && EnsureCapacity(TotalIndexCount))
+	{
+		ID3D11DeviceContext* Context = RHI->GetDeviceContext();
+		D3D11_MAPPED_SUBRESOURCE Mapped;
+		if (SUCCEEDED(Context->Map(DynamicIndexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+		{
+			uint32* Dest = static_cast<uint32*>(Mapped.pData);
+			uint32 WriteOffset = 0;
+			for (const FPendingBatch& Pending : PendingBatches)
+			{
+				FMeshBatchElement& Batch = InOutBatches[Pending.BatchIndex];
+				const TArray<uint32>& Source = *Pending.Data->SourceIndices;
+
+				Batch.IndexBuffer = DynamicIndexBuffer;
+				Batch.StartIndex = WriteOffset;
+				Batch.IndexCount = Pending.IndexCount;
+
+				for (uint32 i = Pending.VisibleBegin; i < Pending.VisibleBegin + Pending.VisibleCount; ++i)
+				{
+					const uint32 Meshlet = VisibleMeshlets[i];
+					const uint32 MeshletIndexCount = Pending.Data->IndexCount[Meshlet];
+					std::memcpy(Dest + WriteOffset, Source.data() + Pending.Data->StartIndex[Meshlet], sizeof(uint32) * MeshletIndexCount);
+					WriteOffset += MeshletIndexCount;
+				}
+			}
+			Context->Unmap(DynamicIndexBuffer, 0);
+
+			Stats.CompactedBatches += static_cast<uint32>(PendingBatches.size());
+			Stats.UploadedIndexBytes += WriteOffset * sizeof(uint32);
+		}
+	}
+
+	// --- 3. 전부 컬링된 배치 제거 ---
+	if (bHasCulledBatch)
+	{
+		InOutBatches.erase(std::remove_if(InOutBatches.begin(), InOutBatches.end(), [](const FMeshBatchElement& Batch)
+			{
+				return Batch.MeshletCullData && Batch.IndexCount == 0;
+			}), InOutBatches.end());
+	}
+
+	auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double, std::milli> CpuTimeMs = CpuTimeEnd - CpuTimeStart;
+	Stats.CullTimeMS += CpuTimeMs.count();
+}
+
+void FMeshletCuller::RunBenchmark(uint32 InViewCount)
+{
+	using FClock = std::chrono::high_resolution_clock;
+	constexpr uint32 Repeats = 20;	// 뷰마다 커널 반복 횟수 (측정 오차 완화)
+
+	const uint32 ViewCount = std::max(1u, InViewCount);
+	uint64 TotalMeshlets = 0, TotalVisibleMeshlets = 0;
+	uint64 TotalTriangles = 0, TotalCulledTriangles = 0, TotalFalseCulls = 0;
+	uint64 TotalKernelMismatches = 0;
+	double TotalKernelMS = 0.0;
+	uint32 MeshCount = 0;
+	const bool bCompareKernels = IsMeshletAVXSupported();
+
+	TArray<uint32> Visible;
+	TArray<uint32> ScalarVisible;
+	TArray<uint8> bVisible;
+	for (UStaticMesh* Mesh : UResourceManager::GetInstance().GetAll<UStaticMesh>())
+	{
+		const FMeshletCullData* Data = Mesh ? Mesh->GetMeshletCullData() : nullptr;
+		const FStaticMesh* Asset = Mesh ? Mesh->GetStaticMeshAsset() : nullptr;
+		if (!Data || Data->IsEmpty() || !Asset)
+		{
+			continue;
+		}
+
+		const TArray<FNormalVertex>& Vertices = Asset->Vertices;
+		const TArray<uint32>& Indices = Asset->Indices;
+		const FAABB Bound = Mesh->GetLocalBound();
+		const FVector Center = Bound.GetCenter();
+		const float Radius = std::max(Bound.GetHalfExtent().Size(), KINDA_SMALL_NUMBER);
+		const FMatrix Projection = FMatrix::PerspectiveFovLH(PI / 3.0f, 16.0f / 9.0f, Radius * 0.01f, Radius * 10.0f);
+
+		uint64 MeshTriangles = 0, MeshCulledTriangles = 0, MeshFalseCulls = 0, MeshVisibleMeshlets = 0;
+		double MeshKernelMS = 0.0;
+		Visible.resize(Data->MeshletCount);
+		ScalarVisible.resize(Data->MeshletCount);
+		bVisible.resize(Data->MeshletCount);
+
+		for (uint32 v = 0; v < ViewCount; ++v)
+		{
+			// 피보나치 구 위의 방향에서, 거리와 시선을 바꿔 가며 일부가 절두체 밖으로 나가게 함
+			const float Z = 1.0f - 2.0f * (v + 0.5f) / ViewCount;
+			const float Ring = std::sqrt(std::max(0.0f, 1.0f - Z * Z));
+			const float Angle = v * 2.39996323f;
+			const FVector Direction(Ring * std::cos(Angle), Ring * std::sin(Angle), Z);
+			const FVector Eye = Center + Direction * (Radius * (1.2f + static_cast<float>(v % 3)));
+			const FVector Up = std::fabs(Z) > 0.99f ? FVector(1.0f, 0.0f, 0.0f) : FVector(0.0f, 0.0f, 1.0f);
+			const FVector At = Center + FVector::Cross(Direction, Up).GetNormalized() * (Radius * 0.5f * static_cast<float>(v % 2));
+
+			const FFrustum Frustum = CreateFrustumFromViewProjection(FMatrix::LookAtLH(Eye, At, Up) * Projection);
+			const FMeshletCullParams Params = FMeshletCullParams::Make(FMatrix::Identity(), Frustum, Eye, false);
+
+			uint32 NumVisible = 0;
+			const FClock::time_point Start = FClock::now();
+			for (uint32 r = 0; r < Repeats; ++r)
+			{
+				NumVisible = CullMeshlets(*Data, 0, Data->MeshletCount, Params, Visible.data());
+			}
+			MeshKernelMS += std::chrono::duration<double, std::milli>(FClock::now() - Start).count() / Repeats;
+			MeshVisibleMeshlets += NumVisible;
+
+			// 스칼라 폴백은 AVX 커널과 같은 메쉴릿을 남겨야 함
+			if (bCompareKernels)
+			{
+				const uint32 NumScalarVisible = CullMeshlets_Scalar(*Data, 0, Data->MeshletCount, Params, ScalarVisible.data());
+				if (NumScalarVisible != NumVisible || !std::equal(Visible.begin(), Visible.begin() + NumVisible, ScalarVisible.begin()))
+				{
+					++TotalKernelMismatches;
+				}
+			}
+
+			std::fill(bVisible.begin(), bVisible.end(), 0);
+			for (uint32 i = 0; i < NumVisible; ++i)
+			{
+				bVisible[Visible[i]] = 1;
+			}
+
+			// 컬링된 메쉴릿에 절두체 안쪽 정점을 가진 앞면 삼각형이 있으면 잘못된 컬링
+			for (uint32 m = 0; m < Data->MeshletCount; ++m)
+			{
+				const uint32 TriangleCount = Data->IndexCount[m] / 3;
+				MeshTriangles += TriangleCount;
+				if (bVisible[m])
+				{
+					continue;
+				}
+				MeshCulledTriangles += TriangleCount;
+
+				for (uint32 i = Data->StartIndex[m]; i < Data->StartIndex[m] + Data->IndexCount[m]; i += 3)
+				{
+					const FVector& P0 = Vertices[Indices[i]].pos;
+					const FVector& P1 = Vertices[Indices[i + 1]].pos;
+					const FVector& P2 = Vertices[Indices[i + 2]].pos;
+					if (FVector::Dot(P0 - Eye, FVector::Cross(P1 - P0, P2 - P0)) >= 0.0f)
+					{
+						continue; // 뒷면 (메쉴릿 노멀 콘과 같은 규약)
+					}
+					for (const FVector* P : { &P0, &P1, &P2 })
+					{
+						bool bInside = true;
+						for (const FPlane& Plane : Params.Planes)
+						{
+							bInside = bInside && (Plane.Normal.X * P->X + Plane.Normal.Y * P->Y + Plane.Normal.Z * P->Z - Plane.Distance) >= 0.0f;
+						}
+						if (bInside)
+						{
+							++MeshFalseCulls;
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		UE_LOG("[MeshletBench] %s: %u meshlets, visible %.1f%%, triangles culled %.1f%%, kernel %.2f us/view, false culls %llu",
+			Asset->PathFileName.c_str(), Data->MeshletCount,
+			100.0 * MeshVisibleMeshlets / (static_cast<double>(Data->MeshletCount) * ViewCount),
+			MeshTriangles ? 100.0 * MeshCulledTriangles / MeshTriangles : 0.0,
+			1000.0 * MeshKernelMS / ViewCount, MeshFalseCulls);
+
+		++MeshCount;
+		TotalMeshlets += static_cast<uint64>(Data->MeshletCount) * ViewCount;
+		TotalVisibleMeshlets += MeshVisibleMeshlets;
+		TotalTriangles += MeshTriangles;
+		TotalCulledTriangles += MeshCulledTriangles;
+		TotalFalseCulls += MeshFalseCulls;
+		TotalKernelMS += MeshKernelMS;
+	}
+
+	if (MeshCount == 0)
+	{
+		UE_LOG("[MeshletBench] 메쉴릿이 있는 스태틱 메시가 없습니다.");
+		return;
+	}
+
+	UE_LOG("[MeshletBench] %u meshes x %u views (%s kernel): visible %.1f%%, triangles culled %.1f%%, %.1f ns/meshlet, false culls %llu, scalar/AVX mismatched views %llu%s (%s)",
+		MeshCount, ViewCount, bCompareKernels ? "AVX" : "scalar",
+		100.0 * TotalVisibleMeshlets / TotalMeshlets,
+		TotalTriangles ? 100.0 * TotalCulledTriangles / TotalTriangles : 0.0,
+		1.0e6 * TotalKernelMS / TotalMeshlets, TotalFalseCulls, TotalKernelMismatches, bCompareKernels ? "" : " (not compared)",
+		TotalFalseCulls == 0 && TotalKernelMismatches == 0 ? "OK" : "FAILED");
+}
@@ -0,0 +1,98 @@
+﻿#pragma once
+#include "Frustum.h"
+
+class D3D11RHI;
+class FSceneView;
+struct FMeshBatchElement;
+struct FMeshlet;
+
+// 메쉴릿 컬링용 SoA 데이터 (UStaticMesh가 소유)
+// AVX로 8개씩 읽으므로 배열 끝에 8개 패딩을 둠
+struct FMeshletCullData
+{
+	TArray<float> CenterX, CenterY, CenterZ, Radius;
+	TArray<float> ConeAxisX, ConeAxisY, ConeAxisZ, ConeCutoff;
+	TArray<uint32> StartIndex, IndexCount;
+	uint32 MeshletCount = 0;
+
+	// 압축 시 복사할 원본 인덱스 (FStaticMesh::Indices, LOD0)
+	const TArray<uint32>* SourceIndices = nullptr;
+
+	void Build(const TArray<FMeshlet>& Meshlets, const TArray<uint32>* InSourceIndices);
+	void Reset();
+	bool IsEmpty() const { return MeshletCount == 0; }
+
+	// 인덱스 구간 [InStartIndex, InStartIndex + InIndexCount)에 속한 메쉴릿 범위. 메쉴릿이 구간을 정확히 덮지 않으면 OutCount = 0
+	void FindMeshletRange(uint32 InStartIndex, uint32 InIndexCount, uint32& OutFirst, uint32& OutCount) const;
+};
+
+// 메시 로컬 공간으로 옮긴 컬링 입력
+struct FMeshletCullParams
+{
+	FPlane Planes[6];           // 안쪽 >= 0
+	FVector CameraPosition;     // 원근 투영 backface 콘 테스트 기준
+	FVector ViewDirection;      // 직교 투영 backface 콘 테스트 기준
+	bool bOrthographic = false;
+	bool bConeCulling = true;   // 음수 스케일(미러링)이면 와인딩이 뒤집히므로 끔
+
+	// 월드 행렬(row-vector, p' = p * M)의 역변환으로 뷰 정보를 메시 로컬 공간으로 옮김
+	static FMeshletCullParams Make(const FMatrix& WorldMatrix, const FSceneView& View);
+	static FMeshletCullParams Make(const FMatrix& WorldMatrix, const FFrustum& Frustum, const FVector& ViewLocation, bool bInOrthographic);
+};
+
+// [First, First + Count) 메쉴릿을 절두체 + 노멀 콘으로 컬링해 보이는 메쉴릿 번호를 OutVisibleMeshlets에 기록 (최대 Count개)
+// @return 보이는 메쉴릿 수
+using FCullMeshletsKernel = uint32(*)(const FMeshletCullData& Data, uint32 First, uint32 Count, const FMeshletCullParams& Params, uint32* OutVisibleMeshlets);
+
+uint32 CullMeshlets_Scalar(const FMeshletCullData& Data, uint32 First, uint32 Count, const FMeshletCullParams& Params, uint32* OutVisibleMeshlets);
+// AVX를 지원하는 CPU/OS에서만 호출 가능 (IsMeshletAVXSupported)
+uint32 CullMeshlets_AVX(const FMeshletCullData& Data, uint32 First, uint32 Count, const FMeshletCullParams& Params, uint32* OutVisibleMeshlets);
+
+// CPUID/XGETBV로 AVX 명령과 OS의 YMM 상태 저장 지원을 확인 (최초 호출 시 한 번 검사)
+bool IsMeshletAVXSupported();
+
+// 시작 시 CPU 기능에 맞춰 고른 커널로 컬링 (AVX 미지원 CPU는 스칼라 커널)
+uint32 CullMeshlets(const FMeshletCullData& Data, uint32 First, uint32 Count, const FMeshletCullParams& Params, uint32* OutVisibleMeshlets);
+
+/**
+ * 메인 패스 배치 중 메쉴릿 데이터가 있는 것을 메쉴릿 단위로 컬링하고,
+ * 보이는 메쉴릿의 인덱스만 프레임 동적 인덱스 버퍼에 모아 배치의 인덱스 범위를 교체합니다.
+ * 전부 보이면 원래 정적 인덱스 버퍼를 그대로 쓰고, 전부 컬링되면 배치를 제거합니다.
+ * 그림자 패스는 카메라 밖 캐스터도 그려야 하므로 적용하지 않습니다.
+ */
+class FMeshletCuller
+{
+public:
+	FMeshletCuller() = default;
+	~FMeshletCuller();
+
+	void Initialize(D3D11RHI* InRHI);
+	void Release();
+
+	void CullAndCompact(TArray<FMeshBatchElement>& InOutBatches, const FSceneView& View);
+
+	// 로드된 모든 스태틱 메시(번들 모델)를 메시 주위 InViewCount개의 카메라에서 컬링해
+	// 커널 시간, 컬링 비율, 잘못 컬링된 앞면 삼각형 수(0이어야 함)를 로그로 출력 (GPU 불필요)
+	// AVX를 쓸 수 있으면 스칼라 커널과 결과가 같은지도 비교
+	static void RunBenchmark(uint32 InViewCount);
+
+private:
+	bool EnsureCapacity(uint32 InIndexCount);
+
+	struct FPendingBatch
+	{
+		uint32 BatchIndex;
+		uint32 VisibleBegin; // VisibleMeshlets 내 시작 위치
+		uint32 VisibleCount;
+		uint32 IndexCount;
+		const FMeshletCullData* Data;
+	};
+
+	D3D11RHI* RHI = nullptr;
+	ID3D11Buffer* DynamicIndexBuffer = nullptr;
+	uint32 Capacity = 0; // 인덱스 개수
+
+	// 프레임 간 재사용하는 작업 버퍼
+	TArray<uint32> VisibleMeshlets;
+	TArray<FPendingBatch> PendingBatches;
+};
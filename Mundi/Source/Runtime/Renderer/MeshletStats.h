@@ -0,0 +1,67 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 메쉴릿 CPU 컬링 통계 (프레임 단위, 모든 뷰 합산)
+struct FMeshletStats
+{
+	uint32 TestedMeshlets = 0;
+	uint32 VisibleMeshlets = 0;
+	uint32 TestedTriangles = 0;
+	uint32 VisibleTriangles = 0;
+	uint32 CompactedBatches = 0;   // 동적 인덱스 버퍼로 교체된 배치 수
+	uint32 CulledBatches = 0;      // 메쉴릿이 전부 컬링되어 제거된 배치 수
+	uint32 UploadedIndexBytes = 0; // 동적 인덱스 버퍼로 올린 크기
+	double CullTimeMS = 0.0;       // 컬링 + 압축 + 업로드 CPU 시간
+
+	void Reset()
+	{
+		*this = FMeshletStats();
+	}
+
+	// 컬링된 삼각형 비율 (%)
+	float GetTriangleCullRate() const
+	{
+		if (TestedTriangles == 0)
+		{
+			return 0.0f;
+		}
+		return 100.0f * static_cast<float>(TestedTriangles - VisibleTriangles) / static_cast<float>(TestedTriangles);
+	}
+};
+
+// 메쉴릿 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FMeshletStatManager
+{
+public:
+	static FMeshletStatManager& GetInstance()
+	{
+		static FMeshletStatManager Instance;
+		return Instance;
+	}
+
+	// 매 프레임 렌더링 시작 시 호출
+	void ResetFrameStats()
+	{
+		CurrentStats.Reset();
+	}
+
+	// 뷰마다 누적
+	FMeshletStats& GetStatsSlot()
+	{
+		return CurrentStats;
+	}
+
+	const FMeshletStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+private:
+	FMeshletStatManager() = default;
+	~FMeshletStatManager() = default;
+	FMeshletStatManager(const FMeshletStatManager&) = delete;
+	FMeshletStatManager& operator=(const FMeshletStatManager&) = delete;
+
+	FMeshletStats CurrentStats;
+};
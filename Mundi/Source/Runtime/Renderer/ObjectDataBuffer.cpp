@@ -0,0 +1,212 @@
+﻿#include "pch.h"
+#include "ObjectDataBuffer.h"
+#include "D3D11RHI.h"
+#include "MeshBatchElement.h"
+#include "ParallelFor.h"
+
+namespace
+{
+	void PackObject(const FMeshBatchElement& Batch, FObjectGPUData& OutData)
+	{
+		FObjectGPUData Data;
+		Data.WorldMatrix = Batch.WorldMatrix;
+		Data.WorldInverseTranspose = Batch.WorldMatrix.InverseAffine().Transpose();
+		Data.PositionDequantScale = Batch.PositionDequantScale;
+		Data.PositionDequantOffset = Batch.PositionDequantOffset;
+		Data.InstanceColor = Batch.InstanceColor;
+		Data.ObjectID = Batch.ObjectID;
+
+		// 한 번에 통째로 기록 (쓰기 결합 메모리에서 부분 쓰기/읽기를 피함)
+		OutData = Data;
+	}
+}
+
+FObjectDataBuffer::~FObjectDataBuffer()
+{
+	Release();
+}
+
+void FObjectDataBuffer::Initialize(D3D11RHI* InRHI, FTaskPool* InTaskPool)
+{
+	RHI = InRHI;
+	TaskPool = InTaskPool;
+}
+
+void FObjectDataBuffer::Release()
+{
+	if (ObjectBufferSRV)
+	{
+		ObjectBufferSRV->Release();
+		ObjectBufferSRV = nullptr;
+	}
+	if (ObjectBuffer)
+	{
+		ObjectBuffer->Release();
+		ObjectBuffer = nullptr;
+	}
+	if (InstanceIndexBuffer)
+	{
+		InstanceIndexBuffer->Release();
+		InstanceIndexBuffer = nullptr;
+	}
+	Capacity = 0;
+}
+
+bool FObjectDataBuffer::EnsureCapacity(uint32 InNumObjects)
+{
+	if (ObjectBuffer && InNumObjects <= Capacity)
+	{
+		return true;
+	}
+
+	Release();
+
+	// 매 프레임 재생성하지 않도록 여유를 두고 키움
+	const uint32 NewCapacity = std::max<uint32>(InNumObjects + InNumObjects / 2, 4 * 1024);
+
+	HRESULT hr = RHI->CreateStructuredBuffer(sizeof(FObjectGPUData), NewCapacity, nullptr, &ObjectBuffer);
+	if (SUCCEEDED(hr))
+	{
+		hr = RHI->CreateStructuredBufferSRV(ObjectBuffer, &ObjectBufferSRV);
+	}
+
+	if (SUCCEEDED(hr))
+	{
+		// 인스턴스 i가 OBJECTINDEX = StartInstanceLocation + i를 읽도록 0부터 채운 정적 스트림
+		TArray<uint32> Indices;
+		Indices.resize(NewCapacity);
+		for (uint32 i = 0; i < NewCapacity; ++i)
+		{
+			Indices[i] = i;
+		}
+
+		D3D11_BUFFER_DESC Desc = {};
+		Desc.Usage = D3D11_USAGE_IMMUTABLE;
+		Desc.ByteWidth = static_cast<UINT>(sizeof(uint32) * NewCapacity);
+		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+
+		D3D11_SUBRESOURCE_DATA InitData = {};
+		InitData.pSysMem = Indices.data();
+		hr = RHI->GetDevice()->CreateBuffer(&Desc, &InitData, &InstanceIndexBuffer);
+	}
+
+	if (FAILED(hr))
+	{
+		UE_LOG("FObjectDataBuffer: 오브젝트 데이터 버퍼 생성 실패 (%u objects)", NewCapacity);
+		Release();
+		return false;
+	}
+
+	Capacity = NewCapacity;
+	return true;
+}
+
+void FObjectDataBuffer::Pack(const FMeshBatchElement* InBatches, uint32 InNumBatches, FObjectGPUData* OutData, FTaskPool* InTaskPool, uint32 InMaxThreads)
+{
+	if (InNumBatches == 0)
+	{
+		return;
+	}
+
+	// 배치마다 독립적인 역행렬 계산이 대부분이므로 연속 구간으로 나눠 병렬 처리
+	const uint32 NumThreads = GetParallelThreadCount(InTaskPool, InNumBatches, MinObjectsPerThread, InMaxThreads);
+	const uint32 PerThread = (InNumBatches + NumThreads - 1) / NumThreads;
+
+	ParallelFor(InTaskPool, NumThreads, [&](uint32 ThreadIndex)
+	{
+		const uint32 Begin = std::min(InNumBatches, ThreadIndex * PerThread);
+		const uint32 End = std::min(InNumBatches, Begin + PerThread);
+		for (uint32 Index = Begin; Index < End; ++Index)
+		{
+			PackObject(InBatches[Index], OutData[Index]);
+		}
+	});
+}
+
+bool FObjectDataBuffer::UploadAndBind(const TArray<FMeshBatchElement>& InBatches)
+{
+	const uint32 NumObjects = static_cast<uint32>(InBatches.size());
+	if (!RHI || NumObjects == 0 || !EnsureCapacity(NumObjects))
+	{
+		return false;
+	}
+
+	ID3D11DeviceContext* DeviceContext = RHI->GetDeviceContext();
+
+	// 패스 전체를 한 번의 DISCARD Map으로 기록 (이전 패스의 드로우는 드라이버가 이전 내용을 유지)
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	if (FAILED(DeviceContext->Map(ObjectBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+	{
+		return false;
+	}
+	Pack(InBatches.data(), NumObjects, static_cast<FObjectGPUData*>(Mapped.pData), TaskPool);
+	DeviceContext->Unmap(ObjectBuffer, 0);
+
+	DeviceContext->VSSetShaderResources(ShaderResourceSlot, 1, &ObjectBufferSRV);
+	DeviceContext->PSSetShaderResources(ShaderResourceSlot, 1, &ObjectBufferSRV);
+
+	UINT Stride = sizeof(uint32);
+	UINT Offset = 0;
+	DeviceContext->IASetVertexBuffers(InstanceStreamSlot, 1, &InstanceIndexBuffer, &Stride, &Offset);
+	return true;
+}
+
+void FObjectDataBuffer::RunBenchmark(uint32 InNumObjects, FTaskPool* InTaskPool)
+{
+	using FClock = std::chrono::high_resolution_clock;
+	auto ElapsedMS = [](FClock::time_point Start)
+	{
+		return std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+	};
+
+	const uint32 NumObjects = std::max(1u, InNumObjects);
+
+	// 합성 배치: 비균등 스케일 + 이동 (역전치 행렬이 단위 행렬이 되지 않도록)
+	TArray<FMeshBatchElement> Batches;
+	Batches.resize(NumObjects);
+	for (uint32 i = 0; i < NumObjects; ++i)
+	{
+		FMeshBatchElement& Batch = Batches[i];
+		const FVector Scale(1.0f + static_cast<float>(i % 7), 1.0f + static_cast<float>(i % 3), 0.5f + static_cast<float>(i % 5));
+		const FVector Location(static_cast<float>(i % 100), static_cast<float>((i / 100) % 100), static_cast<float>(i / 10000));
+		Batch.WorldMatrix = FMatrix::MakeScale(Scale) * FMatrix::MakeTranslation(Location);
+		Batch.InstanceColor = FLinearColor(static_cast<float>(i % 256) / 255.0f, 0.0f, 0.0f, 0.0f);
+		Batch.ObjectID = i;
+	}
+
+	TArray<FObjectGPUData> SerialData;
+	TArray<FObjectGPUData> ParallelData;
+	SerialData.resize(NumObjects);
+	ParallelData.resize(NumObjects);
+
+	// 캐시 예열 (측정에서 최초 접근 비용 제외)
+	Pack(Batches.data(), NumObjects, SerialData.data(), InTaskPool, 1);
+
+	FClock::time_point Start = FClock::now();
+	Pack(Batches.data(), NumObjects, SerialData.data(), InTaskPool, 1);
+	const double SerialMS = ElapsedMS(Start);
+
+	const uint32 NumThreads = GetParallelThreadCount(InTaskPool, NumObjects, MinObjectsPerThread);
+	Start = FClock::now();
+	Pack(Batches.data(), NumObjects, ParallelData.data(), InTaskPool, 0);
+	const double ParallelMS = ElapsedMS(Start);
+
+	// 병렬 결과는 단일 스레드 결과와 비트 단위로 같아야 하고, 배치 i는 인덱스 i에 있어야 함
+	uint32 Mismatches = 0;
+	for (uint32 i = 0; i < NumObjects; ++i)
+	{
+		if (memcmp(&SerialData[i], &ParallelData[i], sizeof(FObjectGPUData)) != 0 || ParallelData[i].ObjectID != Batches[i].ObjectID)
+		{
+			++Mismatches;
+		}
+	}
+
+	// 기존 방식: 드로우마다 ModelBuffer + ColorBuffer 갱신
+	const double UploadKB = static_cast<double>(NumObjects) * sizeof(FObjectGPUData) / 1024.0;
+	const double PerDrawKB = static_cast<double>(NumObjects) * (sizeof(ModelBufferType) + sizeof(ColorBufferType)) / 1024.0;
+
+	UE_LOG("[ObjectDataBench] %u objects: pack 1 thread %.3f ms, %u threads %.3f ms (x%.2f)",
+		NumObjects, SerialMS, NumThreads, ParallelMS, ParallelMS > 0.0 ? SerialMS / ParallelMS : 0.0);
+	UE_LOG("[ObjectDataBench] 1 map / %.1f KB (per-draw path: %u constant updates / %.1f KB), mismatches %u",
+		UploadKB, NumObjects * 2, PerDrawKB, Mismatches);
+}
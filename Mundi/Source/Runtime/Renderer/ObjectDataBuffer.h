@@ -0,0 +1,65 @@
+﻿#pragma once
+#include "Color.h"
+
+class D3D11RHI;
+class FTaskPool;
+struct FMeshBatchElement;
+struct ID3D11Buffer;
+struct ID3D11ShaderResourceView;
+
+// 오브젝트별 GPU 데이터 (Shaders/Common/ObjectData.hlsl의 FObjectData와 일치, 192 bytes)
+struct FObjectGPUData
+{
+	FMatrix WorldMatrix;
+	FMatrix WorldInverseTranspose;	// 비균등 스케일 노멀 변환용
+	FVector4 PositionDequantScale;	// 압축 정점 위치 복원 (COMPRESSED_VERTEX 변형만 사용)
+	FVector4 PositionDequantOffset;
+	FLinearColor InstanceColor;
+	uint32 ObjectID = 0;
+	uint32 Padding[3] = {};
+};
+static_assert(sizeof(FObjectGPUData) == 192, "FObjectGPUData must match FObjectData in ObjectData.hlsl");
+
+/**
+ * 패스의 모든 배치에 대한 오브젝트별 데이터를 구조화 버퍼 하나에 모아 한 번의 Map으로 업로드
+ * - 드로우마다 ModelBuffer(b0)/ColorBuffer(b3)를 갱신하지 않고, 배치 인덱스를 StartInstanceLocation으로 넘김
+ * - D3D11에는 루트 상수가 없고 SV_InstanceID에는 StartInstanceLocation이 더해지지 않으므로,
+ *   0..N-1을 담은 인스턴스 스트림(IA 슬롯 1, OBJECTINDEX)으로 셰이더에 인덱스를 전달
+ * 패킹(Pack)은 CPU만 사용하므로 GPU 없이 측정/검증 가능
+ */
+class FObjectDataBuffer
+{
+public:
+	// 스레드 하나가 맡는 최소 오브젝트 수
+	static constexpr uint32 MinObjectsPerThread = 2048;
+
+	// 셰이더 바인딩 위치 (ObjectData.hlsl과 일치)
+	static constexpr uint32 ShaderResourceSlot = 20;	// t20, VS+PS
+	static constexpr uint32 InstanceStreamSlot = 1;		// IA 슬롯 1, OBJECTINDEX
+
+	FObjectDataBuffer() = default;
+	~FObjectDataBuffer();
+
+	void Initialize(D3D11RHI* InRHI, FTaskPool* InTaskPool);
+	void Release();
+
+	// 배치 i의 데이터를 OutData[i]에 기록. InMaxThreads가 0이면 풀의 스레드 수까지 사용 (풀이 없으면 단일 스레드)
+	// OutData는 매핑된 GPU 메모리일 수 있으므로 읽지 않고 쓰기만 함
+	static void Pack(const FMeshBatchElement* InBatches, uint32 InNumBatches, FObjectGPUData* OutData, FTaskPool* InTaskPool, uint32 InMaxThreads = 0);
+
+	// 배치 목록을 패킹해 업로드하고 SRV와 인스턴스 스트림을 바인딩 (실패 시 false)
+	bool UploadAndBind(const TArray<FMeshBatchElement>& InBatches);
+
+	// 합성 배치로 패킹 시간(단일/병렬)을 측정하고 두 결과가 같은지 검증 (GPU 불필요)
+	static void RunBenchmark(uint32 InNumObjects, FTaskPool* InTaskPool);
+
+private:
+	bool EnsureCapacity(uint32 InNumObjects);
+
+	D3D11RHI* RHI = nullptr;
+	FTaskPool* TaskPool = nullptr;
+	ID3D11Buffer* ObjectBuffer = nullptr;
+	ID3D11ShaderResourceView* ObjectBufferSRV = nullptr;
+	ID3D11Buffer* InstanceIndexBuffer = nullptr;	// 0..Capacity-1, 인스턴스당 uint32 하나
+	uint32 Capacity = 0;	// 오브젝트 개수
+};
@@ -0,0 +1,180 @@
+﻿#include "pch.h"
+#include "RenderScene.h"
+#include "SceneComponent.h"
+#include "MeshComponent.h"
+#include "StaticMeshComponent.h"
+#include "BillboardComponent.h"
+#include "DecalComponent.h"
+#include "LineComponent.h"
+#include "HeightFogComponent.h"
+#include "DirectionalLightComponent.h"
+#include "AmbientLightComponent.h"
+#include "PointLightComponent.h"
+#include "SpotLightComponent.h"
+#include "SkyDomeActor.h"
+#include "Gizmo/GizmoArrowComponent.h"
+
+void FRenderScene::AddProxy(USceneComponent* Component, bool bEditorActorComponent)
+{
+	if (!Component || !Component->GetOwner() || ProxyLocations.Contains(Component))
+	{
+		return;
+	}
+
+	FSceneProxy Proxy;
+	ESceneProxyType Type = ESceneProxyType::Count;
+	if (!ClassifyProxy(Component, bEditorActorComponent, Proxy, Type))
+	{
+		return;
+	}
+	CacheProxyState(Proxy);
+
+	TArray<FSceneProxy>& TypeProxies = Proxies[static_cast<int32>(Type)];
+	ProxyLocations.Add(Component, FProxyLocation{ Type, TypeProxies.Num() });
+	TypeProxies.Add(Proxy);
+	MarkRenderStateDirty();
+}
+
+void FRenderScene::RemoveProxy(USceneComponent* Component)
+{
+	const FProxyLocation* Location = ProxyLocations.Find(Component);
+	if (!Location)
+	{
+		return;
+	}
+
+	// 마지막 프록시를 빈 자리로 옮겨 배열을 빈틈없이 유지
+	TArray<FSceneProxy>& TypeProxies = Proxies[static_cast<int32>(Location->Type)];
+	const int32 Index = Location->Index;
+	const int32 LastIndex = TypeProxies.Num() - 1;
+	if (Index != LastIndex)
+	{
+		TypeProxies[Index] = TypeProxies[LastIndex];
+		ProxyLocations[TypeProxies[Index].Component].Index = Index;
+	}
+	TypeProxies.pop_back();
+	if (Location->Type == ESceneProxyType::Decal)
+	{
+		DecalReceiverCache.Remove(static_cast<UDecalComponent*>(Component));
+	}
+	ProxyLocations.Remove(Component);
+	MarkRenderStateDirty();
+}
+
+void FRenderScene::UpdateProxy(USceneComponent* Component)
+{
+	const FProxyLocation* Location = ProxyLocations.Find(Component);
+	if (!Location)
+	{
+		return;
+	}
+
+	CacheProxyState(Proxies[static_cast<int32>(Location->Type)][Location->Index]);
+	MarkRenderStateDirty();
+}
+
+void FRenderScene::Clear()
+{
+	for (TArray<FSceneProxy>& TypeProxies : Proxies)
+	{
+		TypeProxies.clear();
+	}
+	ProxyLocations.clear();
+	DecalReceiverCache.Clear();
+	MarkRenderStateDirty();
+}
+
+void FRenderScene::CacheProxyState(FSceneProxy& InOutProxy)
+{
+	USceneComponent* Component = InOutProxy.Component;
+	AActor* Owner = InOutProxy.Owner;
+
+	// USceneComponent::IsVisible / AActor::IsActorVisible과 같은 조건을 PIE/에디터 각각 미리 계산
+	const bool bComponentVisible = Component->IsActive() && Component->GetVisibility();
+	InOutProxy.bVisibleInEditor = bComponentVisible && !Owner->GetActorHiddenInEditor();
+	InOutProxy.bVisibleInGame = bComponentVisible && !Component->GetHiddenInGame() && !Owner->GetActorHiddenInGame();
+
+	if (InOutProxy.bStaticMesh)
+	{
+		InOutProxy.WorldBounds = static_cast<UStaticMeshComponent*>(Component)->GetWorldAABB();
+		InOutProxy.bHasBounds = true;
+	}
+}
+
+bool FRenderScene::ClassifyProxy(USceneComponent* Component, bool bEditorActorComponent, FSceneProxy& OutProxy, ESceneProxyType& OutType)
+{
+	OutProxy.Component = Component;
+	OutProxy.Owner = Component->GetOwner();
+
+	// 에디터 액터 (기즈모, 그리드): 화살표와 라인만 그림
+	if (bEditorActorComponent)
+	{
+		if (Cast<UGizmoArrowComponent>(Component))
+		{
+			OutType = ESceneProxyType::OverlayPrimitive;
+			return true;
+		}
+		if (Cast<ULineComponent>(Component))
+		{
+			OutType = ESceneProxyType::EditorLine;
+			return true;
+		}
+		return false;
+	}
+
+	if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
+	{
+		// 에디터 보조 컴포넌트 (빌보드 아이콘 등)
+		if (!PrimitiveComponent->IsEditable())
+		{
+			OutType = ESceneProxyType::EditorPrimitive;
+			return true;
+		}
+
+		if (Cast<UMeshComponent>(PrimitiveComponent))
+		{
+			OutProxy.bStaticMesh = Cast<UStaticMeshComponent>(PrimitiveComponent) != nullptr;
+			OutProxy.bSkyDome = OutProxy.Owner->IsA<ASkyDomeActor>();
+			OutType = ESceneProxyType::Mesh;
+			return true;
+		}
+		if (Cast<UBillboardComponent>(PrimitiveComponent))
+		{
+			OutType = ESceneProxyType::Billboard;
+			return true;
+		}
+		if (Cast<UDecalComponent>(PrimitiveComponent))
+		{
+			OutType = ESceneProxyType::Decal;
+			return true;
+		}
+		return false;
+	}
+
+	if (Cast<UHeightFogComponent>(Component))
+	{
+		OutType = ESceneProxyType::HeightFog;
+		return true;
+	}
+	if (Cast<UDirectionalLightComponent>(Component))
+	{
+		OutType = ESceneProxyType::DirectionalLight;
+		return true;
+	}
+	if (Cast<UAmbientLightComponent>(Component))
+	{
+		OutType = ESceneProxyType::AmbientLight;
+		return true;
+	}
+	if (Cast<USpotLightComponent>(Component))
+	{
+		OutType = ESceneProxyType::SpotLight;
+		return true;
+	}
+	if (Cast<UPointLightComponent>(Component))
+	{
+		OutType = ESceneProxyType::PointLight;
+		return true;
+	}
+	return false;
+}
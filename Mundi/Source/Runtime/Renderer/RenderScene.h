@@ -0,0 +1,84 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "DecalReceiverCache.h"
+#include "AABB.h"
+
+class USceneComponent;
+class AActor;
+
+// 렌더 씬 프록시 분류 (등록 시 컴포넌트 클래스와 소유 액터로 한 번만 결정)
+enum class ESceneProxyType : uint8
+{
+	Mesh,
+	Billboard,
+	Decal,
+	EditorPrimitive,   // 레벨 액터의 편집 불가 보조 프리미티브 (라이트 아이콘, 방향 기즈모 등)
+	EditorLine,        // 에디터 액터의 라인 (그리드)
+	OverlayPrimitive,  // 에디터 액터의 기즈모 화살표
+	HeightFog,
+	DirectionalLight,
+	AmbientLight,
+	PointLight,
+	SpotLight,
+
+	Count
+};
+
+struct FSceneProxy
+{
+	USceneComponent* Component = nullptr;
+	AActor* Owner = nullptr;
+	FAABB WorldBounds;             // 스태틱 메시 월드 바운드 (bHasBounds일 때만 유효)
+	bool bStaticMesh = false;      // SF_StaticMeshes 쇼플래그 대상
+	bool bSkyDome = false;         // 스카이 패스 전용 메시
+	bool bHasBounds = false;
+	bool bVisibleInEditor = false; // 컴포넌트 Active/Visibility + 액터 HiddenInEditor
+	bool bVisibleInGame = false;   // 컴포넌트 Active/Visibility/HiddenInGame + 액터 HiddenInGame
+
+	bool IsVisible(bool bPie) const { return bPie ? bVisibleInGame : bVisibleInEditor; }
+};
+
+/**
+ * 월드가 유지하는 렌더 씬 (씬 컴포넌트 프록시 레지스트리)
+ * - 컴포넌트가 등록될 때 타입별 배열에 프록시를 추가하고, 등록 해제/파괴 시 swap-remove로 제거
+ * - 렌더러는 매 프레임 액터/컴포넌트를 순회하며 Cast로 분류하는 대신 타입별 배열만 선형으로 훑음
+ * 가시성 플래그와 월드 바운드는 등록 시와 UpdateProxy(가시성/트랜스폼/메시 변경) 때만 컴포넌트에서 읽어 프록시에 캐시
+ * 수집 시점에는 PIE 여부와 쇼플래그만 검사하고 액터/컴포넌트는 역참조하지 않음
+ * 렌더 상태 리비전: 프록시 추가/제거, 등록된 컴포넌트의 트랜스폼/가시성 변경, 선택/기즈모 변경 시 증가
+ * (에디터 뷰포트가 이전 렌더 결과를 재사용해도 되는지 판단하는 데 사용)
+ * 데칼 프록시의 수신 메시 캐시도 함께 보관 (데칼 프록시 제거 시 항목 제거)
+ */
+class FRenderScene
+{
+public:
+	void AddProxy(USceneComponent* Component, bool bEditorActorComponent);
+	void RemoveProxy(USceneComponent* Component);
+	// 캐시한 가시성 플래그와 월드 바운드를 다시 읽고 리비전 증가 (등록되지 않은 컴포넌트는 무시)
+	void UpdateProxy(USceneComponent* Component);
+	void Clear();
+
+	bool Contains(USceneComponent* Component) const { return ProxyLocations.Contains(Component); }
+	const TArray<FSceneProxy>& GetProxies(ESceneProxyType Type) const { return Proxies[static_cast<int32>(Type)]; }
+	int32 GetNumProxies() const { return ProxyLocations.Num(); }
+
+	void MarkRenderStateDirty() { ++RenderStateRevision; }
+	uint64 GetRenderStateRevision() const { return RenderStateRevision; }
+
+	FDecalReceiverCache& GetDecalReceiverCache() { return DecalReceiverCache; }
+
+private:
+	struct FProxyLocation
+	{
+		ESceneProxyType Type = ESceneProxyType::Count;
+		int32 Index = -1;
+	};
+
+	// 렌더러가 수집하지 않는 컴포넌트(루트 씬 컴포넌트, 카메라 등)는 false
+	static bool ClassifyProxy(USceneComponent* Component, bool bEditorActorComponent, FSceneProxy& OutProxy, ESceneProxyType& OutType);
+	static void CacheProxyState(FSceneProxy& InOutProxy);
+
+	TArray<FSceneProxy> Proxies[static_cast<int32>(ESceneProxyType::Count)];
+	TMap<USceneComponent*, FProxyLocation> ProxyLocations;
+	uint64 RenderStateRevision = 0;
+	FDecalReceiverCache DecalReceiverCache;
+};
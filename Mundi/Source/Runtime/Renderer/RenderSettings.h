@@ -40,6 +40,10 @@ public:
     void SetShadowAATechnique(EShadowAATechnique In) { ShadowAATechnique = In; }
     EShadowAATechnique GetShadowAATechnique() const { return ShadowAATechnique; }
 
+    // 데칼 렌더 경로
+    void SetDecalRenderPath(EDecalRenderPath In) { DecalRenderPath = In; }
+    EDecalRenderPath GetDecalRenderPath() const { return DecalRenderPath; }
+
 private:
     EEngineShowFlags ShowFlags = EEngineShowFlags::SF_DefaultEnabled;
     EViewModeIndex ViewModeIndex = EViewModeIndex::VMI_Lit_Phong;
@@ -55,4 +59,7 @@ private:
 
     // 그림자 안티 에일리어싱
     EShadowAATechnique ShadowAATechnique = EShadowAATechnique::PCF; // 기본값 PCF
+
+    // 데칼 렌더 경로
+    EDecalRenderPath DecalRenderPath = EDecalRenderPath::MeshProjection;
 };
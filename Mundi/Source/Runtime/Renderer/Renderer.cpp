@@ -29,6 +29,14 @@
 #include "EditorEngine.h"
 #include "DecalComponent.h"
 #include "DecalStatManager.h"
+#include "MeshletCuller.h"
+#include "MeshletStats.h"
+#include "ObjectDataBuffer.h"
+#include "TaskPool.h"
+#include "TileLightCuller.h"
+#include "TileDecalBinner.h"
+#include "RenderScene.h"
+#include "D3D11RenderBackend.h"
 #include "SceneRenderer.h"
 #include "SceneView.h"
 #include "PlayerCameraManager.h"
@@ -40,6 +48,23 @@
 URenderer::URenderer(D3D11RHI* InDevice) : RHIDevice(InDevice)
 {
 	InitializeLineBatch();
+
+	TaskPool = new FTaskPool();
+
+	MeshletCuller = new FMeshletCuller();
+	MeshletCuller->Initialize(RHIDevice);
+
+	ObjectDataBuffer = new FObjectDataBuffer();
+	ObjectDataBuffer->Initialize(RHIDevice, TaskPool);
+
+	TileLightCuller = new FTileLightCuller();
+	TileLightCuller->Initialize(RHIDevice);
+	TileDecalBinner = new FTileDecalBinner();
+	TileDecalBinner->Initialize(RHIDevice);
+	SceneFrameData = new FSceneFrameData();
+
+	D3D11CommandBackend = new FD3D11RenderBackend(RHIDevice);
+	NullCommandBackend = new FNullRenderBackend();
 }
 
 URenderer::~URenderer()
@@ -48,16 +73,60 @@ URenderer::~URenderer()
 	{
 		delete LineBatchData;
 	}
+
+	delete MeshletCuller;
+	MeshletCuller = nullptr;
+
+	delete ObjectDataBuffer;
+	ObjectDataBuffer = nullptr;
+
+	delete TileLightCuller;
+	TileLightCuller = nullptr;
+	delete TileDecalBinner;
+	TileDecalBinner = nullptr;
+	delete SceneFrameData;
+	SceneFrameData = nullptr;
+
+	delete D3D11CommandBackend;
+	D3D11CommandBackend = nullptr;
+	delete NullCommandBackend;
+	NullCommandBackend = nullptr;
+
+	// 워커가 다른 객체를 참조하지 않도록 패스 객체를 모두 정리한 뒤 종료
+	delete TaskPool;
+	TaskPool = nullptr;
+}
+
+FRenderCommandBackend* URenderer::GetCommandBackend() const
+{
+	if (bUseNullCommandBackend)
+	{
+		return NullCommandBackend;
+	}
+	return D3D11CommandBackend;
 }
 
 void URenderer::BeginFrame()
 {
+	++FrameNumber;
+
+	LastFrameRenderedViews = RenderedViews;
+	LastFrameReusedViews = ReusedViews;
+	RenderedViews = 0;
+	ReusedViews = 0;
+
+	// 상태 캐시 무효화 + RHI 프레임 통계 초기화 (프레임 사이 ImGui/D2D가 컨텍스트를 직접 사용)
+	RHIDevice->BeginFrameState();
+
 	RHIDevice->IASetPrimitiveTopology();
 
 	RHIDevice->OMSetRenderTargets(ERTVMode::BackBufferWithDepth);
 
 	// 프레임별 데칼 통계를 추적하기 위해 초기화
 	FDecalStatManager::GetInstance().ResetFrameStats();
+	FMeshletStatManager::GetInstance().ResetFrameStats();
+	D3D11CommandBackend->ResetStats();
+	NullCommandBackend->ResetStats();
 
 	RHIDevice->ClearAllBuffer();
 }
@@ -101,11 +170,92 @@ void URenderer::RenderSceneForView(UWorld* World, UCameraComponent* CameraCompon
 	// 1-1. World로부터 PostProcessSettings 가져오기
 	View.PostProcessSettings = World->GetPostProcessSettings();
 
+	// 1-2. 카메라/씬/설정이 마지막 렌더와 같은 정적 뷰포트는 보관한 결과를 복사하고 렌더를 건너뜀 (PIE는 매 프레임 변하므로 제외)
+	const bool bUseFrameCache = bViewportFrameCacheEnabled && Viewport && !World->bPie;
+	const uint64 ViewSignature = bUseFrameCache ? ComputeViewSignature(World, View) : 0;
+	if (bUseFrameCache && Viewport->IsFrameCachePresentAllowed() && Viewport->PresentCachedFrame(RHIDevice, ViewSignature))
+	{
+		++ReusedViews;
+		return;
+	}
+
 	// 2. FSceneRenderer 생성자에 'View'의 주소(&View)를 전달합니다.
 	FSceneRenderer SceneRenderer(World, &View, this);
 
 	// 3. 실제로 렌더를 수행합니다.
 	SceneRenderer.Render();
+	++RenderedViews;
+
+	// 4. 호버 중이라 재사용하지 않는 뷰포트도 결과를 보관해 두면 마우스가 떠난 다음 프레임부터 재사용 가능
+	if (bUseFrameCache)
+	{
+		Viewport->StoreCachedFrame(RHIDevice, ViewSignature);
+	}
+	else if (Viewport)
+	{
+		Viewport->InvalidateCachedFrame();
+	}
+}
+
+uint64 URenderer::ComputeViewSignature(UWorld* InWorld, const FSceneView& InView) const
+{
+	// 렌더 결과에 영향을 주는 값을 FNV-1a로 해시 (씬 변경은 렌더 씬 리비전, 텍스처/머티리얼 변경은 리소스 리비전, UI 편집/콘솔 명령은 에포크로 반영)
+	uint64 Hash = 14695981039346656037ull;
+	auto HashBytes = [&Hash](const void* Data, size_t Size)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (size_t i = 0; i < Size; ++i)
+		{
+			Hash = (Hash ^ Bytes[i]) * 1099511628211ull;
+		}
+	};
+
+	const FRenderScene* RenderScene = InWorld->GetRenderScene();
+	const URenderSettings& RenderSettings = InWorld->GetRenderSettings();
+	const uint64 RenderStateRevision = RenderScene ? RenderScene->GetRenderStateRevision() : 0;
+	const EEngineShowFlags ShowFlags = RenderSettings.GetShowFlags();
+	const uint32 ShaderVariantSerial = UShader::GetVariantSelectionSerial();
+	const uint32 ResourceContentRevision = UResourceBase::GetContentRevision();
+	const EDecalRenderPath DecalRenderPath = RenderSettings.GetDecalRenderPath();
+	const EShadowAATechnique ShadowAATechnique = RenderSettings.GetShadowAATechnique();
+	const uint32 TileSize = RenderSettings.GetTileSize();
+	const float FXAAParams[3] = { RenderSettings.GetFXAAEdgeThresholdMin(), RenderSettings.GetFXAAEdgeThresholdMax(), RenderSettings.GetFXAAQualitySubPix() };
+	const int32 FXAAIterations = RenderSettings.GetFXAAQualityIterations();
+
+	// 렌더 씬 밖에서 매 프레임 기록되는 전역 상수 (UV 스크롤 b5, 후처리)
+	const FVector2D UVScrollSpeed = RHIDevice->GetUVScrollSpeed();
+	const float UVScrollTime = RHIDevice->GetUVScrollTime();
+	const FPostProcessSettings& PostProcess = InView.PostProcessSettings;
+
+	HashBytes(&InWorld, sizeof(InWorld));
+	HashBytes(&RenderStateRevision, sizeof(RenderStateRevision));
+	HashBytes(&ViewportFrameCacheEpoch, sizeof(ViewportFrameCacheEpoch));
+	HashBytes(&ShowFlags, sizeof(ShowFlags));
+	HashBytes(&ShaderVariantSerial, sizeof(ShaderVariantSerial));
+	HashBytes(&ResourceContentRevision, sizeof(ResourceContentRevision));
+	HashBytes(&DecalRenderPath, sizeof(DecalRenderPath));
+	HashBytes(&ShadowAATechnique, sizeof(ShadowAATechnique));
+	HashBytes(&TileSize, sizeof(TileSize));
+	HashBytes(FXAAParams, sizeof(FXAAParams));
+	HashBytes(&FXAAIterations, sizeof(FXAAIterations));
+	HashBytes(&UVScrollSpeed, sizeof(UVScrollSpeed));
+	HashBytes(&UVScrollTime, sizeof(UVScrollTime));
+	// 구조체 패딩이 섞이지 않도록 멤버별로 해시
+	HashBytes(&PostProcess.FadeColor, sizeof(PostProcess.FadeColor));
+	HashBytes(&PostProcess.FadeAmount, sizeof(PostProcess.FadeAmount));
+	HashBytes(&PostProcess.bEnableVignette, sizeof(PostProcess.bEnableVignette));
+	HashBytes(&PostProcess.VignetteIntensity, sizeof(PostProcess.VignetteIntensity));
+	HashBytes(&PostProcess.VignetteSmoothness, sizeof(PostProcess.VignetteSmoothness));
+	HashBytes(&PostProcess.bEnableGammaCorrection, sizeof(PostProcess.bEnableGammaCorrection));
+	HashBytes(&PostProcess.Gamma, sizeof(PostProcess.Gamma));
+	HashBytes(&PostProcess.bEnableLetterbox, sizeof(PostProcess.bEnableLetterbox));
+	HashBytes(&PostProcess.LetterboxHeight, sizeof(PostProcess.LetterboxHeight));
+	HashBytes(&PostProcess.LetterboxColor, sizeof(PostProcess.LetterboxColor));
+	HashBytes(&InView.ViewMatrix, sizeof(InView.ViewMatrix));
+	HashBytes(&InView.ProjectionMatrix, sizeof(InView.ProjectionMatrix));
+	HashBytes(&InView.ViewRect, sizeof(InView.ViewRect));
+	HashBytes(&InView.ViewMode, sizeof(InView.ViewMode));
+	return Hash;
 }
 
 UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) const
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "RHIDevice.h"
 #include "LineDynamicMesh.h"
+#include "RenderCommandBuffer.h"
 
 class UStaticMeshComponent;
 class UTextRenderComponent;
@@ -12,6 +13,15 @@ class UBillboardComponent;
 class UPrimitiveComponent;
 class UCameraComponent;
 struct FMaterialSlot;
+class FMeshletCuller;
+class FObjectDataBuffer;
+class FTaskPool;
+class FTileLightCuller;
+class FTileDecalBinner;
+struct FSceneFrameData;
+class FSceneView;
+class FD3D11RenderBackend;
+class FNullRenderBackend;
 
 class URenderer
 {
@@ -26,6 +36,9 @@ public:
 	void BeginFrame();
 	void EndFrame();
 
+	// BeginFrame마다 1씩 증가 (프레임 주기로 갱신하는 작업의 기준)
+	uint64 GetFrameNumber() const { return FrameNumber; }
+
 	// Viewport size for current draw context (used by overlay/gizmo scaling)
 	void SetCurrentViewportSize(uint32 InWidth, uint32 InHeight) { CurrentViewportWidth = InWidth; CurrentViewportHeight = InHeight; }
 	uint32 GetCurrentViewportWidth() const { return CurrentViewportWidth; }
@@ -42,6 +55,27 @@ public:
 	void ClearLineBatch();
 
 	D3D11RHI* GetRHIDevice() { return RHIDevice; }
+	FMeshletCuller* GetMeshletCuller() { return MeshletCuller; }
+	FObjectDataBuffer* GetObjectDataBuffer() { return ObjectDataBuffer; }
+	FTileLightCuller* GetTileLightCuller() { return TileLightCuller; }
+	FTileDecalBinner* GetTileDecalBinner() { return TileDecalBinner; }
+	FSceneFrameData* GetSceneFrameData() { return SceneFrameData; }
+	FTaskPool* GetTaskPool() { return TaskPool; }
+
+	// 정적 뷰포트 재사용 (카메라/씬/설정이 마지막 렌더와 같으면 보관한 결과를 복사하고 렌더를 건너뜀)
+	void SetViewportFrameCacheEnabled(bool bEnabled) { bViewportFrameCacheEnabled = bEnabled; InvalidateViewportFrameCaches(); }
+	bool IsViewportFrameCacheEnabled() const { return bViewportFrameCacheEnabled; }
+	// 씬 변경 통지 없이 값이 바뀔 수 있는 경우(UI 위젯 편집 등) 모든 뷰포트가 다시 그리도록 함
+	void InvalidateViewportFrameCaches() { ++ViewportFrameCacheEpoch; }
+	// 직전 프레임에 실제로 렌더한 뷰 / 보관한 결과를 재사용한 뷰 수
+	uint32 GetLastFrameRenderedViews() const { return LastFrameRenderedViews; }
+	uint32 GetLastFrameReusedViews() const { return LastFrameReusedViews; }
+
+	// 메시 배치 커맨드를 실행할 백엔드 (Null이면 기록/검증만 하고 GPU에 제출하지 않음)
+	FRenderCommandBackend* GetCommandBackend() const;
+	TArray<FRenderCommandBuffer>& GetCommandBuffers() { return CommandBuffers; }
+	void SetUseNullCommandBackend(bool bInUseNull) { bUseNullCommandBackend = bInUseNull; }
+	bool IsUsingNullCommandBackend() const { return bUseNullCommandBackend; }
 
 	void SetCurrentCamera(ACameraActor* InCamera) { CurrentCamera = InCamera; }
 	ACameraActor* GetCurrentCamera() const { return CurrentCamera; }
@@ -54,6 +88,8 @@ private:
 	uint32 CurrentViewportWidth = 0;
 	uint32 CurrentViewportHeight = 0;
 
+	uint64 FrameNumber = 0;
+
 	// Batch Line Rendering System using UDynamicMesh for efficiency
 	ULineDynamicMesh* DynamicLineMesh = nullptr;
 	FMeshData* LineBatchData = nullptr;
@@ -71,5 +107,34 @@ private:
 	ID3D11ShaderResourceView* PreSRV = nullptr;*/
 
 	ACameraActor* CurrentCamera = nullptr;
+
+	// 패스 작업(오브젝트 데이터 패킹, 커맨드 기록)을 나눠 받는 상주 워커 스레드 (패스마다 스레드를 만들지 않음)
+	FTaskPool* TaskPool = nullptr;
+
+	// 메쉴릿 컬링 결과를 담는 프레임 동적 인덱스 버퍼 (뷰 간 공유)
+	FMeshletCuller* MeshletCuller = nullptr;
+
+	// 메시 배치 패스의 오브젝트별 데이터 구조화 버퍼 (패스마다 한 번 업로드)
+	FObjectDataBuffer* ObjectDataBuffer = nullptr;
+
+	// 타일 라이트 컬러와 프레임 공유 씬 데이터 (뷰마다 새로 만들지 않고 재사용)
+	FTileLightCuller* TileLightCuller = nullptr;
+	FTileDecalBinner* TileDecalBinner = nullptr;
+	FSceneFrameData* SceneFrameData = nullptr;
+
+	// 정적 뷰포트 재사용
+	uint64 ComputeViewSignature(UWorld* InWorld, const FSceneView& InView) const;
+	bool bViewportFrameCacheEnabled = true;
+	uint64 ViewportFrameCacheEpoch = 0;
+	uint32 RenderedViews = 0;
+	uint32 ReusedViews = 0;
+	uint32 LastFrameRenderedViews = 0;
+	uint32 LastFrameReusedViews = 0;
+
+	// 렌더 커맨드 백엔드와 스레드별 기록 버퍼 (패스/뷰 간 재사용)
+	FD3D11RenderBackend* D3D11CommandBackend = nullptr;
+	FNullRenderBackend* NullCommandBackend = nullptr;
+	bool bUseNullCommandBackend = false;
+	TArray<FRenderCommandBuffer> CommandBuffers;
 };
 
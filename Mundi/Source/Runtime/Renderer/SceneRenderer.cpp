@@ -22,6 +22,10 @@
 #include "SelectionManager.h"
 #include "StaticMeshComponent.h"
 #include "DecalStatManager.h"
+#include "DecalReceiverCache.h"
+#include "TileDecalBinner.h"
+#include "MeshletCuller.h"
+#include "ObjectDataBuffer.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
 #include "OBB.h"
@@ -37,6 +41,7 @@
 #include "ShapeComponent.h"
 #include "SwapGuard.h"
 #include "MeshBatchElement.h"
+#include "MeshBatchCommandRecorder.h"
 #include "SceneView.h"
 #include "Shader.h"
 #include "ResourceManager.h"
@@ -48,6 +53,37 @@
 #include "PostProcessSettings.h"
 #include "PlayerController.h"
 #include "PlayerCameraManager.h"
+#include "RenderScene.h"
+
+bool FSceneFrameData::IsValidFor(const UWorld* InWorld, uint64 InFrameNumber) const
+{
+	return bProxiesGathered
+		&& World == InWorld
+		&& FrameNumber == InFrameNumber
+		&& ShowFlags == static_cast<uint64>(InWorld->GetRenderSettings().GetShowFlags())
+		&& bPie == InWorld->bPie
+		&& bPIEEjected == InWorld->bPIEEjected;
+}
+
+void FSceneFrameData::Reset(UWorld* InWorld, uint64 InFrameNumber)
+{
+	World = InWorld;
+	FrameNumber = InFrameNumber;
+	ShowFlags = static_cast<uint64>(InWorld->GetRenderSettings().GetShowFlags());
+	bPie = InWorld->bPie;
+	bPIEEjected = InWorld->bPIEEjected;
+	bProxiesGathered = false;
+
+	Proxies = FVisibleRenderProxySet();
+	SceneLocals = FSceneLocals();
+	SceneGlobals = FSceneGlobals();
+
+	// 배열 용량은 다음 프레임을 위해 유지
+	bShadowCastersGathered = false;
+	ShadowMeshBatches.clear();
+	ShadowCasters.clear();
+	CasterIndexMap.clear();
+}
 
 FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer)
 	: World(InWorld)
@@ -57,8 +93,8 @@ FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* I
 {
 	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
 
-	// 타일 라이트 컬러 초기화
-	TileLightCuller = std::make_unique<FTileLightCuller>();
+	// 타일 라이트 컬러 (렌더러 소유, 버퍼를 뷰/프레임 간 재사용)
+	TileLightCuller = OwnerRenderer->GetTileLightCuller();
 	uint32 TileSize = World->GetRenderSettings().GetTileSize();
 	TileLightCuller->Initialize(RHIDevice, TileSize);
 
@@ -209,21 +245,151 @@ void FSceneRenderer::RenderSceneDepthPath()
 // 그림자맵 구현
 //====================================================================================
 
+namespace
+{
+	constexpr uint64 FNV64OffsetBasis = 14695981039346656037ull;
+	constexpr uint64 FNV64Prime = 1099511628211ull;
+
+	uint64 HashBytes(uint64 Hash, const void* Data, size_t Size)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Data);
+		for (size_t i = 0; i < Size; ++i)
+		{
+			Hash = (Hash ^ Bytes[i]) * FNV64Prime;
+		}
+		return Hash;
+	}
+
+	template<typename T>
+	uint64 HashValue(uint64 Hash, const T& Value)
+	{
+		return HashBytes(Hash, &Value, sizeof(T));
+	}
+
+	// 뎁스 결과에 영향을 주는 값만 해시 (메시/LOD 버퍼, 인덱스 범위, 월드 행렬)
+	uint64 HashShadowCaster(const UMeshComponent* Component, const TArray<FMeshBatchElement>& Batches, int32 FirstBatch, int32 NumBatches)
+	{
+		uint64 Hash = HashValue(FNV64OffsetBasis, Component);
+		for (int32 i = FirstBatch; i < FirstBatch + NumBatches; ++i)
+		{
+			const FMeshBatchElement& Batch = Batches[i];
+			Hash = HashValue(Hash, Batch.VertexBuffer);
+			Hash = HashValue(Hash, Batch.IndexBuffer);
+			Hash = HashValue(Hash, Batch.IndexCount);
+			Hash = HashValue(Hash, Batch.StartIndex);
+			Hash = HashValue(Hash, Batch.BaseVertexIndex);
+			Hash = HashValue(Hash, Batch.WorldMatrix);
+		}
+		return Hash;
+	}
+}
+
 void FSceneRenderer::RenderShadowMaps()
 {
 	FLightManager* LightManager = GWorld->GetLightManager();
 	if (!LightManager) return;
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
-	TArray<FMeshBatchElement> ShadowMeshBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
+	// 캐스터별 배치 구간/바운드/해시를 기록해 두고, 요청(라이트 뷰)마다 자기 절두체에 들어온 캐스터만 그림
+	// 캐스터 목록은 뷰와 무관하므로 프레임의 첫 번째 뷰에서만 수집하고 이후 뷰는 재사용
+	FSceneFrameData& FrameData = *OwnerRenderer->GetSceneFrameData();
+
+	// BVH 리빌드가 밀려 있으면 트리가 현재 바운드와 다를 수 있으므로 전부 직접 검사
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	const bool bUseBVH = BVH && !BVH->IsRebuildPending();
+
+	if (!FrameData.bShadowCastersGathered)
 	{
-		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
+		for (int32 MeshIndex = 0; MeshIndex < Proxies.Meshes.Num(); ++MeshIndex)
 		{
-			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
+			// Proxies.Meshes는 이미 가시성 검사를 거친 목록
+			UMeshComponent* MeshComponent = Proxies.Meshes[MeshIndex];
+			if (MeshComponent && MeshComponent->IsCastShadows())
+			{
+				FShadowCaster Caster;
+				Caster.Component = MeshComponent;
+				Caster.FirstBatch = FrameData.ShadowMeshBatches.Num();
+				MeshComponent->CollectMeshBatches(FrameData.ShadowMeshBatches, View);
+				Caster.NumBatches = FrameData.ShadowMeshBatches.Num() - Caster.FirstBatch;
+				if (Caster.NumBatches == 0)
+				{
+					continue;
+				}
+
+				if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent))
+				{
+					Caster.Bounds = Proxies.MeshBounds[MeshIndex];
+					Caster.bHasBounds = true;
+					Caster.bTrackedByBVH = bUseBVH && BVH->Contains(StaticMeshComponent) && !Partition->IsPendingUpdate(StaticMeshComponent);
+				}
+				Caster.Hash = HashShadowCaster(MeshComponent, FrameData.ShadowMeshBatches, Caster.FirstBatch, Caster.NumBatches);
+
+				FrameData.CasterIndexMap.Add(MeshComponent, FrameData.ShadowCasters.Num());
+				FrameData.ShadowCasters.Add(Caster);
+			}
 		}
+		FrameData.bShadowCastersGathered = true;
 	}
 
+	const TArray<FMeshBatchElement>& ShadowMeshBatches = FrameData.ShadowMeshBatches;
+	const TArray<FShadowCaster>& ShadowCasters = FrameData.ShadowCasters;
+	const TMap<UMeshComponent*, int32>& CasterIndexMap = FrameData.CasterIndexMap;
+
+	FShadowCasterStats CasterStats;
+	CasterStats.ShadowCasters = ShadowCasters.Num();
+
+	// 요청별 컬링 결과 (요청마다 재사용)
+	TArray<int32> VisibleCasters;
+	TArray<uint64> VisibleCasterHashes;
+	TArray<FMeshBatchElement> CulledShadowBatches;
+
+	// 라이트 뷰 절두체와 겹치는 캐스터의 배치를 CulledShadowBatches에 모으고, 캐스터 구성 해시를 반환
+	auto CullShadowCasters = [&](const FShadowRenderRequest& Request) -> uint64
+	{
+		VisibleCasters.clear();
+		const FFrustum LightFrustum = CreateFrustumFromViewProjection(Request.ViewMatrix * Request.ProjectionMatrix);
+
+		if (bUseBVH)
+		{
+			for (UStaticMeshComponent* Component : BVH->QueryIntersectedComponents(LightFrustum))
+			{
+				const int32* CasterIndex = CasterIndexMap.Find(Component);
+				if (CasterIndex && ShadowCasters[*CasterIndex].bTrackedByBVH)
+				{
+					VisibleCasters.Add(*CasterIndex);
+				}
+			}
+		}
+
+		// BVH가 모르는 캐스터 (비 스태틱 메시, 갱신 대기 중) 는 직접 검사, 바운드가 없으면 항상 포함
+		for (int32 i = 0; i < ShadowCasters.Num(); ++i)
+		{
+			const FShadowCaster& Caster = ShadowCasters[i];
+			if (!Caster.bTrackedByBVH && (!Caster.bHasBounds || IsAABBVisible(LightFrustum, Caster.Bounds)))
+			{
+				VisibleCasters.Add(i);
+			}
+		}
+
+		// 수집 순서와 무관하게 같은 구성이면 같은 해시
+		VisibleCasters.Sort();
+		VisibleCasterHashes.clear();
+		CulledShadowBatches.clear();
+		for (int32 CasterIndex : VisibleCasters)
+		{
+			const FShadowCaster& Caster = ShadowCasters[CasterIndex];
+			VisibleCasterHashes.Add(Caster.Hash);
+			CulledShadowBatches.insert(CulledShadowBatches.end(),
+				ShadowMeshBatches.begin() + Caster.FirstBatch,
+				ShadowMeshBatches.begin() + Caster.FirstBatch + Caster.NumBatches);
+		}
+		VisibleCasterHashes.Sort();
+
+		CasterStats.VisibleCasterSum += VisibleCasters.Num();
+		return HashBytes(FNV64OffsetBasis, VisibleCasterHashes.data(), VisibleCasterHashes.Num() * sizeof(uint64));
+	};
+
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
 	//if (ShadowMeshBatches.IsEmpty()) return;
 
@@ -299,10 +465,10 @@ void FSceneRenderer::RenderShadowMaps()
 		return;
 	}
 
-	// 2D 아틀라스 할당
-	LightManager->AllocateAtlasRegions2D(Requests2D);
+	// 2D 아틀라스 할당 (라이트별 영역 유지, 화면 크기에 따라 해상도 선택)
+	LightManager->AllocateAtlasRegions2D(Requests2D, View);
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
-	LightManager->AllocateAtlasCubeSlices(RequestsCube); // FLightManager가 RequestsCube의 AssignedSliceIndex와 Size 업데이트
+	LightManager->AllocateAtlasCubeSlices(RequestsCube, View); // FLightManager가 RequestsCube의 AssignedSliceIndex, 타일 위치와 Size 업데이트
 
 	// --- 1단계: 2D 아틀라스 렌더링 (Spot + Directional) - RTV만 사용 ---
 	{
@@ -316,19 +482,55 @@ void FSceneRenderer::RenderShadowMaps()
 			ID3D11DepthStencilView* DSV2D = LightManager->GetShadowDepthDSV2D();
 			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f}; // R=depth, G=depth^2
 			RHIDevice->OMSetCustomRenderTargets(1, &AtlasRTV2D, DSV2D);
-			RHIDevice->GetDeviceContext()->ClearRenderTargetView(AtlasRTV2D, ClearColor);
+
+			// 캐시된 영역을 남기려면 다시 그릴 영역만 지워야 함 (ClearView 미지원 시 이전처럼 전체 클리어, 캐시 안 함)
+			// 뎁스 버퍼는 영역끼리 겹치지 않으므로 매번 전체 클리어
+			const bool bCache2D = LightManager->IsShadowCacheEnabled() && RHIDevice->SupportsClearRenderTargetRect();
+			if (!bCache2D)
+			{
+				RHIDevice->GetDeviceContext()->ClearRenderTargetView(AtlasRTV2D, ClearColor);
+			}
 			if (DSV2D) RHIDevice->GetDeviceContext()->ClearDepthStencilView(DSV2D, D3D11_CLEAR_DEPTH, 1.0f, 0);
 
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 
 			for (FShadowRenderRequest& Request : Requests2D)
 			{
-				// 뷰포트 설정
-				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+				if (Request.Size > 0)
+				{
+					const uint64 CasterHash = CullShadowCasters(Request);
+					++CasterStats.Requests;
+
+					if (bCache2D && LightManager->IsShadowViewCached(Request, CasterHash))
+					{
+						++CasterStats.CachedRequests;
+					}
+					else
+					{
+						// 뷰포트 설정
+						D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
+						RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+
+						if (bCache2D)
+						{
+							const D3D11_RECT Region = {
+								static_cast<LONG>(Request.AtlasViewportOffset.X), static_cast<LONG>(Request.AtlasViewportOffset.Y),
+								static_cast<LONG>(Request.AtlasViewportOffset.X) + static_cast<LONG>(Request.Size),
+								static_cast<LONG>(Request.AtlasViewportOffset.Y) + static_cast<LONG>(Request.Size) };
+							RHIDevice->ClearRenderTargetRect(AtlasRTV2D, ClearColor, Region);
+						}
 
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
+						// 뎁스 패스 렌더링
+						RenderShadowDepthPass(Request, CulledShadowBatches);
+						++CasterStats.RenderedRequests;
+						CasterStats.DrawnBatches += CulledShadowBatches.Num();
+
+						if (bCache2D)
+						{
+							LightManager->StoreShadowView(Request, CasterHash);
+						}
+					}
+				}
 
 				FShadowMapData Data;
 				if (Request.Size > 0) // 렌더링 성공
@@ -359,10 +561,6 @@ void FSceneRenderer::RenderShadowMaps()
 			// 2.1. RHI 상태 설정 (큐브맵)
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 
-			// 큐브맵은 항상 1:1 종횡비의 전체 뷰포트 사용
-			D3D11_VIEWPORT ShadowVP = { 0.0f, 0.0f, (float)AtlasSizeCube, (float)AtlasSizeCube, 0.0f, 1.0f };
-			RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
-
 			// 이제 RequestsCube 배열을 직접 순회
 			for (FShadowRenderRequest& Request : RequestsCube) // 레퍼런스 유지
 			{
@@ -388,16 +586,47 @@ void FSceneRenderer::RenderShadowMaps()
 				ID3D11DepthStencilView* DSVCube = LightManager->GetShadowDepthDSVCube();
 				if (FaceRTV)
 				{
+					const uint64 CasterHash = CullShadowCasters(Request);
+					++CasterStats.Requests;
+
+					// 큐브 면은 면(또는 타일) 단위로 클리어하므로 다른 면의 내용은 그대로 재사용 가능
+					if (LightManager->IsShadowViewCached(Request, CasterHash))
+					{
+						++CasterStats.CachedRequests;
+						continue;
+					}
+
+					// 면 전체 또는 면 안의 저해상도 타일 (타일은 같은 면을 쓰는 다른 라이트를 지우지 않도록 영역만 클리어)
+					D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
+					RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+
 					float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
 					RHIDevice->OMSetCustomRenderTargets(1, &FaceRTV, DSVCube);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(FaceRTV, ClearColor);
+					if (Request.Size < AtlasSizeCube)
+					{
+						const D3D11_RECT Region = {
+							static_cast<LONG>(Request.AtlasViewportOffset.X), static_cast<LONG>(Request.AtlasViewportOffset.Y),
+							static_cast<LONG>(Request.AtlasViewportOffset.X) + static_cast<LONG>(Request.Size),
+							static_cast<LONG>(Request.AtlasViewportOffset.Y) + static_cast<LONG>(Request.Size) };
+						RHIDevice->ClearRenderTargetRect(FaceRTV, ClearColor, Region);
+					}
+					else
+					{
+						RHIDevice->GetDeviceContext()->ClearRenderTargetView(FaceRTV, ClearColor);
+					}
 					if (DSVCube) RHIDevice->GetDeviceContext()->ClearDepthStencilView(DSVCube, D3D11_CLEAR_DEPTH, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					RenderShadowDepthPass(Request, CulledShadowBatches);
+					++CasterStats.RenderedRequests;
+					CasterStats.DrawnBatches += CulledShadowBatches.Num();
+
+					LightManager->StoreShadowView(Request, CasterHash);
 				}
 			}
 		}
 	}
 
+	FShadowStatManager::GetInstance().UpdateCasterStats(CasterStats);
+
 	// --- 3. RHI 상태 복구 ---
 	RHIDevice->RSSetState(ERasterizerMode::Solid);
 	ID3D11RenderTargetView* nullRTV = nullptr;
@@ -419,6 +648,10 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	FShaderVariant* ShaderVariantVS = DepthVS->GetOrCompileShaderVariant(RHIDevice->GetDevice());
 	if (!ShaderVariantVS) return;
 
+	// 압축 정점 배치용 VS/레이아웃 (해당 배치가 있을 때만 컴파일)
+	FShaderVariant* CompressedVariantVS = nullptr;
+	bool bCurrentCompressedVertex = false;
+
 	UShader* DepthPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_PS.hlsl");
 	if (!DepthPS || !DepthPS->GetPixelShader()) return;
 
@@ -426,9 +659,9 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	if (!ShaderVariantPS) return;
 
 	// 2. 파이프라인 설정 (RTV를 위해 항상 PS 필요)
-	RHIDevice->GetDeviceContext()->IASetInputLayout(ShaderVariantVS->InputLayout);
-	RHIDevice->GetDeviceContext()->VSSetShader(ShaderVariantVS->VertexShader, nullptr, 0);
-	RHIDevice->GetDeviceContext()->PSSetShader(ShaderVariantPS->PixelShader, nullptr, 0);
+	RHIDevice->IASetInputLayout(ShaderVariantVS->InputLayout);
+	RHIDevice->VSSetShader(ShaderVariantVS->VertexShader);
+	RHIDevice->PSSetShader(ShaderVariantPS->PixelShader);
 
 	// 3. 라이트의 View-Projection 행렬을 메인 ViewProj 버퍼에 설정
 	FMatrix WorldLocation = {};
@@ -444,7 +677,24 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 
 	for (const FMeshBatchElement& Batch : InShadowBatches)
 	{
-		// 셰이더/픽셀 상태 변경 불필요
+		// 정점 포맷이 바뀔 때만 VS/입력 레이아웃 교체 (PS는 공통)
+		if (Batch.bCompressedVertex != bCurrentCompressedVertex)
+		{
+			FShaderVariant* BatchVariantVS = ShaderVariantVS;
+			if (Batch.bCompressedVertex)
+			{
+				if (!CompressedVariantVS)
+				{
+					CompressedVariantVS = DepthVS->GetBatchShaderVariant(RHIDevice->GetDevice(), TArray<FShaderMacro>(), true);
+				}
+				BatchVariantVS = CompressedVariantVS;
+			}
+			if (!BatchVariantVS) continue;
+
+			RHIDevice->IASetInputLayout(BatchVariantVS->InputLayout);
+			RHIDevice->VSSetShader(BatchVariantVS->VertexShader);
+			bCurrentCompressedVertex = Batch.bCompressedVertex;
+		}
 
 		// IA 상태 변경
 		if (Batch.VertexBuffer != CurrentVertexBuffer ||
@@ -465,7 +715,7 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 		}
 
 		// 오브젝트별 World 행렬 설정 (VS에서 필요)
-		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
+		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose(), Batch.PositionDequantScale, Batch.PositionDequantOffset));
 
 		// 드로우 콜
 		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
@@ -539,6 +789,17 @@ void FSceneRenderer::GatherVisibleProxies()
 	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
 	//PerformFrustumCulling();
 
+	// 수집 결과는 뷰와 무관하므로 같은 프레임의 두 번째 뷰부터는 첫 번째 뷰의 결과를 복사 (통계도 이미 갱신됨)
+	FSceneFrameData& FrameData = *OwnerRenderer->GetSceneFrameData();
+	if (FrameData.IsValidFor(World, OwnerRenderer->GetFrameNumber()))
+	{
+		Proxies = FrameData.Proxies;
+		SceneLocals = FrameData.SceneLocals;
+		SceneGlobals = FrameData.SceneGlobals;
+		return;
+	}
+	FrameData.Reset(World, OwnerRenderer->GetFrameNumber());
+
 	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
 	const bool bDrawDecals = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Decals);
 	const bool bDrawFog = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Fog);
@@ -546,126 +807,78 @@ void FSceneRenderer::GatherVisibleProxies()
 	const bool bUseAntiAliasing = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_FXAA);
 	const bool bUseBillboard = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_Billboard);
 
-	// Helper lambda to collect components from an actor
-	auto CollectComponentsFromActor = [&](AActor* Actor, bool bIsEditorActor)
+	// 컴포넌트 등록 시 분류된 렌더 씬 프록시를 타입별로 선형 스캔 (액터/컴포넌트 순회와 Cast 없음)
+	// 가시성은 프록시에 캐시된 플래그만 보고, PIE 여부와 쇼플래그만 여기서 검사
+	const FRenderScene* RenderScene = World->GetRenderScene();
+	const bool bPie = World->bPie;
+
+	auto IsProxyVisible = [bPie](const FSceneProxy& Proxy)
 		{
-			if (!Actor || !Actor->IsActorVisible())
-			{
-				return;
-			}
+			return Proxy.IsVisible(bPie);
+		};
 
-			for (USceneComponent* Component : Actor->GetSceneComponents())
+	// 타입별 프록시 중 보이는 것만 대상 배열에 추가
+	auto CollectProxies = [&](ESceneProxyType Type, auto& OutComponents)
+		{
+			using ComponentType = std::remove_pointer_t<typename std::decay_t<decltype(OutComponents)>::value_type>;
+			for (const FSceneProxy& Proxy : RenderScene->GetProxies(Type))
 			{
-				if (!Component || !Component->IsVisible())
-				{
-					continue;
-				}
-
-				// 엔진 에디터 액터 컴포넌트
-				if (bIsEditorActor)
-				{
-					if (UGizmoArrowComponent* GizmoComponent = Cast<UGizmoArrowComponent>(Component))
-					{
-						Proxies.OverlayPrimitives.Add(GizmoComponent);
-					}
-					else if (ULineComponent* LineComponent = Cast<ULineComponent>(Component))
-					{
-						Proxies.EditorLines.Add(LineComponent);
-					}
-
-					continue;
-				}
-
-				if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component); PrimitiveComponent)
-				{
-					// 에디터 보조 컴포넌트 (빌보드 등)
-					if (!PrimitiveComponent->IsEditable())
-					{
-						Proxies.EditorPrimitives.Add(PrimitiveComponent);
-						continue;
-					}
-
-					// 일반 컴포넌트
-					if (UMeshComponent* MeshComponent = Cast<UMeshComponent>(PrimitiveComponent))
-					{
-						bool bShouldAdd = true;
-
-						// 메시 타입이 '스태틱 메시'인 경우에만 ShowFlag를 검사하여 추가 여부를 결정
-						if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent))
-						{
-							bShouldAdd = bDrawStaticMeshes;
-						}
-						// else if (USkeletalMeshComponent* SkeletalMeshComponent = ...)
-						// {
-						//     bShouldAdd = bDrawSkeletalMeshes;
-						// }
-
-						if (bShouldAdd)
-						{
-							// 스카이돔과 일반 메시를 수집 단계에서 분리
-							if (Actor && Actor->IsA<ASkyDomeActor>())
-							{
-								Proxies.SkyDomeMeshes.Add(MeshComponent);
-								continue;
-							}
-
-							Proxies.Meshes.Add(MeshComponent);
-						}
-					}
-					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
-					{
-						Proxies.Billboards.Add(BillboardComponent);
-					}
-					else if (UDecalComponent* DecalComponent = Cast<UDecalComponent>(PrimitiveComponent); DecalComponent && bDrawDecals)
-					{
-						Proxies.Decals.Add(DecalComponent);
-					}
-				}
-				else
+				if (IsProxyVisible(Proxy))
 				{
-					if (UHeightFogComponent* FogComponent = Cast<UHeightFogComponent>(Component); FogComponent && bDrawFog)
-					{
-						SceneGlobals.Fogs.Add(FogComponent);
-					}
-
-					else if (UDirectionalLightComponent* LightComponent = Cast<UDirectionalLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.DirectionalLights.Add(LightComponent);
-					}
-
-					else if (UAmbientLightComponent* LightComponent = Cast<UAmbientLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						SceneGlobals.AmbientLights.Add(LightComponent);
-					}
-
-					else if (UPointLightComponent* LightComponent = Cast<UPointLightComponent>(Component); LightComponent && bDrawLight)
-					{
-						if (USpotLightComponent* SpotLightComponent = Cast<USpotLightComponent>(LightComponent); SpotLightComponent)
-						{
-							SceneLocals.SpotLights.Add(SpotLightComponent);
-						}
-						else
-						{
-							SceneLocals.PointLights.Add(LightComponent);
-						}
-					}
+					OutComponents.Add(static_cast<ComponentType*>(Proxy.Component));
 				}
 			}
 		};
 
-	// Collect from Editor Actors (Gizmo, Grid, etc.)
+	// Editor Actors (Gizmo, Grid, etc.)
 	if (!World->bPie || (World->bPie && World->bPIEEjected))
 	{
-		for (AActor* EditorActor : World->GetEditorActors())
+		CollectProxies(ESceneProxyType::OverlayPrimitive, Proxies.OverlayPrimitives);
+		CollectProxies(ESceneProxyType::EditorLine, Proxies.EditorLines);
+	}
+
+	// 에디터 보조 컴포넌트 (빌보드 등)
+	CollectProxies(ESceneProxyType::EditorPrimitive, Proxies.EditorPrimitives);
+
+	for (const FSceneProxy& Proxy : RenderScene->GetProxies(ESceneProxyType::Mesh))
+	{
+		// 메시 타입이 '스태틱 메시'인 경우에만 ShowFlag를 검사하여 추가 여부를 결정
+		if ((Proxy.bStaticMesh && !bDrawStaticMeshes) || !IsProxyVisible(Proxy))
+		{
+			continue;
+		}
+
+		// 스카이돔과 일반 메시를 수집 단계에서 분리
+		UMeshComponent* MeshComponent = static_cast<UMeshComponent*>(Proxy.Component);
+		if (Proxy.bSkyDome)
 		{
-			CollectComponentsFromActor(EditorActor, true);
+			Proxies.SkyDomeMeshes.Add(MeshComponent);
+		}
+		else
+		{
+			Proxies.Meshes.Add(MeshComponent);
+			Proxies.MeshBounds.Add(Proxy.WorldBounds);
 		}
 	}
 
-	// Collect from Level Actors (including their Gizmo components)
-	for (AActor* Actor : World->GetActors())
+	if (bUseBillboard)
 	{
-		CollectComponentsFromActor(Actor, false);
+		CollectProxies(ESceneProxyType::Billboard, Proxies.Billboards);
+	}
+	if (bDrawDecals)
+	{
+		CollectProxies(ESceneProxyType::Decal, Proxies.Decals);
+	}
+	if (bDrawFog)
+	{
+		CollectProxies(ESceneProxyType::HeightFog, SceneGlobals.Fogs);
+	}
+	if (bDrawLight)
+	{
+		CollectProxies(ESceneProxyType::DirectionalLight, SceneGlobals.DirectionalLights);
+		CollectProxies(ESceneProxyType::AmbientLight, SceneGlobals.AmbientLights);
+		CollectProxies(ESceneProxyType::PointLight, SceneLocals.PointLights);
+		CollectProxies(ESceneProxyType::SpotLight, SceneLocals.SpotLights);
 	}
 
 	// 라이트 통계 업데이트
@@ -714,6 +927,11 @@ void FSceneRenderer::GatherVisibleProxies()
 
 	ShadowStats.CalculateTotal();
 	FShadowStatManager::GetInstance().UpdateStats(ShadowStats);
+
+	FrameData.Proxies = Proxies;
+	FrameData.SceneLocals = SceneLocals;
+	FrameData.SceneGlobals = SceneGlobals;
+	FrameData.bProxiesGathered = true;
 }
 
 void FSceneRenderer::PerformTileLightCulling()
@@ -801,9 +1019,13 @@ void FSceneRenderer::RenderSkyPass()
 	// --- 2. 스카이 셰이더로 강제 오버라이드 ---
 	for (FMeshBatchElement& BatchElement : SkyBatchElements)
 	{
-		BatchElement.VertexShader = SkyShaderVariant->VertexShader;
-		BatchElement.PixelShader = SkyShaderVariant->PixelShader;
-		BatchElement.InputLayout = SkyShaderVariant->InputLayout;
+		FShaderVariant* BatchVariant = BatchElement.bCompressedVertex
+			? SkyShader->GetBatchShaderVariant(RHIDevice->GetDevice(), TArray<FShaderMacro>(), true)
+			: SkyShaderVariant;
+		if (!BatchVariant) { continue; }
+		BatchElement.VertexShader = BatchVariant->VertexShader;
+		BatchElement.PixelShader = BatchVariant->PixelShader;
+		BatchElement.InputLayout = BatchVariant->InputLayout;
 	}
 
 	// --- 3. 렌더 상태 설정 ---
@@ -913,15 +1135,33 @@ void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
 		MeshComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
 
+	// --- 메쉴릿 컬링 (메쉴릿이 있는 스태틱 메시 섹션만, 보이는 메쉴릿 인덱스로 압축) ---
+	if (World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_MeshletCulling))
+	{
+		OwnerRenderer->GetMeshletCuller()->CullAndCompact(MeshBatchElements, *View);
+	}
+
 	// --- UMeshComponent 셰이더 오버라이드 ---
 	if (bNeedsShaderOverride && ShaderVariant)
 	{
 		// 수집된 UMeshComponent 배치 요소의 셰이더를 ViewModeShader로 강제 변경
+		// 압축 정점 배치는 같은 매크로의 COMPRESSED_VERTEX 변형 사용
+		FShaderVariant* CompressedShaderVariant = nullptr;
 		for (FMeshBatchElement& BatchElement : MeshBatchElements)
 		{
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
+			FShaderVariant* BatchVariant = ShaderVariant;
+			if (BatchElement.bCompressedVertex)
+			{
+				if (!CompressedShaderVariant)
+				{
+					CompressedShaderVariant = ViewModeShader->GetBatchShaderVariant(RHIDevice->GetDevice(), ShaderMacros, true);
+				}
+				BatchVariant = CompressedShaderVariant;
+			}
+			if (!BatchVariant) { continue; }
+			BatchElement.VertexShader = BatchVariant->VertexShader;
+			BatchElement.PixelShader = BatchVariant->PixelShader;
+			BatchElement.InputLayout = BatchVariant->InputLayout;
 		}
 	}
 
@@ -943,6 +1183,38 @@ void FSceneRenderer::RenderOpaquePass(EViewModeIndex InRenderViewMode)
 	DrawMeshBatches(MeshBatchElements, true, true);
 }
 
+namespace
+{
+	// ViewMode에 따른 데칼 조명 모델 매크로 (bPerPixelOnly: 정점 단계가 없는 화면 공간 경로는 Gouraud를 픽셀 단위 Phong으로 대체)
+	TArray<FShaderMacro> GetDecalLightingMacros(EViewModeIndex InViewMode, bool bPerPixelOnly)
+	{
+		TArray<FShaderMacro> ShaderMacros;
+		switch (InViewMode)
+		{
+		case EViewModeIndex::VMI_Lit_Phong:
+			ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" });
+			break;
+		case EViewModeIndex::VMI_Lit_Gouraud:
+			ShaderMacros.push_back(FShaderMacro{ bPerPixelOnly ? "LIGHTING_MODEL_PHONG" : "LIGHTING_MODEL_GOURAUD", "1" });
+			break;
+		case EViewModeIndex::VMI_Lit_Lambert:
+			ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_LAMBERT", "1" });
+			break;
+		case EViewModeIndex::VMI_Lit:
+			// 기본 Lit 모드는 Phong 사용
+			ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" });
+			break;
+		case EViewModeIndex::VMI_Unlit:
+			// 매크로 없음 (Unlit)
+			break;
+		default:
+			// 기타 ViewMode는 매크로 없음
+			break;
+		}
+		return ShaderMacros;
+	}
+}
+
 void FSceneRenderer::RenderDecalPass()
 {
 	if (Proxies.Decals.empty())
@@ -952,58 +1224,58 @@ void FSceneRenderer::RenderDecalPass()
 	if (View->ViewMode == EViewModeIndex::VMI_WorldNormal)
 		return;
 
+	FDecalStatManager::GetInstance().AddTotalDecalCount(Proxies.Decals.Num());	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
+	FDecalStatManager::GetInstance().AddVisibleDecalCount(Proxies.Decals.Num());	// 그릴 Decal 개수 수집
+
+	if (World->GetRenderSettings().GetDecalRenderPath() == EDecalRenderPath::Clustered)
+	{
+		RenderClusteredDecalPass();
+	}
+	else
+	{
+		RenderMeshDecalPass();
+	}
+}
+
+void FSceneRenderer::RenderMeshDecalPass()
+{
 	UWorldPartitionManager* Partition = World->GetPartitionManager();
 	if (!Partition)
 		return;
 
-	const FBVHierarchy* BVH = Partition->GetBVH();
-	if (!BVH)
+	FBVHierarchy* BVH = Partition->GetBVH();
+	FRenderScene* RenderScene = World->GetRenderScene();
+	if (!BVH || !RenderScene)
 		return;
 
-	FDecalStatManager::GetInstance().AddTotalDecalCount(Proxies.Decals.Num());	// TODO: 추후 월드 컴포넌트 추가/삭제 이벤트에서 데칼 컴포넌트의 개수만 추적하도록 수정 필요
-	FDecalStatManager::GetInstance().AddVisibleDecalCount(Proxies.Decals.Num());	// 그릴 Decal 개수 수집
+	FDecalPathStats& PathStats = FDecalStatManager::GetInstance().GetPathStatsSlot(EDecalRenderPath::MeshProjection);
+	auto PassTimeStart = std::chrono::high_resolution_clock::now();
+
+	// 수신 메시가 움직였으면 겹치는 데칼의 캐시만 무효화
+	FDecalReceiverCache& ReceiverCache = RenderScene->GetDecalReceiverCache();
+	ReceiverCache.SyncWithBVH(*BVH);
 
 	// ViewMode에 따라 조명 모델 매크로 설정
-	TArray<FShaderMacro> ShaderMacros;
+	const TArray<FShaderMacro> ShaderMacros = GetDecalLightingMacros(View->ViewMode, false);
 	FString ShaderPath = "Shaders/Effects/Decal.hlsl";
 
-	switch (View->ViewMode)
-	{
-	case EViewModeIndex::VMI_Lit_Phong:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" });
-		break;
-	case EViewModeIndex::VMI_Lit_Gouraud:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_GOURAUD", "1" });
-		break;
-	case EViewModeIndex::VMI_Lit_Lambert:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_LAMBERT", "1" });
-		break;
-	case EViewModeIndex::VMI_Lit:
-		// 기본 Lit 모드는 Phong 사용
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" });
-		break;
-	case EViewModeIndex::VMI_Unlit:
-		// 매크로 없음 (Unlit)
-		break;
-	default:
-		// 기타 ViewMode는 매크로 없음
-		break;
-	}
-
 	// ViewMode에 따른 Decal 셰이더 로드
 	UShader* DecalShader = UResourceManager::GetInstance().Load<UShader>(ShaderPath, ShaderMacros);
-	FShaderVariant* ShaderVariant = DecalShader->GetOrCompileShaderVariant(RHIDevice->GetDevice(), ShaderMacros);
 	if (!DecalShader)
 	{
 		UE_LOG("RenderDecalPass: Failed to load Decal shader with ViewMode macros!");
 		return;
 	}
+	FShaderVariant* ShaderVariant = DecalShader->GetOrCompileShaderVariant(RHIDevice->GetDevice(), ShaderMacros);
 
 	// 데칼 렌더 설정
 	RHIDevice->RSSetState(ERasterizerMode::Decal);
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly); // 깊이 쓰기 OFF
 	RHIDevice->OMSetBlendState(true);
 
+	// Decal이 그려질 Primitives
+	TArray<UPrimitiveComponent*> TargetPrimitives;
+
 	for (UDecalComponent* Decal : Proxies.Decals)
 	{
 		if (!Decal || !Decal->GetDecalTexture())
@@ -1011,16 +1283,13 @@ void FSceneRenderer::RenderDecalPass()
 			continue;
 		}
 
-		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
-
-		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
-		const FOBB DecalOBB = Decal->GetWorldOBB();
-		TArray<UStaticMeshComponent*> IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
+		// 1. Decal의 World OBB와 충돌한 모든 StaticMeshComponent (데칼/수신 메시가 그대로면 캐시된 목록)
+		const TArray<UStaticMeshComponent*>& IntersectedStaticMeshComponents = ReceiverCache.GetReceivers(Decal, *BVH);
 
 		// 2. 충돌한 모든 visible Actor의 PrimitiveComponent를 TargetPrimitives에 추가
 		// Actor에 기본으로 붙어있는 TextRenderComponent, BoundingBoxComponent는 decal 적용 안되게 하기 위해,
 		// 임시로 PrimitiveComponent가 아닌 UStaticMeshComponent를 받도록 함
+		TargetPrimitives.clear();
 		for (UStaticMeshComponent* SMC : IntersectedStaticMeshComponents)
 		{
 			// 기즈모에 데칼 입히면 안되므로 에디팅이 안되는 Component는 데칼 그리지 않음
@@ -1050,13 +1319,22 @@ void FSceneRenderer::RenderDecalPass()
 		}
 		for (FMeshBatchElement& BatchElement : MeshBatchElements)
 		{
+			// 압축 정점 배치는 정점 버퍼 스트라이드를 그대로 쓰고 COMPRESSED_VERTEX 변형으로 디코드
+			FShaderVariant* BatchVariant = BatchElement.bCompressedVertex
+				? DecalShader->GetBatchShaderVariant(RHIDevice->GetDevice(), ShaderMacros, true)
+				: ShaderVariant;
+			if (!BatchVariant) { continue; }
 			BatchElement.InstanceShaderResourceView = Decal->GetDecalTexture()->GetShaderResourceView();
 			BatchElement.Material = Decal->GetMaterial(0);
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.VertexStride = sizeof(FVertexDynamic);
+			BatchElement.InputLayout = BatchVariant->InputLayout;
+			BatchElement.VertexShader = BatchVariant->VertexShader;
+			BatchElement.PixelShader = BatchVariant->PixelShader;
+			if (!BatchElement.bCompressedVertex)
+			{
+				BatchElement.VertexStride = sizeof(FVertexDynamic);
+			}
 		}
+		PathStats.Draws += static_cast<uint32>(MeshBatchElements.Num());
 		DrawMeshBatches(MeshBatchElements, true, true);
 
 		// --- 데칼 렌더 시간 측정 종료 및 결과 저장 ---
@@ -1069,6 +1347,84 @@ void FSceneRenderer::RenderDecalPass()
 	RHIDevice->RSSetState(ERasterizerMode::Solid);
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 	RHIDevice->OMSetBlendState(false);
+
+	// 경로 비용: 수신 메시 조회까지 포함한 패스 전체
+	PathStats.ReceiverCacheHits += ReceiverCache.GetCacheHits();
+	PathStats.ReceiverCacheMisses += ReceiverCache.GetCacheMisses();
+	std::chrono::duration<double, std::milli> PassTimeMs = std::chrono::high_resolution_clock::now() - PassTimeStart;
+	PathStats.CpuTimeMS += PassTimeMs.count();
+}
+
+void FSceneRenderer::RenderClusteredDecalPass()
+{
+	FTileDecalBinner* DecalBinner = OwnerRenderer->GetTileDecalBinner();
+	if (!DecalBinner)
+		return;
+
+	FDecalPathStats& PathStats = FDecalStatManager::GetInstance().GetPathStatsSlot(EDecalRenderPath::Clustered);
+	auto CpuTimeStart = std::chrono::high_resolution_clock::now();
+
+	// 1. 라이트 컬링과 같은 크기의 타일 격자에 데칼 비닝 (격자는 타일 목록 버퍼 헤더로 전달되므로 라이트 컬링 여부와 무관)
+	const uint32 ViewportWidth = View->ViewRect.Width();
+	const uint32 ViewportHeight = View->ViewRect.Height();
+	const uint32 TileSize = World->GetRenderSettings().GetTileSize();
+	const FMatrix ViewProj = View->ViewMatrix * View->ProjectionMatrix;
+
+	if (DecalBinner->Prepare(Proxies.Decals, ViewProj, View->ViewRect.MinX, View->ViewRect.MinY, ViewportWidth, ViewportHeight, TileSize))
+	{
+		const TArray<FShaderMacro> ShaderMacros = GetDecalLightingMacros(View->ViewMode, true);
+		UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
+		UShader* ClusteredDecalPS = UResourceManager::GetInstance().Load<UShader>("Shaders/Effects/ClusteredDecal_PS.hlsl", ShaderMacros);
+		FShaderVariant* PSVariant = ClusteredDecalPS ? ClusteredDecalPS->GetOrCompileShaderVariant(RHIDevice->GetDevice(), ShaderMacros) : nullptr;
+		ID3D11ShaderResourceView* DepthSRV = RHIDevice->GetSRV(RHI_SRV_Index::SceneDepth);
+		if (!FullScreenTriangleVS || !FullScreenTriangleVS->GetVertexShader() || !PSVariant || !PSVariant->PixelShader || !DepthSRV)
+		{
+			UE_LOG("RenderClusteredDecalPass: 셰이더 또는 Depth SRV 없음!");
+			return;
+		}
+
+		// 2. 깊이를 읽어야 하므로 DSV 없이 씬 컬러에 알파 블렌딩
+		RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithoutDepth);
+		RHIDevice->OMSetDepthStencilState(EComparisonFunc::Always);
+		RHIDevice->OMSetBlendState(true);
+
+		RHIDevice->IASetInputLayout(FullScreenTriangleVS->GetInputLayout());
+		RHIDevice->VSSetShader(FullScreenTriangleVS->GetVertexShader());
+		RHIDevice->PSSetShader(PSVariant->PixelShader);
+
+		ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+		DeviceContext->PSSetShaderResources(1, 1, &DepthSRV);
+
+		ID3D11SamplerState* DefaultSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
+		ID3D11SamplerState* ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
+		RHIDevice->PSSetSamplers(0, 1, &DefaultSampler);
+		RHIDevice->PSSetSamplers(2, 1, &ShadowSampler);
+
+		// 3. 텍스처 묶음마다 전체 화면 패스 한 번 (보통 한 번)
+		const uint32 NumPasses = static_cast<uint32>(DecalBinner->GetPasses().Num());
+		for (uint32 PassIndex = 0; PassIndex < NumPasses; ++PassIndex)
+		{
+			if (DecalBinner->BindPass(PassIndex))
+			{
+				RHIDevice->DrawFullScreenQuad();
+				++PathStats.Draws;
+			}
+		}
+
+		// 상태 복구 (깊이 SRV를 풀어야 DSV를 다시 바인딩할 수 있음)
+		DecalBinner->UnbindPass();
+		ID3D11ShaderResourceView* NullSRV = nullptr;
+		DeviceContext->PSSetShaderResources(1, 1, &NullSRV);
+		RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithId);
+		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+		RHIDevice->OMSetBlendState(false);
+	}
+
+	PathStats.TileDecalPairs += DecalBinner->GetTileDecalPairs();
+
+	std::chrono::duration<double, std::milli> CpuTimeMs = std::chrono::high_resolution_clock::now() - CpuTimeStart;
+	PathStats.CpuTimeMS += CpuTimeMs.count();
+	FDecalStatManager::GetInstance().GetDecalPassTimeSlot() += CpuTimeMs.count();
 }
 
 void FSceneRenderer::RenderFogPass()
@@ -1121,7 +1477,7 @@ void FSceneRenderer::RenderFogPass()
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, srvs);
 
 	ID3D11SamplerState* Samplers[2] = { LinearClampSamplerState, PointClampSamplerState };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 2, Samplers);
+	RHIDevice->PSSetSamplers(0, 2, Samplers);
 
 	// 상수 버퍼 업데이트
 	ECameraProjectionMode ProjectionMode = View->ProjectionMode;
@@ -1165,7 +1521,7 @@ void FSceneRenderer::RenderVignettingPass()
 	ID3D11ShaderResourceView* srvs[1] = { SceneSRV };
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, srvs);
 	ID3D11SamplerState* Samplers[1] = { LinearClampSamplerState };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, Samplers);
+	RHIDevice->PSSetSamplers(0, 1, Samplers);
 
 	UShader* VS = RESOURCE.Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
 	UShader* PS = RESOURCE.Load<UShader>("Shaders/PostProcess/Vignetting_PS.hlsl");
@@ -1209,7 +1565,7 @@ void FSceneRenderer::RenderGammaCorrectionPass()
 	ID3D11ShaderResourceView* srvs[1] = { SceneSRV };
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, srvs);
 	ID3D11SamplerState* Samplers[1] = { LinearClampSamplerState };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, Samplers);
+	RHIDevice->PSSetSamplers(0, 1, Samplers);
 
 	UShader* VS = RESOURCE.Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
 	UShader* PS = RESOURCE.Load<UShader>("Shaders/PostProcess/GammaCorrection_PS.hlsl");
@@ -1253,7 +1609,7 @@ void FSceneRenderer::RenderLetterBoxPass()
 	ID3D11ShaderResourceView* srvs[1] = { SceneSRV };
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, srvs);
 	ID3D11SamplerState* Samplers[1] = { LinearClampSamplerState };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, Samplers);
+	RHIDevice->PSSetSamplers(0, 1, Samplers);
 
 	UShader* VS = RESOURCE.Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
 	UShader* PS = RESOURCE.Load<UShader>("Shaders/PostProcess/Letterbox_PS.hlsl");
@@ -1297,7 +1653,7 @@ void FSceneRenderer::RenderFadePass()
 	ID3D11ShaderResourceView* srvs[1] = { SceneSRV };
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, srvs);
 	ID3D11SamplerState* Samplers[1] = { LinearClampSamplerState };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, Samplers);
+	RHIDevice->PSSetSamplers(0, 1, Samplers);
 
 	UShader* VS = RESOURCE.Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
 	UShader* PS = RESOURCE.Load<UShader>("Shaders/PostProcess/Fade_PS.hlsl");
@@ -1374,7 +1730,7 @@ void FSceneRenderer::RenderSceneDepthPostProcess()
 
 	// Shader Resource 바인딩 (슬롯 확인!)
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &DepthSRV);  // t0
-	RHIDevice->GetDeviceContext()->PSSetSamplers(1, 1, &SamplerState);
+	RHIDevice->PSSetSamplers(1, 1, &SamplerState);
 
 	// 상수 버퍼 업데이트
 	ECameraProjectionMode ProjectionMode = View->ProjectionMode;
@@ -1432,7 +1788,7 @@ void FSceneRenderer::RenderTileCullingDebug()
 
 	// t0: 원본 씬 텍스처
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &SceneSRV);
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, &SamplerState);
+	RHIDevice->PSSetSamplers(0, 1, &SamplerState);
 
 	// t2: 타일 라이트 인덱스 버퍼 (이미 PerformTileLightCulling에서 바인딩됨)
 	// 별도 바인딩 불필요, 유지됨
@@ -1552,150 +1908,34 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual); // 깊이 쓰기 ON
 	}
 
-	// PS 리소스 초기화
-	ID3D11ShaderResourceView* nullSRVs[2] = { nullptr, nullptr };
-	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, nullSRVs);
-	ID3D11SamplerState* nullSamplers[2] = { nullptr, nullptr };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 2, nullSamplers);
-	FPixelConstBufferType DefaultPixelConst{};
-	RHIDevice->SetAndUpdateConstantBuffer(DefaultPixelConst);
-
-	// 현재 GPU 상태 캐싱용 변수 (UStaticMesh* 대신 실제 GPU 리소스로 변경)
-	ID3D11VertexShader* CurrentVertexShader = nullptr;
-	ID3D11PixelShader* CurrentPixelShader = nullptr;
-	UMaterialInterface* CurrentMaterial = nullptr;
-	ID3D11ShaderResourceView* CurrentInstanceSRV = nullptr; // [추가] Instance SRV 캐시
-	ID3D11Buffer* CurrentVertexBuffer = nullptr;
-	ID3D11Buffer* CurrentIndexBuffer = nullptr;
-	UINT CurrentVertexStride = 0;
-	D3D11_PRIMITIVE_TOPOLOGY CurrentTopology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
-
-	// 기본 샘플러 미리 가져오기 (루프 내 반복 호출 방지)
-	ID3D11SamplerState* DefaultSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
+	// 기본 샘플러 미리 가져오기 (기록 중 반복 호출 방지)
+	FMeshBatchRecordContext RecordContext;
+	RecordContext.DefaultSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Default);
 	// Shadow PCF용 샘플러 추가
-	ID3D11SamplerState* ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
-	ID3D11SamplerState* VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
+	RecordContext.ShadowSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::Shadow);
+	RecordContext.VSMSampler = RHIDevice->GetSamplerState(RHI_Sampler_Index::VSM);
 
-	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	// 오브젝트별 데이터를 패스당 한 번의 Map으로 업로드 (드로우는 배치 인덱스로 참조)
+	// 실패하면 셰이더가 이전 패스의 오브젝트 데이터를 읽게 되므로 이 패스는 그리지 않음
+	if (!OwnerRenderer->GetObjectDataBuffer()->UploadAndBind(InMeshBatches))
 	{
-		// --- 필수 요소 유효성 검사 ---
-		if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
-		{
-			// 셰이더나 버퍼, 스트라이드 정보가 없으면 그릴 수 없음
-			//UE_LOG("[%s] 머티리얼에 셰이더가 컴파일에 실패했거나 없습니다!", Batch.Material->GetFilePath().c_str());	// NOTE: 로그가 매 프레임 떠서 셰이더 컴파일 에러 로그를 볼 수 없어서 주석 처리
-			continue;
-		}
-
-		// 1. 셰이더 상태 변경
-		if (Batch.VertexShader != CurrentVertexShader || Batch.PixelShader != CurrentPixelShader)
-		{
-			RHIDevice->GetDeviceContext()->IASetInputLayout(Batch.InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(Batch.VertexShader, nullptr, 0);
-
-			RHIDevice->GetDeviceContext()->PSSetShader(Batch.PixelShader, nullptr, 0);
-
-			CurrentVertexShader = Batch.VertexShader;
-			CurrentPixelShader = Batch.PixelShader;
-		}
-
-		// --- 2. 픽셀 상태 (텍스처, 샘플러, 재질CBuffer) 변경 (캐싱됨) ---
-		//
-		// 'Material' 또는 'Instance SRV' 둘 중 하나라도 바뀌면
-		// 모든 픽셀 리소스를 다시 바인딩해야 합니다.
-		if (Batch.Material != CurrentMaterial || Batch.InstanceShaderResourceView != CurrentInstanceSRV)
-		{
-			ID3D11ShaderResourceView* DiffuseTextureSRV = nullptr; // t0
-			ID3D11ShaderResourceView* NormalTextureSRV = nullptr;  // t1
-			FPixelConstBufferType PixelConst{};
-
-			if (Batch.Material)
-			{
-				PixelConst.Material = Batch.Material->GetMaterialInfo();
-				PixelConst.bHasMaterial = true;
-			}
-			else
-			{
-				FMaterialInfo DefaultMaterialInfo;
-				PixelConst.Material = DefaultMaterialInfo;
-				PixelConst.bHasMaterial = false;
-				PixelConst.bHasDiffuseTexture = false;
-				PixelConst.bHasNormalTexture = false;
-			}
-
-			// 1순위: 인스턴스 텍스처 (빌보드)
-			if (Batch.InstanceShaderResourceView)
-			{
-				DiffuseTextureSRV = Batch.InstanceShaderResourceView;
-				PixelConst.bHasDiffuseTexture = true;
-				PixelConst.bHasNormalTexture = false;
-			}
-			// 2순위: 머티리얼 텍스처 (스태틱 메시)
-			else if (Batch.Material)
-			{
-				const FMaterialInfo& MaterialInfo = Batch.Material->GetMaterialInfo();
-				if (!MaterialInfo.DiffuseTextureFileName.empty())
-				{
-					if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Diffuse))
-					{
-						DiffuseTextureSRV = TextureData->GetShaderResourceView();
-						PixelConst.bHasDiffuseTexture = (DiffuseTextureSRV != nullptr);
-					}
-				}
-				if (!MaterialInfo.NormalTextureFileName.empty())
-				{
-					if (UTexture* TextureData = Batch.Material->GetTexture(EMaterialTextureSlot::Normal))
-					{
-						NormalTextureSRV = TextureData->GetShaderResourceView();
-						PixelConst.bHasNormalTexture = (NormalTextureSRV != nullptr);
-					}
-				}
-			}			// --- RHI 상태 업데이트 ---
-			// 1. 텍스처(SRV) 바인딩
-			ID3D11ShaderResourceView* Srvs[2] = { DiffuseTextureSRV, NormalTextureSRV };
-			RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, Srvs);
-
-			// 2. 샘플러 바인딩
-			ID3D11SamplerState* Samplers[4] = { DefaultSampler, DefaultSampler, ShadowSampler, VSMSampler };
-			RHIDevice->GetDeviceContext()->PSSetSamplers(0, 4, Samplers);			
-
-			// 3. 재질 CBuffer 바인딩
-			RHIDevice->SetAndUpdateConstantBuffer(PixelConst);
-
-			// --- 캐시 업데이트 ---
-			CurrentMaterial = Batch.Material;
-			CurrentInstanceSRV = Batch.InstanceShaderResourceView;
-		}
-
-		// 3. IA (Input Assembler) 상태 변경
-		if (Batch.VertexBuffer != CurrentVertexBuffer ||
-			Batch.IndexBuffer != CurrentIndexBuffer ||
-			Batch.VertexStride != CurrentVertexStride ||
-			Batch.PrimitiveTopology != CurrentTopology)
+		UE_LOG("[SceneRenderer] ERROR: object data upload failed, skipping %d mesh batches", InMeshBatches.Num());
+		if (bClearListAfterDraw)
 		{
-			UINT Stride = Batch.VertexStride;
-			UINT Offset = 0;
-
-			// Vertex/Index 버퍼 바인딩
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-
-			// 토폴로지 설정 (이전 코드의 5번에서 이동하여 최적화)
-			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
-
-			// 현재 IA 상태 캐싱
-			CurrentVertexBuffer = Batch.VertexBuffer;
-			CurrentIndexBuffer = Batch.IndexBuffer;
-			CurrentVertexStride = Batch.VertexStride;
-			CurrentTopology = Batch.PrimitiveTopology;
+			InMeshBatches.Empty();
 		}
+		return;
+	}
 
-		// 4. 오브젝트별 상수 버퍼 설정 (매번 변경)
-		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
-		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID));
+	// 정렬된 리스트를 커맨드 버퍼에 기록 (배치가 많으면 스레드별 버퍼로 병렬 기록) 후 순서대로 실행
+	TArray<FRenderCommandBuffer>& CommandBuffers = OwnerRenderer->GetCommandBuffers();
+	const uint32 NumBuffers = FMeshBatchCommandRecorder::Record(InMeshBatches, RecordContext, CommandBuffers, OwnerRenderer->GetTaskPool());
 
-		// 5. 드로우 콜 실행
-		RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+	FRenderCommandBackend* CommandBackend = OwnerRenderer->GetCommandBackend();
+	CommandBackend->BeginPass();
+	for (uint32 BufferIndex = 0; BufferIndex < NumBuffers; ++BufferIndex)
+	{
+		CommandBackend->Execute(CommandBuffers[BufferIndex]);
 	}
 
 	// 루프 종료 후 리스트 비우기 (옵션)
@@ -1729,7 +1969,7 @@ void FSceneRenderer::RenderFXAAPass()
 
 	// Shader Resource 바인딩 (슬롯 확인!)
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &SourceSRV);
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, &SamplerState);
+	RHIDevice->PSSetSamplers(0, 1, &SamplerState);
 
 	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
 	UShader* CopyTexturePS = UResourceManager::GetInstance().Load<UShader>("Shaders/PostProcess/FXAA_PS.hlsl");
@@ -1788,7 +2028,7 @@ void FSceneRenderer::CompositeToBackBuffer()
 
 	// 4. 셰이더 리소스 바인딩
 	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 1, &SourceSRV);
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 1, &SamplerState);
+	RHIDevice->PSSetSamplers(0, 1, &SamplerState);
 
 	// 5. 셰이더 준비
 	UShader* FullScreenTriangleVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Utility/FullScreenTriangle_VS.hlsl");
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "AABB.h"
 
 // 전방 선언 (헤더 파일 의존성 최소화)
 class UWorld;
@@ -30,6 +31,7 @@ struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
 	TArray<UMeshComponent*> Meshes;
+	TArray<FAABB> MeshBounds;              // Meshes와 같은 순서의 프록시 캐시 월드 바운드 (스태틱 메시만 유효)
 	TArray<UMeshComponent*> SkyDomeMeshes; // 스카이돔 전용 (Sky Pass에서만 렌더링)
 	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
 	TArray<UDecalComponent*> Decals;
@@ -58,6 +60,46 @@ struct FSceneGlobals
 	TArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
 };
 
+// 그림자 캐스터 하나 (배치는 ShadowMeshBatches의 [FirstBatch, FirstBatch + NumBatches) 구간)
+struct FShadowCaster
+{
+	UMeshComponent* Component = nullptr;
+	FAABB Bounds;
+	int32 FirstBatch = 0;
+	int32 NumBatches = 0;
+	uint64 Hash = 0;
+	bool bHasBounds = false;
+	bool bTrackedByBVH = false; // BVH에 최신 바운드로 들어있어 쿼리 결과만으로 판정 가능
+};
+
+/**
+ * 한 프레임의 여러 뷰(쿼드 뷰 등)가 공유하는 뷰 독립 데이터 (URenderer 소유)
+ * - 프록시 수집과 그림자 캐스터 수집은 첫 번째 뷰에서 한 번만 하고, 이후 뷰는 결과를 복사해 사용
+ * - 월드/프레임/쇼플래그/PIE 상태가 바뀌면 다시 수집
+ */
+struct FSceneFrameData
+{
+	bool IsValidFor(const UWorld* InWorld, uint64 InFrameNumber) const;
+	void Reset(UWorld* InWorld, uint64 InFrameNumber);
+
+	UWorld* World = nullptr;
+	uint64 FrameNumber = 0;
+	uint64 ShowFlags = 0;
+	bool bPie = false;
+	bool bPIEEjected = false;
+	bool bProxiesGathered = false;
+
+	FVisibleRenderProxySet Proxies;
+	FSceneLocals SceneLocals;
+	FSceneGlobals SceneGlobals;
+
+	// 그림자 캐스터 (캐스터 메시 배치는 첫 번째 뷰의 LOD로 수집)
+	bool bShadowCastersGathered = false;
+	TArray<FMeshBatchElement> ShadowMeshBatches;
+	TArray<FShadowCaster> ShadowCasters;
+	TMap<UMeshComponent*, int32> CasterIndexMap;
+};
+
 /**
  * @class FSceneRenderer
  * @brief 한 프레임의 특정 뷰(View)에 대한 씬 렌더링을 총괄하는 임시(transient) 클래스.
@@ -103,8 +145,10 @@ private:
 
 	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw, bool bSetDefaultState = true);
 
-	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
+	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. RenderSettings의 데칼 렌더 경로에 따라 아래 둘 중 하나를 사용합니다. */
 	void RenderDecalPass();
+	void RenderMeshDecalPass();
+	void RenderClusteredDecalPass();
 
 	
 	/** @brief 후처리 렌더링 패스입니다. */
@@ -151,6 +195,6 @@ private:
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
-	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
-	std::unique_ptr<FTileLightCuller> TileLightCuller;
+	// 타일 기반 라이트 컬링 시스템 (URenderer 소유, 뷰 간 재사용)
+	FTileLightCuller* TileLightCuller = nullptr;
 };
\ No newline at end of file
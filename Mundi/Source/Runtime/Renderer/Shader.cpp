@@ -3,6 +3,8 @@
 
 IMPLEMENT_CLASS(UShader)
 
+uint32 UShader::VariantSelectionSerial = 0;
+
 // 컴파일 로직을 처리하는 비공개 헬퍼 함수
 static bool CompileShaderInternal(
 	const FWideString& InFilePath,
@@ -48,6 +50,7 @@ static bool CompileShaderInternal(
 
 UShader::~UShader()
 {
+	ReleaseFileWatches();
 	ReleaseResources();
 }
 
@@ -97,6 +100,7 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 		}
 		// Include 파일 파싱 (최초 1회)
 		ParseIncludeFiles(FilePath);
+		RefreshFileWatches();
 	}
 
 	// 2. 실제 컴파일/가져오기 로직은 GetOrCompileShaderVariant에 위임
@@ -208,7 +212,7 @@ bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InSh
 		{
 			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
 			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, OutVariant); // OutVariant 전달
+			CreateInputLayout(InDevice, InShaderPath, InMacros, OutVariant); // OutVariant 전달
 		}
 	}
 	else if (EndsWith(InShaderPath, "_PS.hlsl"))
@@ -229,7 +233,7 @@ bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InSh
 		{
 			Hr = InDevice->CreateVertexShader(OutVariant.VSBlob->GetBufferPointer(), OutVariant.VSBlob->GetBufferSize(), nullptr, &OutVariant.VertexShader);
 			assert(SUCCEEDED(Hr));
-			CreateInputLayout(InDevice, InShaderPath, OutVariant);
+			CreateInputLayout(InDevice, InShaderPath, InMacros, OutVariant);
 		}
 		if (bPsCompiled)
 		{
@@ -251,6 +255,37 @@ FShaderVariant* UShader::GetShaderVariant(const TArray<FShaderMacro>& InMacros)
 	return ShaderVariantMap.Find(Key);
 }
 
+bool UShader::HasCompressedVertexMacro(const TArray<FShaderMacro>& InMacros)
+{
+	for (const FShaderMacro& Macro : InMacros)
+	{
+		if (Macro.Name == "COMPRESSED_VERTEX")
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+TArray<FShaderMacro> UShader::AddCompressedVertexMacro(const TArray<FShaderMacro>& InMacros)
+{
+	TArray<FShaderMacro> Macros = InMacros;
+	if (!HasCompressedVertexMacro(Macros))
+	{
+		Macros.Add(FShaderMacro{ "COMPRESSED_VERTEX", "1" });
+	}
+	return Macros;
+}
+
+FShaderVariant* UShader::GetBatchShaderVariant(ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros, bool bCompressedVertex)
+{
+	if (!bCompressedVertex)
+	{
+		return GetOrCompileShaderVariant(InDevice, InMacros);
+	}
+	return GetOrCompileShaderVariant(InDevice, AddCompressedVertexMacro(InMacros));
+}
+
 ID3D11InputLayout* UShader::GetInputLayout(const TArray<FShaderMacro>& InMacros)
 {
 	FShaderVariant* Variant = GetShaderVariant(InMacros);
@@ -281,9 +316,11 @@ ID3D11PixelShader* UShader::GetPixelShader(const TArray<FShaderMacro>& InMacros)
 	return nullptr;
 }
 
-void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant)
+void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& InOutVariant)
 {
-	TArray<D3D11_INPUT_ELEMENT_DESC> descArray = UResourceManager::GetInstance().GetProperInputLayout(InShaderPath);
+	TArray<D3D11_INPUT_ELEMENT_DESC> descArray = HasCompressedVertexMacro(InMacros)
+		? UResourceManager::GetInstance().GetCompressedVertexInputLayout()
+		: UResourceManager::GetInstance().GetProperInputLayout(InShaderPath);
 	const D3D11_INPUT_ELEMENT_DESC* layout = descArray.data();
 	uint32 layoutCount = static_cast<uint32>(descArray.size());
 
@@ -423,8 +460,14 @@ bool UShader::Reload(ID3D11Device* InDevice)
 		Context->IASetInputLayout(nullptr);
 		Context->Flush(); // GPU 작업 완료 대기
 		Context->Release();
+
+		// 컨텍스트를 직접 건드렸고 해제된 셰이더 주소가 재사용될 수 있으므로 RHI 상태 캐시도 무효화
+		GEngine.GetRHIDevice()->InvalidateStateCache();
 	}
 
+	// 변형 맵이 새로 만들어졌으므로 캐시된 변형/셰이더 포인터를 다시 조회하도록 알림
+	InvalidateVariantSelections();
+
 	// 6. [최종 처리] 성공/실패에 따라 맵 처리
 	if (bAllReloadsSuccessful)
 	{
@@ -441,9 +484,11 @@ bool UShader::Reload(ID3D11Device* InDevice)
 		try
 		{
 			SetLastModifiedTime(std::filesystem::last_write_time(FilePath));
-			UpdateIncludeTimestamps(); // Include 파일 타임스탬프도 갱신
+			// Include 목록이 바뀌었을 수 있으므로 다시 파싱 (타임스탬프도 갱신됨)
+			ParseIncludeFiles(FilePath);
 		}
 		catch (...) { /* 무시 */ }
+		RefreshFileWatches();
 
 		return true;
 	}
@@ -589,3 +634,31 @@ void UShader::UpdateIncludeTimestamps()
 		}
 	}
 }
+
+void UShader::RefreshFileWatches()
+{
+	ReleaseFileWatches();
+
+	// 콜백은 this를 캡처하지 않음: 실제 변경 여부는 CheckAndReloadShaders에서 IsOutdated로 판단
+	auto OnShaderFileChanged = [](const std::filesystem::path&)
+	{
+		UResourceManager::GetInstance().RequestShaderHotReload();
+	};
+
+	FFileWatcher& Watcher = FFileWatcher::GetInstance();
+	FileWatchHandles.push_back(Watcher.WatchFile(FilePath, OnShaderFileChanged));
+	for (const FString& IncludedFile : IncludedFiles)
+	{
+		FileWatchHandles.push_back(Watcher.WatchFile(IncludedFile, OnShaderFileChanged));
+	}
+}
+
+void UShader::ReleaseFileWatches()
+{
+	FFileWatcher& Watcher = FFileWatcher::GetInstance();
+	for (FFileWatchHandle& Handle : FileWatchHandles)
+	{
+		Watcher.Unwatch(Handle);
+	}
+	FileWatchHandles.clear();
+}
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "ResourceBase.h"
 #include <filesystem>
+#include "FileWatcher.h"
 
 struct FShaderMacro
 {
@@ -49,6 +50,12 @@ public:
 	FShaderVariant* GetOrCompileShaderVariant(ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	bool CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant);
 	FShaderVariant* GetShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
+
+	// 압축 정점(FCompressedVertex) 디코드 변형. 입력 레이아웃도 압축 레이아웃으로 생성됨
+	static bool HasCompressedVertexMacro(const TArray<FShaderMacro>& InMacros);
+	static TArray<FShaderMacro> AddCompressedVertexMacro(const TArray<FShaderMacro>& InMacros);
+	// 배치 정점 포맷에 맞는 변형 (압축 정점이면 COMPRESSED_VERTEX 변형을 필요 시 컴파일)
+	FShaderVariant* GetBatchShaderVariant(ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros, bool bCompressedVertex);
 	ID3D11InputLayout* GetInputLayout(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11VertexShader* GetVertexShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11PixelShader* GetPixelShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
@@ -56,6 +63,11 @@ public:
 	// Hot Reload Support
 	bool IsOutdated() const;
 	bool Reload(ID3D11Device* InDevice);
+
+	// 변형 선택 결과가 바뀔 수 있는 변경(핫 리로드, 머티리얼의 셰이더/매크로 교체)마다 증가
+	// 컴포넌트에 캐시된 메시 드로우 커맨드는 이 값이 바뀌면 다시 만듦
+	static uint32 GetVariantSelectionSerial() { return VariantSelectionSerial; }
+	static void InvalidateVariantSelections() { ++VariantSelectionSerial; }
 	//const TArray<FShaderMacro>& GetMacros() const { return Macros; }
 	
 protected:
@@ -64,17 +76,25 @@ protected:
 private:
 	TMap<FString, FShaderVariant> ShaderVariantMap;
 
+	static uint32 VariantSelectionSerial;
+
 	// Store included files (e.g., "Shaders/Common/LightingCommon.hlsl")
 	// Used for hot reload - if any included file changes, reload this shader
 	TArray<FString> IncludedFiles;
 	TMap<FString, std::filesystem::file_time_type> IncludedFileTimestamps;
 
-	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant);
+	// 메인 파일 + Include 파일 감시 구독 (변경 시 UResourceManager에 리로드 요청)
+	TArray<FFileWatchHandle> FileWatchHandles;
+
+	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& InOutVariant);
 	void ReleaseResources();
 
 	// Include 파일 파싱 및 추적
 	void ParseIncludeFiles(const FString& ShaderPath);
 	void UpdateIncludeTimestamps();
+
+	void RefreshFileWatches();
+	void ReleaseFileWatches();
 };
 
 struct FVertexPositionColor
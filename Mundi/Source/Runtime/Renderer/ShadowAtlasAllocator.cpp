@@ -0,0 +1,187 @@
+﻿#include "pch.h"
+#include "ShadowAtlasAllocator.h"
+
+void FShadowAtlasQuadTree::Initialize(uint32 InAtlasSize, uint32 InMinTileSize)
+{
+	AtlasSize = RoundUpToPowerOfTwo(InAtlasSize);
+	MinTileSize = FMath::Clamp(RoundUpToPowerOfTwo(InMinTileSize), 1u, AtlasSize);
+	Reset();
+}
+
+void FShadowAtlasQuadTree::Reset()
+{
+	Nodes.clear();
+	FreeChildBlocks.clear();
+	UsedTexels = 0;
+
+	if (AtlasSize == 0)
+	{
+		return;
+	}
+
+	FNode Root;
+	Root.Size = AtlasSize;
+	Nodes.Add(Root);
+}
+
+bool FShadowAtlasQuadTree::Allocate(uint32 InSize, FRegion& OutRegion)
+{
+	OutRegion = FRegion();
+	if (Nodes.IsEmpty() || InSize == 0 || InSize > AtlasSize)
+	{
+		return false;
+	}
+
+	const uint32 Size = FMath::Max(RoundUpToPowerOfTwo(InSize), MinTileSize);
+
+	// 1. 이미 쪼개진 영역 안의 딱 맞는 빈칸, 2. 가장 작은 빈 노드를 쪼개서 사용
+	int32 NodeIndex = FindFreeNode(0, Size, false);
+	if (NodeIndex < 0)
+	{
+		NodeIndex = FindFreeNode(0, Size, true);
+		if (NodeIndex < 0)
+		{
+			return false;
+		}
+
+		while (Nodes[NodeIndex].Size > Size)
+		{
+			SplitNode(NodeIndex);
+			NodeIndex = Nodes[NodeIndex].FirstChild;
+		}
+	}
+
+	FNode& Node = Nodes[NodeIndex];
+	Node.State = ENodeState::Used;
+	UsedTexels += static_cast<uint64>(Node.Size) * Node.Size;
+
+	OutRegion.Node = NodeIndex;
+	OutRegion.X = Node.X;
+	OutRegion.Y = Node.Y;
+	OutRegion.Size = Node.Size;
+	return true;
+}
+
+void FShadowAtlasQuadTree::Free(FRegion& InOutRegion)
+{
+	if (!InOutRegion.IsValid() || InOutRegion.Node >= Nodes.Num() || Nodes[InOutRegion.Node].State != ENodeState::Used)
+	{
+		InOutRegion = FRegion();
+		return;
+	}
+
+	int32 NodeIndex = InOutRegion.Node;
+	Nodes[NodeIndex].State = ENodeState::Free;
+	UsedTexels -= static_cast<uint64>(Nodes[NodeIndex].Size) * Nodes[NodeIndex].Size;
+	InOutRegion = FRegion();
+
+	// 형제가 모두 비었으면 부모로 병합
+	int32 ParentIndex = Nodes[NodeIndex].Parent;
+	while (ParentIndex >= 0)
+	{
+		const int32 FirstChild = Nodes[ParentIndex].FirstChild;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (Nodes[FirstChild + i].State != ENodeState::Free)
+			{
+				return;
+			}
+		}
+
+		FreeChildBlocks.Add(FirstChild);
+		Nodes[ParentIndex].FirstChild = -1;
+		Nodes[ParentIndex].State = ENodeState::Free;
+		ParentIndex = Nodes[ParentIndex].Parent;
+	}
+}
+
+uint32 FShadowAtlasQuadTree::RoundUpToPowerOfTwo(uint32 Value)
+{
+	if (Value <= 1)
+	{
+		return Value;
+	}
+
+	uint32 Result = 1;
+	while (Result < Value && Result < 0x80000000u)
+	{
+		Result <<= 1;
+	}
+	return Result;
+}
+
+int32 FShadowAtlasQuadTree::FindFreeNode(int32 NodeIndex, uint32 InSize, bool bAllowSplit) const
+{
+	const FNode& Node = Nodes[NodeIndex];
+	if (Node.Size < InSize)
+	{
+		return -1;
+	}
+
+	switch (Node.State)
+	{
+	case ENodeState::Used:
+		return -1;
+	case ENodeState::Free:
+		// 쪼개기 허용 시 크기가 맞지 않아도 후보 (호출자가 가장 작은 후보를 고름)
+		return (Node.Size == InSize || bAllowSplit) ? NodeIndex : -1;
+	case ENodeState::Split:
+	default:
+		break;
+	}
+
+	int32 Best = -1;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const int32 Candidate = FindFreeNode(Node.FirstChild + i, InSize, bAllowSplit);
+		if (Candidate < 0)
+		{
+			continue;
+		}
+		if (Nodes[Candidate].Size == InSize)
+		{
+			return Candidate;
+		}
+		if (Best < 0 || Nodes[Candidate].Size < Nodes[Best].Size)
+		{
+			Best = Candidate;
+		}
+	}
+	return Best;
+}
+
+void FShadowAtlasQuadTree::SplitNode(int32 NodeIndex)
+{
+	const int32 FirstChild = AllocateChildBlock();
+
+	// AllocateChildBlock이 Nodes를 늘릴 수 있으므로 참조는 그 뒤에 얻음
+	FNode& Node = Nodes[NodeIndex];
+	const uint32 HalfSize = Node.Size / 2;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		FNode& Child = Nodes[FirstChild + i];
+		Child.X = Node.X + (i % 2) * HalfSize;
+		Child.Y = Node.Y + (i / 2) * HalfSize;
+		Child.Size = HalfSize;
+		Child.Parent = NodeIndex;
+		Child.FirstChild = -1;
+		Child.State = ENodeState::Free;
+	}
+
+	Node.FirstChild = FirstChild;
+	Node.State = ENodeState::Split;
+}
+
+int32 FShadowAtlasQuadTree::AllocateChildBlock()
+{
+	if (!FreeChildBlocks.IsEmpty())
+	{
+		const int32 Block = FreeChildBlocks.Last();
+		FreeChildBlocks.pop_back();
+		return Block;
+	}
+
+	const int32 Block = Nodes.Num();
+	Nodes.SetNum(Block + 4);
+	return Block;
+}
@@ -0,0 +1,63 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+/**
+ * 섀도우 아틀라스 4분할 트리 할당기
+ * - 정사각형 아틀라스를 2의 거듭제곱 크기 타일로 나눠 할당 (요청 크기는 MinTileSize ~ AtlasSize)
+ * - 이미 쪼개진 노드의 빈칸을 먼저 채우고, 없으면 가장 작은 빈 노드를 쪼갬 (큰 빈칸을 최대한 남김)
+ * - 해제 시 네 형제가 모두 비면 부모로 병합하므로 라이트가 프레임마다 바뀌어도 단편화가 쌓이지 않음
+ */
+class FShadowAtlasQuadTree
+{
+public:
+	struct FRegion
+	{
+		int32 Node = -1;
+		uint32 X = 0;
+		uint32 Y = 0;
+		uint32 Size = 0;
+
+		bool IsValid() const { return Node >= 0; }
+	};
+
+	void Initialize(uint32 InAtlasSize, uint32 InMinTileSize);
+	void Reset();
+
+	bool Allocate(uint32 InSize, FRegion& OutRegion);
+	void Free(FRegion& InOutRegion);
+
+	bool IsInitialized() const { return !Nodes.IsEmpty(); }
+	uint32 GetAtlasSize() const { return AtlasSize; }
+	uint32 GetMinTileSize() const { return MinTileSize; }
+	uint64 GetUsedTexels() const { return UsedTexels; }
+
+	static uint32 RoundUpToPowerOfTwo(uint32 Value);
+
+private:
+	enum class ENodeState : uint8
+	{
+		Free,
+		Split,
+		Used,
+	};
+
+	struct FNode
+	{
+		uint32 X = 0;
+		uint32 Y = 0;
+		uint32 Size = 0;
+		int32 Parent = -1;
+		int32 FirstChild = -1; // 자식 4개는 연속 배치
+		ENodeState State = ENodeState::Free;
+	};
+
+	int32 FindFreeNode(int32 NodeIndex, uint32 InSize, bool bAllowSplit) const;
+	void SplitNode(int32 NodeIndex);
+	int32 AllocateChildBlock();
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeChildBlocks; // 병합으로 반납된 자식 블록 (재사용)
+	uint32 AtlasSize = 0;
+	uint32 MinTileSize = 0;
+	uint64 UsedTexels = 0;
+};
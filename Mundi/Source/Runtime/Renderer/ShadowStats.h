@@ -1,6 +1,27 @@
 #pragma once
 #include "UEContainer.h"
 
+// 섀도우 맵 렌더링 통계 (요청별 캐스터 컬링 / 정적 섀도우 캐시)
+struct FShadowCasterStats
+{
+	uint32 ShadowCasters = 0;       // 그림자를 드리우는 메시 컴포넌트 수
+	uint32 Requests = 0;            // 아틀라스가 할당된 섀도우 뷰 수 (스팟, CSM 캐스케이드, 큐브 면)
+	uint32 RenderedRequests = 0;    // 다시 그린 섀도우 뷰 수
+	uint32 CachedRequests = 0;      // 이전 내용을 재사용한 섀도우 뷰 수
+	uint32 VisibleCasterSum = 0;    // 요청별 컬링을 통과한 캐스터 수의 합
+	uint32 DrawnBatches = 0;        // 실제로 그린 배치 수
+
+	float GetCastersPerRequest() const
+	{
+		return Requests > 0 ? static_cast<float>(VisibleCasterSum) / static_cast<float>(Requests) : 0.0f;
+	}
+
+	float GetCacheHitRate() const
+	{
+		return Requests > 0 ? 100.0f * static_cast<float>(CachedRequests) / static_cast<float>(Requests) : 0.0f;
+	}
+};
+
 // 섀도우 통계 구조체
 // 씬의 섀도우 맵 관련 정보를 추적
 struct FShadowStats
@@ -21,6 +42,9 @@ struct FShadowStats
 	float ShadowAtlasCubeMemoryMB = 0.0f;
 	float TotalShadowMemoryMB = 0.0f;
 
+	// 섀도우 맵 패스 (RenderShadowMaps에서 채움)
+	FShadowCasterStats Casters;
+
 	// 모든 통계를 0으로 리셋
 	void Reset()
 	{
@@ -34,6 +58,7 @@ struct FShadowStats
 		ShadowAtlas2DMemoryMB = 0.0f;
 		ShadowAtlasCubeMemoryMB = 0.0f;
 		TotalShadowMemoryMB = 0.0f;
+		Casters = FShadowCasterStats();
 	}
 
 	// 전체 섀도우 캐스팅 라이트 수 계산
@@ -84,6 +109,12 @@ public:
 		CurrentStats = InStats;
 	}
 
+	// 섀도우 맵 패스 통계 갱신 (UpdateStats 이후 같은 뷰에서 호출)
+	void UpdateCasterStats(const FShadowCasterStats& InStats)
+	{
+		CurrentStats.Casters = InStats;
+	}
+
 	// 통계 조회
 	const FShadowStats& GetStats() const
 	{
@@ -0,0 +1,284 @@
+﻿#include "pch.h"
+#include "TileDecalBinner.h"
+#include "D3D11RHI.h"
+#include "DecalComponent.h"
+#include "OBB.h"
+#include "Texture.h"
+#include <cfloat>
+
+FTileDecalBinner::~FTileDecalBinner()
+{
+	Release();
+}
+
+void FTileDecalBinner::Initialize(D3D11RHI* InRHI)
+{
+	RHI = InRHI;
+}
+
+void FTileDecalBinner::Release()
+{
+	if (DecalDataSRV) { DecalDataSRV->Release(); DecalDataSRV = nullptr; }
+	if (DecalDataBuffer) { DecalDataBuffer->Release(); DecalDataBuffer = nullptr; }
+	if (TileListSRV) { TileListSRV->Release(); TileListSRV = nullptr; }
+	if (TileListBuffer) { TileListBuffer->Release(); TileListBuffer = nullptr; }
+	DecalDataCapacity = 0;
+	TileListCapacity = 0;
+}
+
+bool FTileDecalBinner::Prepare(const TArray<UDecalComponent*>& InDecals, const FMatrix& InViewProj, uint32 InViewportStartX, uint32 InViewportStartY,
+	uint32 InViewportWidth, uint32 InViewportHeight, uint32 InTileSize)
+{
+	ViewportStartX = InViewportStartX;
+	ViewportStartY = InViewportStartY;
+	ViewportWidth = InViewportWidth;
+	ViewportHeight = InViewportHeight;
+	TileSize = std::max(1u, InTileSize);
+	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
+	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
+
+	DecalData.clear();
+	DecalTileRects.clear();
+	Passes.clear();
+	TileDecalPairs = 0;
+
+	if (!RHI || TileCountX == 0 || TileCountY == 0)
+	{
+		return false;
+	}
+
+	for (UDecalComponent* Decal : InDecals)
+	{
+		UTexture* Texture = Decal ? Decal->GetDecalTexture() : nullptr;
+		if (!Texture || !Texture->GetShaderResourceView())
+		{
+			continue;
+		}
+
+		FTileRect Rect;
+		if (!ComputeTileRect(Decal->GetWorldOBB(), InViewProj, Rect))
+		{
+			continue;
+		}
+
+		// 현재 패스에 없는 텍스처인데 슬롯이 다 찼으면 새 패스 시작
+		if (Passes.empty())
+		{
+			Passes.Add(FPass());
+		}
+		FPass* Pass = &Passes.back();
+		auto It = std::find(Pass->Textures.begin(), Pass->Textures.end(), Texture);
+		if (It == Pass->Textures.end() && Pass->Textures.Num() >= static_cast<int32>(MaxTexturesPerPass))
+		{
+			FPass NewPass;
+			NewPass.FirstDecal = static_cast<uint32>(DecalData.Num());
+			Passes.Add(NewPass);
+			Pass = &Passes.back();
+			It = Pass->Textures.end();
+		}
+		if (It == Pass->Textures.end())
+		{
+			Pass->Textures.Add(Texture);
+			It = Pass->Textures.end() - 1;
+		}
+
+		FDecalGPUData Data;
+		Data.DecalMatrix = Decal->GetDecalProjectionMatrix();
+		Data.Opacity = Decal->GetOpacity();
+		Data.TextureSlot = static_cast<uint32>(It - Pass->Textures.begin());
+		DecalData.Add(Data);
+		DecalTileRects.Add(Rect);
+		++Pass->NumDecals;
+	}
+
+	if (DecalData.empty())
+	{
+		return false;
+	}
+
+	const uint32 NumDecals = static_cast<uint32>(DecalData.Num());
+	if (!EnsureBuffer(DecalDataBuffer, DecalDataSRV, DecalDataCapacity, sizeof(FDecalGPUData), NumDecals))
+	{
+		return false;
+	}
+	RHI->UpdateStructuredBuffer(DecalDataBuffer, DecalData.data(), sizeof(FDecalGPUData) * NumDecals);
+	return true;
+}
+
+bool FTileDecalBinner::BindPass(uint32 PassIndex)
+{
+	if (PassIndex >= static_cast<uint32>(Passes.Num()))
+	{
+		return false;
+	}
+
+	const FPass& Pass = Passes[PassIndex];
+	const uint32 NumTiles = TileCountX * TileCountY;
+	const uint32 HeaderSize = GridHeaderSize + NumTiles * 2;
+	const uint32 EndDecal = Pass.FirstDecal + Pass.NumDecals;
+
+	// 0. 셰이더가 타일을 찾을 격자 (비닝에 쓴 값 그대로)
+	TileDecalList.assign(HeaderSize, 0);
+	TileDecalList[0] = TileSize;
+	TileDecalList[1] = TileCountX;
+	TileDecalList[2] = TileCountY;
+	TileDecalList[3] = ViewportStartX;
+	TileDecalList[4] = ViewportStartY;
+
+	// 1. 타일별 데칼 개수
+	for (uint32 DecalIndex = Pass.FirstDecal; DecalIndex < EndDecal; ++DecalIndex)
+	{
+		const FTileRect& Rect = DecalTileRects[DecalIndex];
+		for (uint32 TileY = Rect.MinY; TileY <= Rect.MaxY; ++TileY)
+		{
+			for (uint32 TileX = Rect.MinX; TileX <= Rect.MaxX; ++TileX)
+			{
+				++TileDecalList[GridHeaderSize + (TileY * TileCountX + TileX) * 2 + 1];
+			}
+		}
+	}
+
+	// 2. 헤더 뒤에 이어 붙일 오프셋 (누적합)
+	TileCursors.resize(NumTiles);
+	uint32 Offset = HeaderSize;
+	for (uint32 Tile = 0; Tile < NumTiles; ++Tile)
+	{
+		TileDecalList[GridHeaderSize + Tile * 2] = Offset;
+		TileCursors[Tile] = Offset;
+		Offset += TileDecalList[GridHeaderSize + Tile * 2 + 1];
+	}
+	TileDecalList.resize(Offset);
+
+	// 3. 데칼 순서대로 채움 (셰이더가 같은 순서로 합성)
+	for (uint32 DecalIndex = Pass.FirstDecal; DecalIndex < EndDecal; ++DecalIndex)
+	{
+		const FTileRect& Rect = DecalTileRects[DecalIndex];
+		for (uint32 TileY = Rect.MinY; TileY <= Rect.MaxY; ++TileY)
+		{
+			for (uint32 TileX = Rect.MinX; TileX <= Rect.MaxX; ++TileX)
+			{
+				TileDecalList[TileCursors[TileY * TileCountX + TileX]++] = DecalIndex;
+			}
+		}
+	}
+	TileDecalPairs += Offset - HeaderSize;
+
+	if (!EnsureBuffer(TileListBuffer, TileListSRV, TileListCapacity, sizeof(uint32), Offset))
+	{
+		return false;
+	}
+	RHI->UpdateStructuredBuffer(TileListBuffer, TileDecalList.data(), sizeof(uint32) * Offset);
+
+	ID3D11DeviceContext* DeviceContext = RHI->GetDeviceContext();
+	DeviceContext->PSSetShaderResources(DecalDataSlot, 1, &DecalDataSRV);
+	DeviceContext->PSSetShaderResources(TileDecalListSlot, 1, &TileListSRV);
+
+	// 쓰지 않는 슬롯은 이전 패스의 텍스처가 남지 않도록 비움
+	ID3D11ShaderResourceView* TextureSRVs[MaxTexturesPerPass] = {};
+	for (int32 i = 0; i < Pass.Textures.Num(); ++i)
+	{
+		TextureSRVs[i] = Pass.Textures[i]->GetShaderResourceView();
+	}
+	DeviceContext->PSSetShaderResources(DecalTextureSlot, MaxTexturesPerPass, TextureSRVs);
+	return true;
+}
+
+void FTileDecalBinner::UnbindPass()
+{
+	if (!RHI)
+	{
+		return;
+	}
+
+	ID3D11DeviceContext* DeviceContext = RHI->GetDeviceContext();
+	ID3D11ShaderResourceView* NullSRVs[MaxTexturesPerPass] = {};
+	DeviceContext->PSSetShaderResources(DecalDataSlot, 1, NullSRVs);
+	DeviceContext->PSSetShaderResources(TileDecalListSlot, 1, NullSRVs);
+	DeviceContext->PSSetShaderResources(DecalTextureSlot, MaxTexturesPerPass, NullSRVs);
+}
+
+bool FTileDecalBinner::ComputeTileRect(const FOBB& InOBB, const FMatrix& InViewProj, FTileRect& OutRect) const
+{
+	float MinNdcX = FLT_MAX, MinNdcY = FLT_MAX, MinNdcZ = FLT_MAX;
+	float MaxNdcX = -FLT_MAX, MaxNdcY = -FLT_MAX;
+	const TArray<FVector> Corners = InOBB.GetCorners();
+	int32 NumBehindCamera = 0;
+
+	for (const FVector& Corner : Corners)
+	{
+		const FVector4 Clip = FVector4(Corner.X, Corner.Y, Corner.Z, 1.0f) * InViewProj;
+		if (Clip.W <= KINDA_SMALL_NUMBER)
+		{
+			++NumBehindCamera;
+			continue;
+		}
+		const float InvW = 1.0f / Clip.W;
+		MinNdcX = std::min(MinNdcX, Clip.X * InvW);
+		MaxNdcX = std::max(MaxNdcX, Clip.X * InvW);
+		MinNdcY = std::min(MinNdcY, Clip.Y * InvW);
+		MaxNdcY = std::max(MaxNdcY, Clip.Y * InvW);
+		MinNdcZ = std::min(MinNdcZ, Clip.Z * InvW);
+	}
+
+	if (NumBehindCamera == Corners.Num())
+	{
+		return false;
+	}
+	if (NumBehindCamera > 0)
+	{
+		// 카메라 뒤로 넘어간 꼭짓점은 투영이 뒤집히므로 화면 전체로 간주
+		OutRect.MinX = 0;
+		OutRect.MinY = 0;
+		OutRect.MaxX = TileCountX - 1;
+		OutRect.MaxY = TileCountY - 1;
+		return true;
+	}
+
+	// 화면 밖 또는 원평면 너머
+	if (MaxNdcX < -1.0f || MinNdcX > 1.0f || MaxNdcY < -1.0f || MinNdcY > 1.0f || MinNdcZ > 1.0f)
+	{
+		return false;
+	}
+
+	// NDC → 뷰포트 픽셀 (Y 반전) → 타일
+	auto ToTile = [](float Pixel, uint32 Size, uint32 InTileSize)
+	{
+		const float Clamped = FMath::Clamp(Pixel, 0.0f, static_cast<float>(Size - 1));
+		return static_cast<uint32>(Clamped) / InTileSize;
+	};
+	OutRect.MinX = ToTile((MinNdcX * 0.5f + 0.5f) * ViewportWidth, ViewportWidth, TileSize);
+	OutRect.MaxX = ToTile((MaxNdcX * 0.5f + 0.5f) * ViewportWidth, ViewportWidth, TileSize);
+	OutRect.MinY = ToTile((0.5f - MaxNdcY * 0.5f) * ViewportHeight, ViewportHeight, TileSize);
+	OutRect.MaxY = ToTile((0.5f - MinNdcY * 0.5f) * ViewportHeight, ViewportHeight, TileSize);
+	return true;
+}
+
+bool FTileDecalBinner::EnsureBuffer(ID3D11Buffer*& InOutBuffer, ID3D11ShaderResourceView*& InOutSRV, uint32& InOutCapacity, uint32 InElementSize, uint32 InNumElements)
+{
+	if (InOutBuffer && InNumElements <= InOutCapacity)
+	{
+		return true;
+	}
+
+	if (InOutSRV) { InOutSRV->Release(); InOutSRV = nullptr; }
+	if (InOutBuffer) { InOutBuffer->Release(); InOutBuffer = nullptr; }
+	InOutCapacity = 0;
+
+	// 매 프레임 재생성하지 않도록 여유를 두고 키움
+	const uint32 NewCapacity = std::max<uint32>(InNumElements + InNumElements / 2, 256);
+	HRESULT hr = RHI->CreateStructuredBuffer(InElementSize, NewCapacity, nullptr, &InOutBuffer);
+	if (SUCCEEDED(hr))
+	{
+		hr = RHI->CreateStructuredBufferSRV(InOutBuffer, &InOutSRV);
+	}
+	if (FAILED(hr))
+	{
+		UE_LOG("FTileDecalBinner: 구조화 버퍼 생성 실패 (%u elements)", NewCapacity);
+		if (InOutSRV) { InOutSRV->Release(); InOutSRV = nullptr; }
+		if (InOutBuffer) { InOutBuffer->Release(); InOutBuffer = nullptr; }
+		return false;
+	}
+
+	InOutCapacity = NewCapacity;
+	return true;
+}
@@ -0,0 +1,106 @@
+﻿#pragma once
+#include "Vector.h"
+
+class D3D11RHI;
+class UDecalComponent;
+class UTexture;
+struct FOBB;
+struct ID3D11Buffer;
+struct ID3D11ShaderResourceView;
+
+// 데칼 하나의 GPU 데이터 (Shaders/Effects/ClusteredDecal_PS.hlsl의 FDecalData와 일치, 80 bytes)
+struct FDecalGPUData
+{
+	FMatrix DecalMatrix;		// 월드 → 데칼 투영 공간 (UDecalComponent::GetDecalProjectionMatrix)
+	float Opacity = 1.0f;
+	uint32 TextureSlot = 0;		// 패스에 묶인 데칼 텍스처 중 몇 번째인지
+	uint32 Padding[2] = {};
+};
+static_assert(sizeof(FDecalGPUData) == 80, "FDecalGPUData must match FDecalData in ClusteredDecal_PS.hlsl");
+
+/**
+ * 클러스터드 데칼 경로: 데칼을 라이트 컬링과 같은 화면 타일 격자에 비닝하고 전체 화면 패스로 한 번에 적용
+ * - 데칼 OBB 꼭짓점을 화면에 투영한 사각형으로 보수적으로 비닝 (꼭짓점이 카메라 뒤로 넘어가면 화면 전체)
+ * - 타일 목록 버퍼: 격자 헤더(타일 크기/개수, 뷰포트 시작) 뒤에 타일마다 (오프셋, 개수), 그 뒤에 데칼 인덱스를 데칼 순서대로 이어 붙임
+ *   (겹친 데칼의 합성 순서 유지, 격자를 버퍼에 직접 담아 라이트 컬링 상수(b11)가 갱신되지 않는 Unlit 등에서도 맞는 타일을 읽음)
+ * - SM5.0은 텍스처 배열을 동적 인덱싱할 수 없어 서로 다른 데칼 텍스처를 패스당 MaxTexturesPerPass개까지 슬롯에 묶고,
+ *   넘치면 텍스처 묶음 단위로 패스를 나눔
+ */
+class FTileDecalBinner
+{
+public:
+	static constexpr uint32 MaxTexturesPerPass = 8;
+
+	// 셰이더 바인딩 위치 (ClusteredDecal_PS.hlsl과 일치)
+	static constexpr uint32 DecalDataSlot = 6;		// t6
+	static constexpr uint32 TileDecalListSlot = 7;	// t7
+	static constexpr uint32 DecalTextureSlot = 11;	// t11 ~ t18
+
+	// 타일 목록 버퍼 앞의 격자 헤더 (ClusteredDecal_PS.hlsl과 일치)
+	static constexpr uint32 GridHeaderSize = 8;		// TileSize, TileCountX, TileCountY, ViewportStartX, ViewportStartY, 패딩
+
+	struct FPass
+	{
+		uint32 FirstDecal = 0;
+		uint32 NumDecals = 0;
+		TArray<UTexture*> Textures;
+	};
+
+	FTileDecalBinner() = default;
+	~FTileDecalBinner();
+
+	void Initialize(D3D11RHI* InRHI);
+	void Release();
+
+	// 화면에 걸친 데칼을 패스로 나누고 타일 범위를 계산한 뒤 데칼 데이터를 업로드 (그릴 데칼이 없으면 false)
+	bool Prepare(const TArray<UDecalComponent*>& InDecals, const FMatrix& InViewProj, uint32 InViewportStartX, uint32 InViewportStartY,
+		uint32 InViewportWidth, uint32 InViewportHeight, uint32 InTileSize);
+
+	const TArray<FPass>& GetPasses() const { return Passes; }
+
+	// 패스 하나의 타일 목록을 만들어 업로드하고, 데칼 데이터/타일 목록/텍스처를 PS에 바인딩
+	bool BindPass(uint32 PassIndex);
+	void UnbindPass();
+
+	// 마지막 Prepare 이후 통계
+	uint32 GetNumBinnedDecals() const { return static_cast<uint32>(DecalData.Num()); }
+	uint32 GetTileDecalPairs() const { return TileDecalPairs; }
+
+private:
+	struct FTileRect
+	{
+		uint32 MinX = 0;
+		uint32 MinY = 0;
+		uint32 MaxX = 0;
+		uint32 MaxY = 0;
+	};
+
+	// 화면 밖이면 false
+	bool ComputeTileRect(const FOBB& InOBB, const FMatrix& InViewProj, FTileRect& OutRect) const;
+	bool EnsureBuffer(ID3D11Buffer*& InOutBuffer, ID3D11ShaderResourceView*& InOutSRV, uint32& InOutCapacity, uint32 InElementSize, uint32 InNumElements);
+
+	D3D11RHI* RHI = nullptr;
+
+	uint32 ViewportStartX = 0;
+	uint32 ViewportStartY = 0;
+	uint32 ViewportWidth = 0;
+	uint32 ViewportHeight = 0;
+	uint32 TileSize = 16;
+	uint32 TileCountX = 0;
+	uint32 TileCountY = 0;
+
+	TArray<FDecalGPUData> DecalData;
+	TArray<FTileRect> DecalTileRects;
+	TArray<FPass> Passes;
+	TArray<uint32> TileDecalList;	// 격자 헤더 + [타일 수 * 2] 헤더 + 데칼 인덱스
+	TArray<uint32> TileCursors;
+	uint32 TileDecalPairs = 0;
+
+	// GPU 리소스 (필요할 때만 키움)
+	ID3D11Buffer* DecalDataBuffer = nullptr;
+	ID3D11ShaderResourceView* DecalDataSRV = nullptr;
+	uint32 DecalDataCapacity = 0;
+	ID3D11Buffer* TileListBuffer = nullptr;
+	ID3D11ShaderResourceView* TileListSRV = nullptr;
+	uint32 TileListCapacity = 0;
+};
@@ -10,6 +10,7 @@ FTileLightCuller::FTileLightCuller()
 	, TotalTileCount(0)
 	, LightIndexBuffer(nullptr)
 	, LightIndexBufferSRV(nullptr)
+	, LightIndexBufferCapacity(0)
 {
 }
 
@@ -127,6 +128,18 @@ void FTileLightCuller::CullLights(
 	// 컬링 효율성 계산
 	Stats.CalculateStats();
 
+	// 여러 뷰포트가 컬러를 공유하므로 더 큰 뷰를 만나면 버퍼를 다시 만듦 (작은 뷰는 앞부분만 갱신)
+	if (LightIndexBuffer && RequiredSize > LightIndexBufferCapacity)
+	{
+		if (LightIndexBufferSRV)
+		{
+			LightIndexBufferSRV->Release();
+			LightIndexBufferSRV = nullptr;
+		}
+		LightIndexBuffer->Release();
+		LightIndexBuffer = nullptr;
+	}
+
 	// GPU 버퍼 생성 또는 업데이트
 	if (!LightIndexBuffer)
 	{
@@ -142,9 +155,8 @@ void FTileLightCuller::CullLights(
 		{
 			// SRV 생성
 			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+			LightIndexBufferCapacity = RequiredSize;
 		}
-
-		Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
 	}
 	else
 	{
@@ -155,6 +167,8 @@ void FTileLightCuller::CullLights(
 			RequiredSize * sizeof(uint32)
 		);
 	}
+
+	Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
 }
 
 FFrustum FTileLightCuller::CreateTileFrustum(
@@ -414,6 +428,7 @@ void FTileLightCuller::Release()
 		LightIndexBuffer->Release();
 		LightIndexBuffer = nullptr;
 	}
+	LightIndexBufferCapacity = 0;
 
 	TileLightIndices.Empty();
 }
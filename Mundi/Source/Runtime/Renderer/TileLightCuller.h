@@ -82,6 +82,7 @@ private:
 	// GPU 리소스
 	ID3D11Buffer* LightIndexBuffer;
 	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	UINT LightIndexBufferCapacity;	// 원소(uint32) 개수
 
 	// 통계
 	FTileCullingStats Stats;
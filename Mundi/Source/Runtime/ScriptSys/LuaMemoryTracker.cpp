@@ -0,0 +1,126 @@
+﻿#include "pch.h"
+#include "LuaMemoryTracker.h"
+
+void* FLuaMemoryTracker::Allocate(void* UserData, void* Ptr, size_t OldSize, size_t NewSize)
+{
+	FLuaMemoryTracker& Tracker = *static_cast<FLuaMemoryTracker*>(UserData);
+
+	// Ptr이 nullptr이면 OldSize는 객체 타입 정보이므로 크기로 쓰지 않음
+	const size_t PrevSize = Ptr ? OldSize : 0;
+
+	if (NewSize == 0)
+	{
+		if (Ptr)
+		{
+			Tracker.HeapBytes -= PrevSize;
+			++Tracker.FrameFreeCount;
+			std::free(Ptr);
+		}
+		return nullptr;
+	}
+
+	void* NewPtr = std::realloc(Ptr, NewSize);
+	if (!NewPtr)
+	{
+		return nullptr;
+	}
+
+	Tracker.HeapBytes = Tracker.HeapBytes - PrevSize + NewSize;
+	Tracker.PeakHeapBytes = std::max(Tracker.PeakHeapBytes, Tracker.HeapBytes);
+
+	// 축소는 할당으로 세지 않음
+	if (NewSize > PrevSize)
+	{
+		const uint64 Grown = NewSize - PrevSize;
+		Tracker.FrameAllocBytes += Grown;
+		++Tracker.FrameAllocCount;
+
+		if (Tracker.CurrentScope >= 0)
+		{
+			FLuaScopeAllocStat& Scope = Tracker.Scopes[Tracker.CurrentScope];
+			Scope.FrameAllocBytes += Grown;
+			++Scope.FrameAllocCount;
+		}
+	}
+	return NewPtr;
+}
+
+int32 FLuaMemoryTracker::RegisterScope(const FString& Name)
+{
+	if (const int32* Existing = ScopeByName.Find(Name))
+	{
+		return *Existing;
+	}
+
+	const int32 ScopeId = static_cast<int32>(Scopes.size());
+	FLuaScopeAllocStat NewScope;
+	NewScope.Name = Name;
+	Scopes.push_back(NewScope);
+	ScopeByName.Add(Name, ScopeId);
+	return ScopeId;
+}
+
+void FLuaMemoryTracker::AddGCStepTime(double MS)
+{
+	FrameGCStepMS += MS;
+}
+
+void FLuaMemoryTracker::EndFrame(const FLuaGCSettings& Settings)
+{
+	PeakGCStepMS = std::max(PeakGCStepMS, FrameGCStepMS);
+
+	CurrentStats.HeapBytes = HeapBytes;
+	CurrentStats.PeakHeapBytes = PeakHeapBytes;
+	CurrentStats.FrameAllocBytes = FrameAllocBytes;
+	CurrentStats.FrameAllocCount = FrameAllocCount;
+	CurrentStats.FrameFreeCount = FrameFreeCount;
+	CurrentStats.GCMode = Settings.Mode;
+	CurrentStats.FrameBudgetMS = Settings.FrameBudgetMS;
+	CurrentStats.GCStepMS = FrameGCStepMS;
+	CurrentStats.PeakGCStepMS = PeakGCStepMS;
+	CurrentStats.GCCycles = GCCycles;
+
+	for (FLuaScopeAllocStat& Scope : Scopes)
+	{
+		Scope.TotalAllocBytes += Scope.FrameAllocBytes;
+		Scope.TotalAllocCount += Scope.FrameAllocCount;
+	}
+
+	GatherScopeStats(CurrentStats.TopScopes);
+	if (CurrentStats.TopScopes.size() > FLuaMemoryFrameStats::MaxTopScopes)
+	{
+		CurrentStats.TopScopes.resize(FLuaMemoryFrameStats::MaxTopScopes);
+	}
+
+	// 다음 프레임 집계 준비
+	FrameAllocBytes = 0;
+	FrameAllocCount = 0;
+	FrameFreeCount = 0;
+	FrameGCStepMS = 0.0;
+	for (FLuaScopeAllocStat& Scope : Scopes)
+	{
+		Scope.FrameAllocBytes = 0;
+		Scope.FrameAllocCount = 0;
+	}
+}
+
+void FLuaMemoryTracker::GatherScopeStats(TArray<FLuaScopeAllocStat>& OutStats) const
+{
+	OutStats.clear();
+	for (const FLuaScopeAllocStat& Scope : Scopes)
+	{
+		if (Scope.FrameAllocCount > 0 || Scope.TotalAllocCount > 0)
+		{
+			OutStats.push_back(Scope);
+		}
+	}
+
+	std::sort(OutStats.begin(), OutStats.end(), [](const FLuaScopeAllocStat& A, const FLuaScopeAllocStat& B)
+	{
+		if (A.FrameAllocBytes != B.FrameAllocBytes)
+		{
+			return A.FrameAllocBytes > B.FrameAllocBytes;
+		}
+		return A.TotalAllocBytes > B.TotalAllocBytes;
+	});
+}
@@ -0,0 +1,141 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// Lua GC 모드
+enum class ELuaGCMode : uint8
+{
+	Incremental,
+	Generational,
+};
+
+inline const char* GetLuaGCModeName(ELuaGCMode Mode)
+{
+	return Mode == ELuaGCMode::Generational ? "Generational" : "Incremental";
+}
+
+// GC 설정 (값의 의미는 lua_gc의 LUA_GCINC/LUA_GCGEN 인자와 동일, 0이면 Lua 기본값)
+struct FLuaGCSettings
+{
+	ELuaGCMode Mode = ELuaGCMode::Incremental;
+	int32 Pause = 0;         // Incremental: 다음 사이클 시작 시점 (힙 크기 %)
+	int32 StepMul = 0;       // Incremental: 스텝당 작업량 배수
+	int32 StepSize = 0;      // Incremental: 스텝 크기 (log2 바이트)
+	int32 MinorMul = 0;      // Generational: minor 수집 빈도 (%)
+	int32 MajorMul = 0;      // Generational: major 수집 빈도 (%)
+
+	// 프레임 GC 예산. 0보다 크면 자동 GC를 멈추고 매 프레임 예산 안에서만 스텝 실행
+	float FrameBudgetMS = 0.0f;
+	int32 BudgetStepKB = 64; // 예산 모드에서 스텝 한 번에 처리할 양 (KB)
+};
+
+// 스크립트(할당 스코프) 하나의 할당 통계
+struct FLuaScopeAllocStat
+{
+	FString Name;                // 스크립트 경로
+	uint64 FrameAllocBytes = 0;  // 이번 프레임 할당량
+	uint32 FrameAllocCount = 0;
+	uint64 TotalAllocBytes = 0;  // 누적 할당량
+	uint64 TotalAllocCount = 0;
+};
+
+// 프레임 단위 Lua 메모리/GC 통계
+struct FLuaMemoryFrameStats
+{
+	static constexpr uint32 MaxTopScopes = 5;
+
+	uint64 HeapBytes = 0;        // 현재 Lua 힙 (할당기 기준)
+	uint64 PeakHeapBytes = 0;
+	uint64 FrameAllocBytes = 0;
+	uint32 FrameAllocCount = 0;
+	uint32 FrameFreeCount = 0;
+
+	ELuaGCMode GCMode = ELuaGCMode::Incremental;
+	float FrameBudgetMS = 0.0f;
+	double GCStepMS = 0.0;       // 이번 프레임에 엔진이 직접 실행한 GC 시간 (예산 스텝/전체 수집)
+	double PeakGCStepMS = 0.0;
+	uint32 GCCycles = 0;         // 완료된 GC 사이클 수 (누적)
+
+	// 이번 프레임 할당량이 큰 순서
+	TArray<FLuaScopeAllocStat> TopScopes;
+};
+
+/**
+ * Lua 할당기 + 메모리 통계 (싱글톤)
+ * - 전역 Lua state를 만들 때 Allocate를 lua_Alloc으로 설치하면 힙 크기/할당 횟수를 정확히 집계
+ * - 스크립트별 집계는 FLuaAllocScope로 현재 실행 중인 스크립트를 표시해서 그동안의 할당을 귀속 (해제는 전체만 집계)
+ * Lua state는 게임 스레드에서만 쓰므로 동기화하지 않음
+ */
+class FLuaMemoryTracker
+{
+public:
+	static FLuaMemoryTracker& GetInstance()
+	{
+		static FLuaMemoryTracker Instance;
+		return Instance;
+	}
+
+	// lua_Alloc 시그니처
+	static void* Allocate(void* UserData, void* Ptr, size_t OldSize, size_t NewSize);
+
+	// 스크립트 경로로 스코프 ID 발급 (같은 경로는 같은 ID)
+	int32 RegisterScope(const FString& Name);
+
+	int32 GetCurrentScope() const { return CurrentScope; }
+	void SetCurrentScope(int32 ScopeId) { CurrentScope = ScopeId; }
+
+	// 엔진이 실행한 GC 시간 기록 (UScriptManager::TickGarbageCollection)
+	void AddGCStepTime(double MS);
+	void AddGCCycle() { ++GCCycles; }
+
+	// 프레임 통계 확정 후 다음 프레임 집계 시작
+	void EndFrame(const FLuaGCSettings& Settings);
+
+	const FLuaMemoryFrameStats& GetStats() const { return CurrentStats; }
+	void GatherScopeStats(TArray<FLuaScopeAllocStat>& OutStats) const;
+
+	uint64 GetHeapBytes() const { return HeapBytes; }
+
+private:
+	FLuaMemoryTracker() = default;
+	~FLuaMemoryTracker() = default;
+	FLuaMemoryTracker(const FLuaMemoryTracker&) = delete;
+	FLuaMemoryTracker& operator=(const FLuaMemoryTracker&) = delete;
+
+	uint64 HeapBytes = 0;
+	uint64 PeakHeapBytes = 0;
+	uint64 FrameAllocBytes = 0;
+	uint32 FrameAllocCount = 0;
+	uint32 FrameFreeCount = 0;
+
+	double FrameGCStepMS = 0.0;
+	double PeakGCStepMS = 0.0;
+	uint32 GCCycles = 0;
+
+	int32 CurrentScope = -1;
+	TArray<FLuaScopeAllocStat> Scopes;
+	TMap<FString, int32> ScopeByName;
+
+	FLuaMemoryFrameStats CurrentStats;
+};
+
+// 스코프 동안의 Lua 할당을 해당 스크립트에 귀속 (중첩 시 이전 스코프 복원)
+class FLuaAllocScope
+{
+public:
+	explicit FLuaAllocScope(int32 ScopeId)
+		: PreviousScope(FLuaMemoryTracker::GetInstance().GetCurrentScope())
+	{
+		FLuaMemoryTracker::GetInstance().SetCurrentScope(ScopeId);
+	}
+
+	~FLuaAllocScope()
+	{
+		FLuaMemoryTracker::GetInstance().SetCurrentScope(PreviousScope);
+	}
+
+	FLuaAllocScope(const FLuaAllocScope&) = delete;
+	FLuaAllocScope& operator=(const FLuaAllocScope&) = delete;
+
+private:
+	int32 PreviousScope;
+};
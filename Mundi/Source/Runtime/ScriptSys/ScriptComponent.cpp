@@ -4,6 +4,7 @@
 #include "Actor.h"
 #include "Source/Runtime/Core/Game/CoroutineHelper.h"
 #include "Source/Runtime/Engine/Components/PrimitiveComponent.h"
+#include "ScriptTickManager.h"
 
 IMPLEMENT_CLASS(UScriptComponent)
 
@@ -26,6 +27,11 @@ UScriptComponent::UScriptComponent()
 
 UScriptComponent::~UScriptComponent()
 {
+	if (RegisteredTickManager)
+	{
+		RegisteredTickManager->Unregister(this);
+	}
+	UnwatchScriptFile();
 	StopAllCoroutines();
 
     if (CoroutineHelper)
@@ -43,6 +49,12 @@ void UScriptComponent::BeginPlay()
 	UActorComponent::BeginPlay();
 	EnsureCoroutineHelper();
 
+	// Lua Tick은 월드의 스크립트 틱 매니저가 그룹 단위로 호출
+	if (UWorld* World = GetWorld())
+	{
+		World->GetScriptTickManager()->Register(this);
+	}
+
     UE_LOG(("[ScriptComponent] BeginPlay called for: " + GetOwner()->GetName().ToString() + "\n").c_str());
     UE_LOG(("  ScriptPath: '" + ScriptPath + "'\n").c_str());
     UE_LOG(("  bScriptLoaded: " + std::string(bScriptLoaded ? "true" : "false") + "\n").c_str());
@@ -70,7 +82,7 @@ void UScriptComponent::BeginPlay()
 	if (bScriptLoaded)
 	{
         UE_LOG("  Calling Lua BeginPlay()...\n");
-		CallLuaFunction("BeginPlay");
+		CallLuaHook(LuaHooks.BeginPlay, "BeginPlay");
         UE_LOG("  Lua BeginPlay() finished\n");
 	}
     else
@@ -97,10 +109,8 @@ void UScriptComponent::BeginPlay()
 	}
 }
 
-void UScriptComponent::TickComponent(float DeltaTime)
+bool UScriptComponent::TickScript(float DeltaTime)
 {
-	UActorComponent::TickComponent(DeltaTime);
-
     static int tickCount = 0;
     if (tickCount < 5) // 처음 5번만 로그
     {
@@ -108,19 +118,80 @@ void UScriptComponent::TickComponent(float DeltaTime)
         tickCount++;
     }
 
-    // 1. 핫 리로드 체크
-    CheckHotReload(DeltaTime);
+    // 1. 핫 리로드 (파일 감시 알림을 받은 경우에만)
+    if (bScriptFileChanged)
+    {
+        bScriptFileChanged = false;
+        UE_LOG("Hot-reloading script...\n");
+        ReloadScript();
+    }
 
     // Case A. 스크립트가 존재하지 않으면 Tick 생략
-    if (!bScriptLoaded) { return; }
+    if (!bScriptLoaded) { return false; }
+
+    // 2. Lua Tick 호출 (TickInterval이 있으면 누적 시간이 찰 때만, 누적 DeltaTime 전달)
+    bool bLuaTicked = false;
+    ScriptTickAccumulator += DeltaTime;
+    if (ScriptTickAccumulator >= ScriptTickInterval)
+    {
+        const float TickDeltaTime = ScriptTickAccumulator;
+        ScriptTickAccumulator = 0.0f;
+        CallLuaHook(LuaHooks.Tick, "Tick", TickDeltaTime);
+        bLuaTicked = LuaHooks.Tick.valid();
+    }
 
-    // 2. Lua Tick 호출
-    CallLuaFunction("Tick", DeltaTime);
+    // 코루틴은 월드의 FCoroutineScheduler가 일괄 실행
 
-    // 3. 코루틴 실행
-    if (CoroutineHelper)
+    return bLuaTicked;
+}
+
+void UScriptComponent::SetTickInterval(float InSeconds)
+{
+    ScriptTickInterval = std::max(0.0f, InSeconds);
+    ScriptTickAccumulator = 0.0f;
+}
+
+void UScriptComponent::SetTickGroup(EScriptTickGroup InGroup)
+{
+    if (RegisteredTickManager)
+    {
+        RegisteredTickManager->ChangeTickGroup(this, InGroup);
+    }
+    else
+    {
+        ScriptTickGroup = InGroup;
+    }
+}
+
+bool UScriptComponent::SetTickGroupByName(const FString& InGroupName)
+{
+    for (uint32 i = 0; i < static_cast<uint32>(EScriptTickGroup::Count); ++i)
     {
-        CoroutineHelper->RunScheduler(DeltaTime);
+        const EScriptTickGroup Group = static_cast<EScriptTickGroup>(i);
+        if (_stricmp(InGroupName.c_str(), GetScriptTickGroupName(Group)) == 0)
+        {
+            SetTickGroup(Group);
+            return true;
+        }
+    }
+
+    UE_LOG("[ScriptComponent] Unknown tick group '%s' (%s)\n", InGroupName.c_str(), ScriptPath.c_str());
+    return false;
+}
+
+void UScriptComponent::ApplyDeclaredTickSettings()
+{
+    // 전역 fallback 없이 스크립트 환경에 직접 선언된 값만 사용
+    sol::object DeclaredGroup = ScriptEnv.raw_get<sol::object>("TickGroup");
+    if (DeclaredGroup.is<std::string>())
+    {
+        SetTickGroupByName(DeclaredGroup.as<std::string>());
+    }
+
+    sol::object DeclaredInterval = ScriptEnv.raw_get<sol::object>("TickInterval");
+    if (DeclaredInterval.is<double>())
+    {
+        SetTickInterval(static_cast<float>(DeclaredInterval.as<double>()));
     }
 }
 
@@ -129,10 +200,15 @@ void UScriptComponent::EndPlay(EEndPlayReason Reason)
     // Lua EndPlay() 호출
     if (bScriptLoaded)
     {
-        CallLuaFunction("EndPlay");
+        CallLuaHook(LuaHooks.EndPlay, "EndPlay");
     }
     
     StopAllCoroutines();
+    UnwatchScriptFile();
+    if (RegisteredTickManager)
+    {
+        RegisteredTickManager->Unregister(this);
+    }
 
     UActorComponent::EndPlay(Reason);
 }
@@ -190,6 +266,9 @@ bool UScriptComponent::ReloadScript()
 
     UE_LOG(("[ScriptComponent] Script file found at: " + AbsolutePath.string() + "\n").c_str());
 
+    // 컴파일 실패해도 파일을 고치면 다시 로드되도록 먼저 감시 등록
+    WatchScriptFile(AbsolutePath);
+
     // Owner Actor를 Lua에 바인딩
     AActor* OwnerActor = GetOwner();
     if (!OwnerActor)
@@ -209,6 +288,10 @@ bool UScriptComponent::ReloadScript()
         return false;
     }
 
+    // 이 스크립트에서 일어나는 Lua 할당을 경로별로 집계
+    LuaAllocScopeId = FLuaMemoryTracker::GetInstance().RegisterScope(ScriptPath);
+    FLuaAllocScope AllocScope(LuaAllocScopeId);
+
     // 스크립트별 독립 환경 생성 (전역 환경을 fallback으로 사용)
     ScriptEnv = sol::environment(*GlobalLua, sol::create, GlobalLua->globals());
 
@@ -216,34 +299,24 @@ bool UScriptComponent::ReloadScript()
     ScriptEnv["actor"] = OwnerActor;
     ScriptEnv["self"] = this;
 
+    // 이전 스크립트의 훅은 새 로드 결과와 무관하므로 먼저 비움
+    LuaHooks.Reset();
+
     // 스크립트 로드
     try
     {
-        // 파일을 직접 읽어서 실행 (한글 경로 문제 해결)
-        std::ifstream file(AbsolutePath, std::ios::binary);
-        if (!file.is_open())
+        // 같은 스크립트를 쓰는 인스턴스는 컴파일된 청크를 공유 (파일이 바뀌었을 때만 다시 컴파일)
+        long long ScriptWriteTime_ms = 0;
+        FString LoadError;
+        sol::protected_function scriptFunc = SCRIPT.LoadScriptChunk(ScriptPath, ScriptWriteTime_ms, LoadError);
+        if (!scriptFunc.valid())
         {
-            UE_LOG("Failed to open script file\n");
-            bScriptLoaded = false;
-            return false;
-        }
-
-        // 파일 내용 읽기
-        std::string scriptContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-        file.close();
-
-        // 스크립트를 로드 (아직 실행 안 함)
-        auto loadResult = GlobalLua->load(scriptContent, ScriptPath);
-        if (!loadResult.valid())
-        {
-            sol::error err = loadResult;
-            UE_LOG(("Lua script load error: " + std::string(err.what()) + "\n").c_str());
+            UE_LOG(("Lua script load error: " + LoadError + "\n").c_str());
             bScriptLoaded = false;
             return false;
         }
 
         // 로드된 chunk 함수에 환경 설정
-        sol::protected_function scriptFunc = loadResult;
         sol::set_environment(ScriptEnv, scriptFunc);
 
         // 스크립트 실행
@@ -258,11 +331,12 @@ bool UScriptComponent::ReloadScript()
 
         // 스크립트 환경을 ScriptTable에 저장
         ScriptTable = ScriptEnv;
+        CacheLuaHooks();
+        ApplyDeclaredTickSettings();
         bScriptLoaded = true;
 
         // Store timestamp for hot-reload
-        auto Ftime = fs::last_write_time(AbsolutePath);
-        LastScriptWriteTime_ms = std::chrono::duration_cast<std::chrono::milliseconds>(Ftime.time_since_epoch()).count();
+        LastScriptWriteTime_ms = ScriptWriteTime_ms;
 
         UE_LOG("Script loaded successfully\n");
         return true;
@@ -275,6 +349,29 @@ bool UScriptComponent::ReloadScript()
     }
 }
 
+void UScriptComponent::CacheLuaHooks()
+{
+    auto Resolve = [this](const char* InName, sol::protected_function& OutHook)
+    {
+        sol::object Value = ScriptTable[InName];
+        if (Value.get_type() != sol::type::function)
+        {
+            OutHook = sol::protected_function();
+            return;
+        }
+
+        OutHook = Value.as<sol::protected_function>();
+        // 매 호출마다 하던 환경 설정을 로드 시 한 번만 수행
+        sol::set_environment(ScriptEnv, OutHook);
+    };
+
+    Resolve("BeginPlay", LuaHooks.BeginPlay);
+    Resolve("Tick", LuaHooks.Tick);
+    Resolve("EndPlay", LuaHooks.EndPlay);
+    Resolve("OnOverlap", LuaHooks.OnOverlap);
+    Resolve("OnEndOverlap", LuaHooks.OnEndOverlap);
+}
+
 // ==================== Coroutine ====================
 int UScriptComponent::StartCoroutine(sol::function EntryPoint)
 {
@@ -300,6 +397,18 @@ FYieldInstruction* UScriptComponent::WaitForSeconds(float Seconds)
 	return CoroutineHelper ? CoroutineHelper->CreateWaitForSeconds(Seconds) : nullptr;
 }
 
+FYieldInstruction* UScriptComponent::WaitForFrames(int32 Frames)
+{
+	EnsureCoroutineHelper();
+	return CoroutineHelper ? CoroutineHelper->CreateWaitForFrames(Frames) : nullptr;
+}
+
+FYieldInstruction* UScriptComponent::WaitForEvent(const FString& EventName)
+{
+	EnsureCoroutineHelper();
+	return CoroutineHelper ? CoroutineHelper->CreateWaitForEvent(EventName) : nullptr;
+}
+
 void UScriptComponent::StopAllCoroutines()
 {
 	if (CoroutineHelper)
@@ -316,37 +425,36 @@ void UScriptComponent::EnsureCoroutineHelper()
 	}
 }
 
-void UScriptComponent::CheckHotReload(float DeltaTime)
+void UScriptComponent::WatchScriptFile(const std::filesystem::path& InAbsolutePath)
 {
-    HotReloadCheckTimer += DeltaTime;
-
-    if (HotReloadCheckTimer <= 1.0f) { return; }
-
-    HotReloadCheckTimer = 0.0f;
-    if (ScriptPath.empty()) { return; }
-
-    namespace fs = std::filesystem;
-
-    fs::path absolutePath = UScriptManager::ResolveScriptPath(ScriptPath);
-    if (fs::exists(absolutePath))
+    const FWideString NewPath = InAbsolutePath.lexically_normal().wstring();
+    if (ScriptWatchHandle != FFileWatcher::InvalidHandle && WatchedScriptPath == NewPath)
     {
-        try
-        {
-            auto ftime = fs::last_write_time(absolutePath);
-            long long currentTime_ms =
-                std::chrono::duration_cast<std::chrono::milliseconds>(ftime.time_since_epoch()).count();
+        return;
+    }
 
-            if (currentTime_ms > LastScriptWriteTime_ms)
-            {
-                UE_LOG("Hot-reloading script...\n");
-                ReloadScript();
-            }
-        }
-        catch (const fs::filesystem_error& e)
+    UnwatchScriptFile();
+    WatchedScriptPath = NewPath;
+    ScriptWatchHandle = FFileWatcher::GetInstance().WatchFile(InAbsolutePath, [this](const std::filesystem::path&)
+    {
+        // 틱 매니저에 등록된(BeginPlay 이후) 컴포넌트는 자기 틱 그룹 순서에서 리로드
+        if (RegisteredTickManager)
         {
-            UE_LOG(e.what());
+            bScriptFileChanged = true;
+            return;
         }
-    }
+
+        // 에디터 월드처럼 틱을 받지 않는 컴포넌트는 알림이 디스패치되는 메인 스레드에서 바로 리로드
+        UE_LOG("Hot-reloading script (not ticking)...\n");
+        ReloadScript();
+    });
+}
+
+void UScriptComponent::UnwatchScriptFile()
+{
+    FFileWatcher::GetInstance().Unwatch(ScriptWatchHandle);
+    WatchedScriptPath.clear();
+    bScriptFileChanged = false;
 }
 
 // ==================== Lua Events ====================
@@ -370,6 +478,12 @@ void UScriptComponent::NotifyOverlap(AActor* OtherActor, const FContactInfo& Con
         return;
     }
 
+    // 훅이 없으면 충돌 정보 테이블도 만들지 않음
+    if (!LuaHooks.OnOverlap.valid())
+    {
+        return;
+    }
+
     UE_LOG("[Overlap] Calling Lua OnOverlap function...\n");
 
     // FContactInfo를 Lua 테이블로 변환
@@ -381,12 +495,12 @@ void UScriptComponent::NotifyOverlap(AActor* OtherActor, const FContactInfo& Con
         contactInfoTable["ContactNormal"] = ContactInfo.ContactNormal;
         contactInfoTable["PenetrationDepth"] = ContactInfo.PenetrationDepth;
 
-        CallLuaFunction("OnOverlap", OtherActor, contactInfoTable);
+        CallLuaHook(LuaHooks.OnOverlap, "OnOverlap", OtherActor, contactInfoTable);
     }
     else
     {
         // Fallback: 충돌 정보 없이 호출
-        CallLuaFunction("OnOverlap", OtherActor);
+        CallLuaHook(LuaHooks.OnOverlap, "OnOverlap", OtherActor);
     }
 }
 
@@ -408,7 +522,7 @@ void UScriptComponent::OnBeginOverlap(UPrimitiveComponent* /*OverlappedComp*/, A
 void UScriptComponent::OnEndOverlap(UPrimitiveComponent* /*OverlappedComp*/, AActor* OtherActor, UPrimitiveComponent* /*OtherComp*/, const FContactInfo& ContactInfo)
 {
 	// Optional: call Lua if function exists
-	if (!bScriptLoaded || !OtherActor)
+	if (!bScriptLoaded || !OtherActor || !LuaHooks.OnEndOverlap.valid())
 	{
 		return;
 	}
@@ -422,11 +536,11 @@ void UScriptComponent::OnEndOverlap(UPrimitiveComponent* /*OverlappedComp*/, AAc
 		contactInfoTable["ContactNormal"] = ContactInfo.ContactNormal;
 		contactInfoTable["PenetrationDepth"] = ContactInfo.PenetrationDepth;
 
-		CallLuaFunction("OnEndOverlap", OtherActor, contactInfoTable);
+		CallLuaHook(LuaHooks.OnEndOverlap, "OnEndOverlap", OtherActor, contactInfoTable);
 	}
 	else
 	{
-		CallLuaFunction("OnEndOverlap", OtherActor);
+		CallLuaHook(LuaHooks.OnEndOverlap, "OnEndOverlap", OtherActor);
 	}
 }
 
@@ -543,16 +657,8 @@ bool UScriptComponent::GetHUDGameOver(FString& OutTitle, TArray<FString>& OutLin
 // ==================== Serialization ====================
 void UScriptComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
+	// ScriptPath는 리플렉션 직렬화(FScriptPath)에서 처리
 	UActorComponent::Serialize(bInIsLoading, InOutHandle);
-
-	if (bInIsLoading)
-	{
-		FJsonSerializer::ReadString(InOutHandle, "ScriptPath", ScriptPath);
-	}
-	else
-	{
-		InOutHandle["ScriptPath"] = ScriptPath.c_str();
-	}
 }
 
 void UScriptComponent::OnSerialized()
@@ -573,6 +679,16 @@ void UScriptComponent::DuplicateSubObjects()
     // 복제본은 런타임 로드 상태를 초기화하고 필요 시 BeginPlay/OnSerialized에서 로드
     bScriptLoaded = false;
 	CoroutineHelper = nullptr;
+	// 훅은 원본 환경의 함수를 가리키므로 복제본에서는 비움 (ReloadScript에서 다시 캐시)
+	LuaHooks.Reset();
+	// 틱 매니저 등록은 원본 소유이므로 복제본은 BeginPlay에서 새로 등록
+	RegisteredTickManager = nullptr;
+	ScriptTickIndex = -1;
+	ScriptTickAccumulator = 0.0f;
+	// 감시 구독은 원본 소유이므로 복제본은 ReloadScript에서 새로 등록
+	ScriptWatchHandle = FFileWatcher::InvalidHandle;
+	WatchedScriptPath.clear();
+	bScriptFileChanged = false;
 	// 전역 Lua state 사용하므로 초기화 불필요
 	// ScriptEnv와 ScriptTable은 ReloadScript에서 생성됨
 }
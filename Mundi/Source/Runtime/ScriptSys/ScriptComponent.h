@@ -2,8 +2,12 @@
 #include "ActorComponent.h"
 #include "sol.hpp"
 #include "Source/Runtime/Core/Game/YieldInstruction.h"
+#include "FileWatcher.h"
+#include "ScriptTickStats.h"
+#include "LuaMemoryTracker.h"
 
 class FCoroutineHelper;
+class FScriptTickManager;
 
 /**
  * @class UScriptComponent
@@ -13,6 +17,10 @@ class FCoroutineHelper;
  *   1. Actor에 AddComponent<UScriptComponent>()
  *   2. SetScriptPath()로 스크립트 파일 경로 설정
  *   3. Actor의 Tick/BeginPlay 등에서 Lua 함수 호출
+ *
+ * Lua Tick은 AActor::Tick이 아니라 월드의 FScriptTickManager가 틱 그룹별로 호출.
+ * 스크립트에서 전역으로 TickGroup("PrePhysics"/"PostPhysics"/"PostCamera"),
+ * TickInterval(초)을 선언하거나 self:SetTickGroup/SetTickInterval로 바꿀 수 있음
  */
 class UScriptComponent : public UActorComponent
 {
@@ -25,9 +33,22 @@ public:
 
 	// ==================== Lifecycle ====================
 	void BeginPlay() override;
-	void TickComponent(float DeltaTime) override;
 	void EndPlay(EEndPlayReason Reason) override;
 
+	/**
+	 * @brief FScriptTickManager가 매 프레임 호출 (핫 리로드, 간격이 찬 경우 Lua Tick, 코루틴)
+	 * @return 이번 프레임에 Lua Tick을 호출했는지 여부
+	 */
+	bool TickScript(float DeltaTime);
+
+	// ==================== 틱 설정 ====================
+	void SetTickInterval(float InSeconds);
+	float GetTickInterval() const { return ScriptTickInterval; }
+	void SetTickGroup(EScriptTickGroup InGroup);
+	EScriptTickGroup GetTickGroup() const { return ScriptTickGroup; }
+	// Lua용: "PrePhysics" / "PostPhysics" / "PostCamera"
+	bool SetTickGroupByName(const FString& InGroupName);
+
 	// ==================== 스크립트 관리 ====================
 	
 	/**
@@ -56,6 +77,8 @@ public:
 	int StartCoroutine(sol::function EntryPoint);
 	void StopCoroutine(int CoroutineID);
 	FYieldInstruction* WaitForSeconds(float Seconds);
+	FYieldInstruction* WaitForFrames(int32 Frames);
+	FYieldInstruction* WaitForEvent(const FString& EventName);  // 이벤트 데이터는 yield의 반환값
 	void StopAllCoroutines();
 
 	// ==================== Lua 이벤트 ====================
@@ -96,6 +119,12 @@ public:
 	 */
 	sol::environment GetScriptEnv() const { return ScriptEnv; }
 
+	/**
+	 * @brief Lua 할당 통계용 스코프 ID (스크립트 경로 단위, 로드 전이면 -1)
+	 */
+	int32 GetLuaAllocScopeId() const { return LuaAllocScopeId; }
+
+    // 이름으로 함수를 찾아 호출 (동적 호출용). 라이프사이클 훅은 CallLuaHook 사용
     template<typename ...Args>
     void CallLuaFunction(const FString& InFunctionName, Args&&... InArgs);
 
@@ -116,9 +145,34 @@ public:
     bool GetHUDGameOver(FString& OutTitle, TArray<FString>& OutLines);
 
 private:
+	/**
+	 * 라이프사이클 훅 캐시. 로드/리로드 시 한 번만 ScriptTable에서 찾고 환경도 그때 설정.
+	 * 스크립트에 없는 훅은 invalid로 남아 호출 자체를 건너뜀
+	 */
+	struct FLuaHooks
+	{
+		sol::protected_function BeginPlay;
+		sol::protected_function Tick;
+		sol::protected_function EndPlay;
+		sol::protected_function OnOverlap;
+		sol::protected_function OnEndOverlap;
+
+		void Reset() { *this = FLuaHooks(); }
+	};
+
+	void CacheLuaHooks();
+
+	// 스크립트 전역에 선언된 TickGroup/TickInterval 적용
+	void ApplyDeclaredTickSettings();
+
+	template<typename ...Args>
+	void CallLuaHook(const sol::protected_function& InHook, const char* InHookName, Args&&... InArgs);
+
 	void EnsureCoroutineHelper();
 
-	void CheckHotReload(float DeltaTime);
+	// 스크립트 파일을 FFileWatcher에 (재)등록. 변경 알림은 다음 Tick에서, 틱을 받지 않으면 알림 즉시 리로드
+	void WatchScriptFile(const std::filesystem::path& InAbsolutePath);
+	void UnwatchScriptFile();
 
     FString ScriptPath;                 ///< 스크립트 파일 경로
     bool bScriptLoaded = false;   ///< 스크립트 로드 성공 여부
@@ -126,14 +180,46 @@ private:
     // 전역 Lua state 대신 스크립트별 독립 환경 사용
     sol::environment ScriptEnv;         ///< 스크립트별 독립 환경 (전역 변수 격리)
     sol::table ScriptTable;             ///< 스크립트 함수/변수를 담은 테이블
+    FLuaHooks LuaHooks;                 ///< 캐시된 라이프사이클 훅
+    int32 LuaAllocScopeId = -1;         ///< FLuaMemoryTracker 스코프 (할당을 이 스크립트에 귀속)
 
-    // Hot-reload on tick
-    float HotReloadCheckTimer = 0.0f;        ///< 핫 리로드 체크 타이머
+    // Hot-reload (FFileWatcher 알림 기반)
+    FFileWatchHandle ScriptWatchHandle = FFileWatcher::InvalidHandle; ///< 스크립트 파일 감시 구독
+    FWideString WatchedScriptPath;           ///< 현재 감시 중인 절대 경로
+    bool bScriptFileChanged = false;         ///< 파일 변경 알림 수신 여부 (Tick에서 리로드)
     long long LastScriptWriteTime_ms = 0;    ///< 마지막으로 로드한 스크립트 파일의 수정 시간 (ms)
 
 	FCoroutineHelper* CoroutineHelper{ nullptr };
+
+	// 스크립트 틱 (FScriptTickManager가 관리)
+	friend class FScriptTickManager;
+	FScriptTickManager* RegisteredTickManager = nullptr;
+	int32 ScriptTickIndex = -1;                 ///< 그룹 배열 내 위치 (대기 중이면 -1)
+	EScriptTickGroup ScriptTickGroup = EScriptTickGroup::PostPhysics;
+	float ScriptTickInterval = 0.0f;            ///< 0이면 매 프레임
+	float ScriptTickAccumulator = 0.0f;         ///< 간격 동안 누적된 DeltaTime (Lua Tick에 그대로 전달)
 };
 
+template <typename ... Args>
+void UScriptComponent::CallLuaHook(const sol::protected_function& InHook, const char* InHookName, Args&&... InArgs)
+{
+	// 빠른 경로: 훅이 없으면 아무것도 하지 않음 (문자열 조회/환경 설정 없음)
+	if (!InHook.valid())
+	{
+		return;
+	}
+
+	FLuaAllocScope AllocScope(LuaAllocScopeId);
+
+	// protected_function이 Lua 에러를 결과로 돌려주므로 try/catch 불필요
+	auto result = InHook(std::forward<Args>(InArgs)...);
+	if (!result.valid())
+	{
+		sol::error err = result;
+		UE_LOG("[Lua Error] %s: %s\n", InHookName, err.what());
+	}
+}
+
 template <typename ... Args>
 void UScriptComponent::CallLuaFunction(const FString& InFunctionName, Args&&... InArgs)
 {
@@ -142,6 +228,8 @@ void UScriptComponent::CallLuaFunction(const FString& InFunctionName, Args&&...
 		return;
 	}
 
+	FLuaAllocScope AllocScope(LuaAllocScopeId);
+
 	try
 	{
 		sol::protected_function func = ScriptTable[InFunctionName];
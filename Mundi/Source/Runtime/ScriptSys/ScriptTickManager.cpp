@@ -0,0 +1,283 @@
+﻿#include "pch.h"
+#include "ScriptTickManager.h"
+#include "ScriptComponent.h"
+#include "Actor.h"
+
+namespace
+{
+	// 평균 CPU 시간 지수 이동 평균 가중치 (약 30프레임)
+	constexpr double AverageWeight = 1.0 / 30.0;
+}
+
+FScriptTickManager::~FScriptTickManager()
+{
+	// 월드가 먼저 사라지는 경우 컴포넌트가 해제된 매니저에 접근하지 않도록 역참조를 끊음
+	for (TArray<FScriptTickEntry>& GroupEntries : Entries)
+	{
+		for (FScriptTickEntry& Entry : GroupEntries)
+		{
+			if (Entry.Component)
+			{
+				Entry.Component->RegisteredTickManager = nullptr;
+				Entry.Component->ScriptTickIndex = -1;
+			}
+		}
+	}
+	for (UScriptComponent* Component : PendingRegistrations)
+	{
+		Component->RegisteredTickManager = nullptr;
+	}
+}
+
+void FScriptTickManager::Register(UScriptComponent* Component)
+{
+	if (!Component || Component->RegisteredTickManager == this)
+	{
+		return;
+	}
+
+	Component->RegisteredTickManager = this;
+	Component->ScriptTickIndex = -1;
+
+	if (bTicking)
+	{
+		PendingRegistrations.push_back(Component);
+		return;
+	}
+
+	AddEntry(Component);
+}
+
+void FScriptTickManager::Unregister(UScriptComponent* Component)
+{
+	if (!Component || Component->RegisteredTickManager != this)
+	{
+		return;
+	}
+
+	const int32 Index = Component->ScriptTickIndex;
+	if (Index < 0)
+	{
+		// 아직 대기 중인 등록
+		auto It = std::find(PendingRegistrations.begin(), PendingRegistrations.end(), Component);
+		if (It != PendingRegistrations.end())
+		{
+			PendingRegistrations.erase(It);
+		}
+	}
+	else if (bTicking)
+	{
+		// 순회 중인 배열은 건드리지 않고 슬롯만 비움
+		Entries[static_cast<uint32>(Component->ScriptTickGroup)][Index].Component = nullptr;
+		bHasEmptySlots = true;
+	}
+	else
+	{
+		RemoveEntryAt(Component->ScriptTickGroup, Index);
+	}
+
+	Component->RegisteredTickManager = nullptr;
+	Component->ScriptTickIndex = -1;
+}
+
+void FScriptTickManager::ChangeTickGroup(UScriptComponent* Component, EScriptTickGroup NewGroup)
+{
+	if (!Component || Component->ScriptTickGroup == NewGroup)
+	{
+		return;
+	}
+
+	if (Component->RegisteredTickManager != this)
+	{
+		Component->ScriptTickGroup = NewGroup;
+		return;
+	}
+
+	Unregister(Component);
+	Component->ScriptTickGroup = NewGroup;
+	Register(Component);
+}
+
+void FScriptTickManager::TickGroup(EScriptTickGroup Group, float DeltaTime)
+{
+	const uint32 GroupIndex = static_cast<uint32>(Group);
+	TArray<FScriptTickEntry>& GroupEntries = Entries[GroupIndex];
+
+	// 첫 그룹에서 프레임 통계 초기화
+	if (Group == EScriptTickGroup::PrePhysics)
+	{
+		FrameStats.Reset();
+	}
+
+	const auto GroupStart = std::chrono::high_resolution_clock::now();
+
+	bTicking = true;
+	// 틱 도중 추가된 항목은 PendingRegistrations로 가므로 배열 크기는 고정
+	const size_t Count = GroupEntries.size();
+	for (size_t i = 0; i < Count; ++i)
+	{
+		FScriptTickEntry& Entry = GroupEntries[i];
+		UScriptComponent* Component = Entry.Component;
+		if (!Component || !Component->IsComponentTickEnabled())
+		{
+			continue;
+		}
+
+		const auto Start = std::chrono::high_resolution_clock::now();
+		const bool bLuaTicked = Component->TickScript(DeltaTime);
+		const double ElapsedMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+
+		// TickScript 안에서 자기 자신이 해제됐을 수 있으므로 슬롯을 다시 확인
+		FScriptTickEntry& Current = GroupEntries[i];
+		if (Current.Component)
+		{
+			Current.LastMS = ElapsedMS;
+			Current.AverageMS += (ElapsedMS - Current.AverageMS) * AverageWeight;
+			Current.PeakMS = std::max(Current.PeakMS, ElapsedMS);
+		}
+
+		if (bLuaTicked)
+		{
+			++FrameStats.TickedScripts;
+		}
+	}
+	bTicking = false;
+
+	FrameStats.GroupMS[GroupIndex] = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - GroupStart).count();
+
+	FlushDeferred();
+}
+
+void FScriptTickManager::PublishFrameStats()
+{
+	FrameStats.ScriptCount = Num();
+	FrameStats.TotalMS = 0.0;
+	for (double GroupMS : FrameStats.GroupMS)
+	{
+		FrameStats.TotalMS += GroupMS;
+	}
+
+	// 상위 목록은 보는 곳이 있을 때만 수집 (합계/그룹 시간은 항상 게시)
+	FScriptTickStatManager& StatManager = FScriptTickStatManager::GetInstance();
+	if (StatManager.IsTopScriptsRequested())
+	{
+		GatherStats(FrameStats.TopScripts, FScriptTickFrameStats::MaxTopScripts);
+	}
+	else
+	{
+		FrameStats.TopScripts.clear();
+	}
+
+	StatManager.UpdateStats(FrameStats);
+}
+
+void FScriptTickManager::GatherStats(TArray<FScriptTickStat>& OutStats, uint32 MaxCount) const
+{
+	OutStats.clear();
+
+	// 문자열을 담는 FScriptTickStat은 상위 항목에 대해서만 만들도록 엔트리 포인터로 먼저 고름
+	TArray<const FScriptTickEntry*> Candidates;
+	Candidates.reserve(Num());
+	for (const TArray<FScriptTickEntry>& GroupEntries : Entries)
+	{
+		for (const FScriptTickEntry& Entry : GroupEntries)
+		{
+			if (Entry.Component)
+			{
+				Candidates.push_back(&Entry);
+			}
+		}
+	}
+
+	const size_t Count = MaxCount == 0 ? Candidates.size() : std::min<size_t>(MaxCount, Candidates.size());
+	std::partial_sort(Candidates.begin(), Candidates.begin() + Count, Candidates.end(), [](const FScriptTickEntry* A, const FScriptTickEntry* B)
+	{
+		return A->AverageMS > B->AverageMS;
+	});
+
+	OutStats.reserve(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		OutStats.push_back(MakeStat(*Candidates[i]));
+	}
+}
+
+uint32 FScriptTickManager::Num() const
+{
+	size_t Count = PendingRegistrations.size();
+	for (const TArray<FScriptTickEntry>& GroupEntries : Entries)
+	{
+		Count += GroupEntries.size();
+	}
+	return static_cast<uint32>(Count);
+}
+
+void FScriptTickManager::AddEntry(UScriptComponent* Component)
+{
+	TArray<FScriptTickEntry>& GroupEntries = Entries[static_cast<uint32>(Component->ScriptTickGroup)];
+	Component->ScriptTickIndex = static_cast<int32>(GroupEntries.size());
+
+	FScriptTickEntry NewEntry;
+	NewEntry.Component = Component;
+	GroupEntries.push_back(NewEntry);
+}
+
+void FScriptTickManager::RemoveEntryAt(EScriptTickGroup Group, int32 Index)
+{
+	TArray<FScriptTickEntry>& GroupEntries = Entries[static_cast<uint32>(Group)];
+	const int32 LastIndex = static_cast<int32>(GroupEntries.size()) - 1;
+	if (Index != LastIndex)
+	{
+		GroupEntries[Index] = GroupEntries[LastIndex];
+		if (GroupEntries[Index].Component)
+		{
+			GroupEntries[Index].Component->ScriptTickIndex = Index;
+		}
+	}
+	GroupEntries.pop_back();
+}
+
+void FScriptTickManager::FlushDeferred()
+{
+	if (bHasEmptySlots)
+	{
+		bHasEmptySlots = false;
+		for (uint32 GroupIndex = 0; GroupIndex < static_cast<uint32>(EScriptTickGroup::Count); ++GroupIndex)
+		{
+			TArray<FScriptTickEntry>& GroupEntries = Entries[GroupIndex];
+			for (int32 i = static_cast<int32>(GroupEntries.size()) - 1; i >= 0; --i)
+			{
+				if (!GroupEntries[i].Component)
+				{
+					RemoveEntryAt(static_cast<EScriptTickGroup>(GroupIndex), i);
+				}
+			}
+		}
+	}
+
+	if (!PendingRegistrations.empty())
+	{
+		TArray<UScriptComponent*> Pending;
+		Pending.swap(PendingRegistrations);
+		for (UScriptComponent* Component : Pending)
+		{
+			AddEntry(Component);
+		}
+	}
+}
+
+FScriptTickStat FScriptTickManager::MakeStat(const FScriptTickEntry& Entry) const
+{
+	FScriptTickStat Stat;
+	Stat.ScriptPath = Entry.Component->GetScriptPath();
+	if (AActor* Owner = Entry.Component->GetOwner())
+	{
+		Stat.OwnerName = Owner->GetName().ToString();
+	}
+	Stat.Group = Entry.Component->ScriptTickGroup;
+	Stat.TickInterval = Entry.Component->GetTickInterval();
+	Stat.LastMS = Entry.LastMS;
+	Stat.AverageMS = Entry.AverageMS;
+	Stat.PeakMS = Entry.PeakMS;
+	return Stat;
+}
@@ -0,0 +1,57 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "ScriptTickStats.h"
+
+class UScriptComponent;
+
+/**
+ * 월드별 스크립트 틱 매니저
+ * - BeginPlay된 UScriptComponent를 틱 그룹별 평탄한 배열로 보관하고 그룹마다 한 루프로 틱
+ * - 틱 간격(TickInterval)은 컴포넌트가 처리하고, 여기서는 스크립트별 CPU 시간을 기록
+ * - 틱 도중 등록/해제는 루프가 끝난 뒤 반영 (해제는 슬롯을 비우고 나중에 swap-remove)
+ */
+class FScriptTickManager
+{
+public:
+	FScriptTickManager() = default;
+	~FScriptTickManager();
+
+	void Register(UScriptComponent* Component);
+	void Unregister(UScriptComponent* Component);
+
+	// 그룹 변경 (틱 중이면 다음 프레임부터 적용)
+	void ChangeTickGroup(UScriptComponent* Component, EScriptTickGroup NewGroup);
+
+	void TickGroup(EScriptTickGroup Group, float DeltaTime);
+
+	// 모든 그룹 틱 후 호출: 프레임 통계를 FScriptTickStatManager에 게시
+	void PublishFrameStats();
+
+	// 평균 비용이 큰 순서로 스크립트 통계 수집. MaxCount가 0이면 전부 (콘솔 출력용)
+	void GatherStats(TArray<FScriptTickStat>& OutStats, uint32 MaxCount = 0) const;
+
+	uint32 Num() const;
+
+private:
+	struct FScriptTickEntry
+	{
+		UScriptComponent* Component = nullptr; // 틱 중 해제되면 nullptr
+		double LastMS = 0.0;
+		double AverageMS = 0.0;
+		double PeakMS = 0.0;
+	};
+
+	void AddEntry(UScriptComponent* Component);
+	void RemoveEntryAt(EScriptTickGroup Group, int32 Index);
+	void FlushDeferred();
+	FScriptTickStat MakeStat(const FScriptTickEntry& Entry) const;
+
+	TArray<FScriptTickEntry> Entries[static_cast<uint32>(EScriptTickGroup::Count)];
+
+	// 틱 도중 들어온 등록 요청
+	TArray<UScriptComponent*> PendingRegistrations;
+	bool bTicking = false;
+	bool bHasEmptySlots = false;
+
+	FScriptTickFrameStats FrameStats;
+};
@@ -0,0 +1,95 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 스크립트 틱 그룹. 월드 틱 안에서 아래 순서로 한 번씩 실행됨
+enum class EScriptTickGroup : uint8
+{
+	PrePhysics,  // 파티션/충돌 갱신 전
+	PostPhysics, // 액터 Tick 이후 (기본값)
+	PostCamera,  // PlayerCameraManager 갱신 이후
+	Count
+};
+
+inline const char* GetScriptTickGroupName(EScriptTickGroup Group)
+{
+	switch (Group)
+	{
+	case EScriptTickGroup::PrePhysics:  return "PrePhysics";
+	case EScriptTickGroup::PostPhysics: return "PostPhysics";
+	case EScriptTickGroup::PostCamera:  return "PostCamera";
+	default:                            return "Unknown";
+	}
+}
+
+// 스크립트 하나의 틱 비용
+struct FScriptTickStat
+{
+	FString ScriptPath;
+	FString OwnerName;
+	EScriptTickGroup Group = EScriptTickGroup::PostPhysics;
+	float TickInterval = 0.0f;
+	double LastMS = 0.0;    // 마지막 프레임 CPU 시간 (Lua Tick + 코루틴)
+	double AverageMS = 0.0; // 지수 이동 평균
+	double PeakMS = 0.0;
+};
+
+// 프레임 단위 스크립트 틱 통계
+struct FScriptTickFrameStats
+{
+	static constexpr uint32 MaxTopScripts = 5;
+
+	uint32 ScriptCount = 0;
+	uint32 TickedScripts = 0;  // 이번 프레임에 Lua Tick까지 호출된 스크립트 수 (간격 미도달 제외)
+	double GroupMS[static_cast<uint32>(EScriptTickGroup::Count)] = {};
+	double TotalMS = 0.0;
+
+	// 평균 비용이 큰 순서
+	TArray<FScriptTickStat> TopScripts;
+
+	void Reset()
+	{
+		*this = FScriptTickFrameStats();
+	}
+};
+
+// 스크립트 틱 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 PIE 월드의 최신 통계를 보관
+class FScriptTickStatManager
+{
+public:
+	static FScriptTickStatManager& GetInstance()
+	{
+		static FScriptTickStatManager Instance;
+		return Instance;
+	}
+
+	void UpdateStats(const FScriptTickFrameStats& InStats)
+	{
+		CurrentStats = InStats;
+	}
+
+	const FScriptTickFrameStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+	// 상위 스크립트 목록(문자열 생성 + 정렬)은 오버레이가 켜져 있을 때만 모음
+	void SetTopScriptsRequested(bool bRequested)
+	{
+		bTopScriptsRequested = bRequested;
+	}
+
+	bool IsTopScriptsRequested() const
+	{
+		return bTopScriptsRequested;
+	}
+
+private:
+	FScriptTickStatManager() = default;
+	~FScriptTickStatManager() = default;
+	FScriptTickStatManager(const FScriptTickStatManager&) = delete;
+	FScriptTickStatManager& operator=(const FScriptTickStatManager&) = delete;
+
+	FScriptTickFrameStats CurrentStats;
+	bool bTopScriptsRequested = false;
+};
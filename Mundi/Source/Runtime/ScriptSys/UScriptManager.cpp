@@ -198,7 +198,8 @@ void UScriptManager::InitializeGlobalLuaState()
     }
 
     UE_LOG("[ScriptManager] Initializing global Lua state...\n");
-    GlobalLuaState = std::make_unique<sol::state>();
+    // 힙/할당 통계를 위해 추적 할당기 설치
+    GlobalLuaState = std::make_unique<sol::state>(sol::default_at_panic, &FLuaMemoryTracker::Allocate, &FLuaMemoryTracker::GetInstance());
     GlobalLuaState->open_libraries(
         sol::lib::base,
         sol::lib::package,
@@ -215,9 +216,136 @@ void UScriptManager::InitializeGlobalLuaState()
     // 모든 타입 등록
     RegisterTypesToState(GlobalLuaState.get());
 
+    // GC 사이클 감지: 사이클마다 수집되는 센티널의 __gc에서 카운트하고 다시 생성
+    GlobalLuaState->set_function("__OnLuaGCCycle", []() {
+        FLuaMemoryTracker::GetInstance().AddGCCycle();
+    });
+    GlobalLuaState->script(R"(
+        local function ArmGCSentinel()
+            setmetatable({}, { __gc = function() __OnLuaGCCycle(); ArmGCSentinel() end })
+        end
+        ArmGCSentinel()
+    )");
+
+    ApplyGCSettings();
+
     UE_LOG("[ScriptManager] Global Lua state initialized successfully\n");
 }
 
+// ==================== Lua GC 제어 ====================
+void UScriptManager::SetGCIncremental(int32 Pause, int32 StepMul, int32 StepSize)
+{
+    GCSettings.Mode = ELuaGCMode::Incremental;
+    GCSettings.Pause = Pause;
+    GCSettings.StepMul = StepMul;
+    GCSettings.StepSize = StepSize;
+    ApplyGCSettings();
+}
+
+void UScriptManager::SetGCGenerational(int32 MinorMul, int32 MajorMul)
+{
+#if LUA_VERSION_NUM >= 504
+    GCSettings.Mode = ELuaGCMode::Generational;
+    GCSettings.MinorMul = MinorMul;
+    GCSettings.MajorMul = MajorMul;
+    ApplyGCSettings();
+#else
+    UE_LOG("[ScriptManager] Generational GC requires Lua 5.4\n");
+#endif
+}
+
+void UScriptManager::SetGCFrameBudget(float BudgetMS, int32 StepKB)
+{
+    GCSettings.FrameBudgetMS = std::max(0.0f, BudgetMS);
+    GCSettings.BudgetStepKB = std::max(1, StepKB);
+    bBudgetCycleActive = false;
+    HeapAfterLastBudgetCycle = FLuaMemoryTracker::GetInstance().GetHeapBytes();
+    ApplyGCSettings();
+}
+
+void UScriptManager::CollectGarbageFull()
+{
+    if (!GlobalLuaState)
+    {
+        return;
+    }
+
+    auto Start = std::chrono::high_resolution_clock::now();
+    lua_gc(GlobalLuaState->lua_state(), LUA_GCCOLLECT, 0);
+    FLuaMemoryTracker::GetInstance().AddGCStepTime(std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count());
+
+    bBudgetCycleActive = false;
+    HeapAfterLastBudgetCycle = FLuaMemoryTracker::GetInstance().GetHeapBytes();
+}
+
+void UScriptManager::TickGarbageCollection()
+{
+    FLuaMemoryTracker& Tracker = FLuaMemoryTracker::GetInstance();
+    if (GlobalLuaState && GCSettings.FrameBudgetMS > 0.0f)
+    {
+        // 자동 GC와 같은 기준(Pause, 기본 200%)으로 힙이 충분히 늘었을 때만 새 사이클 시작
+        const uint64 PausePercent = GCSettings.Pause > 0 ? GCSettings.Pause : 200;
+        if (!bBudgetCycleActive && Tracker.GetHeapBytes() * 100 >= HeapAfterLastBudgetCycle * PausePercent)
+        {
+            bBudgetCycleActive = true;
+        }
+
+        if (bBudgetCycleActive)
+        {
+            lua_State* L = GlobalLuaState->lua_state();
+            const auto Start = std::chrono::high_resolution_clock::now();
+            double ElapsedMS = 0.0;
+            do
+            {
+                // 사이클이 끝나면 1 반환
+                if (lua_gc(L, LUA_GCSTEP, GCSettings.BudgetStepKB))
+                {
+                    bBudgetCycleActive = false;
+                    HeapAfterLastBudgetCycle = Tracker.GetHeapBytes();
+                    break;
+                }
+                ElapsedMS = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+            } while (ElapsedMS < GCSettings.FrameBudgetMS);
+
+            Tracker.AddGCStepTime(std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count());
+        }
+    }
+
+    Tracker.EndFrame(GCSettings);
+}
+
+void UScriptManager::ApplyGCSettings()
+{
+    if (!GlobalLuaState)
+    {
+        return;
+    }
+
+    lua_State* L = GlobalLuaState->lua_state();
+#if LUA_VERSION_NUM >= 504
+    if (GCSettings.Mode == ELuaGCMode::Generational)
+    {
+        lua_gc(L, LUA_GCGEN, GCSettings.MinorMul, GCSettings.MajorMul);
+    }
+    else
+    {
+        lua_gc(L, LUA_GCINC, GCSettings.Pause, GCSettings.StepMul, GCSettings.StepSize);
+    }
+#else
+    if (GCSettings.Pause > 0)
+    {
+        lua_gc(L, LUA_GCSETPAUSE, GCSettings.Pause);
+    }
+    if (GCSettings.StepMul > 0)
+    {
+        lua_gc(L, LUA_GCSETSTEPMUL, GCSettings.StepMul);
+    }
+#endif
+
+    // 예산 모드에서는 자동 GC를 멈추고 TickGarbageCollection에서만 수집
+    lua_gc(L, GCSettings.FrameBudgetMS > 0.0f ? LUA_GCSTOP : LUA_GCRESTART, 0);
+}
+
 void UScriptManager::RegisterTypesToState(sol::state* state)
 {
     if (!state) return;
@@ -308,6 +436,431 @@ std::wstring UScriptManager::FStringToWideString(const FString& UTF8Str)
     return Path;
 }
 
+// ==================== 스크립트 청크 캐시 ====================
+namespace
+{
+    bool ReadScriptFile(const fs::path& AbsolutePath, std::string& OutContent)
+    {
+        // 파일을 직접 읽음 (한글 경로 문제 해결)
+        std::ifstream File(AbsolutePath, std::ios::binary);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        OutContent.assign((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+        return true;
+    }
+}
+
+sol::protected_function UScriptManager::LoadScriptChunk(const FString& ScriptPath, long long& OutWriteTime_ms, FString& OutError)
+{
+    if (!GlobalLuaState)
+    {
+        OutError = "Global Lua state not initialized";
+        return sol::protected_function();
+    }
+
+    const fs::path AbsolutePath = ResolveScriptPath(ScriptPath);
+    std::error_code ErrorCode;
+    const auto FileTime = fs::last_write_time(AbsolutePath, ErrorCode);
+    if (ErrorCode)
+    {
+        OutError = "Script file not found: " + ScriptPath;
+        return sol::protected_function();
+    }
+    const long long WriteTime_ms = std::chrono::duration_cast<std::chrono::milliseconds>(FileTime.time_since_epoch()).count();
+
+    const FWideString Key = AbsolutePath.lexically_normal().wstring();
+    FScriptChunkCacheEntry* Entry = ScriptChunkCache.Find(Key);
+
+    // 캐시가 없거나 파일이 바뀐 경우에만 소스를 읽고 컴파일
+    if (!Entry || Entry->WriteTime_ms != WriteTime_ms)
+    {
+        auto CompileStart = std::chrono::high_resolution_clock::now();
+
+        std::string ScriptContent;
+        if (!ReadScriptFile(AbsolutePath, ScriptContent))
+        {
+            OutError = "Failed to open script file";
+            return sol::protected_function();
+        }
+
+        sol::load_result SourceResult = GlobalLuaState->load(ScriptContent, ScriptPath, sol::load_mode::text);
+        if (!SourceResult.valid())
+        {
+            sol::error Err = SourceResult;
+            OutError = Err.what();
+            ScriptChunkCache.Remove(Key);
+            return sol::protected_function();
+        }
+
+        // 이번 호출은 방금 컴파일한 함수를 그대로 사용하고, 이후 인스턴스를 위해 바이트코드만 보관
+        sol::protected_function SourceChunk = SourceResult;
+        FScriptChunkCacheEntry NewEntry;
+        NewEntry.Bytecode = SourceChunk.dump();
+        NewEntry.WriteTime_ms = WriteTime_ms;
+        ScriptChunkCache[Key] = std::move(NewEntry);
+
+        ++ScriptChunkCacheStats.Misses;
+        ScriptChunkCacheStats.CompileTimeMs += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - CompileStart).count();
+
+        OutWriteTime_ms = WriteTime_ms;
+        return SourceChunk;
+    }
+
+    // 바이트코드 로드는 파싱/컴파일 없이 새 클로저만 생성
+    sol::load_result BinaryResult = GlobalLuaState->load(Entry->Bytecode.as_string_view(), ScriptPath, sol::load_mode::binary);
+    if (!BinaryResult.valid())
+    {
+        sol::error Err = BinaryResult;
+        OutError = Err.what();
+        ScriptChunkCache.Remove(Key);
+        return sol::protected_function();
+    }
+
+    ++ScriptChunkCacheStats.Hits;
+    OutWriteTime_ms = WriteTime_ms;
+    return BinaryResult;
+}
+
+void UScriptManager::InvalidateScriptChunk(const FString& ScriptPath)
+{
+    ScriptChunkCache.Remove(ResolveScriptPath(ScriptPath).lexically_normal().wstring());
+}
+
+void UScriptManager::ClearScriptChunkCache()
+{
+    ScriptChunkCache.Empty();
+    ScriptChunkCacheStats = FScriptChunkCacheStats();
+}
+
+void UScriptManager::BenchmarkScriptInstantiation(const FString& ScriptPath, int32 Count)
+{
+    if (!GlobalLuaState || Count <= 0)
+    {
+        return;
+    }
+
+    const fs::path AbsolutePath = ResolveScriptPath(ScriptPath);
+
+    // ScriptComponent::ReloadScript와 같은 순서로 인스턴스 하나를 만듦 (액터 없이 환경 + 청크 실행)
+    auto RunInstance = [this](sol::protected_function& Chunk) -> bool
+    {
+        sol::environment Env(*GlobalLuaState, sol::create, GlobalLuaState->globals());
+        Env["actor"] = sol::lua_nil;
+        Env["self"] = sol::lua_nil;
+        sol::set_environment(Env, Chunk);
+        return Chunk().valid();
+    };
+
+    // 1. 캐시 미사용: 인스턴스마다 파일 읽기 + 소스 컴파일
+    int32 FailedCount = 0;
+    auto UncachedStart = std::chrono::high_resolution_clock::now();
+    for (int32 i = 0; i < Count; ++i)
+    {
+        std::string ScriptContent;
+        if (!ReadScriptFile(AbsolutePath, ScriptContent))
+        {
+            UE_LOG("[ScriptManager] Benchmark: failed to open %s", ScriptPath.c_str());
+            return;
+        }
+        sol::load_result Result = GlobalLuaState->load(ScriptContent, ScriptPath, sol::load_mode::text);
+        sol::protected_function Chunk = Result;
+        if (!Result.valid() || !RunInstance(Chunk))
+        {
+            ++FailedCount;
+        }
+    }
+    const double UncachedMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - UncachedStart).count();
+    GlobalLuaState->collect_garbage();
+
+    // 2. 캐시 사용: 첫 인스턴스만 컴파일, 나머지는 바이트코드 로드
+    InvalidateScriptChunk(ScriptPath);
+    auto CachedStart = std::chrono::high_resolution_clock::now();
+    for (int32 i = 0; i < Count; ++i)
+    {
+        long long WriteTime_ms = 0;
+        FString Error;
+        sol::protected_function Chunk = LoadScriptChunk(ScriptPath, WriteTime_ms, Error);
+        if (!Chunk.valid() || !RunInstance(Chunk))
+        {
+            ++FailedCount;
+        }
+    }
+    const double CachedMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - CachedStart).count();
+    GlobalLuaState->collect_garbage();
+
+    UE_LOG("[ScriptManager] Benchmark %s x%d: uncached %.2f ms (%.1f us/instance), cached %.2f ms (%.1f us/instance), failed %d",
+        ScriptPath.c_str(), Count,
+        UncachedMs, UncachedMs * 1000.0 / Count,
+        CachedMs, CachedMs * 1000.0 / Count,
+        FailedCount);
+}
+
+void UScriptManager::BenchmarkScriptTick(const FString& ScriptPath, int32 Count, int32 Frames)
+{
+    if (!GlobalLuaState || Count <= 0 || Frames <= 0)
+    {
+        return;
+    }
+
+    // ScriptComponent와 같은 방식으로 인스턴스 환경을 만들고 청크 실행 (액터 없이)
+    TArray<sol::environment> Envs;
+    Envs.reserve(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        long long WriteTime_ms = 0;
+        FString Error;
+        sol::protected_function Chunk = LoadScriptChunk(ScriptPath, WriteTime_ms, Error);
+        if (!Chunk.valid())
+        {
+            UE_LOG("[ScriptManager] TickBench: failed to load %s: %s", ScriptPath.c_str(), Error.c_str());
+            return;
+        }
+
+        sol::environment Env(*GlobalLuaState, sol::create, GlobalLuaState->globals());
+        Env["actor"] = sol::lua_nil;
+        Env["self"] = sol::lua_nil;
+        sol::set_environment(Env, Chunk);
+        if (Chunk().valid())
+        {
+            Envs.push_back(Env);
+        }
+    }
+
+    if (Envs.empty())
+    {
+        UE_LOG("[ScriptManager] TickBench: %s failed to execute", ScriptPath.c_str());
+        return;
+    }
+
+    const float DeltaTime = 1.0f / 60.0f;
+    int32 FailedCalls = 0;
+
+    // 1. 이름 조회 경로: 매 호출마다 테이블 조회 + 환경 설정 + try/catch (기존 CallLuaFunction)
+    auto LookupStart = std::chrono::high_resolution_clock::now();
+    for (int32 Frame = 0; Frame < Frames; ++Frame)
+    {
+        for (sol::environment& Env : Envs)
+        {
+            try
+            {
+                sol::protected_function Func = Env["Tick"];
+                if (Func.valid())
+                {
+                    sol::set_environment(Env, Func);
+                    if (!Func(DeltaTime).valid())
+                    {
+                        ++FailedCalls;
+                    }
+                }
+            }
+            catch (const sol::error&)
+            {
+                ++FailedCalls;
+            }
+        }
+    }
+    const double LookupMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - LookupStart).count();
+
+    // 2. 캐시 경로: 로드 시 한 번 조회/환경 설정한 훅을 바로 호출 (UScriptComponent::CallLuaHook)
+    TArray<sol::protected_function> Hooks;
+    Hooks.reserve(Envs.size());
+    for (sol::environment& Env : Envs)
+    {
+        sol::object Value = Env["Tick"];
+        if (Value.get_type() == sol::type::function)
+        {
+            sol::protected_function Hook = Value.as<sol::protected_function>();
+            sol::set_environment(Env, Hook);
+            Hooks.push_back(Hook);
+        }
+    }
+
+    auto CachedStart = std::chrono::high_resolution_clock::now();
+    for (int32 Frame = 0; Frame < Frames; ++Frame)
+    {
+        for (const sol::protected_function& Hook : Hooks)
+        {
+            if (!Hook(DeltaTime).valid())
+            {
+                ++FailedCalls;
+            }
+        }
+    }
+    const double CachedMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - CachedStart).count();
+    GlobalLuaState->collect_garbage();
+
+    const double CallCount = static_cast<double>(Envs.size()) * Frames;
+    UE_LOG("[ScriptManager] TickBench %s: %d instances x %d frames, lookup %.2f ms (%.3f us/call), cached %.2f ms (%.3f us/call), failed %d",
+        ScriptPath.c_str(), static_cast<int32>(Envs.size()), Frames,
+        LookupMs, LookupMs * 1000.0 / CallCount,
+        CachedMs, CachedMs * 1000.0 / CallCount,
+        FailedCalls);
+}
+
+void UScriptManager::BenchmarkGameEvents(int32 EventsPerFrame, int32 Subscribers, int32 Frames)
+{
+    if (!GlobalLuaState || EventsPerFrame <= 0 || Subscribers <= 0 || Frames <= 0)
+    {
+        return;
+    }
+
+    // 월드에 속하지 않은 임시 GameMode (코루틴 신호 경로 제외)
+    AGameModeBase* BenchGameMode = ObjectFactory::NewObject<AGameModeBase>();
+    if (!BenchGameMode)
+    {
+        return;
+    }
+
+    const FString EventName = "__EventBench";
+    const FGameEventId EventId = BenchGameMode->RegisterEvent(EventName);
+    for (int32 i = 0; i < Subscribers; ++i)
+    {
+        sol::function Callback = GlobalLuaState->script("local n = 0 return function(v) n = n + 1 end");
+        BenchGameMode->SubscribeEventById(EventId, Callback);
+    }
+
+    const sol::object Payload = sol::make_object(*GlobalLuaState, 42);
+    auto Measure = [Frames](auto&& FireFrame)
+    {
+        auto Start = std::chrono::high_resolution_clock::now();
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            FireFrame();
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - Start).count();
+    };
+
+    // 1. 이름 경로 (매 발행마다 이름 -> ID 조회)
+    const double ByNameMs = Measure([&]()
+    {
+        for (int32 i = 0; i < EventsPerFrame; ++i)
+        {
+            BenchGameMode->FireEvent(EventName, Payload);
+        }
+    });
+
+    // 2. ID 경로
+    const double ByIdMs = Measure([&]()
+    {
+        for (int32 i = 0; i < EventsPerFrame; ++i)
+        {
+            BenchGameMode->FireEventById(EventId, Payload);
+        }
+    });
+
+    // 3. 타입 지정 경로 (sol::object 없이 값 직접 push)
+    const double TypedMs = Measure([&]()
+    {
+        for (int32 i = 0; i < EventsPerFrame; ++i)
+        {
+            BenchGameMode->FireEventTyped(EventId, 42);
+        }
+    });
+
+    // 4. 큐 경로 (프레임 끝 일괄 발행)
+    const double QueuedMs = Measure([&]()
+    {
+        for (int32 i = 0; i < EventsPerFrame; ++i)
+        {
+            BenchGameMode->QueueEvent(EventId, Payload);
+        }
+        BenchGameMode->FlushQueuedEvents();
+    });
+
+    BenchGameMode->ClearAllDynamicEvents();
+    ObjectFactory::DeleteObject(BenchGameMode);
+    GlobalLuaState->collect_garbage();
+
+    UE_LOG("[ScriptManager] EventBench: %d events/frame x %d subscribers x %d frames (ms/frame): name %.3f, id %.3f, typed %.3f, queued %.3f",
+        EventsPerFrame, Subscribers, Frames,
+        ByNameMs / Frames, ByIdMs / Frames, TypedMs / Frames, QueuedMs / Frames);
+}
+
+void UScriptManager::BenchmarkVectorMath(int32 Iterations)
+{
+    if (!GlobalLuaState || Iterations <= 0)
+    {
+        return;
+    }
+
+    // FirstPersonController::UpdateMovement와 같은 형태의 이동 계산 (Mode별로 GC를 멈추고 할당량 측정)
+    sol::protected_function_result Loaded = GlobalLuaState->safe_script(R"(
+        return function(Mode, N)
+            local Fwd, Right = Vector(1, 0, 0), Vector(0, 1, 0)
+            local Pos, Movement = Vector(0, 0, 0), Vector(0, 0, 0)
+            local Dt, ForwardSpeed, RightSpeed = 1 / 60, 10, 3
+            collectgarbage("collect")
+            collectgarbage("stop")
+            local Before = collectgarbage("count")
+            if Mode == 0 then
+                -- 연산자: 연산마다 새 userdata
+                for i = 1, N do
+                    local M = Vector(0, 0, 0)
+                    M = M + Right * (RightSpeed * Dt)
+                    M = M + Fwd * (ForwardSpeed * Dt)
+                    Pos = Pos + M
+                end
+            elseif Mode == 1 then
+                -- in-place 메서드
+                for i = 1, N do
+                    Movement:Set(0, 0, 0)
+                    Movement:AddScaledInPlace(Right, RightSpeed * Dt)
+                    Movement:AddScaledInPlace(Fwd, ForwardSpeed * Dt)
+                    Pos:AddInPlace(Movement)
+                end
+            elseif Mode == 2 then
+                -- 임시 벡터 풀
+                for i = 1, N do
+                    local M = TempVector(0, 0, 0)
+                    M:AddScaledInPlace(Right, RightSpeed * Dt)
+                    M:AddScaledInPlace(Fwd, ForwardSpeed * Dt)
+                    Pos:AddInPlace(M)
+                end
+            else
+                -- 숫자 3개 (XYZ API 형태)
+                for i = 1, N do
+                    local Rx, Ry, Rz = Right:Unpack()
+                    local Fx, Fy, Fz = Fwd:Unpack()
+                    local Rs, Fs = RightSpeed * Dt, ForwardSpeed * Dt
+                    local Px, Py, Pz = Pos:Unpack()
+                    Pos:Set(Px + Rx * Rs + Fx * Fs, Py + Ry * Rs + Fy * Fs, Pz + Rz * Rs + Fz * Fs)
+                end
+            end
+            local AllocatedKB = collectgarbage("count") - Before
+            collectgarbage("restart")
+            return AllocatedKB
+        end
+    )");
+    if (!Loaded.valid())
+    {
+        sol::error Err = Loaded;
+        UE_LOG("[ScriptManager] VecBench: %s", Err.what());
+        return;
+    }
+
+    sol::protected_function Bench = Loaded;
+    static const char* ModeNames[] = { "operators", "in-place", "temp pool", "xyz" };
+    for (int32 Mode = 0; Mode < 4; ++Mode)
+    {
+        auto Start = std::chrono::high_resolution_clock::now();
+        sol::protected_function_result Result = Bench(Mode, Iterations);
+        const double ElapsedNs = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - Start).count();
+        if (!Result.valid())
+        {
+            sol::error Err = Result;
+            UE_LOG("[ScriptManager] VecBench %s: %s", ModeNames[Mode], Err.what());
+            continue;
+        }
+
+        const double AllocatedKB = Result.get<double>();
+        UE_LOG("[ScriptManager] VecBench %-9s x%d: %.1f ns/iter, %.1f KB allocated (%.1f B/iter)",
+            ModeNames[Mode], Iterations, ElapsedNs / Iterations, AllocatedKB, AllocatedKB * 1024.0 / Iterations);
+    }
+    GlobalLuaState->collect_garbage();
+}
+
 void UScriptManager::RegisterCoreTypes(sol::state* state)
 {
     RegisterLOG(state);
@@ -367,7 +920,43 @@ void UScriptManager::RegisterVector(sol::state* state)
         ADD_LUA_META_FUNCTION(division, [](const FVector& v, float f) {
             return v / f;
         })
+
+        // 할당 없는 경로: 연산자는 매번 새 userdata를 만들므로 매 프레임 수학은 in-place 메서드 사용
+        ADD_LUA_FUNCTION("Set", [](FVector& v, float x, float y, float z) {
+            v.X = x; v.Y = y; v.Z = z;
+        })
+        ADD_LUA_FUNCTION("Assign", [](FVector& v, const FVector& other) {
+            v = other;
+        })
+        ADD_LUA_FUNCTION("AddInPlace", [](FVector& v, const FVector& other) {
+            v += other;
+        })
+        ADD_LUA_FUNCTION("SubInPlace", [](FVector& v, const FVector& other) {
+            v -= other;
+        })
+        ADD_LUA_FUNCTION("ScaleInPlace", [](FVector& v, float f) {
+            v *= f;
+        })
+        ADD_LUA_FUNCTION("AddScaledInPlace", [](FVector& v, const FVector& other, float f) {
+            v.X += other.X * f; v.Y += other.Y * f; v.Z += other.Z * f;
+        })
+        ADD_LUA_FUNCTION("Unpack", [](const FVector& v) {
+            return std::make_tuple(v.X, v.Y, v.Z);
+        })
     END_LUA_TYPE() // 4. 종료
+
+    // 임시 벡터 풀: 미리 만든 userdata를 링으로 돌려 쓰므로 할당 없음
+    // 반환값은 이후 TempVector를 256번 호출하면 재사용되므로 저장하지 말고 그 자리에서만 사용
+    state->script(R"(
+        local Pool, Cursor, Size = {}, 0, 256
+        for i = 1, Size do Pool[i] = Vector(0, 0, 0) end
+        function TempVector(x, y, z)
+            Cursor = Cursor % Size + 1
+            local V = Pool[Cursor]
+            V:Set(x or 0, y or 0, z or 0)
+            return V
+        end
+    )");
 }
 
 void UScriptManager::RegisterQuat(sol::state* state)
@@ -744,6 +1333,30 @@ void UScriptManager::RegisterActor(sol::state* state)
         ADD_LUA_FUNCTION("GetActorRight", &AActor::GetActorRight)
         ADD_LUA_FUNCTION("GetActorUp", &AActor::GetActorUp)
 
+        // Batched Transform API: Vector userdata 없이 숫자 3개로 주고받음 (매 프레임 이동 코드용)
+        ADD_LUA_FUNCTION("GetActorLocationXYZ", [](AActor* actor) {
+            const FVector L = actor->GetActorLocation();
+            return std::make_tuple(L.X, L.Y, L.Z);
+        })
+        ADD_LUA_FUNCTION("SetActorLocationXYZ", [](AActor* actor, float x, float y, float z) {
+            actor->SetActorLocation(FVector(x, y, z));
+        })
+        ADD_LUA_FUNCTION("AddActorWorldLocationXYZ", [](AActor* actor, float x, float y, float z) {
+            actor->AddActorWorldLocation(FVector(x, y, z));
+        })
+        ADD_LUA_FUNCTION("GetActorForwardXYZ", [](AActor* actor) {
+            const FVector F = actor->GetActorForward();
+            return std::make_tuple(F.X, F.Y, F.Z);
+        })
+        ADD_LUA_FUNCTION("GetActorRightXYZ", [](AActor* actor) {
+            const FVector R = actor->GetActorRight();
+            return std::make_tuple(R.X, R.Y, R.Z);
+        })
+        // 기존 Vector에 결과를 써넣음 (새 userdata 없음)
+        ADD_LUA_FUNCTION("GetActorLocationInto", [](AActor* actor, FVector& out) {
+            out = actor->GetActorLocation();
+        })
+
         // Name/Visibility
         ADD_LUA_FUNCTION("GetName", [](AActor* actor) -> std::string {
             return actor->GetName().ToString();
@@ -1252,10 +1865,17 @@ void UScriptManager::RegisterScriptComponent(sol::state* state)
         // Lifecycle
         ADD_LUA_FUNCTION("BeginPlay", &UScriptComponent::BeginPlay)
 
+        // Tick 설정 (스크립트 전역 TickGroup/TickInterval 선언과 동일)
+        ADD_LUA_FUNCTION("SetTickInterval", &UScriptComponent::SetTickInterval)
+        ADD_LUA_FUNCTION("GetTickInterval", &UScriptComponent::GetTickInterval)
+        ADD_LUA_FUNCTION("SetTickGroup", &UScriptComponent::SetTickGroupByName)
+
         // Coroutine API
         ADD_LUA_FUNCTION("StartCoroutine", &UScriptComponent::StartCoroutine)
         ADD_LUA_FUNCTION("StopCoroutine", &UScriptComponent::StopCoroutine)
         ADD_LUA_FUNCTION("WaitForSeconds", &UScriptComponent::WaitForSeconds)
+        ADD_LUA_FUNCTION("WaitForFrames", &UScriptComponent::WaitForFrames)
+        ADD_LUA_FUNCTION("WaitForEvent", &UScriptComponent::WaitForEvent)
         ADD_LUA_FUNCTION("StopAllCoroutines", &UScriptComponent::StopAllCoroutines)
 
         // Owner Actor 접근
@@ -1405,23 +2025,51 @@ void UScriptManager::RegisterGameMode(sol::state* state)
         ADD_LUA_FUNCTION("GetScriptComponent", &AGameModeBase::GetScriptComponent)
 
         // 동적 이벤트 시스템 API
+        // 이벤트는 이름 또는 RegisterEvent가 반환한 ID로 지정 (매 프레임 발행은 ID 권장)
         ADD_LUA_FUNCTION("RegisterEvent", &AGameModeBase::RegisterEvent)
-        ADD_LUA_FUNCTION("SubscribeEvent", &AGameModeBase::SubscribeEvent)
-        ADD_LUA_FUNCTION("UnsubscribeEvent", &AGameModeBase::UnsubscribeEvent)
+        ADD_LUA_FUNCTION("GetEventIds", &AGameModeBase::GetEventIdTable)
+        ADD_LUA_OVERLOAD("SubscribeEvent",
+            &AGameModeBase::SubscribeEventById,
+            &AGameModeBase::SubscribeEvent
+        )
+        ADD_LUA_OVERLOAD("UnsubscribeEvent",
+            &AGameModeBase::UnsubscribeHandle,
+            &AGameModeBase::UnsubscribeEvent
+        )
         ADD_LUA_FUNCTION("PrintRegisteredEvents", &AGameModeBase::PrintRegisteredEvents)
 
-        // FireEvent - sol::object를 받기 위한 커스텀 바인딩
+        // FireEvent - sol::object를 받기 위한 커스텀 바인딩 (data는 변환 없이 구독자에게 전달)
         ADD_LUA_OVERLOAD("FireEvent",
-            // 파라미터 없이 호출
+            [](AGameModeBase* gm, FGameEventId eventId) {
+                gm->FireEventById(eventId);
+            },
+            [](AGameModeBase* gm, FGameEventId eventId, sol::object data) {
+                gm->FireEventById(eventId, data);
+            },
             [](AGameModeBase* gm, const FString& eventName) {
                 gm->FireEvent(eventName, sol::nil);
             },
-            // 파라미터와 함께 호출
             [](AGameModeBase* gm, const FString& eventName, sol::object data) {
                 gm->FireEvent(eventName, data);
             }
         )
 
+        // QueueEvent - 프레임 끝에 일괄 발행
+        ADD_LUA_OVERLOAD("QueueEvent",
+            [](AGameModeBase* gm, FGameEventId eventId) {
+                gm->QueueEvent(eventId);
+            },
+            [](AGameModeBase* gm, FGameEventId eventId, sol::object data) {
+                gm->QueueEvent(eventId, data);
+            },
+            [](AGameModeBase* gm, const FString& eventName) {
+                gm->QueueEvent(gm->RegisterEvent(eventName));
+            },
+            [](AGameModeBase* gm, const FString& eventName, sol::object data) {
+                gm->QueueEvent(gm->RegisterEvent(eventName), data);
+            }
+        )
+
         // 정적 Delegate 바인딩 (기존)
         ADD_LUA_FUNCTION("BindOnGameStart", [](AGameModeBase* gm, sol::function fn) {
             if (!gm || !fn.valid()) return (FDelegateHandle)0;
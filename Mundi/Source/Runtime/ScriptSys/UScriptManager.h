@@ -1,4 +1,15 @@
 ﻿#pragma once
+#include "LuaMemoryTracker.h"
+
+/**
+ * @brief 스크립트 청크 캐시 통계 (STAT/벤치마크용)
+ */
+struct FScriptChunkCacheStats
+{
+    uint32 Hits = 0;            // 캐시된 바이트코드로 로드한 횟수
+    uint32 Misses = 0;          // 파일을 읽고 소스를 컴파일한 횟수
+    double CompileTimeMs = 0.0; // Miss에 쓴 누적 시간
+};
 
 /**
  * @brief 전역 Lua 타입 바인딩을 관리하는 싱글톤 매니저
@@ -10,7 +21,8 @@ class UScriptManager : public UObject
 public:
     DECLARE_CLASS(UScriptManager, UObject)
 
-    UScriptManager() = default;
+    // Lua state가 닫힐 때까지 할당기가 살아있도록 추적기를 먼저 생성 (정적 객체는 생성 역순으로 파괴)
+    UScriptManager() { FLuaMemoryTracker::GetInstance(); }
 
     /**
      * @brief 싱글톤 인스턴스 반환
@@ -54,6 +66,74 @@ public:
      */
     void RegisterTypesToState(sol::state* state);
 
+    // ==================== 스크립트 청크 캐시 ====================
+    /**
+     * @brief 컴파일된 청크 캐시에서 스크립트를 새 함수로 로드 (아직 실행 안 함)
+     * @details 캐시 키는 해석된 절대 경로이며, 파일 수정 시간이 바뀌면 처음 요청한 인스턴스가 한 번만 다시 컴파일합니다.
+     *          같은 함수를 여러 환경에서 공유하면 _ENV 업밸류가 덮어써지므로, 인스턴스마다 바이트코드로 새 클로저를 만듭니다.
+     * @param ScriptPath 스크립트 경로 (상대 경로면 LuaScripts 기준)
+     * @param OutWriteTime_ms [out] 로드한 파일의 수정 시간 (ms)
+     * @param OutError [out] 실패 시 에러 메시지
+     * @return 로드된 청크 함수 (실패 시 invalid)
+     */
+    sol::protected_function LoadScriptChunk(const FString& ScriptPath, long long& OutWriteTime_ms, FString& OutError);
+
+    /**
+     * @brief 캐시 항목 무효화 (다음 로드 시 다시 컴파일)
+     */
+    void InvalidateScriptChunk(const FString& ScriptPath);
+    void ClearScriptChunkCache();
+
+    const FScriptChunkCacheStats& GetScriptChunkCacheStats() const { return ScriptChunkCacheStats; }
+
+    /**
+     * @brief 스크립트 인스턴스 생성 비용 측정 (환경 생성 + 청크 로드 + 실행을 Count번, 캐시 사용/미사용 비교)
+     */
+    void BenchmarkScriptInstantiation(const FString& ScriptPath, int32 Count = 1000);
+
+    /**
+     * @brief Tick 호출 비용 측정 (Count개 인스턴스 x Frames 프레임, 이름 조회 경로와 캐시된 훅 경로 비교)
+     */
+    void BenchmarkScriptTick(const FString& ScriptPath, int32 Count = 1000, int32 Frames = 100);
+
+    /**
+     * @brief GameMode 동적 이벤트 발행 비용 측정 (프레임당 EventsPerFrame회 x Subscribers명, 이름/ID/타입 지정/큐 경로 비교)
+     */
+    void BenchmarkGameEvents(int32 EventsPerFrame = 10000, int32 Subscribers = 20, int32 Frames = 10);
+
+    /**
+     * @brief 컨트롤러식 벡터 계산 비용 측정 (연산자/in-place/임시 벡터 풀/XYZ 경로의 반복당 ns와 GC 할당량 비교)
+     */
+    void BenchmarkVectorMath(int32 Iterations = 100000);
+
+    // ==================== Lua GC 제어 ====================
+    /**
+     * @brief Incremental GC로 전환 (인자가 0이면 Lua 기본값)
+     */
+    void SetGCIncremental(int32 Pause = 0, int32 StepMul = 0, int32 StepSize = 0);
+
+    /**
+     * @brief Generational GC로 전환 (Lua 5.4 이상, 인자가 0이면 Lua 기본값)
+     */
+    void SetGCGenerational(int32 MinorMul = 0, int32 MajorMul = 0);
+
+    /**
+     * @brief 프레임 GC 예산 설정. BudgetMS > 0이면 자동 GC를 멈추고 TickGarbageCollection에서 예산만큼만 스텝 실행
+     */
+    void SetGCFrameBudget(float BudgetMS, int32 StepKB = 64);
+
+    /**
+     * @brief 전체 수집 (소요 시간은 GC 통계에 기록)
+     */
+    void CollectGarbageFull();
+
+    /**
+     * @brief 매 프레임 엔진 루프에서 호출 (예산 모드 GC 스텝 + 메모리 통계 확정)
+     */
+    void TickGarbageCollection();
+
+    const FLuaGCSettings& GetGCSettings() const { return GCSettings; }
+
     // ==================== 파일 시스템 유틸리티 ====================
     /**
      * @brief 상대 스크립트 경로를 절대 경로(std::filesystem::path)로 변환
@@ -116,4 +196,18 @@ private:
 
     // ==================== Private Members ====================
     std::unique_ptr<sol::state> GlobalLuaState;  // 전역 Lua state (모든 스크립트 공유)
+
+    struct FScriptChunkCacheEntry
+    {
+        sol::bytecode Bytecode;     // 디버그 정보 포함 (에러 메시지 줄 번호 유지)
+        long long WriteTime_ms = 0;
+    };
+    TMap<FWideString, FScriptChunkCacheEntry> ScriptChunkCache;  // 해석된 절대 경로 → 바이트코드
+    FScriptChunkCacheStats ScriptChunkCacheStats;
+
+    // Lua GC
+    void ApplyGCSettings();
+    FLuaGCSettings GCSettings;
+    bool bBudgetCycleActive = false;        // 예산 모드에서 진행 중인 사이클이 있는지
+    uint64 HeapAfterLastBudgetCycle = 0;    // 예산 모드에서 마지막 사이클이 끝났을 때의 힙 크기
 };
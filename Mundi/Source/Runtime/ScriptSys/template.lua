@@ -8,8 +8,14 @@
 --
 -- 사용 가능한 타입:
 --   Vector(x, y, z): 3D 벡터 (연산 가능: +, *)
+--     매 프레임 계산은 할당 없는 경로 권장: v:Set/AddInPlace/AddScaledInPlace, TempVector(x, y, z),
+--     actor:GetActorLocationXYZ/SetActorLocationXYZ/AddActorWorldLocationXYZ (숫자 3개로 주고받음)
 --   Actor: GetActorLocation, SetActorLocation, AddActorWorldLocation 등
 --   PrimitiveComponent: BindOnBeginOverlap, BindOnEndOverlap 등 Delegate 바인딩
+--
+-- 틱 설정 (선택, 스크립트 전역으로 선언):
+--   TickGroup = "PrePhysics" | "PostPhysics"(기본) | "PostCamera"
+--   TickInterval = 0.5  -- 초 단위, Tick(dt)에는 누적된 dt가 전달됨
 -- ==============================================================================
 
 ---
@@ -13,6 +13,9 @@
 #include "TileCullingStats.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "MeshletStats.h"
+#include "ScriptTickStats.h"
+#include "LuaMemoryTracker.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -98,7 +101,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowMeshlet && !bShowScript && !bShowLua && !bShowRHI) || !SwapChain)
 		return;
 
 	ID2D1Factory1* D2dFactory = nullptr;
@@ -247,17 +250,28 @@ void UStatsOverlayD2D::Draw()
 		double AverageTimePerDecal = FDecalStatManager::GetInstance().GetAverageTimePerDecalMS();
 		double AverageTimePerDraw = FDecalStatManager::GetInstance().GetAverageTimePerDrawMS();
 
+		// 경로별 비용 (* = 이번 프레임에 사용한 경로, 나머지는 마지막으로 측정한 값)
+		const FDecalPathStats& MeshStats = FDecalStatManager::GetInstance().GetPathStats(EDecalRenderPath::MeshProjection);
+		const FDecalPathStats& ClusteredStats = FDecalStatManager::GetInstance().GetPathStats(EDecalRenderPath::Clustered);
+		const wchar_t* MeshMark = FDecalStatManager::GetInstance().IsPathMeasuredThisFrame(EDecalRenderPath::MeshProjection) ? L"*" : L"";
+		const wchar_t* ClusteredMark = FDecalStatManager::GetInstance().IsPathMeasuredThisFrame(EDecalRenderPath::Clustered) ? L"*" : L"";
+
 		// 2. 출력할 문자열 버퍼를 만듭니다.
-		wchar_t Buf[256];
-		swprintf_s(Buf, L"[Decal Stats]\nTotal: %u\nAffectedMesh: %u\n전체 소요 시간: %.3f ms\nAvg/Decal: %.3f ms\nAvg/Mesh: %.3f ms",
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Decal Stats]\nTotal: %u\nAffectedMesh: %u\n전체 소요 시간: %.3f ms\nAvg/Decal: %.3f ms\nAvg/Mesh: %.3f ms"
+			L"\nMesh%s: %.3f ms\n  Draw %u, Cache %u/%u\nClustered%s: %.3f ms\n  Pass %u, TileRef %u",
 			TotalCount,
 			AffectedMeshCount,
 			TotalTime,
 			AverageTimePerDecal,
-			AverageTimePerDraw);
+			AverageTimePerDraw,
+			MeshMark, MeshStats.CpuTimeMS,
+			MeshStats.Draws, MeshStats.ReceiverCacheHits, MeshStats.ReceiverCacheHits + MeshStats.ReceiverCacheMisses,
+			ClusteredMark, ClusteredStats.CpuTimeMS,
+			ClusteredStats.Draws, ClusteredStats.TileDecalPairs);
 
 		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
-		const float decalPanelHeight = 140.0f;
+		const float decalPanelHeight = 230.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + decalPanelHeight);
 
 		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 주황색(Orange)으로 설정합니다.
@@ -329,14 +343,149 @@ void UStatsOverlayD2D::Draw()
 		NextY += lightPanelHeight + Space;
 	}
 
+	if (bShowMeshlet)
+	{
+		const FMeshletStats& MeshletStats = FMeshletStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Meshlet Stats]\nMeshlets: %u / %u\nTriangles: %u / %u (%.1f%% culled)\nBatches: %u compacted, %u culled\nUpload: %.1f KB\nCull Time: %.3f ms",
+			MeshletStats.VisibleMeshlets,
+			MeshletStats.TestedMeshlets,
+			MeshletStats.VisibleTriangles,
+			MeshletStats.TestedTriangles,
+			MeshletStats.GetTriangleCullRate(),
+			MeshletStats.CompactedBatches,
+			MeshletStats.CulledBatches,
+			MeshletStats.UploadedIndexBytes / 1024.0,
+			MeshletStats.CullTimeMS);
+
+		const float meshletPanelHeight = 140.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + meshletPanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightGreen));
+
+		NextY += meshletPanelHeight + Space;
+	}
+
+	if (bShowScript)
+	{
+		const FScriptTickFrameStats& ScriptStats = FScriptTickStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[1024];
+		int Len = swprintf_s(Buf, L"[Script Tick]\nScripts: %u (%u ticked)\nTotal: %.3f ms\n  Pre: %.3f  Post: %.3f  Cam: %.3f",
+			ScriptStats.ScriptCount,
+			ScriptStats.TickedScripts,
+			ScriptStats.TotalMS,
+			ScriptStats.GroupMS[static_cast<uint32>(EScriptTickGroup::PrePhysics)],
+			ScriptStats.GroupMS[static_cast<uint32>(EScriptTickGroup::PostPhysics)],
+			ScriptStats.GroupMS[static_cast<uint32>(EScriptTickGroup::PostCamera)]);
+
+		// 평균 비용이 큰 스크립트
+		for (const FScriptTickStat& Stat : ScriptStats.TopScripts)
+		{
+			if (Len < 0 || Len >= static_cast<int>(std::size(Buf)))
+			{
+				break;
+			}
+			const FString FileName = std::filesystem::path(Stat.ScriptPath).filename().string();
+			Len += swprintf_s(Buf + Len, std::size(Buf) - Len, L"\n%hs: %.3f ms", FileName.c_str(), Stat.AverageMS);
+		}
+
+		const float scriptPanelHeight = 100.0f + 20.0f * static_cast<float>(ScriptStats.TopScripts.size());
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 60.0f, NextY + scriptPanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Orange));
+
+		NextY += scriptPanelHeight + Space;
+	}
+
+	if (bShowLua)
+	{
+		const FLuaMemoryFrameStats& LuaStats = FLuaMemoryTracker::GetInstance().GetStats();
+
+		wchar_t Buf[1024];
+		int Len = swprintf_s(Buf, L"[Lua Memory]\nHeap: %.1f KB (peak %.1f KB)\nAlloc/frame: %.1f KB, %u allocs, %u frees\nGC: %hs, budget %.2f ms\nGC step: %.3f ms (peak %.3f)\nCycles: %u",
+			static_cast<double>(LuaStats.HeapBytes) / 1024.0,
+			static_cast<double>(LuaStats.PeakHeapBytes) / 1024.0,
+			static_cast<double>(LuaStats.FrameAllocBytes) / 1024.0,
+			LuaStats.FrameAllocCount,
+			LuaStats.FrameFreeCount,
+			GetLuaGCModeName(LuaStats.GCMode),
+			LuaStats.FrameBudgetMS,
+			LuaStats.GCStepMS,
+			LuaStats.PeakGCStepMS,
+			LuaStats.GCCycles);
+
+		// 이번 프레임 할당량이 큰 스크립트
+		for (const FLuaScopeAllocStat& Scope : LuaStats.TopScopes)
+		{
+			if (Len < 0 || Len >= static_cast<int>(std::size(Buf)))
+			{
+				break;
+			}
+			const FString FileName = std::filesystem::path(Scope.Name).filename().string();
+			Len += swprintf_s(Buf + Len, std::size(Buf) - Len, L"\n%hs: %.1f KB (%u)", FileName.c_str(),
+				static_cast<double>(Scope.FrameAllocBytes) / 1024.0, Scope.FrameAllocCount);
+		}
+
+		const float luaPanelHeight = 140.0f + 20.0f * static_cast<float>(LuaStats.TopScopes.size());
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 60.0f, NextY + luaPanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::Khaki));
+
+		NextY += luaPanelHeight + Space;
+	}
+
+	if (bShowRHI)
+	{
+		const FRHIStateStats& RHIStats = GEngine.GetRHIDevice()->GetStateStats();
+		auto Submitted = [&RHIStats](ERHIStateCall Call) { return RHIStats.Submitted[static_cast<uint32>(Call)]; };
+		auto Skipped = [&RHIStats](ERHIStateCall Call) { return RHIStats.Skipped[static_cast<uint32>(Call)]; };
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[RHI State]\nCalls: %u submitted, %u skipped\n  Shader: %u / %u\n  CBuffer: %u / %u\n  Sampler: %u / %u\n  RS: %u / %u  OM: %u / %u\nCB Ring: %hs, %u allocs (%.1f KB), %u wraps\nCB Discard: %u",
+			RHIStats.GetTotalSubmitted(),
+			RHIStats.GetTotalSkipped(),
+			Submitted(ERHIStateCall::Shader), Skipped(ERHIStateCall::Shader),
+			Submitted(ERHIStateCall::ConstantBuffer), Skipped(ERHIStateCall::ConstantBuffer),
+			Submitted(ERHIStateCall::Sampler), Skipped(ERHIStateCall::Sampler),
+			Submitted(ERHIStateCall::Rasterizer), Skipped(ERHIStateCall::Rasterizer),
+			Submitted(ERHIStateCall::OutputMerger), Skipped(ERHIStateCall::OutputMerger),
+			GEngine.GetRHIDevice()->IsConstantRingEnabled() ? "on" : "off",
+			RHIStats.RingAllocations,
+			RHIStats.RingBytes / 1024.0,
+			RHIStats.RingWraps,
+			RHIStats.DiscardUpdates);
+
+		const float rhiPanelHeight = 180.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth + 60.0f, NextY + rhiPanelHeight);
+
+		DrawTextBlock(
+			D2dCtx, Dwrite, Buf, rc, 16.0f,
+			D2D1::ColorF(0, 0, 0, 0.6f),
+			D2D1::ColorF(D2D1::ColorF::LightSkyBlue));
+
+		NextY += rhiPanelHeight + Space;
+	}
+
 	if (bShowShadow)
 	{
 		// 1. FShadowStatManager로부터 통계 데이터를 가져옵니다.
 		const FShadowStats& ShadowStats = FShadowStatManager::GetInstance().GetStats();
 
 		// 2. 출력할 문자열 버퍼를 만듭니다.
-		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		const FShadowCasterStats& CasterStats = ShadowStats.Casters;
+		wchar_t Buf[768];
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB\n\nCasters: %u\nViews: %u (Rendered %u, Cached %u)\nCasters / View: %.1f\nCache Hit: %.1f %%\nDrawn Batches: %u",
 			ShadowStats.TotalShadowCastingLights,
 			ShadowStats.ShadowCastingPointLights,
 			ShadowStats.ShadowCastingSpotLights,
@@ -348,10 +497,17 @@ void UStatsOverlayD2D::Draw()
 			ShadowStats.ShadowAtlasCubeSize,
 			ShadowStats.ShadowCubeArrayCount,
 			ShadowStats.ShadowAtlasCubeMemoryMB,
-			ShadowStats.TotalShadowMemoryMB);
+			ShadowStats.TotalShadowMemoryMB,
+			CasterStats.ShadowCasters,
+			CasterStats.Requests,
+			CasterStats.RenderedRequests,
+			CasterStats.CachedRequests,
+			CasterStats.GetCastersPerRequest(),
+			CasterStats.GetCacheHitRate(),
+			CasterStats.DrawnBatches);
 
 		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
-		const float shadowPanelHeight = 260.0f;
+		const float shadowPanelHeight = 380.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowPanelHeight);
 
 		// 4. DrawTextBlock 함수를 호출하여 화면에 그립니다. 색상은 구분을 위해 한색(Magenta)으로 설정합니다.
@@ -458,3 +614,45 @@ void UStatsOverlayD2D::ToggleShadow()
 {
 	bShowShadow = !bShowShadow;
 }
+
+void UStatsOverlayD2D::SetShowMeshlet(bool b)
+{
+	bShowMeshlet = b;
+}
+
+void UStatsOverlayD2D::ToggleMeshlet()
+{
+	bShowMeshlet = !bShowMeshlet;
+}
+
+void UStatsOverlayD2D::SetShowScript(bool b)
+{
+	bShowScript = b;
+	FScriptTickStatManager::GetInstance().SetTopScriptsRequested(bShowScript);
+}
+
+void UStatsOverlayD2D::ToggleScript()
+{
+	bShowScript = !bShowScript;
+	FScriptTickStatManager::GetInstance().SetTopScriptsRequested(bShowScript);
+}
+
+void UStatsOverlayD2D::SetShowLua(bool b)
+{
+	bShowLua = b;
+}
+
+void UStatsOverlayD2D::ToggleLua()
+{
+	bShowLua = !bShowLua;
+}
+
+void UStatsOverlayD2D::SetShowRHI(bool b)
+{
+	bShowRHI = b;
+}
+
+void UStatsOverlayD2D::ToggleRHI()
+{
+	bShowRHI = !bShowRHI;
+}
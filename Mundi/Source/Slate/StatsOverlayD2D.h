@@ -19,6 +19,10 @@ public:
     void SetShowTileCulling(bool b);
     void SetShowLights(bool b);
     void SetShowShadow(bool b);
+    void SetShowMeshlet(bool b);
+    void SetShowScript(bool b);
+    void SetShowLua(bool b);
+    void SetShowRHI(bool b);
     void ToggleFPS();
     void ToggleMemory();
     void TogglePicking();
@@ -26,6 +30,10 @@ public:
     void ToggleTileCulling();
     void ToggleLights();
     void ToggleShadow();
+    void ToggleMeshlet();
+    void ToggleScript();
+    void ToggleLua();
+    void ToggleRHI();
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -33,6 +41,10 @@ public:
     bool IsTileCullingVisible() const { return bShowTileCulling; }
     bool IsLightsVisible() const { return bShowLights; }
     bool IsShadowVisible() const { return bShowShadow; }
+    bool IsMeshletVisible() const { return bShowMeshlet; }
+    bool IsScriptVisible() const { return bShowScript; }
+    bool IsLuaVisible() const { return bShowLua; }
+    bool IsRHIVisible() const { return bShowRHI; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -52,6 +64,10 @@ private:
     bool bShowTileCulling = false;
     bool bShowShadow = false;
     bool bShowLights = false;
+    bool bShowMeshlet = false;
+    bool bShowScript = false;
+    bool bShowLua = false;
+    bool bShowRHI = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
@@ -12,6 +12,7 @@
 #include "UIManager.h"
 #include "GlobalConsole.h"
 #include "InputMappingSubsystem.h"
+#include "RenderManager.h"
 
 IMPLEMENT_CLASS(USlateManager)
 
@@ -207,6 +208,17 @@ void USlateManager::Render()
 #endif
 
 #ifdef _EDITOR
+    // UI 위젯 편집은 씬 변경 알림 없이 값을 바꿀 수 있으므로, 조작 중(과 끝난 직후 한 프레임)에는 뷰포트 캐시를 무효화
+    const bool bAnyItemActive = ImGui::IsAnyItemActive();
+    if (bAnyItemActive || bWasAnyItemActive)
+    {
+        if (URenderer* Renderer = URenderManager::GetInstance().GetRenderer())
+        {
+            Renderer->InvalidateViewportFrameCaches();
+        }
+    }
+    bWasAnyItemActive = bAnyItemActive;
+
     // 메인 툴바 렌더링 (항상 최상단에)
     MainToolbar->RenderWidget();
     if (TopPanel)
@@ -92,6 +92,9 @@ private:
     // 메인 툴바 관련
     UMainToolbarWidget* MainToolbar;
 
+    // 직전 프레임에 ImGui 위젯을 조작 중이었는지 (조작이 끝난 프레임까지 뷰포트 캐시 무효화)
+    bool bWasAnyItemActive = false;
+
     // 콘솔 오버레이
     UConsoleWindow* ConsoleWindow = nullptr;
     bool bIsConsoleVisible = false;
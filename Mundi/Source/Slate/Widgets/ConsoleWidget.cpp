@@ -3,6 +3,19 @@
 #include "ObjectFactory.h"
 #include "GlobalConsole.h"
 #include "StatsOverlayD2D.h"
+#include "ScriptTickManager.h"
+#include "LuaMemoryTracker.h"
+#include "Level.h"
+#include "MeshBatchCommandRecorder.h"
+#include "RenderManager.h"
+#include "LightManager.h"
+#include "StaticMeshComponent.h"
+#include "ObjectDataBuffer.h"
+#include "MeshSimplifier.h"
+#include "VertexCompression.h"
+#include "MeshletCuller.h"
+#include "TimerWheel.h"
+#include "DirectionalLightComponent.h"
 #include <windows.h>
 #include <cstdarg>
 #include <cctype>
@@ -50,6 +63,33 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
+	HelpCommandList.Add("STAT LUA");
+	HelpCommandList.Add("STAT RHI");
+	HelpCommandList.Add("SCRIPT CACHE");
+	HelpCommandList.Add("SCRIPT BENCH <path> [count]");
+	HelpCommandList.Add("SCRIPT TICKBENCH <path> [count] [frames]");
+	HelpCommandList.Add("SCRIPT TICKSTATS");
+	HelpCommandList.Add("SCRIPT EVENTBENCH [events] [subscribers] [frames]");
+	HelpCommandList.Add("SCRIPT VECBENCH [iterations]");
+	HelpCommandList.Add("LUA MEM");
+	HelpCommandList.Add("LUA GC");
+	HelpCommandList.Add("LUA GC INC [pause] [stepmul] [stepsize]");
+	HelpCommandList.Add("LUA GC GEN [minormul] [majormul]");
+	HelpCommandList.Add("LUA GC BUDGET <ms> [stepKB]");
+	HelpCommandList.Add("LUA GC COLLECT");
+	HelpCommandList.Add("SCENE BENCH [actors]");
+	HelpCommandList.Add("RENDER BENCH [batches]");
+	HelpCommandList.Add("MESHBATCH BENCH [components]");
+	HelpCommandList.Add("OBJECTDATA BENCH [objects]");
+	HelpCommandList.Add("MESHLOD TEST");
+	HelpCommandList.Add("VERTEXCOMPRESSION TEST [vertices]");
+	HelpCommandList.Add("MESHLET BENCH [views]");
+	HelpCommandList.Add("TIMERWHEEL TEST [entries]");
+	HelpCommandList.Add("RENDER BACKEND NULL | D3D11");
+	HelpCommandList.Add("SHADOW CACHE ON | OFF");
+	HelpCommandList.Add("SHADOW CSM TEST [frames]");
+	HelpCommandList.Add("VIEWPORT CACHE ON | OFF | STATS");
+	HelpCommandList.Add("DECAL PATH MESH | CLUSTERED");
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -246,6 +286,12 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 	}
 	History.Add(FString(command_line));
 
+	// 콘솔 명령은 씬 변경 알림 없이 렌더 설정(그림자, LOD, 컬링 등)을 바꿀 수 있으므로 정적 뷰포트도 다시 그리게 함
+	if (URenderer* Renderer = URenderManager::GetInstance().GetRenderer())
+	{
+		Renderer->InvalidateViewportFrameCaches();
+	}
+
 	// Process command
 	if (Stricmp(command_line, "CLEAR") == 0)
 	{
@@ -276,6 +322,10 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT DECAL");
 		AddLog("- STAT ALL");
 		AddLog("- STAT LIGHT");
+		AddLog("- STAT MESHLET");
+		AddLog("- STAT SCRIPT");
+		AddLog("- STAT LUA");
+		AddLog("- STAT RHI");
 		AddLog("- STAT NONE");
 	}
 	else if (Stricmp(command_line, "STAT FPS") == 0)
@@ -303,6 +353,26 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleTileCulling();
 		AddLog("STAT LIGHT TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT MESHLET") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleMeshlet();
+		AddLog("STAT MESHLET TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT SCRIPT") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleScript();
+		AddLog("STAT SCRIPT TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT LUA") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleLua();
+		AddLog("STAT LUA TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT RHI") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleRHI();
+		AddLog("STAT RHI TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -319,8 +389,298 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowPicking(false);
 		UStatsOverlayD2D::Get().SetShowDecal(false);
 		UStatsOverlayD2D::Get().SetShowTileCulling(false);
+		UStatsOverlayD2D::Get().SetShowScript(false);
+		UStatsOverlayD2D::Get().SetShowLua(false);
+		UStatsOverlayD2D::Get().SetShowRHI(false);
 		AddLog("STAT: OFF");
 	}
+	else if (Stricmp(command_line, "SCRIPT CACHE") == 0)
+	{
+		const FScriptChunkCacheStats& Stats = SCRIPT.GetScriptChunkCacheStats();
+		AddLog("Script chunk cache: %u hits, %u compiles (%.2f ms)", Stats.Hits, Stats.Misses, Stats.CompileTimeMs);
+	}
+	else if (Strnicmp(command_line, "SCRIPT BENCH ", 13) == 0)
+	{
+		char ScriptPath[260] = {};
+		int32 Count = 1000;
+		if (sscanf_s(command_line + 13, "%259s %d", ScriptPath, (unsigned)sizeof(ScriptPath), &Count) >= 1)
+		{
+			SCRIPT.BenchmarkScriptInstantiation(ScriptPath, Count);
+		}
+		else
+		{
+			AddLog("Usage: SCRIPT BENCH <path> [count]");
+		}
+	}
+	else if (Stricmp(command_line, "SCRIPT TICKSTATS") == 0)
+	{
+		FScriptTickManager* TickManager = GWorld ? GWorld->GetScriptTickManager() : nullptr;
+		if (!TickManager || TickManager->Num() == 0)
+		{
+			AddLog("No ticking scripts in the current world");
+		}
+		else
+		{
+			TArray<FScriptTickStat> Stats;
+			TickManager->GatherStats(Stats);
+			AddLog("Script tick cost (%d scripts, avg / peak / last ms):", static_cast<int32>(Stats.size()));
+			for (const FScriptTickStat& Stat : Stats)
+			{
+				AddLog("  %.3f / %.3f / %.3f  %s [%s, %s, interval %.2fs]",
+					Stat.AverageMS, Stat.PeakMS, Stat.LastMS,
+					Stat.ScriptPath.c_str(), Stat.OwnerName.c_str(),
+					GetScriptTickGroupName(Stat.Group), Stat.TickInterval);
+			}
+		}
+	}
+	else if (Strnicmp(command_line, "SCRIPT EVENTBENCH", 17) == 0)
+	{
+		int32 EventsPerFrame = 10000;
+		int32 Subscribers = 20;
+		int32 Frames = 10;
+		sscanf_s(command_line + 17, "%d %d %d", &EventsPerFrame, &Subscribers, &Frames);
+		SCRIPT.BenchmarkGameEvents(EventsPerFrame, Subscribers, Frames);
+	}
+	else if (Strnicmp(command_line, "SCRIPT VECBENCH", 15) == 0)
+	{
+		int32 Iterations = 100000;
+		sscanf_s(command_line + 15, "%d", &Iterations);
+		SCRIPT.BenchmarkVectorMath(Iterations);
+	}
+	else if (Stricmp(command_line, "LUA MEM") == 0)
+	{
+		const FLuaMemoryFrameStats& LuaStats = FLuaMemoryTracker::GetInstance().GetStats();
+		AddLog("Lua heap: %.1f KB (peak %.1f KB), last frame %.1f KB in %u allocs",
+			static_cast<double>(LuaStats.HeapBytes) / 1024.0, static_cast<double>(LuaStats.PeakHeapBytes) / 1024.0,
+			static_cast<double>(LuaStats.FrameAllocBytes) / 1024.0, LuaStats.FrameAllocCount);
+
+		TArray<FLuaScopeAllocStat> Scopes;
+		FLuaMemoryTracker::GetInstance().GatherScopeStats(Scopes);
+		AddLog("Lua allocations by script (total KB / total allocs):");
+		for (const FLuaScopeAllocStat& Scope : Scopes)
+		{
+			AddLog("  %.1f KB / %llu  %s", static_cast<double>(Scope.TotalAllocBytes) / 1024.0, Scope.TotalAllocCount, Scope.Name.c_str());
+		}
+	}
+	else if (Stricmp(command_line, "LUA GC") == 0)
+	{
+		const FLuaGCSettings& Settings = SCRIPT.GetGCSettings();
+		const FLuaMemoryFrameStats& LuaStats = FLuaMemoryTracker::GetInstance().GetStats();
+		AddLog("Lua GC: %s (pause %d, stepmul %d, stepsize %d, minormul %d, majormul %d; 0 = Lua default)",
+			GetLuaGCModeName(Settings.Mode), Settings.Pause, Settings.StepMul, Settings.StepSize, Settings.MinorMul, Settings.MajorMul);
+		if (Settings.FrameBudgetMS > 0.0f)
+		{
+			AddLog("Frame budget: %.2f ms, %d KB per step", Settings.FrameBudgetMS, Settings.BudgetStepKB);
+		}
+		else
+		{
+			AddLog("Frame budget: off (automatic GC)");
+		}
+		AddLog("Cycles: %u, last step %.3f ms, peak step %.3f ms", LuaStats.GCCycles, LuaStats.GCStepMS, LuaStats.PeakGCStepMS);
+	}
+	else if (Strnicmp(command_line, "LUA GC INC", 10) == 0)
+	{
+		int32 Pause = 0;
+		int32 StepMul = 0;
+		int32 StepSize = 0;
+		sscanf_s(command_line + 10, "%d %d %d", &Pause, &StepMul, &StepSize);
+		SCRIPT.SetGCIncremental(Pause, StepMul, StepSize);
+		AddLog("Lua GC: Incremental");
+	}
+	else if (Strnicmp(command_line, "LUA GC GEN", 10) == 0)
+	{
+		int32 MinorMul = 0;
+		int32 MajorMul = 0;
+		sscanf_s(command_line + 10, "%d %d", &MinorMul, &MajorMul);
+		SCRIPT.SetGCGenerational(MinorMul, MajorMul);
+		AddLog("Lua GC: %s", GetLuaGCModeName(SCRIPT.GetGCSettings().Mode));
+	}
+	else if (Strnicmp(command_line, "LUA GC BUDGET ", 14) == 0)
+	{
+		float BudgetMS = 0.0f;
+		int32 StepKB = 64;
+		if (sscanf_s(command_line + 14, "%f %d", &BudgetMS, &StepKB) >= 1)
+		{
+			SCRIPT.SetGCFrameBudget(BudgetMS, StepKB);
+			AddLog(BudgetMS > 0.0f ? "Lua GC frame budget: %.2f ms" : "Lua GC frame budget: off", BudgetMS);
+		}
+		else
+		{
+			AddLog("Usage: LUA GC BUDGET <ms> [stepKB]");
+		}
+	}
+	else if (Stricmp(command_line, "LUA GC COLLECT") == 0)
+	{
+		const uint64 HeapBefore = FLuaMemoryTracker::GetInstance().GetHeapBytes();
+		SCRIPT.CollectGarbageFull();
+		AddLog("Lua GC: collected %.1f KB",
+			static_cast<double>(HeapBefore - std::min(HeapBefore, FLuaMemoryTracker::GetInstance().GetHeapBytes())) / 1024.0);
+	}
+	else if (Strnicmp(command_line, "SCENE BENCH", 11) == 0)
+	{
+		int32 ActorCount = 50000;
+		sscanf_s(command_line + 11, "%d", &ActorCount);
+		ULevelService::BenchmarkSceneLoad(ActorCount);
+	}
+	else if (Strnicmp(command_line, "RENDER BENCH", 12) == 0)
+	{
+		int32 BatchCount = 100000;
+		sscanf_s(command_line + 12, "%d", &BatchCount);
+		URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
+		FMeshBatchCommandRecorder::RunBenchmark(static_cast<uint32>(std::max(1, BatchCount)), Renderer ? Renderer->GetTaskPool() : nullptr);
+	}
+	else if (Strnicmp(command_line, "MESHBATCH BENCH", 15) == 0)
+	{
+		int32 ComponentCount = 20000;
+		sscanf_s(command_line + 15, "%d", &ComponentCount);
+		UStaticMeshComponent::BenchmarkCollectMeshBatches(ComponentCount);
+	}
+	else if (Strnicmp(command_line, "OBJECTDATA BENCH", 16) == 0)
+	{
+		int32 ObjectCount = 100000;
+		sscanf_s(command_line + 16, "%d", &ObjectCount);
+		URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
+		FObjectDataBuffer::RunBenchmark(static_cast<uint32>(std::max(1, ObjectCount)), Renderer ? Renderer->GetTaskPool() : nullptr);
+	}
+	else if (Strnicmp(command_line, "MESHLET BENCH", 13) == 0)
+	{
+		int32 ViewCount = 64;
+		sscanf_s(command_line + 13, "%d", &ViewCount);
+		FMeshletCuller::RunBenchmark(static_cast<uint32>(std::max(1, ViewCount)));
+	}
+	else if (Strnicmp(command_line, "VERTEXCOMPRESSION TEST", 22) == 0)
+	{
+		int32 VertexCount = 100000;
+		sscanf_s(command_line + 22, "%d", &VertexCount);
+		const bool bPassed = FVertexCompression::RunSelfTest(static_cast<uint32>(std::max(1, VertexCount)));
+		AddLog("Vertex compression self-test: %s (details in log)", bPassed ? "PASSED" : "FAILED");
+	}
+	else if (Strnicmp(command_line, "TIMERWHEEL TEST", 15) == 0)
+	{
+		int32 EntryCount = 200000;
+		sscanf_s(command_line + 15, "%d", &EntryCount);
+		const bool bPassed = FTimerWheel::RunSelfTest(static_cast<uint32>(std::max(1, EntryCount)));
+		AddLog("Timer wheel self-test: %s (details in log)", bPassed ? "PASSED" : "FAILED");
+	}
+	else if (Strnicmp(command_line, "MESHLOD TEST", 12) == 0)
+	{
+		const bool bPassed = FMeshSimplifier::RunSelfTest();
+		AddLog("Mesh LOD self-test: %s (details in log)", bPassed ? "PASSED" : "FAILED");
+	}
+	else if (Strnicmp(command_line, "RENDER BACKEND ", 15) == 0)
+	{
+		URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
+		if (!Renderer)
+		{
+			AddLog("Renderer not available");
+		}
+		else if (Stricmp(command_line + 15, "NULL") == 0)
+		{
+			Renderer->SetUseNullCommandBackend(true);
+			AddLog("Mesh draw commands: Null backend (recorded and validated, not submitted)");
+		}
+		else if (Stricmp(command_line + 15, "D3D11") == 0)
+		{
+			Renderer->SetUseNullCommandBackend(false);
+			AddLog("Mesh draw commands: D3D11 backend");
+		}
+		else
+		{
+			AddLog("Usage: RENDER BACKEND NULL | D3D11");
+		}
+	}
+	else if (Strnicmp(command_line, "SHADOW CSM TEST", 15) == 0)
+	{
+		int32 FrameCount = 2000;
+		sscanf_s(command_line + 15, "%d", &FrameCount);
+		const bool bPassed = UDirectionalLightComponent::RunCascadeStabilityTest(static_cast<uint32>(std::max(2, FrameCount)));
+		AddLog("Cascade stability self-test: %s (details in log)", bPassed ? "PASSED" : "FAILED");
+	}
+	else if (Strnicmp(command_line, "SHADOW CACHE ", 13) == 0)
+	{
+		FLightManager* LightManager = GWorld ? GWorld->GetLightManager() : nullptr;
+		if (!LightManager)
+		{
+			AddLog("Light manager not available");
+		}
+		else if (Stricmp(command_line + 13, "ON") == 0)
+		{
+			LightManager->SetShadowCacheEnabled(true);
+			AddLog("Shadow cache: ON (unchanged shadow views reuse last atlas contents)");
+		}
+		else if (Stricmp(command_line + 13, "OFF") == 0)
+		{
+			LightManager->SetShadowCacheEnabled(false);
+			AddLog("Shadow cache: OFF");
+		}
+		else
+		{
+			AddLog("Usage: SHADOW CACHE ON | OFF");
+		}
+	}
+	else if (Strnicmp(command_line, "VIEWPORT CACHE ", 15) == 0)
+	{
+		URenderer* Renderer = URenderManager::GetInstance().GetRenderer();
+		if (!Renderer)
+		{
+			AddLog("Renderer not available");
+		}
+		else if (Stricmp(command_line + 15, "ON") == 0)
+		{
+			Renderer->SetViewportFrameCacheEnabled(true);
+			AddLog("Viewport cache: ON (unchanged, non-hovered viewports present their last frame)");
+		}
+		else if (Stricmp(command_line + 15, "OFF") == 0)
+		{
+			Renderer->SetViewportFrameCacheEnabled(false);
+			AddLog("Viewport cache: OFF");
+		}
+		else if (Stricmp(command_line + 15, "STATS") == 0)
+		{
+			AddLog("Viewport cache: %s, last frame rendered %u / reused %u views",
+				Renderer->IsViewportFrameCacheEnabled() ? "ON" : "OFF",
+				Renderer->GetLastFrameRenderedViews(), Renderer->GetLastFrameReusedViews());
+		}
+		else
+		{
+			AddLog("Usage: VIEWPORT CACHE ON | OFF | STATS");
+		}
+	}
+	else if (Strnicmp(command_line, "DECAL PATH ", 11) == 0)
+	{
+		if (!GWorld)
+		{
+			AddLog("World not available");
+		}
+		else if (Stricmp(command_line + 11, "MESH") == 0)
+		{
+			GWorld->GetRenderSettings().SetDecalRenderPath(EDecalRenderPath::MeshProjection);
+			AddLog("Decal path: Mesh projection (receiver meshes redrawn per decal, cached receiver lists)");
+		}
+		else if (Stricmp(command_line + 11, "CLUSTERED") == 0)
+		{
+			GWorld->GetRenderSettings().SetDecalRenderPath(EDecalRenderPath::Clustered);
+			AddLog("Decal path: Clustered (decals binned into light culling tiles, one screen-space pass)");
+		}
+		else
+		{
+			AddLog("Usage: DECAL PATH MESH | CLUSTERED");
+		}
+	}
+	else if (Strnicmp(command_line, "SCRIPT TICKBENCH ", 17) == 0)
+	{
+		char ScriptPath[260] = {};
+		int32 Count = 1000;
+		int32 Frames = 100;
+		if (sscanf_s(command_line + 17, "%259s %d %d", ScriptPath, (unsigned)sizeof(ScriptPath), &Count, &Frames) >= 1)
+		{
+			SCRIPT.BenchmarkScriptTick(ScriptPath, Count, Frames);
+		}
+		else
+		{
+			AddLog("Usage: SCRIPT TICKBENCH <path> [count] [frames]");
+		}
+	}
 	else
 	{
 		AddLog("Unknown command: '%s'", command_line);
@@ -520,9 +520,8 @@ void UMainToolbarWidget::OnSaveScene()
 
         FString FilePath = "Scene/" + SceneName + ".Scene";
 
-        JSON LevelJson;
-        CurrentWorld->GetLevel()->Serialize(false, LevelJson);
-        bool bSuccess = FJsonSerializer::SaveJsonToFile(LevelJson, FilePath);
+        // JSON 저장 + 바이너리 캐시 쿠킹
+        bool bSuccess = ULevelService::SaveLevelToFile(CurrentWorld->GetLevel(), FilePath);
 
         UE_LOG("MainToolbar: Scene saved: %s", SceneName.c_str());
     }
@@ -568,13 +567,8 @@ void UMainToolbarWidget::OnLoadScene()
         UUIManager::GetInstance().ClearTransformWidgetSelection();
         GWorld->GetSelectionManager()->ClearSelection();
 
-        std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
-        JSON LevelJsonData;
-        if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, InFilePath))
-        {
-            NewLevel->Serialize(true, LevelJsonData);
-        }
-        else
+        std::unique_ptr<ULevel> NewLevel = ULevelService::LoadLevelFromFile(InFilePath);
+        if (!NewLevel)
         {
             UE_LOG("MainToolbar: Failed To Load Level From: %s", InFilePath.c_str());
             return;
@@ -145,6 +145,11 @@ bool UPropertyRenderer::RenderProperty(const FProperty& Property, void* ObjectIn
 				FVector* ScaleValue = Property.GetValuePtr<FVector>(ObjectInstance);
 				SceneComponent->SetRelativeScale(*ScaleValue);
 			}
+			else
+			{
+				// bIsVisible/bIsActive/bHiddenInGame 등은 필드를 직접 쓰므로 렌더 프록시 캐시를 다시 읽게 함
+				SceneComponent->RefreshSceneProxy();
+			}
 		}
 
 		// LightComponent는 Light 프로퍼티가 변경되면 UpdateLightData를 호출하여 동기화
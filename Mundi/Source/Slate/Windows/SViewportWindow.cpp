@@ -128,7 +128,14 @@ void SViewportWindow::OnRender()
 #endif
 
 	if (Viewport)
+	{
+#ifdef _EDITOR
+		// 마우스 아래 뷰포트나 드래그 중인 뷰포트는 호버 강조/카메라 조작에 바로 반응하도록 항상 다시 그림
+		const bool bInteracting = IsHover(INPUT.GetMousePosition()) || USlateManager::ActiveViewport == this;
+		Viewport->SetFrameCachePresentAllowed(!bInteracting);
+#endif
 		Viewport->Render();
+	}
 }
 
 void SViewportWindow::OnUpdate(float DeltaSeconds)
@@ -1459,6 +1466,26 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("라이트 타입별 개수를 표시합니다.");
 			}
 
+			bool bMeshletStats = UStatsOverlayD2D::Get().IsMeshletVisible();
+			if (ImGui::Checkbox(" MESHLET", &bMeshletStats))
+			{
+				UStatsOverlayD2D::Get().ToggleMeshlet();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("메쉴릿 CPU 컬링 통계를 표시합니다.");
+			}
+
+			bool bRHIStats = UStatsOverlayD2D::Get().IsRHIVisible();
+			if (ImGui::Checkbox(" RHI STATE", &bRHIStats))
+			{
+				UStatsOverlayD2D::Get().ToggleRHI();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("상태 캐시가 걸러낸 호출 수와 상수 버퍼 링 사용량을 표시합니다.");
+			}
+
 			bool bShadowStats = UStatsOverlayD2D::Get().IsShadowVisible();
 			if (ImGui::Checkbox(" SHADOWS", &bShadowStats))
 			{
@@ -1529,7 +1556,34 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::Image((void*)IconDecal->GetShaderResourceView(), IconSize);
 			ImGui::SameLine(0, 4);
 		}
-		ImGui::Text(" 데칼");
+		// 서브메뉴: 데칼 렌더 경로
+		if (ImGui::BeginMenu(" 데칼"))
+		{
+			ImGui::TextColored(ImVec4(0.6f, 0.6f, 0.6f, 1.0f), "데칼 렌더 경로");
+			ImGui::Separator();
+
+			int decalPathInt = static_cast<int>(RenderSettings.GetDecalRenderPath());
+			const int oldDecalPathInt = decalPathInt;
+
+			ImGui::RadioButton(" Mesh Projection", &decalPathInt, static_cast<int>(EDecalRenderPath::MeshProjection));
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("데칼마다 수신 메시를 다시 그립니다. (기본값)");
+			}
+
+			ImGui::RadioButton(" Clustered", &decalPathInt, static_cast<int>(EDecalRenderPath::Clustered));
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("데칼을 화면 타일에 비닝해 전체 화면 패스 한 번으로 적용합니다.");
+			}
+
+			if (decalPathInt != oldDecalPathInt)
+			{
+				RenderSettings.SetDecalRenderPath(static_cast<EDecalRenderPath>(decalPathInt));
+			}
+
+			ImGui::EndMenu();
+		}
 		if (ImGui::IsItemHovered())
 		{
 			ImGui::SetTooltip("데칼 렌더링을 표시합니다.");
@@ -1571,6 +1625,32 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 			ImGui::SetTooltip("빌보드 텍스트를 표시합니다.");
 		}
 
+		// Static Mesh LOD
+		bool bStaticMeshLOD = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshLOD);
+		if (ImGui::Checkbox("##StaticMeshLOD", &bStaticMeshLOD))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_StaticMeshLOD);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 스태틱 메시 LOD");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("화면 크기에 따라 자동 생성된 LOD를 사용합니다. 끄면 항상 원본(LOD0)으로 그립니다.");
+		}
+
+		// Meshlet Culling
+		bool bMeshletCulling = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_MeshletCulling);
+		if (ImGui::Checkbox("##MeshletCulling", &bMeshletCulling))
+		{
+			RenderSettings.ToggleShowFlag(EEngineShowFlags::SF_MeshletCulling);
+		}
+		ImGui::SameLine();
+		ImGui::Text(" 메쉴릿 컬링");
+		if (ImGui::IsItemHovered())
+		{
+			ImGui::SetTooltip("큰 스태틱 메시를 메쉴릿 단위로 절두체/뒷면 컬링합니다.");
+		}
+
 		// Fog
 		bool bFog = RenderSettings.IsShowFlagEnabled(EEngineShowFlags::SF_Fog);
 		if (ImGui::Checkbox("##Fog", &bFog))
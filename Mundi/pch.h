@@ -4,6 +4,14 @@
 // Uncomment to enable DDS texture caching (faster loading, uses Data/TextureCache/)
 #define USE_DDS_CACHE
 #define USE_OBJ_CACHE
+// Uncomment to cook .Scene JSON into a binary cache (DerivedDataCache/<name>.Scene.bin) and load scenes from it
+#define USE_SCENE_CACHE
+// Uncomment to reorder static mesh indices/vertices for vertex cache & overdraw at import time
+#define USE_MESH_OPTIMIZATION
+// Uncomment to generate QEM-simplified static mesh LODs at import time (stored in the mesh cache)
+#define USE_STATIC_MESH_LOD
+// Uncomment to store static mesh vertices in the 20-byte compressed layout (quantized position, octahedral normal/tangent, half UV)
+//#define USE_COMPRESSED_VERTEX
 
 // Linker
 #pragma comment(lib, "user32")